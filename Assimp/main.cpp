@@ -64,7 +64,7 @@ int main()
 		return -1;
 	}
 
-	glEnable(GL_DEPTH_TEST);
+	gl::GLState::Instance()->SetPipeline(gl::PipelineState::Opaque());
 
 	gl::Shader basic_shader;
 	basic_shader.AttachVertexShader("Shader/triangle_vs.glsl");
@@ -76,6 +76,7 @@ int main()
 	glm::mat4 model_mat = glm::mat4(1.0f);
 	model_mat = glm::translate(model_mat, glm::vec3(0.0f, -1.75f, 0.0f));
 	model_mat = glm::scale(model_mat, glm::vec3(0.2f, 0.2f, 0.2f));
+	model.SetTransform(model_mat);
 
 
 	// Render
@@ -83,7 +84,7 @@ int main()
 	{
 		processInput(window);
 
-		glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+		gl::GLState::Instance()->SetClearColor(0.05f, 0.05f, 0.05f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 		float currentFrame = glfwGetTime();
@@ -93,7 +94,6 @@ int main()
 		glm::mat4 view = camera.GetViewMatrix();
 
 		basic_shader.Active();
-		basic_shader.SetMatrix("model", &model_mat[0][0]);
 		basic_shader.SetMatrix("view", &view[0][0]);
 		basic_shader.SetMatrix("projection", &projection[0][0]);
 
@@ -130,7 +130,7 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
 	// make sure the viewport matches the new window dimensions; note that width and 
 	// height will be significantly larger than specified on retina displays.
-	glViewport(0, 0, width, height);
+	gl::GLState::Instance()->SetViewport(0, 0, width, height);
 }
 
 // glfw: whenever the mouse moves, this callback is called
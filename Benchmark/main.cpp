@@ -0,0 +1,891 @@
+#include "engine.hpp"
+#include "shader.hpp"
+#include "model.hpp"
+#include "common.hpp"
+#include "transform.hpp"
+#include "occlusion.hpp"
+#include "bvh.hpp"
+#include "common_mesh.hpp"
+#include "draw_list.hpp"
+#include "gl_benchmark.hpp"
+#include "image_diff.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iterator>
+#include <random>
+#include <array>
+#include <memory>
+#include <thread>
+#include <glm/gtc/matrix_transform.hpp>
+#ifdef _WIN32
+// glad defines APIENTRY as windows.h does, which would otherwise warn about the redefinition
+#undef APIENTRY
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <csignal>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+namespace gl
+{
+	// CPU-side micro-benchmarks. The pure CPU ones run before any window exists, so they also work on machines
+	// without a GPU; the GL ones are timed on the render thread with the GPU drained around them, so only the
+	// cost of issuing the calls is measured.
+	namespace bench
+	{
+		template <typename Func>
+		double Measure(const char* name, unsigned int iterations, Func&& func)
+		{
+			auto start = std::chrono::high_resolution_clock::now();
+			for (unsigned int i = 0; i < iterations; ++i)
+			{
+				func();
+			}
+			auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count();
+
+			double perIteration = elapsed / iterations;
+			std::printf("%-40s %12.1f ns/iter\n", name, perIteration);
+			return perIteration;
+		}
+
+		template <typename Func>
+		double MeasureGL(const char* name, unsigned int iterations, Func&& func)
+		{
+			glFinish();
+			double perIteration = Measure(name, iterations, std::forward<Func>(func));
+			glFinish();
+			return perIteration;
+		}
+
+		// What Mesh::Draw used to do for every texture of every draw: build the sampler name, look it up, set it
+		void LegacyBindTextures(const Shader& shader, const std::vector<Texture>& textures)
+		{
+			unsigned int index_diffuse  = 1;
+			unsigned int index_specular = 1;
+			unsigned int index_normal	= 1;
+			unsigned int index_height	= 1;
+
+			for (unsigned int i = 0; i < textures.size(); ++i)
+			{
+				glActiveTexture(GL_TEXTURE0 + i);
+
+				std::string index;
+				const std::string& name = textures[i].type;
+				if (name == "texture_diffuse")
+				{
+					index = std::to_string(index_diffuse++);
+				}
+				else if (name == "texture_specular")
+				{
+					index = std::to_string(index_specular++);
+				}
+				else if (name == "texture_normal")
+				{
+					index = std::to_string(index_normal++);
+				}
+				else if (name == "texture_height")
+				{
+					index = std::to_string(index_height++);
+				}
+
+				glUniform1i(glGetUniformLocation(shader.program(), (name + index).c_str()), i);
+				glBindTexture(GL_TEXTURE_2D, textures[i].id);
+			}
+		}
+
+		GLuint CreateSolidTexture(const glm::vec3& color)
+		{
+			unsigned char texel[3] = { static_cast<unsigned char>(color.r * 255), static_cast<unsigned char>(color.g * 255), static_cast<unsigned char>(color.b * 255) };
+
+			GLuint texture;
+			glGenTextures(1, &texture);
+			GLState::Instance()->BindTexture(GL_TEXTURE_2D, texture);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, texel);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			GLState::Instance()->BindTexture(GL_TEXTURE_2D, 0);
+			return texture;
+		}
+
+		// Many small meshes with diffuse/specular/normal textures, like the parts of an imported model
+		void MaterialBinding()
+		{
+			const unsigned int meshCount  = 256;
+			const unsigned int iterations = 200;
+
+			Shader shader;
+			shader.AttachShader(GL_VERTEX_SHADER, "Shaders/material.vs.glsl");
+			shader.AttachShader(GL_FRAGMENT_SHADER, "Shaders/material.fs.glsl");
+			shader.Link();
+			shader.Active();
+
+			const char* types[] = { "texture_diffuse", "texture_specular", "texture_normal" };
+			std::vector<Mesh> meshes;
+			meshes.reserve(meshCount);
+			for (unsigned int i = 0; i < meshCount; ++i)
+			{
+				std::vector<Vertex> vertices(3);
+				vertices[0].position = glm::vec3(-0.01f, -0.01f, 0.f);
+				vertices[1].position = glm::vec3( 0.01f, -0.01f, 0.f);
+				vertices[2].position = glm::vec3( 0.00f,  0.01f, 0.f);
+				std::vector<unsigned int> indices = { 0, 1, 2 };
+
+				std::vector<Texture> textures(3);
+				for (unsigned int t = 0; t < 3; ++t)
+				{
+					textures[t].id	 = CreateSolidTexture(glm::vec3(t == 0, t == 1, t == 2) * (i / float(meshCount)));
+					textures[t].type = types[t];
+				}
+				meshes.emplace_back(std::move(vertices), std::move(indices), std::move(textures));
+			}
+
+			std::printf("Material binding: %u meshes x 3 textures\n", meshCount);
+			double legacy = MeasureGL("  bind, string + glGetUniformLocation", iterations, [&]()
+			{
+				for (auto& mesh : meshes)
+				{
+					LegacyBindTextures(shader, mesh.material().textures());
+				}
+			});
+			// The legacy path binds behind GLState's back
+			GLState::Instance()->Invalidate();
+			double table = MeasureGL("  bind, Material table", iterations, [&]()
+			{
+				for (auto& mesh : meshes)
+				{
+					mesh.material().Bind(shader);
+				}
+			});
+			GLState::Instance()->NextFrame();
+			MeasureGL("  Mesh::Draw", iterations, [&]()
+			{
+				for (auto& mesh : meshes)
+				{
+					mesh.Draw(shader);
+				}
+			});
+			GLState::Instance()->NextFrame();
+			const GLStateStats& calls = GLState::Instance()->GetFrameStats();
+			std::printf("  Mesh::Draw state calls per iteration: %u issued, %u elided\n", calls.issued / iterations, calls.elided / iterations);
+			std::printf("  binding speedup: %.1fx\n\n", legacy / table);
+		}
+
+		// A scene's worth of packets with programs, materials and meshes interleaved at random, as several passes
+		// submitting independently would produce
+		void DrawListSorting()
+		{
+			const unsigned int programCount	 = 8;
+			const unsigned int materialCount = 64;
+			const unsigned int packetCount	 = 10000;
+			const unsigned int iterations	 = 20;
+
+			std::vector<std::unique_ptr<Shader>> programs;
+			for (unsigned int i = 0; i < programCount; ++i)
+			{
+				programs.emplace_back(new Shader());
+				programs.back()->AttachShader(GL_VERTEX_SHADER, "Shaders/material.vs.glsl");
+				programs.back()->AttachShader(GL_FRAGMENT_SHADER, "Shaders/material.fs.glsl");
+				programs.back()->Link();
+				programs.back()->Active();
+				programs.back()->SetValue("texture_diffuse1", 0);
+				programs.back()->SetValue("texture_specular1", 1);
+				programs.back()->SetValue("texture_normal1", 2);
+			}
+
+			std::vector<std::array<GLuint, 3>> materials(materialCount);
+			for (unsigned int i = 0; i < materialCount; ++i)
+			{
+				for (unsigned int t = 0; t < 3; ++t)
+				{
+					materials[i][t] = CreateSolidTexture(glm::vec3(t == 0, t == 1, t == 2) * (i / float(materialCount)));
+				}
+			}
+
+			std::vector<BaseMesh> meshes;
+			for (int primitive = PRIMITIVE_PLANE; primitive <= PRIMITIVE_TORUS; ++primitive)
+			{
+				meshes.push_back(BaseMesh(static_cast<Primitive>(primitive), TESSELLATION_LOW, static_cast<VertexLayout>(primitive % 3)));
+			}
+
+			std::mt19937 random(5);
+			std::uniform_real_distribution<float> position(-20.f, 20.f), deep(-90.f, -1.f);
+			std::vector<DrawPacket> packets;
+			for (unsigned int i = 0; i < packetCount; ++i)
+			{
+				auto& material = materials[random() % materialCount];
+				DrawPacket packet = meshes[random() % meshes.size()].GetPacket(programs[random() % programCount]->program());
+				packet.material = material[0];
+				std::copy(material.begin(), material.end(), packet.textures);
+				packet.model = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(position(random), position(random), deep(random))), glm::vec3(0.001f));
+				packets.push_back(packet);
+			}
+
+			DrawList drawList;
+			glm::mat4 view(1.0f);
+			std::printf("Draw list: %u packets, %u programs, %u materials, %u meshes\n", packetCount, programCount, materialCount, static_cast<unsigned int>(meshes.size()));
+			Measure("  submit", iterations, [&]()
+			{
+				drawList.Begin(view, 100.f);
+				for (auto& packet : packets)
+				{
+					drawList.Submit(packet);
+				}
+			});
+			MeasureGL("  sort + execute", iterations, [&]()
+			{
+				drawList.Execute();
+			});
+
+			auto& before = drawList.GetSubmissionStats();
+			auto& after	 = drawList.GetStats();
+			std::printf("  state changes per frame, submission order: %u (%u programs, %u VAOs, %u textures)\n", before.StateChanges(), before.programs, before.vaos, before.textures);
+			std::printf("  state changes per frame, sorted:           %u (%u programs, %u VAOs, %u textures)\n\n", after.StateChanges(), after.programs, after.vaos, after.textures);
+		}
+
+		// A wide random hierarchy (each node parented to any earlier node), updated fully and with 1% of the
+		// nodes animated per frame
+		void TransformHierarchy()
+		{
+			const unsigned int nodeCount  = 100000;
+			const unsigned int iterations = 50;
+
+			std::mt19937 random(42);
+			TransformStore store;
+			store.Reserve(nodeCount);
+			for (unsigned int i = 0; i < nodeCount; ++i)
+			{
+				unsigned int parent = i == 0 ? TransformStore::NO_PARENT : random() % i;
+				store.Add(glm::translate(glm::mat4(1.0f), glm::vec3(0.01f * (random() % 100), 0.f, 0.f)), parent);
+			}
+			store.Update();
+
+			std::printf("Transform hierarchy: %u nodes, %u threads\n", nodeCount, ThreadPool::Instance()->GetThreadCount());
+			Measure("  Update, every node changed", iterations, [&]()
+			{
+				for (unsigned int i = 0; i < nodeCount; ++i)
+				{
+					store.SetLocal(i, store.GetLocal(i));
+				}
+				store.Update();
+			});
+			Measure("  Update, 1% of nodes changed", iterations, [&]()
+			{
+				for (unsigned int i = 0; i < nodeCount / 100; ++i)
+				{
+					unsigned int node = random() % nodeCount;
+					store.SetLocal(node, store.GetLocal(node));
+				}
+				store.Update();
+			});
+			Measure("  Update, nothing changed", iterations, [&]()
+			{
+				store.Update();
+			});
+			std::printf("\n");
+		}
+
+		// An indoor-like grid of wall boxes in front of many small objects, as seen from a camera at the origin
+		void OcclusionCulling()
+		{
+			const unsigned int wallCount   = 200;
+			const unsigned int objectCount = 20000;
+			const unsigned int iterations  = 50;
+
+			glm::mat4 projection = glm::perspective(glm::radians(45.0f), 1280.f / 720.f, 0.1f, 100.0f);
+			glm::mat4 view = glm::lookAt(glm::vec3(0.f, 1.5f, 0.f), glm::vec3(0.f, 1.5f, -1.f), glm::vec3(0.f, 1.f, 0.f));
+
+			std::mt19937 random(7);
+			std::uniform_real_distribution<float> across(-20.f, 20.f), deep(-60.f, -2.f);
+			std::vector<AABB> walls, objects;
+			for (unsigned int i = 0; i < wallCount; ++i)
+			{
+				glm::vec3 corner(across(random), 0.f, deep(random));
+				walls.push_back(random() % 2 ? AABB(corner, corner + glm::vec3(4.f, 3.f, 0.2f)) : AABB(corner, corner + glm::vec3(0.2f, 3.f, 4.f)));
+			}
+			for (unsigned int i = 0; i < objectCount; ++i)
+			{
+				glm::vec3 corner(across(random), 0.f, deep(random));
+				objects.push_back(AABB(corner, corner + glm::vec3(0.5f)));
+			}
+
+			OcclusionCuller culler;
+			FrustumCuller	frustum;
+			std::vector<GLuint> visible;
+
+			std::printf("Occlusion culling: %u wall occluders, %u objects, %ux%u depth, %u threads\n", wallCount, objectCount, culler.GetWidth(), culler.GetHeight(), ThreadPool::Instance()->GetThreadCount());
+			Measure("  rasterize occluders", iterations, [&]()
+			{
+				culler.Begin(projection, view);
+				for (auto& wall : walls)
+				{
+					culler.AddOccluder(wall, glm::mat4(1.0f));
+				}
+				culler.Rasterize();
+			});
+			Measure("  frustum + occlusion test", iterations, [&]()
+			{
+				frustum.SetFrustum(projection, view);
+				frustum.Cull(objects.data(), objects.size(), visible);
+				culler.Filter(objects.data(), visible);
+			});
+			std::printf("  %u in frustum, %u after occlusion\n\n", frustum.GetStats().visible, culler.GetStats().visible / iterations);
+		}
+
+		// Random boxes filling a cube that grows with the count, so the density (and the result sizes of the
+		// sphere queries) stays the same at every scale
+		void BvhQueries(unsigned int count)
+		{
+			const unsigned int queryCount = 1000;
+			const unsigned int iterations = std::max(1u, 100000u / count);
+
+			std::mt19937 random(11);
+			float extent = std::cbrt(static_cast<float>(count)) * 4.f;
+			std::uniform_real_distribution<float> position(-extent, extent), size(0.2f, 2.f), unit(-1.f, 1.f);
+			std::vector<AABB> boxes(count);
+			for (auto& box : boxes)
+			{
+				glm::vec3 corner(position(random), position(random), position(random));
+				box = AABB(corner, corner + glm::vec3(size(random), size(random), size(random)));
+			}
+
+			std::vector<BoundingSphere> spheres;
+			std::vector<Ray> rays;
+			for (unsigned int i = 0; i < queryCount; ++i)
+			{
+				spheres.push_back(BoundingSphere(glm::vec3(position(random), position(random), position(random)), 5.f));
+				rays.push_back(Ray(glm::vec3(position(random), position(random), position(random)), glm::normalize(glm::vec3(unit(random), unit(random), unit(random)) + glm::vec3(1e-3f))));
+			}
+			Frustum frustum(glm::perspective(glm::radians(45.0f), 1280.f / 720.f, 0.1f, extent), glm::lookAt(glm::vec3(0.f), glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, 1.f, 0.f)));
+
+			Bvh bvh;
+			std::vector<GLuint> result;
+			std::printf("BVH: %u boxes, %u threads\n", count, ThreadPool::Instance()->GetThreadCount());
+			Measure("  build", iterations, [&]()
+			{
+				bvh.Build(boxes);
+			});
+			Measure("  refit, every box moved", iterations, [&]()
+			{
+				for (auto& box : boxes)
+				{
+					box.min += glm::vec3(0.01f);
+					box.max += glm::vec3(0.01f);
+				}
+				bvh.Refit(boxes.data());
+			});
+			Measure("  frustum query", iterations, [&]()
+			{
+				result.clear();
+				bvh.QueryFrustum(frustum, result);
+			});
+			std::printf("  %u boxes in frustum\n", static_cast<unsigned int>(result.size()));
+
+			size_t found = 0;
+			double sphere = Measure("  1000 sphere queries", iterations, [&]()
+			{
+				for (auto& query : spheres)
+				{
+					result.clear();
+					bvh.QuerySphere(query, result);
+					found += result.size();
+				}
+			});
+			unsigned int hits = 0;
+			double raycast = Measure("  1000 raycasts", iterations, [&]()
+			{
+				RayHit hit;
+				for (auto& ray : rays)
+				{
+					hits += bvh.Raycast(ray, hit);
+				}
+			});
+			std::printf("  %.2f M sphere queries/s (%.1f boxes each), %.2f M rays/s (%.0f%% hit)\n\n",
+				queryCount * 1e3 / sphere, found / double(queryCount * iterations), queryCount * 1e3 / raycast, hits * 100.0 / (queryCount * iterations));
+		}
+
+		// Every sample's passes live in its own executable, so the suite and the golden-image check run each one
+		// in benchmark or golden mode (see Engine::RunBenchmark and Engine::RenderGolden) from its project
+		// directory, where its shaders are found. Only samples that render through Engine honour those modes;
+		// Texture and Assimp run their own window loops, and FirstWindows, Skybox and Water do not build.
+		const char* SAMPLES[] = { "Lighting", "Deferred", "SSR", "Noise", "Bloom", "HDR", "PBR", "IBL", "IBLDiffuse", "IBLSpecular", "Shadow" };
+
+#ifdef _WIN32
+		const char* SEPARATOR = "\\";
+#else
+		const char* SEPARATOR = "/";
+#endif
+
+		struct SuiteOptions
+		{
+			std::string				 bin;
+			std::string				 root;
+			std::vector<std::string> sizes;
+			std::string				 warmup;
+			std::string				 frames;
+			std::string				 frame;
+			unsigned int			 timeout;		// seconds a sample may run before it is killed
+			bool					 update;
+
+			SuiteOptions() : root(".."), warmup("60"), frames("600"), frame("10"), timeout(300), update(false) {}
+		};
+
+		// An empty value removes the variable
+		void SetEnvironment(const char* name, const std::string& value)
+		{
+#ifdef _WIN32
+			_putenv_s(name, value.c_str());
+#else
+			if (value.empty())
+			{
+				unsetenv(name);
+			}
+			else
+			{
+				setenv(name, value.c_str(), 1);
+			}
+#endif
+		}
+
+		// Runs a sample's executable from its project directory and returns its exit status, or -1 if it could not
+		// be started or was killed after options.timeout seconds, so a sample that never exits cannot stall a run
+		int RunSample(const SuiteOptions& options, const char* sample)
+		{
+			std::string directory = options.root + SEPARATOR + sample;
+			std::fflush(stdout);
+#ifdef _WIN32
+			std::string command = "\"" + options.bin + SEPARATOR + sample + ".exe\"";
+			STARTUPINFOA startup = { sizeof(startup) };
+			PROCESS_INFORMATION process;
+			if (!CreateProcessA(nullptr, &command[0], nullptr, nullptr, FALSE, 0, nullptr, directory.c_str(), &startup, &process))
+			{
+				std::printf("  could not start %s\n", command.c_str());
+				return -1;
+			}
+			int status = -1;
+			if (WaitForSingleObject(process.hProcess, options.timeout * 1000) == WAIT_TIMEOUT)
+			{
+				TerminateProcess(process.hProcess, 1);
+				WaitForSingleObject(process.hProcess, INFINITE);
+				std::printf("  killed after %u s\n", options.timeout);
+			}
+			else
+			{
+				DWORD code;
+				GetExitCodeProcess(process.hProcess, &code);
+				status = static_cast<int>(code);
+			}
+			CloseHandle(process.hThread);
+			CloseHandle(process.hProcess);
+			return status;
+#else
+			// The child changes directory before exec, so a relative --bin is resolved against ours first
+			std::string executable = options.bin + SEPARATOR + sample;
+			char cwd[4096];
+			if (executable[0] != '/' && getcwd(cwd, sizeof(cwd)))
+			{
+				executable = std::string(cwd) + SEPARATOR + executable;
+			}
+			pid_t child = fork();
+			if (child == 0)
+			{
+				if (chdir(directory.c_str()) == 0)
+				{
+					execl(executable.c_str(), executable.c_str(), static_cast<char*>(nullptr));
+				}
+				_exit(127);
+			}
+			if (child < 0)
+			{
+				std::printf("  could not start %s\n", executable.c_str());
+				return -1;
+			}
+
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(options.timeout);
+			int status = 0;
+			while (waitpid(child, &status, WNOHANG) == 0)
+			{
+				if (std::chrono::steady_clock::now() >= deadline)
+				{
+					kill(child, SIGKILL);
+					waitpid(child, &status, 0);
+					std::printf("  killed after %u s\n", options.timeout);
+					return -1;
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			}
+			return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#endif
+		}
+
+		bool CopyBinary(const std::string& from, const std::string& to)
+		{
+			std::ifstream in(from, std::ios::binary);
+			std::ofstream out(to, std::ios::binary);
+			return in && out && (out << in.rdbuf());
+		}
+
+		std::vector<std::string> ReadLines(const std::string& path)
+		{
+			std::vector<std::string> lines;
+			std::ifstream in(path);
+			std::string line;
+			while (std::getline(in, line))
+			{
+				if (!line.empty())
+				{
+					lines.push_back(line);
+				}
+			}
+			return lines;
+		}
+
+		// Runs sample in benchmark mode with the GL_BENCHMARK_* variables already set and returns its result
+		// file indented to nest in the suite's JSON, or an empty string if the run failed. Samples with a
+		// camera_path.txt (see CameraPath) fly it; the rest sway around their start pose.
+		std::string BenchmarkSample(const SuiteOptions& options, const char* sample)
+		{
+			std::string result = options.root + SEPARATOR + sample + SEPARATOR + "benchmark.json";
+			std::remove(result.c_str());
+
+			std::ifstream cameraPath(options.root + SEPARATOR + sample + SEPARATOR + "camera_path.txt");
+			SetEnvironment("GL_CAMERA_PATH", cameraPath ? "camera_path.txt" : "");
+
+			int status = RunSample(options, sample);
+			std::ifstream in(result);
+			if (status != 0 || !in)
+			{
+				std::printf("  failed (exit status %d)\n", status);
+				return std::string();
+			}
+
+			std::string json((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+			while (!json.empty() && std::isspace(static_cast<unsigned char>(json.back())))
+			{
+				json.pop_back();
+			}
+			size_t line = 0;
+			while ((line = json.find('\n', line)) != std::string::npos)
+			{
+				json.insert(++line, "\t");
+			}
+			return json;
+		}
+
+		bool WriteResults(const std::string& output, const std::stringstream& results)
+		{
+			std::ofstream out(output);
+			if (!out)
+			{
+				std::printf("Failed to open %s\n", output.c_str());
+				return false;
+			}
+			out << "{\n" << results.str() << "\n}\n";
+			return true;
+		}
+
+		// Results go into one JSON object keyed "<sample> <W>x<H>"
+		int RunSuite(const std::string& output, const SuiteOptions& options)
+		{
+			SetEnvironment("GL_BENCHMARK_FILE", "benchmark.json");
+			SetEnvironment("GL_BENCHMARK_WARMUP", options.warmup);
+			SetEnvironment("GL_BENCHMARK_FRAMES", options.frames);
+
+			std::stringstream results;
+			GLuint failures = 0;
+			for (const std::string& size : options.sizes)
+			{
+				SetEnvironment("GL_BENCHMARK_SIZE", size);
+				for (const char* sample : SAMPLES)
+				{
+					std::printf("%s %s\n", sample, size.c_str());
+					std::string json = BenchmarkSample(options, sample);
+					if (json.empty())
+					{
+						++failures;
+						continue;
+					}
+					results << (results.tellp() > 0 ? ",\n" : "") << "\t\"" << sample << " " << size << "\": " << json;
+				}
+			}
+
+			if (!WriteResults(output, results))
+			{
+				return 1;
+			}
+			std::printf("%u of %u runs failed, results in %s\n", failures, static_cast<GLuint>(options.sizes.size() * (sizeof(SAMPLES) / sizeof(SAMPLES[0]))),
+						output.c_str());
+			return failures ? 1 : 0;
+		}
+
+		// The Deferred sample's lighting modes (see DEFERRED_LIGHTING there) over light counts and ranges, keyed
+		// "Deferred <mode> <lights> x<range> <W>x<H>" so two sweeps can be compared like suite results. A range
+		// of 2 doubles every light's radius. Prints the mean GPU frame time of each run as a table too.
+		int RunLightSweep(const std::string& output, const SuiteOptions& options)
+		{
+			const char* modes[]	 = { "fullscreen", "clustered", "volumes" };
+			const char* counts[] = { "32", "256", "1024", "4096" };
+			const char* ranges[] = { "0.5", "1", "2" };
+
+			SetEnvironment("GL_BENCHMARK_FILE", "benchmark.json");
+			SetEnvironment("GL_BENCHMARK_WARMUP", options.warmup);
+			SetEnvironment("GL_BENCHMARK_FRAMES", options.frames);
+
+			std::stringstream results, table;
+			GLuint failures = 0;
+			for (const std::string& size : options.sizes)
+			{
+				SetEnvironment("GL_BENCHMARK_SIZE", size);
+				table << "\nGPU ms per frame, " << size << "\n" << "lights range";
+				for (const char* mode : modes)
+				{
+					table << " " << std::setw(11) << mode;
+				}
+				table << "\n";
+
+				for (const char* count : counts)
+				{
+					for (const char* range : ranges)
+					{
+						table << std::setw(6) << count << " " << std::setw(5) << range;
+						for (const char* mode : modes)
+						{
+							SetEnvironment("DEFERRED_LIGHTING", mode);
+							SetEnvironment("DEFERRED_LIGHTS", count);
+							SetEnvironment("DEFERRED_LIGHT_RANGE", range);
+							std::string key = std::string("Deferred ") + mode + " " + count + " x" + range + " " + size;
+							std::printf("%s\n", key.c_str());
+
+							std::string json = BenchmarkSample(options, "Deferred");
+							BenchmarkResults timings;
+							if (json.empty() || !timings.Parse(json))
+							{
+								++failures;
+								table << " " << std::setw(11) << "-";
+								continue;
+							}
+							results << (results.tellp() > 0 ? ",\n" : "") << "\t\"" << key << "\": " << json;
+
+							auto gpu = timings.GetValues().find("gpu_ms.mean");
+							table << " " << std::setw(11) << std::fixed << std::setprecision(3) << (gpu != timings.GetValues().end() ? gpu->second : 0.0);
+						}
+						table << "\n";
+					}
+				}
+			}
+			SetEnvironment("DEFERRED_LIGHTING", "");
+			SetEnvironment("DEFERRED_LIGHTS", "");
+			SetEnvironment("DEFERRED_LIGHT_RANGE", "");
+
+			std::printf("%s\n", table.str().c_str());
+			if (!WriteResults(output, results))
+			{
+				return 1;
+			}
+			std::printf("%u runs failed, results in %s\n", failures, output.c_str());
+			return failures ? 1 : 0;
+		}
+
+		// References, golden.txt and tolerances.txt (see ImageTolerances) live in <sample>/Golden; each run writes
+		// its images, and a _diff.png heatmap for every image that differs, to <sample>/Golden/output.
+		// With update the run's images replace the references instead. References depend on the GPU and driver
+		// that rendered them, so none are committed: the first run on a machine is --update, and its images are
+		// looked over before later runs are compared against them.
+		int RunGolden(const SuiteOptions& options)
+		{
+			SetEnvironment("GL_GOLDEN_DIR", std::string("Golden") + SEPARATOR + "output");
+			SetEnvironment("GL_GOLDEN_FRAME", options.frame);
+			SetEnvironment("GL_GOLDEN_SIZE", options.sizes.front());
+			stbi_set_flip_vertically_on_load(false);
+
+			GLuint failures = 0;
+			for (const char* sample : SAMPLES)
+			{
+				std::string golden = options.root + SEPARATOR + sample + SEPARATOR + "Golden";
+				std::string output = golden + SEPARATOR + "output";
+#ifdef _WIN32
+				std::system(("if not exist \"" + output + "\" mkdir \"" + output + "\"").c_str());
+#else
+				std::system(("mkdir -p \"" + output + "\"").c_str());
+#endif
+				std::remove((output + SEPARATOR + "golden.txt").c_str());
+
+				std::printf("%s\n", sample);
+				int status = RunSample(options, sample);
+				std::vector<std::string> images = ReadLines(output + SEPARATOR + "golden.txt");
+				if (status != 0 || images.empty())
+				{
+					std::printf("  failed (exit status %d, %u images)\n", status, static_cast<GLuint>(images.size()));
+					++failures;
+					continue;
+				}
+
+				if (options.update)
+				{
+					for (const std::string& image : images)
+					{
+						CopyBinary(output + SEPARATOR + image, golden + SEPARATOR + image);
+					}
+					CopyBinary(output + SEPARATOR + "golden.txt", golden + SEPARATOR + "golden.txt");
+					std::printf("  %u references updated\n", static_cast<GLuint>(images.size()));
+					continue;
+				}
+
+				std::vector<std::string> references = ReadLines(golden + SEPARATOR + "golden.txt");
+				if (references.empty())
+				{
+					std::printf("  FAIL, no references in %s yet: render them with --golden --update\n", golden.c_str());
+					++failures;
+					continue;
+				}
+
+				ImageTolerances tolerances;
+				tolerances.Load(golden + SEPARATOR + "tolerances.txt");
+				for (const std::string& reference : references)
+				{
+					if (std::find(images.begin(), images.end(), reference) == images.end())
+					{
+						std::printf("  %-40s FAIL, not rendered any more\n", reference.c_str());
+						++failures;
+					}
+				}
+				for (const std::string& image : images)
+				{
+					int width, height, referenceWidth, referenceHeight, channels;
+					unsigned char* rendered = stbi_load((output + SEPARATOR + image).c_str(), &width, &height, &channels, 3);
+					unsigned char* expected = stbi_load((golden + SEPARATOR + image).c_str(), &referenceWidth, &referenceHeight, &channels, 3);
+					if (!rendered || !expected || width != referenceWidth || height != referenceHeight)
+					{
+						std::printf("  %-40s FAIL, %s\n", image.c_str(), expected ? "size differs from the reference" : "no reference (run with --update)");
+						++failures;
+					}
+					else
+					{
+						std::vector<unsigned char> heatmap;
+						ImageDiff diff		 = CompareImages(expected, rendered, width, height, &heatmap);
+						bool	  accepted	 = tolerances.For(image).Accepts(diff);
+						failures += !accepted;
+						std::printf("  %-40s %s  PSNR %6.2f dB  SSIM %.4f  max error %3u  %u pixels differ\n", image.c_str(), accepted ? "pass" : "FAIL",
+									std::min(diff.psnr, 99.99), diff.ssim, diff.maxError, diff.pixels);
+						if (diff.pixels)
+						{
+							std::string name = output + SEPARATOR + image.substr(0, image.rfind('.')) + "_diff.png";
+							stbi_write_png(name.c_str(), width, height, 3, heatmap.data(), width * 3);
+						}
+					}
+					stbi_image_free(rendered);
+					stbi_image_free(expected);
+				}
+			}
+			std::printf("%u golden-image failures\n", failures);
+			return failures ? 1 : 0;
+		}
+
+		int Compare(const std::string& baselinePath, const std::string& currentPath, double threshold)
+		{
+			BenchmarkResults baseline, current;
+			if (!baseline.Load(baselinePath) || !current.Load(currentPath))
+			{
+				return 1;
+			}
+
+			GLuint regressions = baseline.Compare(current, threshold, std::cout);
+			std::printf("%u timings regressed by more than %.1f%%\n", regressions, threshold);
+			return regressions ? 2 : 0;
+		}
+	}
+}
+
+// Benchmark                                      CPU micro-benchmarks
+// Benchmark --suite <out.json> [--bin <dir>] [--root <dir>] [--size WxH]... [--warmup N] [--frames N]
+//                                                every sample in benchmark mode, per size (default 1280x720); the
+//                                                executables are looked up next to this one, the projects in ..;
+//                                                [--timeout S] kills a sample still running after S seconds
+//                                                (default 300), here and in --lights and --golden
+// Benchmark --lights <out.json> [--bin <dir>] [--root <dir>] [--size WxH]... [--warmup N] [--frames N]
+//                                                Deferred's full-screen, clustered and light volume lighting over
+//                                                32 to 4096 lights at three ranges, same options as --suite
+// Benchmark --golden [--update] [--bin <dir>] [--root <dir>] [--size WxH] [--frame N]
+//                                                every sample's frame N (default 10) against its references, at
+//                                                640x360 unless given; exits with 1 on any failure. No references
+//                                                are committed, so run it with --update first on each machine.
+// Benchmark --compare <baseline.json> <current.json> [threshold %, default 5]
+//                                                exits with 2 if any timing regressed by more than the threshold
+int main(int argc, char** argv)
+{
+	bool suite	= argc >= 3 && std::strcmp(argv[1], "--suite") == 0;
+	bool lights = argc >= 3 && std::strcmp(argv[1], "--lights") == 0;
+	bool golden = argc >= 2 && std::strcmp(argv[1], "--golden") == 0;
+	if (suite || lights || golden)
+	{
+		gl::bench::SuiteOptions options;
+		size_t slash = std::string(argv[0]).find_last_of("/\\");
+		options.bin	 = slash == std::string::npos ? "." : std::string(argv[0]).substr(0, slash);
+
+		for (int i = golden ? 2 : 3; i < argc; ++i)
+		{
+			std::string option = argv[i];
+			if (option == "--update")
+			{
+				options.update = true;
+				continue;
+			}
+			if (i + 1 == argc)
+			{
+				std::printf("missing value for %s\n", option.c_str());
+				return 1;
+			}
+			if (option == "--bin")			options.bin	   = argv[++i];
+			else if (option == "--root")	options.root   = argv[++i];
+			else if (option == "--size")	options.sizes.push_back(argv[++i]);
+			else if (option == "--warmup")	options.warmup = argv[++i];
+			else if (option == "--frames")	options.frames = argv[++i];
+			else if (option == "--frame")	options.frame  = argv[++i];
+			else if (option == "--timeout")	options.timeout = static_cast<unsigned int>(std::atoi(argv[++i]));
+			else
+			{
+				std::printf("unknown option %s\n", option.c_str());
+				return 1;
+			}
+		}
+		if (options.sizes.empty())
+		{
+			options.sizes.push_back(golden ? "640x360" : "1280x720");
+		}
+		if (golden)
+		{
+			return gl::bench::RunGolden(options);
+		}
+		return lights ? gl::bench::RunLightSweep(argv[2], options) : gl::bench::RunSuite(argv[2], options);
+	}
+	if (argc >= 4 && std::strcmp(argv[1], "--compare") == 0)
+	{
+		return gl::bench::Compare(argv[2], argv[3], argc >= 5 ? std::atof(argv[4]) : 5.0);
+	}
+
+	gl::bench::TransformHierarchy();
+	gl::bench::OcclusionCulling();
+	gl::bench::BvhQueries(1000);
+	gl::bench::BvhQueries(100000);
+	gl::bench::BvhQueries(1000000);
+
+	gl::Engine engine;
+	engine.Init(1280, 720);
+
+	gl::bench::MaterialBinding();
+	gl::bench::DrawListSorting();
+
+	return 0;
+}
\ No newline at end of file
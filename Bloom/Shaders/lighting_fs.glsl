@@ -8,12 +8,16 @@ in VS_OUT {
     vec2 TexCoords;
 } fs_in;
 
+// Lights as gl::LightBuffer uploads them; the attenuation terms are unused, falloff is 1 / d^2
 struct Light {
-    vec3 Position;
-    vec3 Color;
+    vec4 PositionLinear;
+    vec4 ColorQuadratic;
 };
-
-uniform Light lights[4];
+layout (std140) uniform LightBlock
+{
+    Light lights[256];
+};
+uniform int uLightCount;
 uniform sampler2D diffuseTexture;
 uniform vec3 viewPos;
 
@@ -26,14 +30,16 @@ void main()
     // lighting
     vec3 lighting = vec3(0.0);
     vec3 viewDir = normalize(viewPos - fs_in.FragPos);
-    for(int i = 0; i < 4; i++)
+    for(int i = 0; i < uLightCount; i++)
     {
+        vec3 lightPos = lights[i].PositionLinear.xyz;
+        vec3 lightColor = lights[i].ColorQuadratic.rgb;
         // diffuse
-        vec3 lightDir = normalize(lights[i].Position - fs_in.FragPos);
+        vec3 lightDir = normalize(lightPos - fs_in.FragPos);
         float diff = max(dot(lightDir, normal), 0.0);
-        vec3 result = lights[i].Color * diff * color;      
+        vec3 result = lightColor * diff * color;      
         // attenuation (use quadratic as we have gamma correction)
-        float distance = length(fs_in.FragPos - lights[i].Position);
+        float distance = length(fs_in.FragPos - lightPos);
         result *= 1.0 / (distance * distance);
         lighting += result;
     }
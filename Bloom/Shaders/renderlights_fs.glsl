@@ -8,11 +8,12 @@ in VS_OUT {
     vec2 TexCoords;
 } fs_in;
 
-uniform vec3 lightColor;
+// Light color in rgb, set per draw by the draw list
+uniform vec4 params;
 
 void main()
 {           
-    FragColor = vec4(lightColor, 1.0);
+    FragColor = vec4(params.rgb, 1.0);
     float brightness = dot(FragColor.rgb, vec3(0.2126, 0.7152, 0.0722));
     if(brightness > 1.0)
         BrightColor = vec4(FragColor.rgb, 1.0);
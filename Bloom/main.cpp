@@ -3,18 +3,11 @@
 #include "common.hpp"
 #include "common_mesh.hpp"
 #include "controller.hpp"
+#include "light_buffer.hpp"
 #include <array>
 
 namespace gl
 {
-	struct LightInfo
-	{
-		glm::vec3 pos;
-		glm::vec3 color;
-
-		LightInfo(const glm::vec3& pos, const glm::vec3& color) : pos(pos), color(color) {}
-	};
-
 	class Bloom : public RenderPass
 	{
 	public:
@@ -27,10 +20,10 @@ namespace gl
 		{
 			// ֡ɫʽʾΪGL_RGB16FGL_RGBA16FGL_RGB32FGL_RGBA32FĬΪRGB8λ
 			glGenFramebuffers(1, &mFloatFrameBuffer);
-			glBindFramebuffer(GL_FRAMEBUFFER, mFloatFrameBuffer);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, mFloatFrameBuffer);
 			{
 				glGenTextures(1, &mNormalColorBuffer);
-				glBindTexture(GL_TEXTURE_2D, mNormalColorBuffer);
+				GLState::Instance()->BindTexture(GL_TEXTURE_2D, mNormalColorBuffer);
 				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, context.width, context.height, 0, GL_RGBA, GL_FLOAT, NULL);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -39,7 +32,7 @@ namespace gl
 				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mNormalColorBuffer, 0);
 
 				glGenTextures(1, &mBrighterColorBuffer);
-				glBindTexture(GL_TEXTURE_2D, mBrighterColorBuffer);
+				GLState::Instance()->BindTexture(GL_TEXTURE_2D, mBrighterColorBuffer);
 				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, context.width, context.height, 0, GL_RGBA, GL_FLOAT, NULL);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -57,14 +50,14 @@ namespace gl
 				glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, context.width, context.height);
 				glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
 			}
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 			glGenFramebuffers(2, &mBlurFrameBuffers[0]);
 			glGenTextures(2, &mBlurColorBuffers[0]);
 			for (size_t i = 0; i < 2; ++i)
 			{
-				glBindFramebuffer(GL_FRAMEBUFFER, mBlurFrameBuffers[i]);
-				glBindTexture(GL_TEXTURE_2D, mBlurColorBuffers[i]);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, mBlurFrameBuffers[i]);
+				GLState::Instance()->BindTexture(GL_TEXTURE_2D, mBlurColorBuffers[i]);
 				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, context.width, context.height, 0, GL_RGB, GL_FLOAT, NULL);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -74,14 +67,16 @@ namespace gl
 				// also check if framebuffers are complete (no need for depth buffer)
 				if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
 					std::cout << "Framebuffer not complete!" << std::endl;
-				glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 			}
 
 			// Init Lights
-			mLightInfos.push_back(LightInfo(glm::vec3(0.0f, 0.5f, 1.5f), glm::vec3(5.0f, 5.0f, 5.0f)));
-			mLightInfos.push_back(LightInfo(glm::vec3(-4.0f, 0.5f, -3.0f), glm::vec3(10.0f, 0.0f, 0.0f)));
-			mLightInfos.push_back(LightInfo(glm::vec3(3.0f, 0.5f, 1.0f), glm::vec3(0.0f, 0.0f, 15.0f)));
-			mLightInfos.push_back(LightInfo(glm::vec3(-.8f, 2.4f, -1.0f), glm::vec3(0.0f, 5.0f, 0.0f)));
+			mLights.Set({
+				PointLight(glm::vec3(0.0f, 0.5f, 1.5f), glm::vec3(5.0f, 5.0f, 5.0f)),
+				PointLight(glm::vec3(-4.0f, 0.5f, -3.0f), glm::vec3(10.0f, 0.0f, 0.0f)),
+				PointLight(glm::vec3(3.0f, 0.5f, 1.0f), glm::vec3(0.0f, 0.0f, 15.0f)),
+				PointLight(glm::vec3(-.8f, 2.4f, -1.0f), glm::vec3(0.0f, 5.0f, 0.0f)),
+			});
 
 			// Init Tex
 			mWoodTex = LoadTexture("../Resource/Texture/wood.png");
@@ -92,6 +87,7 @@ namespace gl
 			mLighting.Link();
 			mLighting.Active();
 			mLighting.SetValue("diffuseTexture", 0);
+			mLights.AttachUniformBlock(mLighting);
 
 			mRenderLights.AttachShader(GL_VERTEX_SHADER, "Shaders/renderlights_vs.glsl");
 			mRenderLights.AttachShader(GL_FRAGMENT_SHADER, "Shaders/renderlights_fs.glsl");
@@ -113,7 +109,7 @@ namespace gl
 			// Init Camera
 			Controller::Instance()->ResetCamera(glm::vec3(0.f, 1.f, 5.f), glm::vec3(0.0f, 1.0f, 0.0f));
 
-			glEnable(GL_DEPTH_TEST);
+			GLState::Instance()->SetPipeline(PipelineState::Opaque());
 		}
 
 		virtual void Update(const SContext& context, const STime& time) override
@@ -121,7 +117,7 @@ namespace gl
 			auto& camera = Controller::Instance()->GetCamera();
 
 			// 1. Render scene into floating point framebuffer
-			glBindFramebuffer(GL_FRAMEBUFFER, mFloatFrameBuffer);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, mFloatFrameBuffer);
 			{
 				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 				glm::mat4 model = glm::mat4(1.0f);
@@ -133,73 +129,75 @@ namespace gl
 				mLighting.SetMatrix("view", &view[0][0]);
 				mLighting.SetMatrix("projection", &projection[0][0]);
 				mLighting.SetValue("viewPos", camera.Position);
-				for (GLuint i = 0; i < mLightInfos.size(); ++i)
-				{
-					mLighting.SetValue(("lights[" + std::to_string(i) + "].Position").c_str(), mLightInfos[i].pos);
-					mLighting.SetValue(("lights[" + std::to_string(i) + "].Color").c_str(), mLightInfos[i].color);
-				}
-				// set texture
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, mWoodTex);
+				mLights.Upload();
+				mLights.BindUniformBlock();
+				// Boxes and light cubes go into the draw list in any order; it groups them by program and draws
+				// front to back
+				mDrawList.Begin(view, 100.0f);
+				DrawPacket box = mBox.GetPacket(mLighting.program());
+				box.material	= mWoodTex;
+				box.textures[0] = mWoodTex;
 
 				// create one large cube that acts as the floor
 				model = glm::mat4(1.0f);
 				model = glm::translate(model, glm::vec3(0.0f, -1.0f, 0.0));
 				model = glm::scale(model, glm::vec3(12.5f, 0.5f, 12.5f));
-				mLighting.SetMatrix("model", &model[0][0]);
-				mBox.Draw();
+				box.model = model;
+				mDrawList.Submit(box);
 				// then create multiple cubes as the scenery
 				model = glm::mat4(1.0f);
 				model = glm::translate(model, glm::vec3(0.0f, 1.5f, 0.0));
 				model = glm::scale(model, glm::vec3(0.5f));
-				mLighting.SetMatrix("model", &model[0][0]);
-				mBox.Draw();
+				box.model = model;
+				mDrawList.Submit(box);
 
 				model = glm::mat4(1.0f);
 				model = glm::translate(model, glm::vec3(2.0f, 0.0f, 1.0));
 				model = glm::scale(model, glm::vec3(0.5f));
-				mLighting.SetMatrix("model", &model[0][0]);
-				mBox.Draw();
+				box.model = model;
+				mDrawList.Submit(box);
 
 				model = glm::mat4(1.0f);
 				model = glm::translate(model, glm::vec3(-1.0f, -1.0f, 2.0));
 				model = glm::rotate(model, glm::radians(60.0f), glm::normalize(glm::vec3(1.0, 0.0, 1.0)));
-				mLighting.SetMatrix("model", &model[0][0]);
-				mBox.Draw();
+				box.model = model;
+				mDrawList.Submit(box);
 
 				model = glm::mat4(1.0f);
 				model = glm::translate(model, glm::vec3(0.0f, 2.7f, 4.0));
 				model = glm::rotate(model, glm::radians(23.0f), glm::normalize(glm::vec3(1.0, 0.0, 1.0)));
 				model = glm::scale(model, glm::vec3(1.25));
-				mLighting.SetMatrix("model", &model[0][0]);
-				mBox.Draw();
+				box.model = model;
+				mDrawList.Submit(box);
 
 				model = glm::mat4(1.0f);
 				model = glm::translate(model, glm::vec3(-2.0f, 1.0f, -3.0));
 				model = glm::rotate(model, glm::radians(124.0f), glm::normalize(glm::vec3(1.0, 0.0, 1.0)));
-				mLighting.SetMatrix("model", &model[0][0]);
-				mBox.Draw();
+				box.model = model;
+				mDrawList.Submit(box);
 
 				model = glm::mat4(1.0f);
 				model = glm::translate(model, glm::vec3(-3.0f, 0.0f, 0.0));
 				model = glm::scale(model, glm::vec3(0.5f));
-				mLighting.SetMatrix("model", &model[0][0]);
-				mBox.Draw();
+				box.model = model;
+				mDrawList.Submit(box);
 
 				mRenderLights.Active();
 				mRenderLights.SetMatrix("view", &view[0][0]);
 				mRenderLights.SetMatrix("projection", &projection[0][0]);
-				for (auto& lightInfo : mLightInfos)
+				DrawPacket lightBox = mBox.GetPacket(mRenderLights.program());
+				for (auto& light : mLights.GetLights())
 				{
 					model = glm::mat4(1.0f);
-					model = glm::translate(model, lightInfo.pos);
+					model = glm::translate(model, light.position);
 					model = glm::scale(model, glm::vec3(0.25f));
-					mRenderLights.SetMatrix("model", &model[0][0]);
-					mRenderLights.SetValue("lightColor", lightInfo.color);
-					mBox.Draw();
+					lightBox.model	= model;
+					lightBox.params = glm::vec4(light.color, 1.0f);
+					mDrawList.Submit(lightBox);
 				}
+				mDrawList.Execute();
 			}
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 
 			// 2. blur bright fragments with two-pass Gaussian Blur
@@ -208,25 +206,23 @@ namespace gl
 			{
 				for (unsigned int i = 0; i < 10; ++i)
 				{
-					glBindFramebuffer(GL_FRAMEBUFFER, mBlurFrameBuffers[horizontal]);
+					GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, mBlurFrameBuffers[horizontal]);
 					mBlur.SetValue("horizontal", horizontal);
-					glBindTexture(GL_TEXTURE_2D, first_iteration ? mBrighterColorBuffer : mBlurColorBuffers[!horizontal]);  // bind texture of other framebuffer (or scene if first iteration)
+					GLState::Instance()->BindTexture(GL_TEXTURE_2D, first_iteration ? mBrighterColorBuffer : mBlurColorBuffers[!horizontal]);  // bind texture of other framebuffer (or scene if first iteration)
 					mQuad.Draw();
 					horizontal = !horizontal;
 					if (first_iteration)
 						first_iteration = false;
 				}
-				glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 			}
 
 
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 			mRenderToScreen.Active();
 			{
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, mNormalColorBuffer);
-				glActiveTexture(GL_TEXTURE1);
-				glBindTexture(GL_TEXTURE_2D, mBlurColorBuffers[!horizontal]);
+				GLState::Instance()->BindTexture(0, GL_TEXTURE_2D, mNormalColorBuffer);
+				GLState::Instance()->BindTexture(1, GL_TEXTURE_2D, mBlurColorBuffers[!horizontal]);
 				mRenderToScreen.SetValue("exposure", mExposure);
 				mQuad.Draw();
 			}
@@ -247,9 +243,11 @@ namespace gl
 		Shader		mBlur;
 		Shader		mRenderToScreen;
 
+		DrawList	mDrawList;
+
 		std::array<GLuint, 2>  mBlurFrameBuffers;
 		std::array<GLuint, 2>  mBlurColorBuffers;
-		std::vector<LightInfo> mLightInfos;
+		LightBuffer			   mLights;
 	};
 }
 
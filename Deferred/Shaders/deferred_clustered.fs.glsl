@@ -0,0 +1,76 @@
+#version 330 core
+out vec4 FragColor;
+in vec2 texCoords;
+
+uniform sampler2D gDepth;
+uniform sampler2D gNormal;
+uniform sampler2D gAlbedoSpec;
+uniform mat4 uInvViewProjection;
+
+// World position from the depth buffer
+vec3 ReconstructPosition(vec2 uv)
+{
+    vec4 position = uInvViewProjection * vec4(vec3(uv, texture(gDepth, uv).r) * 2.0 - 1.0, 1.0);
+    return position.xyz / position.w;
+}
+
+// Inverse of g_buffer.fs.glsl's octahedral encoding
+vec3 DecodeNormal(vec2 e)
+{
+    e = e * 2.0 - 1.0;
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+    return normalize(n);
+}
+
+// gl::LightBuffer's lights, then gl::LightClusters' (offset, count) per cluster into the light index lists
+uniform samplerBuffer uLightData;
+uniform usamplerBuffer uClusterGrid;
+uniform usamplerBuffer uLightIndices;
+uniform vec2 uTileSize;
+uniform float uSliceScale;
+uniform float uSliceBias;
+
+const int TILES_X = 16;
+const int TILES_Y = 9;
+const int SLICES = 24;
+
+uniform mat4 view;
+uniform vec3 viewPos;
+
+void main()
+{
+    vec3 FragPos = ReconstructPosition(texCoords);
+    vec3 Normal  = DecodeNormal(texture(gNormal, texCoords).rg);
+    vec3 Diffuse  = texture(gAlbedoSpec, texCoords).rgb;
+    float Specular = texture(gAlbedoSpec, texCoords).a;
+
+    vec3 lighting = Diffuse * 0.1;
+
+    // The view space depth picks the slice; pixels without geometry land on the far plane
+    float depth = -(view * vec4(FragPos, 1.0)).z;
+    ivec2 tile = min(ivec2(gl_FragCoord.xy / uTileSize), ivec2(TILES_X - 1, TILES_Y - 1));
+    int slice = clamp(int(floor(log(depth) * uSliceScale + uSliceBias)), 0, SLICES - 1);
+    uvec2 cluster = texelFetch(uClusterGrid, tile.x + TILES_X * (tile.y + TILES_Y * slice)).xy;
+
+    vec3 v = normalize(viewPos - FragPos);
+    for (uint i = 0u; i < cluster.y; ++i)
+    {
+        int light = int(texelFetch(uLightIndices, int(cluster.x + i)).r);
+        vec4 positionLinear = texelFetch(uLightData, 2 * light);
+        vec4 colorQuadratic = texelFetch(uLightData, 2 * light + 1);
+
+        vec3 l = normalize(positionLinear.xyz - FragPos);
+        vec3 diffuse = max(dot(Normal, l), 0.0) * Diffuse * colorQuadratic.rgb;
+        vec3 h = normalize(l + v);
+        float spec = pow(max(dot(Normal, h), 0.0), 16.0);
+        vec3 specular = colorQuadratic.rgb * spec * Specular;
+
+        float distance = length(positionLinear.xyz - FragPos);
+        float attenuation = 1.0 / (1.0 + positionLinear.w * distance + colorQuadratic.w * distance * distance);
+        lighting += (diffuse + specular) * attenuation;
+    }
+
+    FragColor = vec4(lighting, 1.0);
+}
\ No newline at end of file
@@ -2,44 +2,58 @@
 out vec4 FragColor;
 in vec2 texCoords;
 
-uniform sampler2D gPosition;
+uniform sampler2D gDepth;
 uniform sampler2D gNormal;
 uniform sampler2D gAlbedoSpec;
+uniform mat4 uInvViewProjection;
 
-struct Light {
-    vec3 Position;
-    vec3 Color;
-    
-    float Linear;
-    float Quadratic;
-};
-const int NR_LIGHTS = 32;
-uniform Light lights[NR_LIGHTS];
+// World position from the depth buffer
+vec3 ReconstructPosition(vec2 uv)
+{
+    vec4 position = uInvViewProjection * vec4(vec3(uv, texture(gDepth, uv).r) * 2.0 - 1.0, 1.0);
+    return position.xyz / position.w;
+}
+
+// Inverse of g_buffer.fs.glsl's octahedral encoding
+vec3 DecodeNormal(vec2 e)
+{
+    e = e * 2.0 - 1.0;
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+    return normalize(n);
+}
+
+// Lights as gl::LightBuffer uploads them: texel 2i is (Position, Linear), texel 2i + 1 is (Color, Quadratic)
+uniform samplerBuffer uLightData;
+uniform int uLightCount;
 uniform vec3 viewPos;
 
 void main()
 {
     // 从G-Buffer中获取数据
-    vec3 FragPos = texture(gPosition, texCoords).rgb;
-    vec3 Normal  = texture(gNormal, texCoords).rgb;
+    vec3 FragPos = ReconstructPosition(texCoords);
+    vec3 Normal  = DecodeNormal(texture(gNormal, texCoords).rg);
     vec3 Diffuse  = texture(gAlbedoSpec, texCoords).rgb;
     float Specular = texture(gAlbedoSpec, texCoords).a;
 
     // 然后和往常一样地计算光照
     vec3 lighting = Diffuse * 0.1; // 硬编码环境光照分量
     vec3 v = normalize(viewPos - FragPos);
-    for(int i = 0; i < NR_LIGHTS; ++i)
+    for(int i = 0; i < uLightCount; ++i)
     {
+        vec4 positionLinear = texelFetch(uLightData, 2 * i);
+        vec4 colorQuadratic = texelFetch(uLightData, 2 * i + 1);
         // 漫反射
-        vec3 l = normalize(lights[i].Position - FragPos);
-        vec3 diffuse = max(dot(Normal, l), 0.0) * Diffuse * lights[i].Color;
+        vec3 l = normalize(positionLinear.xyz - FragPos);
+        vec3 diffuse = max(dot(Normal, l), 0.0) * Diffuse * colorQuadratic.rgb;
         // 高光
         vec3 h = normalize(l + v);
         float spec = pow(max(dot(Normal, h), 0.0), 16.0);
-        vec3 specular = lights[i].Color * spec * Specular;
+        vec3 specular = colorQuadratic.rgb * spec * Specular;
         // Attenuation
-        float distance = length(lights[i].Position - FragPos);
-        float attenuation = 1.0 / (1.0 + lights[i].Linear * distance + lights[i].Quadratic * distance * distance);
+        float distance = length(positionLinear.xyz - FragPos);
+        float attenuation = 1.0 / (1.0 + positionLinear.w * distance + colorQuadratic.w * distance * distance);
         diffuse *= attenuation;
         specular *= attenuation;
         lighting += diffuse + specular;
@@ -1,8 +1,7 @@
 #version 330 core
-// Multiple
-layout (location = 0) out vec3 gPos;
-layout (location = 1) out vec3 gNormal;
-layout (location = 2) out vec4 gAlbedoSpec;
+// Compact G-Buffer: position comes back from the depth buffer, so only normal and material are written
+layout (location = 0) out vec2 gNormal;
+layout (location = 1) out vec4 gAlbedoSpec;
 
 in vec3 fragPos;
 in vec2 texCoords;
@@ -11,10 +10,17 @@ in vec3 normal;
 uniform sampler2D texture_diffuse1;
 uniform sampler2D texture_specular1;
 
+// Octahedral encoding: the unit sphere folded onto a square, stored in [0, 1] for the RG16 target
+vec2 EncodeNormal(vec3 n)
+{
+    n /= abs(n.x) + abs(n.y) + abs(n.z);
+    vec2 e = n.z >= 0.0 ? n.xy : (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    return e * 0.5 + 0.5;
+}
+
 void main()
 {
-    gPos = fragPos;
-    gNormal = normalize(normal);
+    gNormal = EncodeNormal(normalize(normal));
     // And the diffuse per-fragment color
     gAlbedoSpec.rgb = texture(texture_diffuse1, texCoords).rgb;
     // Store specular intensity in gAlbedoSpec's alpha component
@@ -0,0 +1,54 @@
+#version 330 core
+out vec4 FragColor;
+
+flat in int lightIndex;
+
+uniform sampler2D gDepth;
+uniform sampler2D gNormal;
+uniform sampler2D gAlbedoSpec;
+uniform mat4 uInvViewProjection;
+
+// World position from the depth buffer
+vec3 ReconstructPosition(vec2 uv)
+{
+    vec4 position = uInvViewProjection * vec4(vec3(uv, texture(gDepth, uv).r) * 2.0 - 1.0, 1.0);
+    return position.xyz / position.w;
+}
+
+// Inverse of g_buffer.fs.glsl's octahedral encoding
+vec3 DecodeNormal(vec2 e)
+{
+    e = e * 2.0 - 1.0;
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+    return normalize(n);
+}
+
+uniform samplerBuffer uLightData;
+uniform vec2 uScreenSize;
+uniform vec3 viewPos;
+
+// One light's share of deferred_shading.fs.glsl, added onto the ambient pass by blending
+void main()
+{
+    vec2 texCoords = gl_FragCoord.xy / uScreenSize;
+    vec3 FragPos = ReconstructPosition(texCoords);
+    vec3 Normal  = DecodeNormal(texture(gNormal, texCoords).rg);
+    vec3 Diffuse  = texture(gAlbedoSpec, texCoords).rgb;
+    float Specular = texture(gAlbedoSpec, texCoords).a;
+
+    vec4 positionLinear = texelFetch(uLightData, 2 * lightIndex);
+    vec4 colorQuadratic = texelFetch(uLightData, 2 * lightIndex + 1);
+
+    vec3 v = normalize(viewPos - FragPos);
+    vec3 l = normalize(positionLinear.xyz - FragPos);
+    vec3 diffuse = max(dot(Normal, l), 0.0) * Diffuse * colorQuadratic.rgb;
+    vec3 h = normalize(l + v);
+    float spec = pow(max(dot(Normal, h), 0.0), 16.0);
+    vec3 specular = colorQuadratic.rgb * spec * Specular;
+
+    float distance = length(positionLinear.xyz - FragPos);
+    float attenuation = 1.0 / (1.0 + positionLinear.w * distance + colorQuadratic.w * distance * distance);
+    FragColor = vec4((diffuse + specular) * attenuation, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+
+// One instance per light of the gl::LightBuffer
+uniform samplerBuffer uLightData;
+uniform mat4 view;
+uniform mat4 projection;
+
+flat out int lightIndex;
+
+// The registry sphere is a 16 x 16 polygon inside the unit sphere; this much larger it contains it
+const float SPHERE_SCALE = 1.04;
+
+// gl::PointLight::Radius: where the brightest channel has fallen to 5/256
+float Radius(vec3 color, float linear, float quadratic)
+{
+    float c = 1.0 - max(max(color.r, color.g), color.b) * 256.0 / 5.0;
+    return max((-linear + sqrt(linear * linear - 4.0 * quadratic * c)) / (2.0 * quadratic), 0.0);
+}
+
+void main()
+{
+    vec4 positionLinear = texelFetch(uLightData, 2 * gl_InstanceID);
+    vec4 colorQuadratic = texelFetch(uLightData, 2 * gl_InstanceID + 1);
+    float radius = Radius(colorQuadratic.rgb, positionLinear.w, colorQuadratic.w) * SPHERE_SCALE;
+
+    gl_Position = projection * view * vec4(positionLinear.xyz + aPos * radius, 1.0);
+    lightIndex = gl_InstanceID;
+}
\ No newline at end of file
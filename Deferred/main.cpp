@@ -3,71 +3,89 @@
 #include "model.hpp"
 #include "common.hpp"
 #include "controller.hpp"
+#include "hiz.hpp"
+#include "light_clusters.hpp"
+#include "common_mesh.hpp"
 #include <vector>
+#include <algorithm>
 #include <random>
+#include <string>
+#include <cstdlib>
 
 GLuint SCR_WIDTH = 1280;
 GLuint SCR_HEIGHT = 720;
 
+// Lights in the scene, how far they reach and how the lighting pass shades them; DEFERRED_LIGHTS,
+// DEFERRED_LIGHT_RANGE and DEFERRED_LIGHTING ("fullscreen", "clustered" or "volumes") override them
+GLuint NUM_LIGHTS = 32;
+GLfloat LIGHT_RANGE = 1.0f;
+enum class LightingMode { FullScreen, Clustered, Volumes };
+LightingMode LIGHTING_MODE = LightingMode::Clustered;
+
+// DEFERRED_CULLING picks how the model instances are culled: "hiz" (default) tests them on the GPU against a
+// Hi-Z pyramid of the depth buffer, "cpu" tests their boxes against the frustum and against the nearest
+// instances rasterized on the CPU (see OcclusionCuller), before any draw is issued
+enum class CullingMode { HiZ, CPU };
+CullingMode CULLING_MODE = CullingMode::HiZ;
+
+const GLfloat Z_NEAR = 0.1f;
+const GLfloat Z_FAR = 100.0f;
+
 namespace gl
 {
 	// TODO ŻܹǰȾӳȾܹ
 	GLuint gBuffer = 0;
-	GLuint gPos, gNormal, gAlbedoSpec;
+	GLuint gNormal, gAlbedoSpec, gDepth;
 
 	class GeometryPass : public RenderPass
 	{
 	public:
-		GeometryPass() : mShader(), mModel("../Resource/Model/Nanosuit/nanosuit.obj")
+		// The CPU culler rasterizes the model itself, so it keeps the model's geometry
+		GeometryPass() : mShader(), mModel("../Resource/Model/Nanosuit/nanosuit.obj", CULLING_MODE == CullingMode::CPU)
 		{
 
 		}
 
-		virtual void Init() override
+		virtual void Init(const SContext& context) override
 		{
-			glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
-			glEnable(GL_DEPTH_TEST);
+			GLState::Instance()->SetViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
+			GLState::Instance()->SetPipeline(PipelineState::Opaque());
 
-			// G-Buffer, 3 texture:
-			// 1. Position (RGB, 16F)
-			// 2. Normals (RGB, 16F)
-			// 3. Color (RGB) + Specular(A)
+			// G-Buffer, 2 textures and depth, 12 bytes a pixel:
+			// 1. Normals, octahedral (RG, 16 unorm)
+			// 2. Color (RGB) + Specular(A)
+			// 3. Depth, from which the lighting pass reconstructs position
 			glGenFramebuffers(1, &gBuffer);
-			glBindFramebuffer(GL_FRAMEBUFFER, gBuffer);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, gBuffer);
 			{
-				// Position Buffer
-				glGenTextures(1, &gPos);
-				glBindTexture(GL_TEXTURE_2D, gPos);
-				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGB, GL_FLOAT, NULL);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);			
-				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, gPos, 0);
 				// Normal Buffer
 				glGenTextures(1, &gNormal);
-				glBindTexture(GL_TEXTURE_2D, gNormal);
-				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGB, GL_FLOAT, NULL);
+				GLState::Instance()->BindTexture(GL_TEXTURE_2D, gNormal);
+				glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16, SCR_WIDTH, SCR_HEIGHT, 0, GL_RG, GL_UNSIGNED_SHORT, NULL);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, gNormal, 0);
+				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, gNormal, 0);
 				// Color & Specular color buffer
 				glGenTextures(1, &gAlbedoSpec);
-				glBindTexture(GL_TEXTURE_2D, gAlbedoSpec);
+				GLState::Instance()->BindTexture(GL_TEXTURE_2D, gAlbedoSpec);
 				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST); 
 
-				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT2, GL_TEXTURE_2D, gAlbedoSpec, 0);
+				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, gAlbedoSpec, 0);
 
 				// Tell OpenGL which color attachments we'll use (of this framebuffer) for rendering
-				GLuint attachments[3] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2 };
-				glDrawBuffers(3, attachments);
-
-				// Depth buffer?
-				GLuint rboDepth;
-				glGenRenderbuffers(1, &rboDepth);
-				glBindRenderbuffer(GL_RENDERBUFFER, rboDepth);
-				glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, SCR_WIDTH, SCR_HEIGHT);
-				glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rboDepth);
+				GLuint attachments[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+				glDrawBuffers(2, attachments);
+
+				// Depth buffer, a texture so the Hi-Z pyramid and the lighting pass can sample it. 24 bits like the
+				// default framebuffer, which the lighting pass blits it into.
+				glGenTextures(1, &gDepth);
+				GLState::Instance()->BindTexture(GL_TEXTURE_2D, gDepth);
+				glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, SCR_WIDTH, SCR_HEIGHT, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, gDepth, 0);
 
 				// Check the framebuffer status
 				if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
@@ -75,7 +93,7 @@ namespace gl
 					throw std::exception("Framebuffer not complete!");
 				}
 			}
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 			// Init shader
 			mShader.AttachShader(GL_VERTEX_SHADER, "Shaders/g_buffer.vs.glsl");
@@ -93,51 +111,122 @@ namespace gl
 			mModelPositions.push_back(glm::vec3(0.0, -3.0, 3.0));
 			mModelPositions.push_back(glm::vec3(3.0, -3.0, 3.0));
 
+			// Instances never move, so the culler gets them once and tests them on the GPU every frame
+			for (auto& pos : mModelPositions)
+			{
+				mInstances.push_back(InstanceData(glm::scale(glm::translate(glm::mat4(1.0f), pos), glm::vec3(0.25f))));
+				mInstanceBounds.push_back(mModel.bounds().Transform(mInstances.back().model));
+			}
+			if (CULLING_MODE == CullingMode::HiZ)
+			{
+				mCuller.Init(mModel.indirect_commands(), static_cast<GLuint>(mInstances.size()));
+				mCuller.SetInstances(mInstances, mModel.bounding_sphere());
+				mPyramid.Init(SCR_WIDTH, SCR_HEIGHT);
+			}
+
 			Controller::Instance()->ResetCamera(glm::vec3(0.f, 0.f, 5.f), glm::vec3(0.0f, 1.0f, 0.0f));
 		}
 
-		virtual void Update() override
+		virtual void Update(const SContext& context, const STime& time) override
 		{
 			auto& camera = Controller::Instance()->GetCamera();
 
 			// Geometry Pass: render scene's geometry/color data into gbuffer
-			glBindFramebuffer(GL_FRAMEBUFFER, gBuffer);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, gBuffer);
 			{
 				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 				glm::mat4 view = camera.GetViewMatrix();
-				glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
+				glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, Z_NEAR, Z_FAR);
 				mShader.Active();
 				mShader.SetMatrix("view", &view[0][0]);
 				mShader.SetMatrix("projection", &projection[0][0]);
 
-				for (auto& pos : mModelPositions)
+				if (CULLING_MODE == CullingMode::CPU)
 				{
-					glm::mat4 model = glm::mat4(1.0f);
-					model = glm::translate(model, pos);
-					model = glm::scale(model, glm::vec3(0.25f));
-					mShader.SetMatrix("model", &model[0][0]);
-
-					mModel.Draw(mShader);
+					_CullOnCpu(projection, view, camera.Position);
+					if (!mVisibleInstances.empty())
+					{
+						mVisibleBuffer.Upload(mVisibleInstances);
+						mModel.DrawInstanced(mShader, mVisibleBuffer);
+					}
+				}
+				else
+				{
+					// What last frame's pyramid doesn't hide is drawn first; the pyramid rebuilt from that depth then
+					// decides on the rest. Instance counts stay on the GPU, so each phase is one indirect call per mesh.
+					mCuller.SetFrustum(projection, view);
+					mCuller.Cull(CULL_PHASE_FIRST, mPyramid);
+					mModel.DrawIndirect(mShader, mCuller.GetInstances(CULL_PHASE_FIRST), mCuller.GetCommands(CULL_PHASE_FIRST));
+
+					mPyramid.Build(gDepth, projection * view);
+					mCuller.Cull(CULL_PHASE_SECOND, mPyramid);
+					mModel.DrawIndirect(mShader, mCuller.GetInstances(CULL_PHASE_SECOND), mCuller.GetCommands(CULL_PHASE_SECOND));
 				}
-				mModel.Draw(mShader);
 			}
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 		}
 
 	private:
+		// Instances whose meshes are rasterized as occluders, nearest to the camera first
+		static const GLuint OCCLUDER_INSTANCES = 3;
+
+		// Leaves the instances in the frustum and not hidden behind the nearest ones in mVisibleInstances
+		void _CullOnCpu(const glm::mat4& projection, const glm::mat4& view, const glm::vec3& viewPos)
+		{
+			mFrustum.SetFrustum(projection, view);
+			mFrustum.Cull(mInstanceBounds.data(), mInstanceBounds.size(), mVisible);
+
+			std::vector<GLuint> nearest = mVisible;
+			std::sort(nearest.begin(), nearest.end(), [&](GLuint a, GLuint b)
+			{
+				return glm::length(mInstanceBounds[a].Center() - viewPos) < glm::length(mInstanceBounds[b].Center() - viewPos);
+			});
+			nearest.resize(std::min<size_t>(nearest.size(), OCCLUDER_INSTANCES));
+
+			mOcclusion.Begin(projection, view);
+			for (GLuint instance : nearest)
+			{
+				mModel.AddOccluders(mOcclusion, mInstances[instance].model);
+			}
+			mOcclusion.Rasterize();
+			mOcclusion.Filter(mInstanceBounds.data(), mVisible);
+
+			mVisibleInstances.clear();
+			for (GLuint instance : mVisible)
+			{
+				mVisibleInstances.push_back(mInstances[instance]);
+			}
+		}
+
 		Model  mModel;
 		Shader mShader;
 		std::vector<glm::vec3> mModelPositions;
+		std::vector<InstanceData> mInstances;
+		std::vector<AABB>		  mInstanceBounds;
+
+		HiZCuller	mCuller;
+		HiZPyramid	mPyramid;
+
+		FrustumCuller			  mFrustum;
+		OcclusionCuller			  mOcclusion;
+		std::vector<GLuint>		  mVisible;
+		std::vector<InstanceData> mVisibleInstances;
+		InstanceBuffer			  mVisibleBuffer;
 	};
 
 	class DeferredLightingPass : public RenderPass
 	{
 	public:
-		virtual void Init() override
+		DeferredLightingPass() : mLightVolume(TESSELLATION_LOW)
+		{
+
+		}
+
+		virtual void Init(const SContext& context) override
 		{
 			glGenVertexArrays(1, &mQuadVao);
-			glBindVertexArray(mQuadVao);
+			GLState::Instance()->BindVertexArray(mQuadVao);
 			{
 				GLfloat quadVertices[] = {
 					// Positions        // Texture Coords
@@ -156,25 +245,41 @@ namespace gl
 				glEnableVertexAttribArray(1);
 				glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
 			}
-			glBindVertexArray(0);
+			GLState::Instance()->BindVertexArray(0);
 
 			// Init shader
 			mShader.AttachShader(GL_VERTEX_SHADER, "Shaders/deferred_shading.vs.glsl");
-			mShader.AttachShader(GL_FRAGMENT_SHADER, "Shaders/deferred_shading.fs.glsl");
+			mShader.AttachShader(GL_FRAGMENT_SHADER, LIGHTING_MODE == LightingMode::Clustered ? "Shaders/deferred_clustered.fs.glsl" : "Shaders/deferred_shading.fs.glsl");
 			mShader.Link();
 
 			// Set samplers
 			mShader.Active();
-			mShader.SetValue("gPosition", 0);
+			mShader.SetValue("gDepth", 0);
 			mShader.SetValue("gNormal", 1);
 			mShader.SetValue("gAlbedoSpec", 2);
 
-			// Init Light
-			constexpr GLuint NUM_LIGHTS = 32;
-			Lights.resize(NUM_LIGHTS);
+			// Light volumes: the full-screen shader only adds the ambient term, each light's sphere adds its light
+			if (LIGHTING_MODE == LightingMode::Volumes)
+			{
+				mVolumeShader.AttachShader(GL_VERTEX_SHADER, "Shaders/light_volume.vs.glsl");
+				mVolumeShader.AttachShader(GL_FRAGMENT_SHADER, "Shaders/light_volume.fs.glsl");
+				mVolumeShader.Link();
+				mVolumeShader.Active();
+				mVolumeShader.SetValue("gDepth", 0);
+				mVolumeShader.SetValue("gNormal", 1);
+				mVolumeShader.SetValue("gAlbedoSpec", 2);
+				mLights.AttachTexture(mVolumeShader, 3);
+				mShader.Active();
+			}
+
+			// Init Light. More lights get proportionally shorter ranges so the scene stays as bright as with 32;
+			// dividing linear by the range and quadratic by its square scales every radius by the range.
+			const GLfloat linear = 0.7 / LIGHT_RANGE;
+			const GLfloat quadratic = 1.8 * std::max(NUM_LIGHTS / 32.0, 1.0) / (LIGHT_RANGE * LIGHT_RANGE);
+			std::vector<PointLight> lights(NUM_LIGHTS);
 
 			srand(13);
-			for (auto& light : Lights)
+			for (auto& light : lights)
 			{
 				// Cal slightly ramdom offsets
 				GLfloat x = ((rand() % 100) / 100.0) * 6.0 - 3.0;
@@ -183,53 +288,89 @@ namespace gl
 				GLfloat r = ((rand() % 100) / 200.0) + 0.5;
 				GLfloat g = ((rand() % 100) / 200.0) + 0.5;
 				GLfloat b = ((rand() % 100) / 200.0) + 0.5;
-				light = std::make_pair<glm::vec3, glm::vec3>(glm::vec3(x, y, z), glm::vec3(r, g, b));
+				light = PointLight(glm::vec3(x, y, z), glm::vec3(r, g, b), linear, quadratic);
+			}
+			mLights.Set(lights);
+			mClusters.Init(Z_NEAR, Z_FAR);
+			mLights.AttachTexture(mShader, 3);
+			if (LIGHTING_MODE == LightingMode::Volumes)
+			{
+				mShader.SetValue("uLightCount", 0);
 			}
 		}
 
-		virtual void Update() override
+		virtual void Update(const SContext& context, const STime& time) override
 		{
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 			auto& camera = Controller::Instance()->GetCamera();
 
+			// Positions come back from depth through the inverse of the geometry pass's view-projection
+			glm::mat4 view = camera.GetViewMatrix();
+			glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, Z_NEAR, Z_FAR);
+			glm::mat4 invViewProjection = glm::inverse(projection * view);
+
 			mShader.Active();
 			mShader.SetValue("viewPos", camera.Position);
-			glActiveTexture(GL_TEXTURE0);
-			glBindTexture(GL_TEXTURE_2D, gPos);
-			glActiveTexture(GL_TEXTURE1);
-			glBindTexture(GL_TEXTURE_2D, gNormal);
-			glActiveTexture(GL_TEXTURE2);
-			glBindTexture(GL_TEXTURE_2D, gAlbedoSpec);
-
-			// Set lights
-			for (GLuint i = 0; i < Lights.size(); ++i)
+			mShader.SetMatrix("uInvViewProjection", invViewProjection);
+			GLState::Instance()->BindTexture(0, GL_TEXTURE_2D, gDepth);
+			GLState::Instance()->BindTexture(1, GL_TEXTURE_2D, gNormal);
+			GLState::Instance()->BindTexture(2, GL_TEXTURE_2D, gAlbedoSpec);
+
+			// Only lights that changed are uploaded, here none after the first frame; the clustered path also needs
+			// this frame's light lists
+			mLights.Upload();
+			mLights.BindTexture(3);
+			if (LIGHTING_MODE == LightingMode::Clustered)
 			{
-				mShader.SetValue(("lights[" + std::to_string(i) + "].Position").c_str(), Lights[i].first);
-				mShader.SetValue(("lights[" + std::to_string(i) + "].Color").c_str(), Lights[i].second);
-
-				const GLfloat constant = 1.0; // Note that we don't send this to the shader, we assume it is always 1.0 (in our case)
-				const GLfloat linear = 0.7;
-				const GLfloat quadratic = 1.8;
-				mShader.SetValue(("lights[" + std::to_string(i) + "].Linear").c_str(), linear);
-				mShader.SetValue(("lights[" + std::to_string(i) + "].Quadratic").c_str(), quadratic);
+				mClusters.Update(view, projection, mLights);
+				mClusters.Bind(mShader, 4, SCR_WIDTH, SCR_HEIGHT);
+				mShader.SetMatrix("view", &view[0][0]);
 			}
 
-			glBindVertexArray(mQuadVao);
+			GLState::Instance()->BindVertexArray(mQuadVao);
 			glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-			glBindVertexArray(0);
 
-			glBindFramebuffer(GL_READ_FRAMEBUFFER, gBuffer);
-			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0); // Write to default framebuffer
+			GLState::Instance()->BindFramebuffer(GL_READ_FRAMEBUFFER, gBuffer);
+			GLState::Instance()->BindFramebuffer(GL_DRAW_FRAMEBUFFER, 0); // Write to default framebuffer
 			glBlitFramebuffer(0, 0, SCR_WIDTH, SCR_HEIGHT, 0, 0, SCR_WIDTH, SCR_HEIGHT, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
+
+			if (LIGHTING_MODE == LightingMode::Volumes)
+			{
+				_DrawLightVolumes(view, projection, camera.Position);
+			}
 		}
 
 	private:
+		// One instanced draw of every light's sphere against the blitted scene depth. Only the far half is
+		// rasterised (the registry sphere winds clockwise seen from outside, so culling back faces keeps it), and
+		// a pixel is lit where the scene lies in front of it. Depth clamping keeps spheres reaching past the far
+		// plane, and the camera can be inside a sphere. Pixels in front of a sphere still run its shader, where
+		// the attenuation leaves less than 5/256 of the light.
+		void _DrawLightVolumes(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& viewPos)
+		{
+			mVolumeShader.Active();
+			mVolumeShader.SetMatrix("view", &view[0][0]);
+			mVolumeShader.SetMatrix("projection", &projection[0][0]);
+			mVolumeShader.SetMatrix("uInvViewProjection", glm::inverse(projection * view));
+			mVolumeShader.SetValue("viewPos", viewPos);
+			glUniform2f(glGetUniformLocation(mVolumeShader.program(), "uScreenSize"), (float)SCR_WIDTH, (float)SCR_HEIGHT);
+
+			GLState::Instance()->SetPipeline(PipelineState::Additive().WithDepthTest(true, GL_GREATER).WithCull(true, GL_BACK));
+			glEnable(GL_DEPTH_CLAMP);
+			mLightVolume.DrawInstanced(static_cast<GLsizei>(NUM_LIGHTS));
+			glDisable(GL_DEPTH_CLAMP);
+			GLState::Instance()->SetPipeline(PipelineState::Opaque());
+		}
+
 		GLuint mQuadVao;
 		Shader mShader;
+		Shader mVolumeShader;
+		Sphere mLightVolume;
 
-		std::vector<std::pair<glm::vec3, glm::vec3>> Lights;
+		LightBuffer	  mLights;
+		LightClusters mClusters;
 	};
 }
 
@@ -237,7 +378,7 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
 	// make sure the viewport matches the new window dimensions; note that width and 
 	// height will be significantly larger than specified on retina displays.
-	glViewport(0, 0, width, height);
+	gl::GLState::Instance()->SetViewport(0, 0, width, height);
 }
 
 void mouse_callback(GLFWwindow* window, double xpos, double ypos)
@@ -247,6 +388,25 @@ void mouse_callback(GLFWwindow* window, double xpos, double ypos)
 
 int main()
 {
+	if (const char* lights = std::getenv("DEFERRED_LIGHTS"))
+	{
+		// Light indices are 16 bit
+		NUM_LIGHTS = std::min(std::max(std::atoi(lights), 1), 0xFFFF);
+	}
+	if (const char* mode = std::getenv("DEFERRED_LIGHTING"))
+	{
+		LIGHTING_MODE = std::string(mode) == "fullscreen" ? LightingMode::FullScreen :
+						std::string(mode) == "volumes"	  ? LightingMode::Volumes : LightingMode::Clustered;
+	}
+	if (const char* range = std::getenv("DEFERRED_LIGHT_RANGE"))
+	{
+		LIGHT_RANGE = std::max(static_cast<GLfloat>(std::atof(range)), 0.01f);
+	}
+	if (const char* culling = std::getenv("DEFERRED_CULLING"))
+	{
+		CULLING_MODE = std::string(culling) == "cpu" ? CullingMode::CPU : CullingMode::HiZ;
+	}
+
 	gl::Engine engine;
 	engine.Init(SCR_WIDTH, SCR_HEIGHT);
 	engine.SetFrameBufferSizeCallback(framebuffer_size_callback);
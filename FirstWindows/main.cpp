@@ -27,7 +27,7 @@ namespace gl
 		};
 
 		glGenVertexArrays(1, &mVao);
-		glBindVertexArray(mVao);
+		GLState::Instance()->BindVertexArray(mVao);
 		{
 			glGenBuffers(1, &mVbo);
 			glBindBuffer(GL_ARRAY_BUFFER, mVbo);
@@ -36,7 +36,7 @@ namespace gl
 			glEnableVertexAttribArray(0);
 			glBindBuffer(GL_ARRAY_BUFFER, 0);
 		}
-		glBindVertexArray(0);
+		GLState::Instance()->BindVertexArray(0);
 
 		mShader.AttachShader(GL_VERTEX_SHADER, "Shader/triangle_vs.glsl");
 		mShader.AttachShader(GL_FRAGMENT_SHADER, "Shader/triangle_fs.glsl");
@@ -46,7 +46,7 @@ namespace gl
 	void DrawTriangle::Update()
 	{
 		mShader.Active();
-		glBindVertexArray(mVao);
+		GLState::Instance()->BindVertexArray(mVao);
 		glDrawArrays(GL_TRIANGLES, 0, 3);
 	}
 }
@@ -57,7 +57,7 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
 	// make sure the viewport matches the new window dimensions; note that width and 
 	// height will be significantly larger than specified on retina displays.
-	glViewport(0, 0, width, height);
+	gl::GLState::Instance()->SetViewport(0, 0, width, height);
 }
 
 int main()
@@ -3,6 +3,7 @@
 #include "common.hpp"
 #include "common_mesh.hpp"
 #include "controller.hpp"
+#include "light_buffer.hpp"
 
 namespace gl
 {
@@ -15,22 +16,14 @@ namespace gl
 
 		}
 
-		struct LightInfo
-		{
-			glm::vec3 pos;
-			glm::vec3 color;
-
-			LightInfo(const glm::vec3& pos, const glm::vec3& color) : pos(pos), color(color) {}
-		};
-
 		virtual void Init(const SContext& context) override
 		{
 			// ֡ɫʽʾΪGL_RGB16FGL_RGBA16FGL_RGB32FGL_RGBA32FĬΪRGB8λ
 			glGenFramebuffers(1, &mHDRFrameBuffer);
-			glBindFramebuffer(GL_FRAMEBUFFER, mHDRFrameBuffer);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, mHDRFrameBuffer);
 			{
 				glGenTextures(1, &mFloatColorBuffer);
-				glBindTexture(GL_TEXTURE_2D, mFloatColorBuffer);
+				GLState::Instance()->BindTexture(GL_TEXTURE_2D, mFloatColorBuffer);
 				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, context.width, context.height, 0, GL_RGBA, GL_FLOAT, NULL);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -46,13 +39,15 @@ namespace gl
 					std::cout << "Framebuffer not complete!" << std::endl;
 				}
 			}
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 			// Init Light infos
-			mLightInfos.push_back(LightInfo(glm::vec3(0.0f, 0.0f, -49.5f), glm::vec3(200.0f, 200.0f, 200.0f)));
-			mLightInfos.push_back(LightInfo(glm::vec3(-1.4f, -1.9f, -9.0f), glm::vec3(0.1f, 0.0f, 0.0f)));
-			mLightInfos.push_back(LightInfo(glm::vec3(0.0f, -1.8f, -4.0f), glm::vec3(0.0f, 0.0f, 0.2f)));
-			mLightInfos.push_back(LightInfo(glm::vec3(0.8f, -1.7f, -6.0f), glm::vec3(0.0f, 0.1f, 0.0f)));
+			mLights.Set({
+				PointLight(glm::vec3(0.0f, 0.0f, -49.5f), glm::vec3(200.0f, 200.0f, 200.0f)),
+				PointLight(glm::vec3(-1.4f, -1.9f, -9.0f), glm::vec3(0.1f, 0.0f, 0.0f)),
+				PointLight(glm::vec3(0.0f, -1.8f, -4.0f), glm::vec3(0.0f, 0.0f, 0.2f)),
+				PointLight(glm::vec3(0.8f, -1.7f, -6.0f), glm::vec3(0.0f, 0.1f, 0.0f)),
+			});
 
 			// Init Tex
 			mWoodTex = LoadTexture("../Resource/Texture/wood.png");
@@ -63,6 +58,7 @@ namespace gl
 			mShaderLighting.Link();
 			mShaderLighting.Active();
 			mShaderLighting.SetValue("diffuseTexture", 0);
+			mLights.AttachUniformBlock(mShaderLighting);
 
 			mShaderToneMapping.AttachShader(GL_VERTEX_SHADER, "Shaders/tone_mapping_vs.glsl");
 			mShaderToneMapping.AttachShader(GL_FRAGMENT_SHADER, "Shaders/tone_mapping_fs.glsl");
@@ -79,16 +75,13 @@ namespace gl
 			auto& camera = Controller::Instance()->GetCamera();
 
 			// 1. Render scene into floating point framebuffer
-			glBindFramebuffer(GL_FRAMEBUFFER, mHDRFrameBuffer);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, mHDRFrameBuffer);
 			{
 				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 				mShaderLighting.Active();
 				{
-					for (GLuint i = 0; i < mLightInfos.size(); ++i)
-					{
-						mShaderLighting.SetValue(("lights[" + std::to_string(i) + "].Position").c_str(), mLightInfos[i].pos);
-						mShaderLighting.SetValue(("lights[" + std::to_string(i) + "].Color").c_str(), mLightInfos[i].color);
-					}
+					mLights.Upload();
+					mLights.BindUniformBlock();
 					mShaderLighting.SetValue("viewPos", camera.Position);
 
 					glm::mat4 model = glm::mat4(1.f);
@@ -100,20 +93,18 @@ namespace gl
 					mShaderLighting.SetMatrix("view", &view[0][0]);
 					mShaderLighting.SetMatrix("projection", &projection[0][0]);
 
-					glActiveTexture(GL_TEXTURE0);
-					glBindTexture(GL_TEXTURE_2D, mWoodTex);
+					GLState::Instance()->BindTexture(0, GL_TEXTURE_2D, mWoodTex);
 
 					mTunnel.Draw();
 				}
 			}
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 			// 2. Now render floating point color buffer to 2D quad and tonemap HDR colors to default framebuffer's (clamped) color range
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 			mShaderToneMapping.Active();
 			{
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, mFloatColorBuffer);
+				GLState::Instance()->BindTexture(0, GL_TEXTURE_2D, mFloatColorBuffer);
 				mShaderToneMapping.SetValue("hdr", mHDR);
 				mShaderToneMapping.SetValue("exposure", mExposure);
 				mQuad.Draw();
@@ -132,7 +123,7 @@ namespace gl
 		GLboolean	mHDR;
 		GLfloat		mExposure;
 
-		std::vector<LightInfo> mLightInfos;
+		LightBuffer	mLights;
 	};
 }
 
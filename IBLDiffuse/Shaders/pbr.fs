@@ -13,6 +13,12 @@ uniform float uRoughness;
 
 // IBL
 uniform samplerCube uIrradianceMap;
+// diffuse IBL from the irradiance cubemap, or with uIrradianceSH from SH coefficients
+uniform bool uIrradianceSH;
+layout (std140) uniform SHBlock
+{
+    vec4 uSH[9];
+};
 
 // lights
 uniform vec3 uLightPos[4];
@@ -24,6 +30,21 @@ uniform vec3 uCamPos;
 const float PI = 3.14159265359;
 const float EPSINON = 0.0000001;
 
+// nine SH coefficients from gl::SHIrradiance, already convolved: the sum is irradiance / PI like the cubemap's
+vec3 IrradianceSH(vec3 n)
+{
+    n = normalize(n);
+    return uSH[0].rgb * 0.282095
+         + uSH[1].rgb * (0.488603 * n.y)
+         + uSH[2].rgb * (0.488603 * n.z)
+         + uSH[3].rgb * (0.488603 * n.x)
+         + uSH[4].rgb * (1.092548 * n.x * n.y)
+         + uSH[5].rgb * (1.092548 * n.y * n.z)
+         + uSH[6].rgb * (0.315392 * (3.0 * n.z * n.z - 1.0))
+         + uSH[7].rgb * (1.092548 * n.x * n.z)
+         + uSH[8].rgb * (0.546274 * (n.x * n.x - n.y * n.y));
+}
+
 // NDF, Normal Distribution Function：粗糙度越大，微平面取向越随机，集中性（高亮）降低，最终效果越发灰暗
 float DistributionGGX(float NoH, float roughness) 
 {
@@ -115,7 +136,8 @@ void main()
     // ambient lighting (we now use IBL as the ambient term)
     vec3 kS = FresnelSchlick(max(dot(N, V), 0.0), F0);
     vec3 kD = (1.0 - kS) * (1.0 - metallic);
-    vec3 diffuse = texture(uIrradianceMap, N).rgb * albedo * kD;
+    vec3 irradiance = uIrradianceSH ? IrradianceSH(N) : texture(uIrradianceMap, N).rgb;
+    vec3 diffuse = irradiance * albedo * kD;
     vec3 ambient = diffuse * ao;
     
     // without irradiancemap
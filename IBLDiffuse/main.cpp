@@ -4,10 +4,20 @@
 #include "common.hpp"
 #include "controller.hpp"
 #include "common_mesh.hpp"
+#include "spherical_harmonics.hpp"
 #include <stb_image_write.h>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <iostream>
+#include <cstdlib>
+#include <string>
 
+// IBL_IRRADIANCE picks where diffuse environment lighting comes from: "sh" (default) projects the environment
+// onto nine SH coefficients on the GPU, "sh_cpu" does so on the CPU and "cubemap" convolves an irradiance
+// cubemap. IBL_SH_CHECK=1 convolves the cubemap as well and prints how far the SH irradiance is from it.
+enum class IrradianceMode { SH, SHCPU, Cubemap };
+IrradianceMode IRRADIANCE_MODE = IrradianceMode::SH;
+bool SH_CHECK = false;
 
 namespace gl
 {
@@ -22,9 +32,8 @@ namespace gl
 		virtual void Init(const SContext& context) override
 		{
 			// Configure global OpenGL state
-			glEnable(GL_DEPTH_TEST);
-			// Set depth function to less than AND equal for skybox depth trick.
-			glDepthFunc(GL_LEQUAL); 
+			// Depth function less than AND equal for skybox depth trick.
+			GLState::Instance()->SetPipeline(PipelineState::Opaque().WithDepthTest(true, GL_LEQUAL));
 
 			// Init shader
 			mPbrShader.AttachVertexShader("Shaders/pbr.vs");
@@ -58,7 +67,27 @@ namespace gl
 				glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f,  0.0f, -1.0f), glm::vec3(0.0f, -1.0f,  0.0f))
 			};
 			mEnvCubeMap	= _EquirectangularToCubemap(captureViews, captureProjection, fbo);
-			mIrradianceMap = _CubemapToIrradiancemap(captureViews, captureProjection, fbo);
+			// Diffuse irradiance: the convolution renders 32x32x6 texels of ~15k samples each, the SH projection
+			// sums the environment once
+			mIrradianceMap = IRRADIANCE_MODE == IrradianceMode::Cubemap || SH_CHECK ? _CubemapToIrradiancemap(captureViews, captureProjection, fbo) : 0;
+			mIrradiance.Init();
+			if (IRRADIANCE_MODE == IrradianceMode::SHCPU)
+			{
+				mIrradiance.Project(mEnvCubeMap, mEnvCubeMapSize);
+			}
+			else if (IRRADIANCE_MODE == IrradianceMode::SH)
+			{
+				mIrradiance.ProjectOnGPU(mEnvCubeMap, mEnvCubeMapSize);
+			}
+			if (SH_CHECK && IRRADIANCE_MODE != IrradianceMode::Cubemap)
+			{
+				GLfloat meanError, maxError;
+				SHIrradiance::Compare(mIrradiance.Read(), mIrradianceMap, mIrradianceMapSize, meanError, maxError);
+				std::cout << "SH irradiance vs convolution: mean error " << meanError * 100.f << "%, max " << maxError * 100.f << "%" << std::endl;
+			}
+			mPbrShader.Active();
+			mPbrShader.SetValue("uIrradianceSH", IRRADIANCE_MODE != IrradianceMode::Cubemap);
+			mIrradiance.AttachUniformBlock(mPbrShader);
 
 			// Set light attributes
 			mLightPos.push_back(glm::vec3(-10.0f, 10.0f, 10.0f));
@@ -73,12 +102,12 @@ namespace gl
 			Controller::Instance()->ResetCamera(glm::vec3(0.f, 0.f, 15.f), glm::vec3(0.f, 1.f, 0.f));
 
 			// Ⱦ֮ǰԭڵĳߴ
-			glViewport(0, 0, context.width, context.height);
+			GLState::Instance()->SetViewport(0, 0, context.width, context.height);
 		}
 
 		virtual void Update(const SContext& context, const STime& time) override
 		{
-			glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+			GLState::Instance()->SetClearColor(0.1f, 0.1f, 0.1f, 1.0f);
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 			auto& camera = Controller::Instance()->GetCamera();
@@ -95,8 +124,14 @@ namespace gl
 				mPbrShader.SetMatrix("uProjection", projMat);
 
 				// bind pre-computed IBL data
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, mIrradianceMap);
+				if (IRRADIANCE_MODE == IrradianceMode::Cubemap)
+				{
+					GLState::Instance()->BindTexture(0, GL_TEXTURE_CUBE_MAP, mIrradianceMap);
+				}
+				else
+				{
+					mIrradiance.BindUniformBlock();
+				}
 
 				// render rows*column number of spheres with varying metallic/roughness values scaled by rows and columns respectively
 				for (int row = 0; row < mRows; ++row)
@@ -142,8 +177,7 @@ namespace gl
 				mBackgroundShader.Active();
 				mBackgroundShader.SetMatrix("view", viewMat);
 				mBackgroundShader.SetMatrix("projection", projMat);
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, mEnvCubeMap);
+				GLState::Instance()->BindTexture(0, GL_TEXTURE_CUBE_MAP, mEnvCubeMap);
 				mCube.Draw();
 			}
 		}
@@ -153,7 +187,7 @@ namespace gl
 		{
 			GLuint mEmptyCubeMap;
 			glGenTextures(1, &mEmptyCubeMap);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, mEmptyCubeMap);
+			GLState::Instance()->BindTexture(GL_TEXTURE_CUBE_MAP, mEmptyCubeMap);
 			for (unsigned int i = 0; i < 6; ++i)
 			{
 				// Ϊ
@@ -180,12 +214,11 @@ namespace gl
 				equirectangularToCubemapShader.SetMatrix("projection", proj);
 
 				auto hdr = LoadTextureHDR("../Resource/HDR/Newport_Loft_Ref.hdr");
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, hdr);
+				GLState::Instance()->BindTexture(0, GL_TEXTURE_2D, hdr);
 
 				// Don't forget to configure the viewport to the capture dimensions.
-				glViewport(0, 0, mEnvCubeMapSize, mEnvCubeMapSize);
-				glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+				GLState::Instance()->SetViewport(0, 0, mEnvCubeMapSize, mEnvCubeMapSize);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, fbo);
 				glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mEnvCubeMapSize, mEnvCubeMapSize);
 				for (unsigned int i = 0; i < cubeViews.size(); ++i)
 				{
@@ -194,7 +227,7 @@ namespace gl
 					glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 					mCube.Draw();
 				}
-				glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 				assert(cubeMap > 0);
 			}
@@ -213,11 +246,10 @@ namespace gl
 				irradianceShader.SetValue("environmentMap", 0);
 				irradianceShader.SetMatrix("projection", proj);
 
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, mEnvCubeMap);
+				GLState::Instance()->BindTexture(0, GL_TEXTURE_CUBE_MAP, mEnvCubeMap);
 
-				glViewport(0, 0, mIrradianceMapSize, mIrradianceMapSize);
-				glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+				GLState::Instance()->SetViewport(0, 0, mIrradianceMapSize, mIrradianceMapSize);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, fbo);
 				glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mIrradianceMapSize, mIrradianceMapSize);
 				for (unsigned int i = 0; i < cubeViews.size(); ++i)
 				{
@@ -227,7 +259,7 @@ namespace gl
 
 					mCube.Draw();
 				}
-				glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 				assert(irradianceMap > 0);
 			}
@@ -236,6 +268,7 @@ namespace gl
 
 		GLuint	mEnvCubeMap;
 		GLuint	mIrradianceMap;
+		SHIrradiance mIrradiance;
 
 		GLuint	mEnvCubeMapSize;
 		GLuint	mIrradianceMapSize;
@@ -260,7 +293,7 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
 	// make sure the viewport matches the new window dimensions; note that width and 
 	// height will be significantly larger than specified on retina displays.
-	glViewport(0, 0, width, height);
+	gl::GLState::Instance()->SetViewport(0, 0, width, height);
 }
 
 void mouse_callback(GLFWwindow* window, double xpos, double ypos)
@@ -270,6 +303,16 @@ void mouse_callback(GLFWwindow* window, double xpos, double ypos)
 
 int main()
 {
+	if (const char* mode = std::getenv("IBL_IRRADIANCE"))
+	{
+		IRRADIANCE_MODE = std::string(mode) == "cubemap" ? IrradianceMode::Cubemap :
+						  std::string(mode) == "sh_cpu"	 ? IrradianceMode::SHCPU : IrradianceMode::SH;
+	}
+	if (const char* check = std::getenv("IBL_SH_CHECK"))
+	{
+		SH_CHECK = std::string(check) != "0";
+	}
+
 	gl::Engine engine;
 	engine.Init(1280, 720);
 	engine.SetFrameBufferSizeCallback(framebuffer_size_callback);
@@ -0,0 +1,6 @@
+#version 330 core
+
+// Depth pre-pass: pbr.vs places the spheres, nothing is shaded
+void main()
+{
+}
\ No newline at end of file
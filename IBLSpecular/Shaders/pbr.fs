@@ -4,25 +4,56 @@ in vec2 TexCoords;
 in vec3 WorldPos;
 in vec3 Normal;
 
-// material parameters
+// material parameters, metallic/roughness come per instance
 uniform vec3 albedo;
-uniform float metallic;
-uniform float roughness;
+flat in float metallic;
+flat in float roughness;
 uniform float ao;
 
 // IBL
 uniform samplerCube irradianceMap;
+// diffuse IBL from the irradiance cubemap, or with uIrradianceSH from SH coefficients
+uniform bool uIrradianceSH;
+layout (std140) uniform SHBlock
+{
+    vec4 uSH[9];
+};
 uniform samplerCube prefilterMap;
 uniform sampler2D brdfLUT;
 
-// lights
-uniform vec3 lightPositions[4];
-uniform vec3 lightColors[4];
+// lights: gl::LightBuffer's lights at texels 2i and 2i + 1 of uLightData, read through gl::LightClusters'
+// (offset, count) per cluster into the light index lists, so a fragment loops over the lights of its cluster only
+uniform samplerBuffer uLightData;
+uniform usamplerBuffer uClusterGrid;
+uniform usamplerBuffer uLightIndices;
+uniform vec2 uTileSize;
+uniform float uSliceScale;
+uniform float uSliceBias;
+
+const int TILES_X = 16;
+const int TILES_Y = 9;
+const int SLICES = 24;
 
 uniform vec3 camPos;
+uniform mat4 view;
 
 const float PI = 3.14159265359;
 // ----------------------------------------------------------------------------
+// nine SH coefficients from gl::SHIrradiance, already convolved: the sum is irradiance / PI like the cubemap's
+vec3 IrradianceSH(vec3 n)
+{
+    n = normalize(n);
+    return uSH[0].rgb * 0.282095
+         + uSH[1].rgb * (0.488603 * n.y)
+         + uSH[2].rgb * (0.488603 * n.z)
+         + uSH[3].rgb * (0.488603 * n.x)
+         + uSH[4].rgb * (1.092548 * n.x * n.y)
+         + uSH[5].rgb * (1.092548 * n.y * n.z)
+         + uSH[6].rgb * (0.315392 * (3.0 * n.z * n.z - 1.0))
+         + uSH[7].rgb * (1.092548 * n.x * n.z)
+         + uSH[8].rgb * (0.546274 * (n.x * n.x - n.y * n.y));
+}
+// ----------------------------------------------------------------------------
 float DistributionGGX(vec3 N, vec3 H, float roughness)
 {
     float a = roughness*roughness;
@@ -80,15 +111,24 @@ void main()
     F0 = mix(F0, albedo, metallic);
 
     // reflectance equation
+    float depth = -(view * vec4(WorldPos, 1.0)).z;
+    ivec2 tile = min(ivec2(gl_FragCoord.xy / uTileSize), ivec2(TILES_X - 1, TILES_Y - 1));
+    int slice = clamp(int(floor(log(depth) * uSliceScale + uSliceBias)), 0, SLICES - 1);
+    uvec2 cluster = texelFetch(uClusterGrid, tile.x + TILES_X * (tile.y + TILES_Y * slice)).xy;
+
     vec3 Lo = vec3(0.0);
-    for(int i = 0; i < 4; ++i) 
+    for(uint i = 0u; i < cluster.y; ++i) 
     {
+        int light = int(texelFetch(uLightIndices, int(cluster.x + i)).r);
+        vec3 lightPosition = texelFetch(uLightData, 2 * light).xyz;
+        vec3 lightColor = texelFetch(uLightData, 2 * light + 1).rgb;
+
         // calculate per-light radiance
-        vec3 L = normalize(lightPositions[i] - WorldPos);
+        vec3 L = normalize(lightPosition - WorldPos);
         vec3 H = normalize(V + L);
-        float distance = length(lightPositions[i] - WorldPos);
+        float distance = length(lightPosition - WorldPos);
         float attenuation = 1.0 / (distance * distance);
-        vec3 radiance = lightColors[i] * attenuation;
+        vec3 radiance = lightColor * attenuation;
 
         // Cook-Torrance BRDF
         float NDF = DistributionGGX(N, H, roughness);   
@@ -124,7 +164,7 @@ void main()
     vec3 kD = 1.0 - kS;
     kD *= 1.0 - metallic;	  
     
-    vec3 irradiance = texture(irradianceMap, N).rgb;
+    vec3 irradiance = uIrradianceSH ? IrradianceSH(N) : texture(irradianceMap, N).rgb;
     vec3 diffuse      = irradiance * albedo;
     
     // sample both the pre-filter map and the BRDF lut and combine them together as per the Split-Sum approximation to get the IBL specular part.
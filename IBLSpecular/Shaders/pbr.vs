@@ -2,20 +2,28 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec2 aTexCoords;
 layout (location = 2) in vec3 aNormal;
+layout (location = 5) in mat4 aInstanceModel;
+layout (location = 9) in vec4 aInstanceParams; // x: metallic, y: roughness
 
 out vec2 TexCoords;
 out vec3 WorldPos;
 out vec3 Normal;
+flat out float metallic;
+flat out float roughness;
 
 uniform mat4 projection;
 uniform mat4 view;
-uniform mat4 model;
+
+// the depth pre-pass and the shading pass must agree on depth to the bit
+invariant gl_Position;
 
 void main()
 {
     TexCoords = aTexCoords;
-    WorldPos = vec3(model * vec4(aPos, 1.0));
-    Normal = mat3(model) * aNormal;   
+    WorldPos = vec3(aInstanceModel * vec4(aPos, 1.0));
+    Normal = mat3(aInstanceModel) * aNormal;
+    metallic = aInstanceParams.x;
+    roughness = aInstanceParams.y;
 
     gl_Position =  projection * view * vec4(WorldPos, 1.0);
 }
\ No newline at end of file
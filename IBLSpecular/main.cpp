@@ -4,10 +4,36 @@
 #include "common.hpp"
 #include "controller.hpp"
 #include "common_mesh.hpp"
+#include "light_buffer.hpp"
+#include "light_clusters.hpp"
+#include "spherical_harmonics.hpp"
+#include "ibl_cache.hpp"
 #include <stb_image_write.h>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
-
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <chrono>
+
+// IBL_IRRADIANCE picks where diffuse environment lighting comes from: "sh" (default) projects the environment
+// onto nine SH coefficients on the GPU, "sh_cpu" does so on the CPU and "cubemap" convolves an irradiance
+// cubemap. IBL_SH_CHECK=1 convolves the cubemap as well and prints how far the SH irradiance is from it; run it
+// twice to check the warm start too, whose environment map comes from the cache clamped to its one level.
+enum class IrradianceMode { SH, SHCPU, Cubemap };
+IrradianceMode IRRADIANCE_MODE = IrradianceMode::SH;
+bool SH_CHECK = false;
+// IBL_CACHE=0 renders every precomputed map at startup instead of loading the ones IBL_CACHE_PATH holds
+bool IBL_CACHE = true;
+const char* const IBL_CACHE_PATH = "IBLSpecular.iblcache";
+
+const char* const HDR_PATH		  = "../Resource/HDR/Newport_Loft_Ref.hdr";
+const GLuint	  PREFILTER_SIZE  = 128;
+const GLuint	  PREFILTER_MIPS  = 5;
+const GLuint	  BRDF_LUT_SIZE	  = 512;
+
+const GLfloat Z_NEAR = 0.1f;
+const GLfloat Z_FAR = 100.0f;
 
 namespace gl
 {
@@ -22,9 +48,8 @@ namespace gl
 		virtual void Init(const SContext& context) override
 		{
 			// Configure global OpenGL state
-			glEnable(GL_DEPTH_TEST);
-			// Set depth function to less than AND equal for skybox depth trick.
-			glDepthFunc(GL_LEQUAL);
+			// Depth function less than AND equal for skybox depth trick.
+			GLState::Instance()->SetPipeline(PipelineState::Opaque().WithDepthTest(true, GL_LEQUAL));
 			// enable seamless cubemap sampling for lower mip levels in the pre-filter map.
 			glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 
@@ -39,6 +64,11 @@ namespace gl
 			mPbrShader.SetValue("albedo", glm::vec3(0.5f, 0.0f, 0.0f));
 			mPbrShader.SetValue("ao", 1.0f);
 
+			// Depth pre-pass with the same vertex shader, so shading can test for GL_EQUAL
+			mDepthShader.AttachVertexShader("Shaders/pbr.vs");
+			mDepthShader.AttachFragmentShader("Shaders/depth.fs");
+			mDepthShader.Link();
+
 			mBackgroundShader.AttachShader(GL_VERTEX_SHADER, "Shaders/background.vs");
 			mBackgroundShader.AttachShader(GL_FRAGMENT_SHADER, "Shaders/background.fs");
 			mBackgroundShader.Link();
@@ -66,91 +96,189 @@ namespace gl
 				glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f,  0.0f, -1.0f), glm::vec3(0.0f, -1.0f,  0.0f))
 			};
 
-			// Preprocess
-			mEnvCubeMap		= _EquirectangularToCubemap(captureViews, captureProjection, fbo);
-			mIrradianceMap	= _CubemapToIrradianceMap(captureViews, captureProjection, fbo, rbo, mEnvCubeMap);
-			mPrefilterMap	= _CubemapToPrefilterMap(captureViews, captureProjection, fbo, rbo, mEnvCubeMap);
-			mBRDFLutMap		= _GenBRDFLUT(fbo, rbo);
-
-			// Set light attributes
-			mLightPos.push_back(glm::vec3(-10.0f, 10.0f, 10.0f));
-			mLightPos.push_back(glm::vec3(10.0f, 10.0f, 10.0f));
-			mLightPos.push_back(glm::vec3(-10.0f, -10.0f, 10.0f));
-			mLightPos.push_back(glm::vec3(10.0f, -10.0f, 10.0f));
-			mLightColor.push_back(glm::vec3(300.0f, 300.0f, 300.0f));
-			mLightColor.push_back(glm::vec3(300.0f, 300.0f, 300.0f));
-			mLightColor.push_back(glm::vec3(300.0f, 300.0f, 300.0f));
-			mLightColor.push_back(glm::vec3(300.0f, 300.0f, 300.0f));
+			// Preprocess. Each map comes from the cache when it holds one made from the same HDR file, shaders and
+			// sizes; whatever has to be rendered is added to it for the next start. With IBL_CACHE=0 the cache stays
+			// empty and untouched: no hashing of the inputs and no readback of what was rendered.
+			auto start = std::chrono::steady_clock::now();
+			IBLCache cache(IBL_CACHE_PATH);
+			if (IBL_CACHE)
+			{
+				cache.SetKey({ HDR_PATH, "Shaders/cubemap.vs", "Shaders/equirectangular_to_cubemap.fs", "Shaders/irradiance_convolution.fs",
+							   "Shaders/prefilter.fs", "Shaders/brdf.vs", "Shaders/brdf.fs" },
+							 { mEnvCubeMapSize, mIrradianceMapSize, PREFILTER_SIZE, PREFILTER_MIPS, BRDF_LUT_SIZE });
+				cache.Load();
+			}
+
+			const bool warmStart = cache.Has("environment");
+			if (warmStart)
+			{
+				mEnvCubeMap = cache.CreateTexture("environment");
+			}
+			else
+			{
+				mEnvCubeMap = _EquirectangularToCubemap(captureViews, captureProjection, fbo);
+				if (IBL_CACHE)
+				{
+					cache.Add("environment", GL_TEXTURE_CUBE_MAP, mEnvCubeMap, 1, GL_RGB16F, GL_RGB, GL_HALF_FLOAT);
+				}
+			}
+			if (cache.Has("prefilter"))
+			{
+				mPrefilterMap = cache.CreateTexture("prefilter");
+			}
+			else
+			{
+				mPrefilterMap = _CubemapToPrefilterMap(captureViews, captureProjection, fbo, rbo, mEnvCubeMap);
+				if (IBL_CACHE)
+				{
+					cache.Add("prefilter", GL_TEXTURE_CUBE_MAP, mPrefilterMap, PREFILTER_MIPS, GL_RGB16F, GL_RGB, GL_HALF_FLOAT);
+				}
+			}
+			if (cache.Has("brdf"))
+			{
+				mBRDFLutMap = cache.CreateTexture("brdf");
+			}
+			else
+			{
+				mBRDFLutMap = _GenBRDFLUT(fbo, rbo);
+				if (IBL_CACHE)
+				{
+					cache.Add("brdf", GL_TEXTURE_2D, mBRDFLutMap, 1, GL_RG16F, GL_RG, GL_HALF_FLOAT);
+				}
+			}
+
+			// Diffuse irradiance: the convolution renders 32x32x6 texels of ~15k samples each, the SH projection
+			// sums the environment once
+			mIrradianceMap = 0;
+			if (IRRADIANCE_MODE == IrradianceMode::Cubemap || SH_CHECK)
+			{
+				if (cache.Has("irradiance"))
+				{
+					mIrradianceMap = cache.CreateTexture("irradiance");
+				}
+				else
+				{
+					mIrradianceMap = _CubemapToIrradianceMap(captureViews, captureProjection, fbo, rbo, mEnvCubeMap);
+					if (IBL_CACHE)
+					{
+						cache.Add("irradiance", GL_TEXTURE_CUBE_MAP, mIrradianceMap, 1, GL_RGB16F, GL_RGB, GL_HALF_FLOAT);
+					}
+				}
+			}
+			mIrradiance.Init();
+			if (IRRADIANCE_MODE == IrradianceMode::SHCPU)
+			{
+				mIrradiance.Project(mEnvCubeMap, mEnvCubeMapSize);
+			}
+			else if (IRRADIANCE_MODE == IrradianceMode::SH)
+			{
+				mIrradiance.ProjectOnGPU(mEnvCubeMap, mEnvCubeMapSize);
+			}
+			if (SH_CHECK && IRRADIANCE_MODE != IrradianceMode::Cubemap)
+			{
+				GLfloat meanError, maxError;
+				SHIrradiance::Compare(mIrradiance.Read(), mIrradianceMap, mIrradianceMapSize, meanError, maxError);
+				std::cout << "SH irradiance vs convolution (" << (warmStart ? "warm" : "cold") << " start): mean error " << meanError * 100.f << "%, max " << maxError * 100.f << "%" << std::endl;
+			}
+			if (IBL_CACHE)
+			{
+				cache.Save();
+			}
+			std::cout << "IBL precompute: " << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() << " ms" << std::endl;
+			mPbrShader.Active();
+			mPbrShader.SetValue("uIrradianceSH", IRRADIANCE_MODE != IrradianceMode::Cubemap);
+			mIrradiance.AttachUniformBlock(mPbrShader);
+
+			// Set light attributes; shaded Forward+, each fragment reading only the lights of its cluster
+			mLights.Set({
+				PointLight(glm::vec3(-10.0f, 10.0f, 10.0f), glm::vec3(300.0f, 300.0f, 300.0f)),
+				PointLight(glm::vec3(10.0f, 10.0f, 10.0f), glm::vec3(300.0f, 300.0f, 300.0f)),
+				PointLight(glm::vec3(-10.0f, -10.0f, 10.0f), glm::vec3(300.0f, 300.0f, 300.0f)),
+				PointLight(glm::vec3(10.0f, -10.0f, 10.0f), glm::vec3(300.0f, 300.0f, 300.0f)),
+			});
+			mPbrShader.Active();
+			mLights.AttachTexture(mPbrShader, 3);
+			mClusters.Init(Z_NEAR, Z_FAR);
+
+			// rows*column spheres with varying metallic/roughness values scaled by rows and columns respectively
+			std::vector<InstanceData> instances;
+			for (int row = 0; row < mRows; ++row)
+			{
+				for (int col = 0; col < mColumns; ++col)
+				{
+					// we clamp the roughness to 0.025 - 1.0 as perfectly smooth surfaces (roughness of 0.0) tend to look a bit off
+					// on direct lighting.
+					glm::vec4 params((float)row / (float)mRows, glm::clamp((float)col / (float)mColumns, 0.05f, 1.0f), 0.0f, 0.0f);
+					glm::mat4 modelMat = glm::translate(glm::mat4(1.0f), glm::vec3(
+						(col - (mColumns / 2)) * mSpacing,
+						(row - (mRows / 2)) * mSpacing,
+						0.0f
+					));
+					instances.push_back(InstanceData(modelMat, params));
+				}
+			}
+			// light sources are simply spheres at the light positions, using the last grid material
+			for (auto& light : mLights.GetLights())
+			{
+				glm::mat4 modelMat = glm::scale(glm::translate(glm::mat4(1.0f), light.position), glm::vec3(0.5f));
+				instances.push_back(InstanceData(modelMat, instances.back().params));
+			}
+			mSphereInstances.Upload(instances);
 
 			Controller::Instance()->ResetCamera(glm::vec3(0.f, 0.f, 15.f), glm::vec3(0.f, 1.f, 0.f));
 
 			// Ⱦ֮ǰԭڵĳߴ
-			glViewport(0, 0, context.width, context.height);
+			GLState::Instance()->SetViewport(0, 0, context.width, context.height);
 		}
 
 		virtual void Update(const SContext& context, const STime& time) override
 		{
-			glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+			GLState::Instance()->SetClearColor(0.1f, 0.1f, 0.1f, 1.0f);
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 			auto& camera = Controller::Instance()->GetCamera();
 
-			glm::mat4 modelMat = glm::mat4(1.0f);
 			glm::mat4 viewMat = camera.GetViewMatrix();
-			glm::mat4 projMat = glm::perspective(glm::radians(camera.Zoom), (float)context.width / (float)context.height, 0.1f, 100.0f);
+			glm::mat4 projMat = glm::perspective(glm::radians(camera.Zoom), (float)context.width / (float)context.height, Z_NEAR, Z_FAR);
+
+			// depth pre-pass, so the PBR shading below runs once per visible pixel
+			{
+				glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+				mDepthShader.Active();
+				mDepthShader.SetMatrix("view", viewMat);
+				mDepthShader.SetMatrix("projection", projMat);
+				mSphere.DrawInstanced(mSphereInstances);
+				glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+			}
 
 			// PBR lighting
 			{
+				GLState::Instance()->SetPipeline(PipelineState::Opaque().WithDepthTest(true, GL_EQUAL).WithDepthWrite(false));
 				mPbrShader.Active();
 				mPbrShader.SetValue("camPos", camera.Position);
 				mPbrShader.SetMatrix("view", viewMat);
 				mPbrShader.SetMatrix("projection", projMat);
 
 				// bind pre-computed IBL data
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, mIrradianceMap);
-				glActiveTexture(GL_TEXTURE1);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, mPrefilterMap);
-				glActiveTexture(GL_TEXTURE2);
-				glBindTexture(GL_TEXTURE_2D, mBRDFLutMap);
-
-				// render rows*column number of spheres with varying metallic/roughness values scaled by rows and columns respectively
-				for (int row = 0; row < mRows; ++row)
+				if (IRRADIANCE_MODE == IrradianceMode::Cubemap)
 				{
-					mPbrShader.SetValue("metallic", (float)row / (float)mRows);
-					for (int col = 0; col < mColumns; ++col)
-					{
-						// we clamp the roughness to 0.025 - 1.0 as perfectly smooth surfaces (roughness of 0.0) tend to look a bit off
-						// on direct lighting.
-						mPbrShader.SetValue("roughness", glm::clamp((float)col / (float)mColumns, 0.05f, 1.0f));
-
-						modelMat = glm::mat4(1.0f);
-						modelMat = glm::translate(modelMat, glm::vec3(
-							(col - (mColumns / 2)) * mSpacing,
-							(row - (mRows / 2)) * mSpacing,
-							0.0f
-						));
-						mPbrShader.SetMatrix("model", modelMat);
-						mSphere.Draw();
-					}
+					GLState::Instance()->BindTexture(0, GL_TEXTURE_CUBE_MAP, mIrradianceMap);
 				}
-
-				// render light source (simply re-render sphere at light positions)
-				// this looks a bit off as we use the same shader, but it'll make their positions obvious and 
-				// keeps the codeprint small.
-				for (unsigned int i = 0; i < mLightPos.size(); ++i)
+				else
 				{
-					glm::vec3 newPos = mLightPos[i] + glm::vec3(sin(glfwGetTime() * 5.0) * 5.0, 0.0, 0.0);
-					newPos = mLightPos[i];
-					mPbrShader.SetValue("lightPositions[" + std::to_string(i) + "]", newPos);
-					mPbrShader.SetValue("lightColors[" + std::to_string(i) + "]", mLightColor[i]);
-
-					modelMat = glm::mat4(1.0f);
-					modelMat = glm::translate(modelMat, newPos);
-					modelMat = glm::scale(modelMat, glm::vec3(0.5f));
-					mPbrShader.SetMatrix("model", modelMat);
-					mSphere.Draw();
+					mIrradiance.BindUniformBlock();
 				}
+				GLState::Instance()->BindTexture(1, GL_TEXTURE_CUBE_MAP, mPrefilterMap);
+				GLState::Instance()->BindTexture(2, GL_TEXTURE_2D, mBRDFLutMap);
+
+				mLights.Upload();
+				mLights.BindTexture(3);
+				mClusters.Update(viewMat, projMat, mLights);
+				mClusters.Bind(mPbrShader, 4, context.width, context.height);
+
+				// the sphere grid and the light spheres in a single instanced call
+				mSphere.DrawInstanced(mSphereInstances);
+				GLState::Instance()->SetPipeline(PipelineState::Opaque().WithDepthTest(true, GL_LEQUAL));
 			}
 
 			// render skybox (render as last to prevent overdraw)
@@ -158,8 +286,7 @@ namespace gl
 				mBackgroundShader.Active();
 				mBackgroundShader.SetMatrix("view", viewMat);
 				mBackgroundShader.SetMatrix("projection", projMat);
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, mPrefilterMap);
+				GLState::Instance()->BindTexture(0, GL_TEXTURE_CUBE_MAP, mPrefilterMap);
 				mCube.Draw();
 			}
 		}
@@ -177,13 +304,12 @@ namespace gl
 				equirectangularToCubemapShader.SetValue("equirectangularMap", 0);
 				equirectangularToCubemapShader.SetMatrix("projection", proj);
 
-				auto hdr = LoadTextureHDR("../Resource/HDR/Newport_Loft_Ref.hdr");
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, hdr);
+				auto hdr = LoadTextureHDR(HDR_PATH);
+				GLState::Instance()->BindTexture(0, GL_TEXTURE_2D, hdr);
 
 				// Don't forget to configure the viewport to the capture dimensions.
-				glViewport(0, 0, mEnvCubeMapSize, mEnvCubeMapSize);
-				glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+				GLState::Instance()->SetViewport(0, 0, mEnvCubeMapSize, mEnvCubeMapSize);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, fbo);
 				glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mEnvCubeMapSize, mEnvCubeMapSize);
 				for (unsigned int i = 0; i < cubeViews.size(); ++i)
 				{
@@ -192,7 +318,7 @@ namespace gl
 					glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 					mCube.Draw();
 				}
-				glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 			}
 			return cubeMap;
 		}
@@ -209,11 +335,10 @@ namespace gl
 				irradianceShader.SetValue("environmentMap", 0);
 				irradianceShader.SetMatrix("projection", proj);
 
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, envMap);
+				GLState::Instance()->BindTexture(0, GL_TEXTURE_CUBE_MAP, envMap);
 
-				glViewport(0, 0, mIrradianceMapSize, mIrradianceMapSize);
-				glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+				GLState::Instance()->SetViewport(0, 0, mIrradianceMapSize, mIrradianceMapSize);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, fbo);
 				glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mIrradianceMapSize, mIrradianceMapSize);
 				for (unsigned int i = 0; i < cubeViews.size(); ++i)
 				{
@@ -223,7 +348,7 @@ namespace gl
 
 					mCube.Draw();
 				}
-				glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 			}
 			return irradianceMap;
 		}
@@ -234,8 +359,7 @@ namespace gl
 			Shader prefilterShader("Shaders/cubemap.vs", "Shaders/prefilter.fs");
 			prefilterShader.Link();
 
-			GLuint prefilterMapSize = 128;
-			GLuint prefilterMap		= CreateEmptyCubeMapMipmap(prefilterMapSize);
+			GLuint prefilterMap = CreateEmptyCubeMapMipmap(PREFILTER_SIZE);
 
 			// pbr: run a quasi monte-carlo simulation on the environment lighting to create a prefilter (cube)map.
 			prefilterShader.Active();
@@ -243,19 +367,18 @@ namespace gl
 				prefilterShader.SetValue("environmentMap", 0);
 				prefilterShader.SetMatrix("projection", proj);
 
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_CUBE_MAP, envMap);
+				GLState::Instance()->BindTexture(0, GL_TEXTURE_CUBE_MAP, envMap);
 
-				glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-				unsigned int maxMipLevels = 5;
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, fbo);
+				unsigned int maxMipLevels = PREFILTER_MIPS;
 				for (unsigned int mip = 0; mip < maxMipLevels; ++mip)
 				{
 					// reisze framebuffer according to mip-level size.
-					unsigned int mipWidth = 128 * std::pow(0.5, mip);
-					unsigned int mipHeight = 128 * std::pow(0.5, mip);
+					unsigned int mipWidth = PREFILTER_SIZE * std::pow(0.5, mip);
+					unsigned int mipHeight = PREFILTER_SIZE * std::pow(0.5, mip);
 					glBindRenderbuffer(GL_RENDERBUFFER, rbo);
 					glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mipWidth, mipHeight);
-					glViewport(0, 0, mipWidth, mipHeight);
+					GLState::Instance()->SetViewport(0, 0, mipWidth, mipHeight);
 
 					float roughness = (float)mip / (float)(maxMipLevels - 1);
 					prefilterShader.SetValue("roughness", roughness);
@@ -268,7 +391,7 @@ namespace gl
 						mCube.Draw();
 					}
 				}
-				glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 			}
 			return prefilterMap;
 		}
@@ -279,8 +402,8 @@ namespace gl
 			glGenTextures(1, &brdfLUT);
 
 			// pre-allocate enough memory for the LUT texture.
-			glBindTexture(GL_TEXTURE_2D, brdfLUT);
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16F, 512, 512, 0, GL_RG, GL_FLOAT, 0);
+			GLState::Instance()->BindTexture(GL_TEXTURE_2D, brdfLUT);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16F, BRDF_LUT_SIZE, BRDF_LUT_SIZE, 0, GL_RG, GL_FLOAT, 0);
 			// be sure to set wrapping mode to GL_CLAMP_TO_EDGE
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
@@ -288,22 +411,23 @@ namespace gl
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
 			// then re-configure capture framebuffer object and render screen-space quad with BRDF shader.
-			glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, fbo);
 			glBindRenderbuffer(GL_RENDERBUFFER, rbo);
-			glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, 512, 512);
+			glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, BRDF_LUT_SIZE, BRDF_LUT_SIZE);
 			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, brdfLUT, 0);
 
-			glViewport(0, 0, 512, 512);
+			GLState::Instance()->SetViewport(0, 0, BRDF_LUT_SIZE, BRDF_LUT_SIZE);
 			mBRDFShader.Active();
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 			mQuad.Draw();
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 			return brdfLUT;
 		}
 
 		GLuint	mEnvCubeMap;
 		GLuint	mIrradianceMap;
+		SHIrradiance mIrradiance;
 		GLuint	mPrefilterMap;
 		GLuint  mBRDFLutMap;
 
@@ -311,6 +435,7 @@ namespace gl
 		GLuint	mIrradianceMapSize;
 
 		Shader mPbrShader;
+		Shader mDepthShader;
 		Shader mBRDFShader;
 		Shader mBackgroundShader;
 
@@ -322,14 +447,29 @@ namespace gl
 		GLint	mColumns;
 		GLfloat	mSpacing;
 		Sphere	mSphere;
+		InstanceBuffer mSphereInstances;
 
-		std::vector<glm::vec3> mLightPos;
-		std::vector<glm::vec3> mLightColor;
+		LightBuffer	  mLights;
+		LightClusters mClusters;
 	};
 }
 
 int main()
 {
+	if (const char* mode = std::getenv("IBL_IRRADIANCE"))
+	{
+		IRRADIANCE_MODE = std::string(mode) == "cubemap" ? IrradianceMode::Cubemap :
+						  std::string(mode) == "sh_cpu"	 ? IrradianceMode::SHCPU : IrradianceMode::SH;
+	}
+	if (const char* check = std::getenv("IBL_SH_CHECK"))
+	{
+		SH_CHECK = std::string(check) != "0";
+	}
+	if (const char* cache = std::getenv("IBL_CACHE"))
+	{
+		IBL_CACHE = std::string(cache) != "0";
+	}
+
 	gl::Engine engine;
 	engine.Init(1280, 720);
 	engine.SetFrameBufferSizeCallback(gl::FramebufferSizeCallback);
@@ -12,7 +12,7 @@ namespace gl
 		{
 			// floor data buffer
 			glGenVertexArrays(1, &mFloorVao);
-			glBindVertexArray(mFloorVao);
+			GLState::Instance()->BindVertexArray(mFloorVao);
 			{
 				float floor[] = {
 					 10.0f, -0.5f,  10.0f,
@@ -30,7 +30,7 @@ namespace gl
 				glEnableVertexAttribArray(0);
 				glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
 			}
-			glBindVertexArray(0);
+			GLState::Instance()->BindVertexArray(0);
 
 			mShader.AttachShader(GL_VERTEX_SHADER, "Shader/lighting_vs.glsl");
 			mShader.AttachShader(GL_FRAGMENT_SHADER, "Shader/lighting_fs.glsl");
@@ -54,11 +54,10 @@ namespace gl
 			mShader.SetMatrix("projection", &projMat[0][0]);
 			mShader.SetValue("camPosition", camera.Position);
 			// render
-			glBindVertexArray(mFloorVao);
+			GLState::Instance()->BindVertexArray(mFloorVao);
 			{
 				glDrawArrays(GL_TRIANGLES, 0, 6);
 			}
-			glBindVertexArray(0);
 		}
 
 	private:
@@ -71,7 +70,7 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
 	// make sure the viewport matches the new window dimensions; note that width and 
 	// height will be significantly larger than specified on retina displays.
-	glViewport(0, 0, width, height);
+	gl::GLState::Instance()->SetViewport(0, 0, width, height);
 }
 
 void mouse_callback(GLFWwindow* window, double xpos, double ypos)
@@ -40,10 +40,8 @@ namespace gl
 			mShader.Active();
 			mShader.SetValue("tex", 0);
 			mShader.SetValue("tex_noise", 1);
-			glActiveTexture(GL_TEXTURE0);
-			glBindTexture(GL_TEXTURE_2D, mTex);
-			glActiveTexture(GL_TEXTURE1);
-			glBindTexture(GL_TEXTURE_2D, mTexNoise);
+			GLState::Instance()->BindTexture(0, GL_TEXTURE_2D, mTex);
+			GLState::Instance()->BindTexture(1, GL_TEXTURE_2D, mTexNoise);
 
 			mPlane.Draw();
 		}
@@ -16,12 +16,25 @@ uniform sampler2D uNormalMap;
 uniform sampler2D uMetallicMap;
 uniform sampler2D uRoughnessMap;
 
-// lights
-uniform vec3 uLightPos[4];
-uniform vec3 uLightColor[4];
+// lights: gl::LightBuffer's lights at texels 2i and 2i + 1 of uLightData. In Forward+ a fragment reads only
+// the lights of its cluster, from gl::LightClusters' (offset, count) per cluster into the light index lists.
+uniform samplerBuffer  uLightData;
+uniform int            uLightCount;
+uniform bool           uForwardPlus;
+uniform usamplerBuffer uClusterGrid;
+uniform usamplerBuffer uLightIndices;
+uniform vec2  uTileSize;
+uniform float uSliceScale;
+uniform float uSliceBias;
+
+const int TILES_X = 16;
+const int TILES_Y = 9;
+const int SLICES = 24;
 
 // other
-uniform vec3 uCamPos;
+uniform vec3  uCamPos;
+uniform mat4  uView;
+uniform float uAlpha;
 
 const float PI = 3.14159265359;
 const float EPSINON = 0.0000001;
@@ -114,15 +127,29 @@ void main()
     vec3 N = normalize(Normal);
     vec3 V = normalize(uCamPos - WorldPos);
 
-    vec3 Lo =- vec3(0.0);
-    for (int i = 0; i < 4; ++i)
+    // (offset, count) of the lights to loop over; without Forward+ all of them, in order
+    uvec2 lights = uvec2(0u, uint(uLightCount));
+    if (uForwardPlus)
     {
+        float depth = -(uView * vec4(WorldPos, 1.0)).z;
+        ivec2 tile = min(ivec2(gl_FragCoord.xy / uTileSize), ivec2(TILES_X - 1, TILES_Y - 1));
+        int slice = clamp(int(floor(log(depth) * uSliceScale + uSliceBias)), 0, SLICES - 1);
+        lights = texelFetch(uClusterGrid, tile.x + TILES_X * (tile.y + TILES_Y * slice)).xy;
+    }
+
+    vec3 Lo = vec3(0.0);
+    for (uint i = 0u; i < lights.y; ++i)
+    {
+        int light = uForwardPlus ? int(texelFetch(uLightIndices, int(lights.x + i)).r) : int(i);
+        vec3 lightPos = texelFetch(uLightData, 2 * light).xyz;
+        vec3 lightColor = texelFetch(uLightData, 2 * light + 1).rgb;
+
         // cal per-light radiance
-        float distance = length(uLightPos[i] - WorldPos);
+        float distance = length(lightPos - WorldPos);
         float attenuation = 1.0 / (distance * distance);
-        vec3 radiance = uLightColor[i] * attenuation;
+        vec3 radiance = lightColor * attenuation;
 
-        vec3 L = normalize(uLightPos[i] - WorldPos);
+        vec3 L = normalize(lightPos - WorldPos);
         vec3 fr = brdf(L, V, N, albedo, roughness, metallic);
         Lo += fr * radiance * max(dot(N, L), 0.0);
     }
@@ -138,5 +165,5 @@ void main()
     // gamma correct
     color = pow(color, vec3(1.0/2.2)); 
 
-    FragColor = vec4(color, 1.0);
+    FragColor = vec4(color, uAlpha);
 }
\ No newline at end of file
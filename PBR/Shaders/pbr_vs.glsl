@@ -11,6 +11,9 @@ uniform mat4 uModel;
 uniform mat4 uView;
 uniform mat4 uProjection;
 
+// the depth pre-pass and the shading pass must agree on depth to the bit
+invariant gl_Position;
+
 void main()
 {
     TexCoords = aTexCoords;
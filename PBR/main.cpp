@@ -3,8 +3,24 @@
 #include "common.hpp"
 #include "controller.hpp"
 #include "common_mesh.hpp"
+#include "light_buffer.hpp"
+#include "light_clusters.hpp"
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+const GLfloat Z_NEAR = 0.1f;
+const GLfloat Z_FAR = 100.0f;
+
+// The four lamps come first; PBR_LIGHTS adds dimmer lights around the spheres up to that many. PBR_LIGHTING
+// ("forward" or "forwardplus") picks whether every fragment loops over all of them, or a depth pre-pass is
+// followed by shading that reads only the lights of the fragment's cluster.
+const GLuint NUM_LAMPS = 4;
+GLuint NUM_LIGHTS = NUM_LAMPS;
+enum class LightingMode { Forward, ForwardPlus };
+LightingMode LIGHTING_MODE = LightingMode::ForwardPlus;
 
 namespace gl
 {
@@ -18,7 +34,7 @@ namespace gl
 
 		virtual void Init(const SContext& context) override
 		{
-			glEnable(GL_DEPTH_TEST);
+			GLState::Instance()->SetPipeline(PipelineState::Opaque());
 
 			// Init shader pbr
 			mShaderPBR.AttachShader(GL_VERTEX_SHADER,	"Shaders/pbr_vs.glsl");
@@ -44,96 +60,165 @@ namespace gl
 				mMetallicMap  = LoadTexture("../Resource/pbr_rustediron/rustediron2_metallic.png");
 				mRoughnessMap = LoadTexture("../Resource/pbr_rustediron/rustediron2_roughness.png");
 			}
-			
-			// Set light attributes
-			mLightPos.push_back(glm::vec3(-10.0f, 10.0f, 10.0f));
-			mLightPos.push_back(glm::vec3(10.0f, 10.0f, 10.0f));
-			mLightPos.push_back(glm::vec3(-10.0f, -10.0f, 10.0f));
-			mLightPos.push_back(glm::vec3(10.0f, -10.0f, 10.0f));
-			mLightColor.push_back(glm::vec3(300.0f, 300.0f, 300.0f));
-			mLightColor.push_back(glm::vec3(300.0f, 300.0f, 300.0f));
-			mLightColor.push_back(glm::vec3(300.0f, 300.0f, 300.0f));
-			mLightColor.push_back(glm::vec3(300.0f, 300.0f, 300.0f));
+			mShaderPBR.SetValue("uForwardPlus", LIGHTING_MODE == LightingMode::ForwardPlus);
+			// The shader only branches on uForwardPlus, so the cluster buffers need units of their own in both modes:
+			// samplers of different types on one unit fail every draw. Without Forward+ nothing is bound there.
+			mShaderPBR.SetValue("uClusterGrid",	 5);
+			mShaderPBR.SetValue("uLightIndices", 6);
+
+			// The pre-pass places the spheres with the same vertex shader, so the shading pass can test for GL_EQUAL
+			mShaderDepth.AttachShader(GL_VERTEX_SHADER,	  "Shaders/pbr_vs.glsl");
+			mShaderDepth.AttachShader(GL_FRAGMENT_SHADER, "Shaders/depth_fs.glsl");
+			mShaderDepth.Link();
+
+			// Set light attributes; the inverse square falloff of the shader is PointLight's with linear 0 and
+			// quadratic 1. The extra lights share out a fixed budget so more of them reach less far.
+			std::vector<PointLight> lights;
+			lights.push_back(PointLight(glm::vec3(-10.0f, 10.0f, 10.0f), glm::vec3(300.0f, 300.0f, 300.0f)));
+			lights.push_back(PointLight(glm::vec3(10.0f, 10.0f, 10.0f), glm::vec3(300.0f, 300.0f, 300.0f)));
+			lights.push_back(PointLight(glm::vec3(-10.0f, -10.0f, 10.0f), glm::vec3(300.0f, 300.0f, 300.0f)));
+			lights.push_back(PointLight(glm::vec3(10.0f, -10.0f, 10.0f), glm::vec3(300.0f, 300.0f, 300.0f)));
+			const GLfloat intensity = 4.0 / std::max((NUM_LIGHTS - NUM_LAMPS) / 64.0, 1.0);
+			srand(13);
+			while (lights.size() < NUM_LIGHTS)
+			{
+				GLfloat x = ((rand() % 100) / 100.0) * 18.0 - 9.0;
+				GLfloat y = ((rand() % 100) / 100.0) * 18.0 - 9.0;
+				GLfloat z = ((rand() % 100) / 100.0) * 6.0 - 2.0;
+				GLfloat r = ((rand() % 100) / 200.0) + 0.5;
+				GLfloat g = ((rand() % 100) / 200.0) + 0.5;
+				GLfloat b = ((rand() % 100) / 200.0) + 0.5;
+				lights.push_back(PointLight(glm::vec3(x, y, z), glm::vec3(r, g, b) * intensity));
+			}
+			mLights.Set(lights);
+			mLights.AttachTexture(mShaderPBR, 4);
+			mClusters.Init(Z_NEAR, Z_FAR);
+
+			// Glass spheres in front of the grid. They are blended over it after the opaque pass, without depth
+			// writes, and read the lights of their own clusters: the lists depend on the clusters only, not on
+			// what the pre-pass left in the depth buffer.
+			for (int col = 0; col < mColumns - 1; ++col)
+			{
+				mGlassPos.push_back(glm::vec3((col - (mColumns / 2) + 0.5f) * mSpacing, -0.5f * mSpacing, 3.0f));
+			}
 
 			Controller::Instance()->ResetCamera(glm::vec3(0.f, 0.f, 15.f), glm::vec3(0.f, 1.f, 0.f));
 		}
 
 		virtual void Update(const SContext& context, const STime& time) override
 		{
-			glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+			GLState::Instance()->SetClearColor(0.1f, 0.1f, 0.1f, 1.0f);
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 			auto& camera = Controller::Instance()->GetCamera();
 
-			glm::mat4 modelMat = glm::mat4(1.0f);
 			glm::mat4 viewMat  = camera.GetViewMatrix();
-			glm::mat4 projMat  = glm::perspective(glm::radians(camera.Zoom), (float)context.width / (float)context.height, 0.1f, 100.0f);
+			glm::mat4 projMat  = glm::perspective(glm::radians(camera.Zoom), (float)context.width / (float)context.height, Z_NEAR, Z_FAR);
+
+			// depth pre-pass: every opaque fragment the shading pass runs for is one that ends up on screen
+			if (LIGHTING_MODE == LightingMode::ForwardPlus)
+			{
+				glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+				mShaderDepth.Active();
+				mShaderDepth.SetMatrix("uView",		  &viewMat[0][0]);
+				mShaderDepth.SetMatrix("uProjection", &projMat[0][0]);
+				_DrawOpaque(mShaderDepth, false);
+				glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+				GLState::Instance()->SetPipeline(PipelineState::Opaque().WithDepthTest(true, GL_EQUAL).WithDepthWrite(false));
+			}
 
 			// lighting
 			mShaderPBR.Active();
 			mShaderPBR.SetValue("uCamPos",		camera.Position);
 			mShaderPBR.SetMatrix("uView",		&viewMat[0][0]);
 			mShaderPBR.SetMatrix("uProjection", &projMat[0][0]);
+			mShaderPBR.SetValue("uAlpha",		1.0f);
 
 			if (!mUseBasicMaterialParms)
 			{
-				glActiveTexture(GL_TEXTURE0);
-				glBindTexture(GL_TEXTURE_2D, mAlbedoMap);
-				glActiveTexture(GL_TEXTURE1);
-				glBindTexture(GL_TEXTURE_2D, mNormalMap);
-				glActiveTexture(GL_TEXTURE2);
-				glBindTexture(GL_TEXTURE_2D, mMetallicMap);
-				glActiveTexture(GL_TEXTURE3);
-				glBindTexture(GL_TEXTURE_2D, mRoughnessMap);
+				GLState::Instance()->BindTexture(0, GL_TEXTURE_2D, mAlbedoMap);
+				GLState::Instance()->BindTexture(1, GL_TEXTURE_2D, mNormalMap);
+				GLState::Instance()->BindTexture(2, GL_TEXTURE_2D, mMetallicMap);
+				GLState::Instance()->BindTexture(3, GL_TEXTURE_2D, mRoughnessMap);
+			}
+
+			mLights.Upload();
+			mLights.BindTexture(4);
+			if (LIGHTING_MODE == LightingMode::ForwardPlus)
+			{
+				mClusters.Update(viewMat, projMat, mLights);
+				mClusters.Bind(mShaderPBR, 5, context.width, context.height);
 			}
 
+			_DrawOpaque(mShaderPBR, true);
+
+			// glass, farthest first
+			std::sort(mGlassPos.begin(), mGlassPos.end(), [&camera](const glm::vec3& a, const glm::vec3& b)
+			{
+				return glm::length(a - camera.Position) > glm::length(b - camera.Position);
+			});
+			GLState::Instance()->SetPipeline(PipelineState::AlphaBlended());
+			mShaderPBR.SetValue("uAlpha", 0.35f);
+			if (mUseBasicMaterialParms)
+			{
+				mShaderPBR.SetValue("uAlbedo",	  glm::vec3(0.2f, 0.4f, 0.8f));
+				mShaderPBR.SetValue("uMetallic",  0.0f);
+				mShaderPBR.SetValue("uRoughness", 0.1f);
+			}
+			for (auto& position : mGlassPos)
+			{
+				glm::mat4 modelMat = glm::scale(glm::translate(glm::mat4(1.0f), position), glm::vec3(0.6f));
+				mShaderPBR.SetMatrix("uModel", &modelMat[0][0]);
+				mSphere.Draw();
+			}
+			if (mUseBasicMaterialParms)
+			{
+				mShaderPBR.SetValue("uAlbedo", glm::vec3(0.5f, 0.0f, 0.0f));
+			}
+			GLState::Instance()->SetPipeline(PipelineState::Opaque());
+		}
+
+	private:
+		// The sphere grid and the lamps; material uniforms are only set for the shading pass
+		void _DrawOpaque(const Shader& shader, bool material) const
+		{
 			// render rows*column number of spheres with varying metallic/roughness values scaled by rows and columns respectively
 			for (int row = 0; row < mRows; ++row)
 			{
-				if (mUseBasicMaterialParms)
+				if (material && mUseBasicMaterialParms)
 				{
-					mShaderPBR.SetValue("uMetallic", (float)row / (float)mRows);
+					shader.SetValue("uMetallic", (float)row / (float)mRows);
 				}
 				for (int col = 0; col < mColumns; ++col)
 				{
 					// we clamp the roughness to 0.025 - 1.0 as perfectly smooth surfaces (roughness of 0.0) tend to look a bit off
 					// on direct lighting.
-					if (mUseBasicMaterialParms)
+					if (material && mUseBasicMaterialParms)
 					{
-						mShaderPBR.SetValue("uRoughness", glm::clamp((float)col / (float)mColumns, 0.05f, 1.0f));
-						//mShaderPBR.SetValue("uRoughness", 1.0f);
+						shader.SetValue("uRoughness", glm::clamp((float)col / (float)mColumns, 0.05f, 1.0f));
 					}
 
-					modelMat = glm::mat4(1.0f);
-					modelMat = glm::translate(modelMat, glm::vec3(
+					glm::mat4 modelMat = glm::translate(glm::mat4(1.0f), glm::vec3(
 						(col - (mColumns / 2)) * mSpacing,
 						(row - (mRows / 2)) * mSpacing,
 						0.0f
 					));
-					mShaderPBR.SetMatrix("uModel", &modelMat[0][0]);
+					shader.SetMatrix("uModel", &modelMat[0][0]);
 					mSphere.Draw();
 				}
 			}
 
 			// render light source (simply re-render sphere at light positions)
-			// this looks a bit off as we use the same shader, but it'll make their positions obvious and 
+			// this looks a bit off as we use the same shader, but it'll make their positions obvious and
 			// keeps the codeprint small.
-			for (unsigned int i = 0; i < mLightPos.size(); ++i)
+			for (GLuint i = 0; i < NUM_LAMPS; ++i)
 			{
-				glm::vec3 newPos = mLightPos[i] + glm::vec3(sin(glfwGetTime() * 5.0) * 5.0, 0.0, 0.0);
-				newPos = mLightPos[i];
-				mShaderPBR.SetValue("uLightPos[" + std::to_string(i) + "]", newPos);
-				mShaderPBR.SetValue("uLightColor[" + std::to_string(i) + "]", mLightColor[i]);
-
-				modelMat = glm::mat4(1.0f);
-				modelMat = glm::translate(modelMat, newPos);
-				modelMat = glm::scale(modelMat, glm::vec3(0.5f));
-				mShaderPBR.SetMatrix("uModel", &modelMat[0][0]);
+				glm::mat4 modelMat = glm::scale(glm::translate(glm::mat4(1.0f), mLights.Get(i).position), glm::vec3(0.5f));
+				shader.SetMatrix("uModel", &modelMat[0][0]);
 				mSphere.Draw();
 			}
 		}
 
-	private:
 		GLint		mRows;
 		GLint		mColumns;
 		GLfloat		mSpacing;
@@ -146,17 +231,20 @@ namespace gl
 
 		Sphere  mSphere;
 		Shader  mShaderPBR;
+		Shader  mShaderDepth;
 
-		std::vector<glm::vec3> mLightPos;
-		std::vector<glm::vec3> mLightColor;
+		LightBuffer	  mLights;
+		LightClusters mClusters;
+
+		std::vector<glm::vec3> mGlassPos;
 	};
 }
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
-	// make sure the viewport matches the new window dimensions; note that width and 
+	// make sure the viewport matches the new window dimensions; note that width and
 	// height will be significantly larger than specified on retina displays.
-	glViewport(0, 0, width, height);
+	gl::GLState::Instance()->SetViewport(0, 0, width, height);
 }
 
 void mouse_callback(GLFWwindow* window, double xpos, double ypos)
@@ -166,6 +254,16 @@ void mouse_callback(GLFWwindow* window, double xpos, double ypos)
 
 int main()
 {
+	if (const char* lights = std::getenv("PBR_LIGHTS"))
+	{
+		// Light indices are 16 bit
+		NUM_LIGHTS = std::min(std::max(std::atoi(lights), static_cast<int>(NUM_LAMPS)), 0xFFFF);
+	}
+	if (const char* mode = std::getenv("PBR_LIGHTING"))
+	{
+		LIGHTING_MODE = std::string(mode) == "forward" ? LightingMode::Forward : LightingMode::ForwardPlus;
+	}
+
 	gl::Engine engine;
 	engine.Init(1280, 720);
 	engine.SetFrameBufferSizeCallback(framebuffer_size_callback);
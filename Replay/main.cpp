@@ -0,0 +1,93 @@
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "gl_replay.hpp"
+#include "gl_mock.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Replays a trace written with GL_CAPTURE_FILE in a hidden window of the captured size:
+//
+//     Replay <trace> [repeats] [--finish] [--mock]
+//
+// The captured frames run repeats times (default 10) after the setup. --finish waits for the GPU at every pass
+// boundary, so pass times include GPU work; --mock replays against GLMock to time the trace's CPU side only.
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::printf("usage: Replay <trace> [repeats] [--finish] [--mock]\n");
+		return 1;
+	}
+
+	GLuint repeats = 10;
+	bool finish	   = false;
+	bool mock	   = false;
+	for (int i = 2; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--finish") == 0)
+		{
+			finish = true;
+		}
+		else if (std::strcmp(argv[i], "--mock") == 0)
+		{
+			mock = true;
+		}
+		else
+		{
+			repeats = static_cast<GLuint>(std::strtoul(argv[i], nullptr, 10));
+		}
+	}
+
+	gl::GLReplay replay;
+	if (!replay.Load(argv[1]))
+	{
+		return 1;
+	}
+
+	GLADloadproc load = gl::GLMock::GetProcAddress;
+	if (!mock)
+	{
+		glfwInit();
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+		GLFWwindow* window = glfwCreateWindow(replay.GetWidth(), replay.GetHeight(), "Replay", NULL, NULL);
+		if (window == nullptr)
+		{
+			std::printf("Failed to init GLFW...\n");
+			glfwTerminate();
+			return 1;
+		}
+		glfwMakeContextCurrent(window);
+		load = (GLADloadproc)glfwGetProcAddress;
+	}
+	if (!gladLoadGLLoader(load))
+	{
+		std::printf("Failed to init GLAD...\n");
+		return 1;
+	}
+
+	try
+	{
+		replay.Setup();
+		for (GLuint i = 0; i < repeats; ++i)
+		{
+			replay.ReplayFrames(finish);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::printf("%s\n", e.what());
+		return 1;
+	}
+	replay.Report(std::cout);
+
+	if (!mock)
+	{
+		glfwTerminate();
+	}
+	return replay.GetDivergences() ? 2 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,325 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+#include <glm/glm.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GL_BOUNDS_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace gl
+{
+	struct AABB
+	{
+		glm::vec3 min;
+		glm::vec3 max;
+
+		AABB() : min(std::numeric_limits<float>::max()), max(-std::numeric_limits<float>::max()) {}
+		AABB(const glm::vec3& tMin, const glm::vec3& tMax) : min(tMin), max(tMax) {}
+
+		bool Valid() const { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+		glm::vec3 Center()  const { return (min + max) * 0.5f; }
+		glm::vec3 Extents() const { return (max - min) * 0.5f; }
+
+		void Expand(const glm::vec3& p)
+		{
+			min = glm::min(min, p);
+			max = glm::max(max, p);
+		}
+
+		void Expand(const AABB& box)
+		{
+			if (box.Valid())
+			{
+				min = glm::min(min, box.min);
+				max = glm::max(max, box.max);
+			}
+		}
+
+		// Arvo: transform the center, then project the extents onto the absolute rotation/scale
+		AABB Transform(const glm::mat4& mat) const
+		{
+			if (!Valid())
+			{
+				return *this;
+			}
+			glm::vec3 center  = glm::vec3(mat * glm::vec4(Center(), 1.f));
+			glm::vec3 extents = Extents();
+			glm::vec3 newExtents(0.f);
+			for (int i = 0; i < 3; ++i)
+			{
+				newExtents += glm::abs(glm::vec3(mat[i])) * extents[i];
+			}
+			return AABB(center - newExtents, center + newExtents);
+		}
+	};
+
+	struct BoundingSphere
+	{
+		glm::vec3 center;
+		GLfloat	  radius;
+
+		BoundingSphere() : center(0.f), radius(-1.f) {}
+		BoundingSphere(const glm::vec3& tCenter, GLfloat tRadius) : center(tCenter), radius(tRadius) {}
+
+		bool Valid() const { return radius >= 0.f; }
+
+		static BoundingSphere FromAABB(const AABB& box)
+		{
+			return box.Valid() ? BoundingSphere(box.Center(), glm::length(box.Extents())) : BoundingSphere();
+		}
+
+		// Centered on the box, radius is the farthest point; tighter than the half diagonal for most meshes
+		static BoundingSphere FromPoints(const AABB& box, const glm::vec3* points, size_t stride, size_t count)
+		{
+			if (!box.Valid())
+			{
+				return BoundingSphere();
+			}
+			glm::vec3 center = box.Center();
+			GLfloat maxDist2 = 0.f;
+			auto pBytes = reinterpret_cast<const char*>(points);
+			for (size_t i = 0; i < count; ++i)
+			{
+				auto& p = *reinterpret_cast<const glm::vec3*>(pBytes + i * stride);
+				glm::vec3 d = p - center;
+				maxDist2 = glm::max(maxDist2, glm::dot(d, d));
+			}
+			return BoundingSphere(center, std::sqrt(maxDist2));
+		}
+
+		BoundingSphere Transform(const glm::mat4& mat) const
+		{
+			GLfloat scale = glm::max(glm::length(glm::vec3(mat[0])), glm::max(glm::length(glm::vec3(mat[1])), glm::length(glm::vec3(mat[2]))));
+			return BoundingSphere(glm::vec3(mat * glm::vec4(center, 1.f)), radius * scale);
+		}
+	};
+
+	class Frustum
+	{
+	public:
+		enum Plane { PLANE_LEFT = 0, PLANE_RIGHT, PLANE_BOTTOM, PLANE_TOP, PLANE_NEAR, PLANE_FAR, PLANE_COUNT };
+
+		Frustum() {}
+		Frustum(const glm::mat4& projection, const glm::mat4& view) { Extract(projection * view); }
+
+		// Gribb/Hartmann: planes are read straight from the rows of the clip matrix, pointing inwards
+		void Extract(const glm::mat4& viewProj)
+		{
+			glm::vec4 row0(viewProj[0][0], viewProj[1][0], viewProj[2][0], viewProj[3][0]);
+			glm::vec4 row1(viewProj[0][1], viewProj[1][1], viewProj[2][1], viewProj[3][1]);
+			glm::vec4 row2(viewProj[0][2], viewProj[1][2], viewProj[2][2], viewProj[3][2]);
+			glm::vec4 row3(viewProj[0][3], viewProj[1][3], viewProj[2][3], viewProj[3][3]);
+
+			mPlanes[PLANE_LEFT]	  = row3 + row0;
+			mPlanes[PLANE_RIGHT]  = row3 - row0;
+			mPlanes[PLANE_BOTTOM] = row3 + row1;
+			mPlanes[PLANE_TOP]	  = row3 - row1;
+			mPlanes[PLANE_NEAR]	  = row3 + row2;
+			mPlanes[PLANE_FAR]	  = row3 - row2;
+
+			for (auto& plane : mPlanes)
+			{
+				plane /= glm::length(glm::vec3(plane));
+			}
+		}
+
+		bool Intersects(const BoundingSphere& sphere) const
+		{
+			for (auto& plane : mPlanes)
+			{
+				if (glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool Intersects(const AABB& box) const
+		{
+			glm::vec3 center  = box.Center();
+			glm::vec3 extents = box.Extents();
+			for (auto& plane : mPlanes)
+			{
+				glm::vec3 normal(plane);
+				if (glm::dot(normal, center) + plane.w < -glm::dot(glm::abs(normal), extents))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		const glm::vec4& GetPlane(GLuint i) const { return mPlanes[i]; }
+
+	private:
+		glm::vec4 mPlanes[PLANE_COUNT];
+	};
+
+	struct CullStats
+	{
+		GLuint tested;
+		GLuint visible;
+		GLuint culled;
+
+		CullStats() : tested(0), visible(0), culled(0) {}
+	};
+
+	// Batched culling: tests whole arrays of bounds against one frustum and returns the indices that survive.
+	// Stats accumulate until the next SetFrustum(), so one SetFrustum() per frame gives per-frame counts.
+	class FrustumCuller
+	{
+	public:
+		void SetFrustum(const glm::mat4& projection, const glm::mat4& view);
+		void SetFrustum(const Frustum& frustum);
+
+		void Cull(const BoundingSphere* spheres, size_t count, std::vector<GLuint>& visible);
+		void Cull(const AABB* boxes, size_t count, std::vector<GLuint>& visible);
+
+		const Frustum&	 GetFrustum() const { return mFrustum; }
+		const CullStats& GetStats()	  const { return mStats; }
+
+	private:
+		void _Record(size_t tested, size_t visible);
+
+		Frustum   mFrustum;
+		CullStats mStats;
+	};
+
+	inline void FrustumCuller::SetFrustum(const glm::mat4& projection, const glm::mat4& view)
+	{
+		SetFrustum(Frustum(projection, view));
+	}
+
+	inline void FrustumCuller::SetFrustum(const Frustum& frustum)
+	{
+		mFrustum = frustum;
+		mStats = CullStats();
+	}
+
+	void FrustumCuller::Cull(const BoundingSphere* spheres, size_t count, std::vector<GLuint>& visible)
+	{
+		visible.clear();
+		visible.reserve(count);
+
+		size_t i = 0;
+#ifdef GL_BOUNDS_SSE
+		__m128 px[Frustum::PLANE_COUNT], py[Frustum::PLANE_COUNT], pz[Frustum::PLANE_COUNT], pw[Frustum::PLANE_COUNT];
+		for (GLuint p = 0; p < Frustum::PLANE_COUNT; ++p)
+		{
+			auto& plane = mFrustum.GetPlane(p);
+			px[p] = _mm_set1_ps(plane.x);
+			py[p] = _mm_set1_ps(plane.y);
+			pz[p] = _mm_set1_ps(plane.z);
+			pw[p] = _mm_set1_ps(plane.w);
+		}
+
+		// BoundingSphere is 4 packed floats: load four of them and transpose to SoA
+		static_assert(sizeof(BoundingSphere) == 4 * sizeof(float), "BoundingSphere must stay xyzr-packed for SIMD culling");
+		auto pData = reinterpret_cast<const float*>(spheres);
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(pData + i * 4 + 0);
+			__m128 y = _mm_loadu_ps(pData + i * 4 + 4);
+			__m128 z = _mm_loadu_ps(pData + i * 4 + 8);
+			__m128 r = _mm_loadu_ps(pData + i * 4 + 12);
+			_MM_TRANSPOSE4_PS(x, y, z, r);
+			__m128 negR = _mm_sub_ps(_mm_setzero_ps(), r);
+
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (GLuint p = 0; p < Frustum::PLANE_COUNT; ++p)
+			{
+				__m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px[p], x), _mm_mul_ps(py[p], y)), _mm_add_ps(_mm_mul_ps(pz[p], z), pw[p]));
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(d, negR));
+			}
+
+			int mask = _mm_movemask_ps(inside);
+			for (GLuint lane = 0; mask; ++lane, mask >>= 1)
+			{
+				if (mask & 1)
+				{
+					visible.push_back(static_cast<GLuint>(i + lane));
+				}
+			}
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			if (mFrustum.Intersects(spheres[i]))
+			{
+				visible.push_back(static_cast<GLuint>(i));
+			}
+		}
+		_Record(count, visible.size());
+	}
+
+	void FrustumCuller::Cull(const AABB* boxes, size_t count, std::vector<GLuint>& visible)
+	{
+		visible.clear();
+		visible.reserve(count);
+
+		size_t i = 0;
+#ifdef GL_BOUNDS_SSE
+		const __m128 half = _mm_set1_ps(0.5f);
+		for (; i + 4 <= count; i += 4)
+		{
+			auto& b0 = boxes[i];
+			auto& b1 = boxes[i + 1];
+			auto& b2 = boxes[i + 2];
+			auto& b3 = boxes[i + 3];
+			__m128 minX = _mm_setr_ps(b0.min.x, b1.min.x, b2.min.x, b3.min.x);
+			__m128 minY = _mm_setr_ps(b0.min.y, b1.min.y, b2.min.y, b3.min.y);
+			__m128 minZ = _mm_setr_ps(b0.min.z, b1.min.z, b2.min.z, b3.min.z);
+			__m128 maxX = _mm_setr_ps(b0.max.x, b1.max.x, b2.max.x, b3.max.x);
+			__m128 maxY = _mm_setr_ps(b0.max.y, b1.max.y, b2.max.y, b3.max.y);
+			__m128 maxZ = _mm_setr_ps(b0.max.z, b1.max.z, b2.max.z, b3.max.z);
+			__m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+			__m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+			__m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+			__m128 ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+			__m128 ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+			__m128 ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (GLuint p = 0; p < Frustum::PLANE_COUNT; ++p)
+			{
+				auto& plane = mFrustum.GetPlane(p);
+				__m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), cx), _mm_mul_ps(_mm_set1_ps(plane.y), cy)),
+									  _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.z), cz), _mm_set1_ps(plane.w)));
+				__m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(std::abs(plane.x)), ex), _mm_mul_ps(_mm_set1_ps(std::abs(plane.y)), ey)),
+									  _mm_mul_ps(_mm_set1_ps(std::abs(plane.z)), ez));
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(d, r), _mm_setzero_ps()));
+			}
+
+			int mask = _mm_movemask_ps(inside);
+			for (GLuint lane = 0; mask; ++lane, mask >>= 1)
+			{
+				if (mask & 1)
+				{
+					visible.push_back(static_cast<GLuint>(i + lane));
+				}
+			}
+		}
+#endif
+		for (; i < count; ++i)
+		{
+			if (mFrustum.Intersects(boxes[i]))
+			{
+				visible.push_back(static_cast<GLuint>(i));
+			}
+		}
+		_Record(count, visible.size());
+	}
+
+	inline void FrustumCuller::_Record(size_t tested, size_t visible)
+	{
+		mStats.tested  += static_cast<GLuint>(tested);
+		mStats.visible += static_cast<GLuint>(visible);
+		mStats.culled  += static_cast<GLuint>(tested - visible);
+	}
+}
\ No newline at end of file
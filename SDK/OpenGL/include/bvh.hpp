@@ -0,0 +1,529 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <limits>
+#include <cassert>
+#include <glm/glm.hpp>
+#include "bounds.hpp"
+#include "thread_pool.hpp"
+
+namespace gl
+{
+	struct Ray
+	{
+		glm::vec3 origin;
+		glm::vec3 direction;
+		GLfloat	  maxDistance;
+
+		Ray(const glm::vec3& tOrigin, const glm::vec3& tDirection, GLfloat tMaxDistance = std::numeric_limits<float>::max())
+			: origin(tOrigin), direction(tDirection), maxDistance(tMaxDistance) {}
+	};
+
+	struct RayHit
+	{
+		GLuint	primitive;
+		GLfloat distance;		// in units of the ray direction
+
+		RayHit() : primitive(0xFFFFFFFFu), distance(std::numeric_limits<float>::max()) {}
+
+		bool Valid() const { return primitive != 0xFFFFFFFFu; }
+	};
+
+	// Bounding volume hierarchy over boxes (e.g. instance bounds) or triangles. Queries return primitive indices,
+	// i.e. positions in the array Build was given (or triangle numbers for BuildTriangles).
+	//
+	// The build bins centroids along the widest axis and picks the split with the lowest surface area cost. Big
+	// nodes build their two children on the thread pool. Moving objects call Refit with the new boxes, which keeps
+	// the tree and only recomputes its boxes; rebuild when they have moved far enough that queries slow down.
+	class Bvh
+	{
+	public:
+		static const GLuint MAX_LEAF_SIZE = 4;
+		static const GLuint BIN_COUNT	  = 16;
+
+		Bvh() {}
+
+		void Build(const AABB* bounds, size_t count);
+		void Build(const std::vector<AABB>& bounds) { Build(bounds.data(), bounds.size()); }
+		// Indexed triangles; positions are read with the given byte stride (e.g. sizeof(Vertex) for Mesh data)
+		void BuildTriangles(const glm::vec3* positions, size_t stride, const GLuint* indices, size_t indexCount);
+
+		// Same primitives, new boxes. Box BVHs only: triangles are not refitted.
+		void Refit(const AABB* bounds);
+
+		// Appends the primitives whose boxes touch the frustum or sphere. Subtrees fully inside the frustum are
+		// taken without testing their primitives.
+		void QueryFrustum(const Frustum& frustum, std::vector<GLuint>& result) const;
+		void QuerySphere(const BoundingSphere& sphere, std::vector<GLuint>& result) const;
+
+		// Nearest primitive along the ray: box entry points for box BVHs, exact hits for triangle BVHs
+		bool Raycast(const Ray& ray, RayHit& hit) const;
+
+		const AABB& GetBounds()			const { return mNodes.empty() ? mEmpty : mNodes[0].bounds; }
+		size_t		GetNodeCount()		const { return mNodes.size(); }
+		size_t		GetPrimitiveCount() const { return mBounds.size(); }
+
+	private:
+		// Below this many primitives a node's subtree is built on the current thread
+		static const size_t PARALLEL_THRESHOLD = 4096;
+		// Past this depth nodes split at the median, so no path gets deeper than the traversal stack
+		static const GLuint MAX_SAH_DEPTH = 64;
+		static const GLuint STACK_SIZE	  = 128;
+
+		// count > 0: leaf over mIndices[first, first + count); otherwise children are first and first + 1
+		struct Node
+		{
+			AABB   bounds;
+			GLuint first;
+			GLuint count;
+		};
+
+		struct Triangle
+		{
+			glm::vec3 v0;
+			glm::vec3 edge1;
+			glm::vec3 edge2;
+		};
+
+		void _Build();
+		void _BuildNode(GLuint index, size_t begin, size_t end, GLuint depth, std::atomic<GLuint>& nodeCount);
+		size_t _SplitSah(const AABB& centroidBounds, int axis, size_t begin, size_t end, const AABB& bounds);
+
+		static GLfloat _Area(const AABB& box);
+		static bool	   _Contains(const Frustum& frustum, const AABB& box);
+		static bool	   _Intersects(const BoundingSphere& sphere, const AABB& box);
+		static bool	   _Intersects(const glm::vec3& origin, const glm::vec3& invDirection, GLfloat maxDistance, const AABB& box, GLfloat& distance);
+		static bool	   _Intersects(const Ray& ray, const Triangle& triangle, GLfloat& distance);
+
+		std::vector<Node>		mNodes;
+		std::vector<GLuint>		mIndices;
+		std::vector<AABB>		mBounds;
+		std::vector<glm::vec3>	mCentroids;
+		std::vector<Triangle>	mTriangles;
+		AABB					mEmpty;
+	};
+
+	void Bvh::Build(const AABB* bounds, size_t count)
+	{
+		mBounds.assign(bounds, bounds + count);
+		mTriangles.clear();
+		_Build();
+	}
+
+	void Bvh::BuildTriangles(const glm::vec3* positions, size_t stride, const GLuint* indices, size_t indexCount)
+	{
+		auto pBytes = reinterpret_cast<const char*>(positions);
+		auto position = [&](GLuint index) -> const glm::vec3& { return *reinterpret_cast<const glm::vec3*>(pBytes + index * stride); };
+
+		size_t count = indexCount / 3;
+		mBounds.resize(count);
+		mTriangles.resize(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			const glm::vec3& p0 = position(indices[i * 3 + 0]);
+			const glm::vec3& p1 = position(indices[i * 3 + 1]);
+			const glm::vec3& p2 = position(indices[i * 3 + 2]);
+			mTriangles[i].v0	= p0;
+			mTriangles[i].edge1 = p1 - p0;
+			mTriangles[i].edge2 = p2 - p0;
+			mBounds[i] = AABB(glm::min(p0, glm::min(p1, p2)), glm::max(p0, glm::max(p1, p2)));
+		}
+		_Build();
+	}
+
+	void Bvh::_Build()
+	{
+		size_t count = mBounds.size();
+		mNodes.clear();
+		mIndices.resize(count);
+		mCentroids.resize(count);
+		if (!count)
+		{
+			return;
+		}
+		for (size_t i = 0; i < count; ++i)
+		{
+			mIndices[i]	  = static_cast<GLuint>(i);
+			mCentroids[i] = mBounds[i].Center();
+		}
+
+		// A binary tree over n leaves of at least one primitive has at most 2n - 1 nodes. Children are taken from the
+		// counter by whichever thread splits their parent, so they always come after it.
+		mNodes.resize(2 * count - 1);
+		std::atomic<GLuint> nodeCount(1);
+		_BuildNode(0, 0, count, 0, nodeCount);
+		mNodes.resize(nodeCount);
+
+		std::vector<glm::vec3>().swap(mCentroids);
+	}
+
+	void Bvh::_BuildNode(GLuint index, size_t begin, size_t end, GLuint depth, std::atomic<GLuint>& nodeCount)
+	{
+		AABB bounds, centroidBounds;
+		for (size_t i = begin; i < end; ++i)
+		{
+			bounds.Expand(mBounds[mIndices[i]]);
+			centroidBounds.Expand(mCentroids[mIndices[i]]);
+		}
+
+		Node& node = mNodes[index];
+		node.bounds = bounds;
+
+		size_t count = end - begin;
+		glm::vec3 extent = centroidBounds.max - centroidBounds.min;
+		int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+
+		size_t mid = end;
+		if (count > 1 && extent[axis] > 0.f)
+		{
+			if (depth < MAX_SAH_DEPTH)
+			{
+				mid = _SplitSah(centroidBounds, axis, begin, end, bounds);
+			}
+			else
+			{
+				mid = begin + count / 2;
+				std::nth_element(mIndices.begin() + begin, mIndices.begin() + mid, mIndices.begin() + end, [this, axis](GLuint a, GLuint b)
+				{
+					return mCentroids[a][axis] < mCentroids[b][axis];
+				});
+			}
+		}
+		else if (count > MAX_LEAF_SIZE)
+		{
+			// All centroids coincide; any split is as good as another
+			mid = begin + count / 2;
+		}
+
+		if (mid == end)
+		{
+			node.first = static_cast<GLuint>(begin);
+			node.count = static_cast<GLuint>(count);
+			return;
+		}
+
+		GLuint children = nodeCount.fetch_add(2);
+		node.first = children;
+		node.count = 0;
+
+		if (count >= PARALLEL_THRESHOLD)
+		{
+			ThreadPool::Instance()->ParallelFor(0, 2, 1, [&](size_t first, size_t last)
+			{
+				for (size_t child = first; child < last; ++child)
+				{
+					_BuildNode(children + static_cast<GLuint>(child), child ? mid : begin, child ? end : mid, depth + 1, nodeCount);
+				}
+			});
+		}
+		else
+		{
+			_BuildNode(children, begin, mid, depth + 1, nodeCount);
+			_BuildNode(children + 1, mid, end, depth + 1, nodeCount);
+		}
+	}
+
+	// Returns where the primitives were partitioned, or end when keeping them in one leaf is cheaper
+	size_t Bvh::_SplitSah(const AABB& centroidBounds, int axis, size_t begin, size_t end, const AABB& bounds)
+	{
+		struct Bin
+		{
+			AABB   bounds;
+			GLuint count = 0;
+		};
+		Bin bins[BIN_COUNT];
+
+		GLfloat minimum = centroidBounds.min[axis];
+		GLfloat scale	= BIN_COUNT / (centroidBounds.max[axis] - minimum);
+		auto binOf = [&](GLuint primitive)
+		{
+			return std::min(BIN_COUNT - 1, static_cast<GLuint>((mCentroids[primitive][axis] - minimum) * scale));
+		};
+
+		for (size_t i = begin; i < end; ++i)
+		{
+			auto& bin = bins[binOf(mIndices[i])];
+			bin.bounds.Expand(mBounds[mIndices[i]]);
+			++bin.count;
+		}
+
+		// Sweep from the right to get the cost of every right side, then from the left to combine
+		GLfloat rightCost[BIN_COUNT - 1];
+		AABB	rightBounds;
+		GLuint	rightCount = 0;
+		for (GLuint i = BIN_COUNT - 1; i > 0; --i)
+		{
+			rightBounds.Expand(bins[i].bounds);
+			rightCount += bins[i].count;
+			rightCost[i - 1] = rightCount ? _Area(rightBounds) * rightCount : 0.f;
+		}
+
+		GLfloat bestCost  = std::numeric_limits<float>::max();
+		GLuint	bestSplit = 0;
+		AABB	leftBounds;
+		GLuint	leftCount = 0;
+		for (GLuint i = 0; i + 1 < BIN_COUNT; ++i)
+		{
+			leftBounds.Expand(bins[i].bounds);
+			leftCount += bins[i].count;
+			if (!leftCount || leftCount == end - begin)
+			{
+				continue;
+			}
+			GLfloat cost = _Area(leftBounds) * leftCount + rightCost[i];
+			if (cost < bestCost)
+			{
+				bestCost  = cost;
+				bestSplit = i;
+			}
+		}
+
+		// Costs relative to one primitive test, with a node visit costing about the same
+		size_t count = end - begin;
+		GLfloat area = _Area(bounds);
+		if (count <= MAX_LEAF_SIZE && bestCost + area >= area * count)
+		{
+			return end;
+		}
+
+		auto middle = std::partition(mIndices.begin() + begin, mIndices.begin() + end, [&](GLuint primitive)
+		{
+			return binOf(primitive) <= bestSplit;
+		});
+		return static_cast<size_t>(middle - mIndices.begin());
+	}
+
+	void Bvh::Refit(const AABB* bounds)
+	{
+		assert(mTriangles.empty() && "Triangle BVHs are rebuilt, not refitted");
+		mBounds.assign(bounds, bounds + mBounds.size());
+
+		// Leaves are independent; inner nodes come before their children, so a reverse walk sees children first
+		ThreadPool::Instance()->ParallelFor(0, mNodes.size(), 1024, [this](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				Node& node = mNodes[i];
+				if (node.count)
+				{
+					node.bounds = AABB();
+					for (GLuint j = node.first; j < node.first + node.count; ++j)
+					{
+						node.bounds.Expand(mBounds[mIndices[j]]);
+					}
+				}
+			}
+		});
+		for (size_t i = mNodes.size(); i-- > 0;)
+		{
+			Node& node = mNodes[i];
+			if (!node.count)
+			{
+				node.bounds = mNodes[node.first].bounds;
+				node.bounds.Expand(mNodes[node.first + 1].bounds);
+			}
+		}
+	}
+
+	void Bvh::QueryFrustum(const Frustum& frustum, std::vector<GLuint>& result) const
+	{
+		if (mNodes.empty())
+		{
+			return;
+		}
+
+		// The low bit of each entry marks a subtree already known to be inside
+		GLuint stack[STACK_SIZE];
+		GLuint size = 0;
+		stack[size++] = 0;
+		while (size)
+		{
+			GLuint entry  = stack[--size];
+			bool   inside = (entry & 1) != 0;
+			const Node& node = mNodes[entry >> 1];
+
+			if (!inside)
+			{
+				if (!frustum.Intersects(node.bounds))
+				{
+					continue;
+				}
+				inside = _Contains(frustum, node.bounds);
+			}
+
+			if (node.count)
+			{
+				for (GLuint i = node.first; i < node.first + node.count; ++i)
+				{
+					if (inside || frustum.Intersects(mBounds[mIndices[i]]))
+					{
+						result.push_back(mIndices[i]);
+					}
+				}
+				continue;
+			}
+			stack[size++] = (node.first << 1) | (inside ? 1 : 0);
+			stack[size++] = ((node.first + 1) << 1) | (inside ? 1 : 0);
+		}
+	}
+
+	void Bvh::QuerySphere(const BoundingSphere& sphere, std::vector<GLuint>& result) const
+	{
+		if (mNodes.empty())
+		{
+			return;
+		}
+
+		GLuint stack[STACK_SIZE];
+		GLuint size = 0;
+		stack[size++] = 0;
+		while (size)
+		{
+			const Node& node = mNodes[stack[--size]];
+			if (!_Intersects(sphere, node.bounds))
+			{
+				continue;
+			}
+			if (node.count)
+			{
+				for (GLuint i = node.first; i < node.first + node.count; ++i)
+				{
+					if (_Intersects(sphere, mBounds[mIndices[i]]))
+					{
+						result.push_back(mIndices[i]);
+					}
+				}
+				continue;
+			}
+			stack[size++] = node.first;
+			stack[size++] = node.first + 1;
+		}
+	}
+
+	bool Bvh::Raycast(const Ray& ray, RayHit& hit) const
+	{
+		hit = RayHit();
+		if (mNodes.empty())
+		{
+			return false;
+		}
+
+		glm::vec3 invDirection = 1.f / ray.direction;
+		GLfloat nearest = ray.maxDistance;
+		GLfloat distance;
+
+		GLuint stack[STACK_SIZE];
+		GLuint size = 0;
+		stack[size++] = 0;
+		while (size)
+		{
+			const Node& node = mNodes[stack[--size]];
+			if (!_Intersects(ray.origin, invDirection, nearest, node.bounds, distance))
+			{
+				continue;
+			}
+
+			if (node.count)
+			{
+				for (GLuint i = node.first; i < node.first + node.count; ++i)
+				{
+					GLuint primitive = mIndices[i];
+					bool isHit = mTriangles.empty() ? _Intersects(ray.origin, invDirection, nearest, mBounds[primitive], distance)
+													: _Intersects(ray, mTriangles[primitive], distance);
+					if (isHit && distance < nearest)
+					{
+						nearest		  = distance;
+						hit.primitive = primitive;
+						hit.distance  = distance;
+					}
+				}
+				continue;
+			}
+
+			// Nearer child on top, so its hits shrink the ray before the other one is tested
+			GLfloat distance0, distance1;
+			bool hit0 = _Intersects(ray.origin, invDirection, nearest, mNodes[node.first].bounds, distance0);
+			bool hit1 = _Intersects(ray.origin, invDirection, nearest, mNodes[node.first + 1].bounds, distance1);
+			if (hit0 && hit1)
+			{
+				bool firstNearer = distance0 <= distance1;
+				stack[size++] = firstNearer ? node.first + 1 : node.first;
+				stack[size++] = firstNearer ? node.first : node.first + 1;
+			}
+			else if (hit0 || hit1)
+			{
+				stack[size++] = hit0 ? node.first : node.first + 1;
+			}
+		}
+		return hit.Valid();
+	}
+
+	inline GLfloat Bvh::_Area(const AABB& box)
+	{
+		glm::vec3 d = box.max - box.min;
+		return d.x * d.y + d.y * d.z + d.z * d.x;
+	}
+
+	inline bool Bvh::_Contains(const Frustum& frustum, const AABB& box)
+	{
+		glm::vec3 center  = box.Center();
+		glm::vec3 extents = box.Extents();
+		for (GLuint i = 0; i < Frustum::PLANE_COUNT; ++i)
+		{
+			auto& plane = frustum.GetPlane(i);
+			glm::vec3 normal(plane);
+			if (glm::dot(normal, center) + plane.w < glm::dot(glm::abs(normal), extents))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	inline bool Bvh::_Intersects(const BoundingSphere& sphere, const AABB& box)
+	{
+		glm::vec3 d = sphere.center - glm::clamp(sphere.center, box.min, box.max);
+		return glm::dot(d, d) <= sphere.radius * sphere.radius;
+	}
+
+	// Slab test; distance is where the ray enters the box, 0 when it starts inside
+	inline bool Bvh::_Intersects(const glm::vec3& origin, const glm::vec3& invDirection, GLfloat maxDistance, const AABB& box, GLfloat& distance)
+	{
+		glm::vec3 t0 = (box.min - origin) * invDirection;
+		glm::vec3 t1 = (box.max - origin) * invDirection;
+		glm::vec3 tNear = glm::min(t0, t1);
+		glm::vec3 tFar	= glm::max(t0, t1);
+		GLfloat enter = glm::max(glm::max(tNear.x, tNear.y), glm::max(tNear.z, 0.f));
+		GLfloat exit  = glm::min(glm::min(tFar.x, tFar.y), glm::min(tFar.z, maxDistance));
+		distance = enter;
+		return enter <= exit;
+	}
+
+	// Moller-Trumbore; both sides of the triangle count
+	inline bool Bvh::_Intersects(const Ray& ray, const Triangle& triangle, GLfloat& distance)
+	{
+		glm::vec3 p = glm::cross(ray.direction, triangle.edge2);
+		GLfloat det = glm::dot(triangle.edge1, p);
+		if (std::abs(det) < 1e-12f)
+		{
+			return false;
+		}
+		GLfloat invDet = 1.f / det;
+
+		glm::vec3 s = ray.origin - triangle.v0;
+		GLfloat u = glm::dot(s, p) * invDet;
+		if (u < 0.f || u > 1.f)
+		{
+			return false;
+		}
+		glm::vec3 q = glm::cross(s, triangle.edge1);
+		GLfloat v = glm::dot(ray.direction, q) * invDet;
+		if (v < 0.f || u + v > 1.f)
+		{
+			return false;
+		}
+		distance = glm::dot(triangle.edge2, q) * invDet;
+		return distance >= 0.f && distance <= ray.maxDistance;
+	}
+}
\ No newline at end of file
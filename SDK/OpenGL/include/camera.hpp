@@ -73,6 +73,14 @@ public:
 		updateCameraVectors();
 	}
 
+	// Points the camera along the given Euler angles, e.g. for scripted camera paths
+	void SetOrientation(float yaw, float pitch)
+	{
+		Yaw = yaw;
+		Pitch = pitch;
+		updateCameraVectors();
+	}
+
 	// Processes input received from any keyboard-like input system. Accepts input parameter in the form of camera defined ENUM (to abstract it from windowing systems)
 	void ProcessKeyboard(Camera_Movement direction, float deltaTime)
 	{
@@ -0,0 +1,142 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+namespace gl
+{
+	// An authored camera path, one key per line of a text file:
+	//
+	//     <time in seconds> <position x> <y> <z> <yaw> <pitch>
+	//
+	// with angles in degrees as Camera uses them; '#' starts a comment. Times must increase. The path runs
+	// through the keys on a Catmull-Rom spline and loops; when the last key repeats the first (the yaw may be
+	// whole turns apart), the spline is closed and the loop has no kink. Angles are interpolated as they are
+	// written, so a path turning past 180 degrees keeps counting (-90, 0, 90, 180, 270) rather than wrapping.
+	class CameraPath
+	{
+	public:
+		struct Key
+		{
+			float	  time;
+			glm::vec3 position;
+			float	  yaw;
+			float	  pitch;
+		};
+
+		CameraPath() : mClosed(false) {}
+
+		bool Load(const std::string& path);
+		bool IsEmpty() const { return mKeys.empty(); }
+		float GetDuration() const { return mKeys.empty() ? 0.f : mKeys.back().time - mKeys.front().time; }
+
+		void Sample(float time, glm::vec3& position, float& yaw, float& pitch) const;
+
+	private:
+		template <typename T>
+		static T _CatmullRom(const T& p0, const T& p1, const T& p2, const T& p3, float t)
+		{
+			return 0.5f * ((2.f * p1) + (p2 - p0) * t + (2.f * p0 - 5.f * p1 + 4.f * p2 - p3) * (t * t) +
+						   (3.f * p1 - p0 - 3.f * p2 + p3) * (t * t * t));
+		}
+
+		Key _Neighbour(int index) const;
+
+		std::vector<Key> mKeys;
+		bool			 mClosed;
+	};
+
+	bool CameraPath::Load(const std::string& path)
+	{
+		std::ifstream in(path);
+		if (!in)
+		{
+			std::cerr << "Failed to open camera path " << path << std::endl;
+			return false;
+		}
+
+		mKeys.clear();
+		std::string line;
+		while (std::getline(in, line))
+		{
+			std::istringstream fields(line.substr(0, line.find('#')));
+			Key key;
+			if (!(fields >> key.time >> key.position.x >> key.position.y >> key.position.z >> key.yaw >> key.pitch))
+			{
+				continue;
+			}
+			if (!mKeys.empty() && key.time <= mKeys.back().time)
+			{
+				std::cerr << "Camera path " << path << ": key at " << key.time << "s is not after the one before" << std::endl;
+				mKeys.clear();
+				return false;
+			}
+			mKeys.push_back(key);
+		}
+
+		if (mKeys.empty())
+		{
+			std::cerr << "Camera path " << path << " has no keys" << std::endl;
+			return false;
+		}
+
+		const Key& first = mKeys.front();
+		const Key& last	 = mKeys.back();
+		mClosed = mKeys.size() > 2 && first.position == last.position && first.pitch == last.pitch &&
+				  std::fmod(last.yaw - first.yaw, 360.f) == 0.f;
+		return true;
+	}
+
+	// Keys before the first and after the last: the other end of a closed path, skipping its repeated key and
+	// turned by the path's whole turns of yaw, else the end key itself
+	CameraPath::Key CameraPath::_Neighbour(int index) const
+	{
+		int count = static_cast<int>(mKeys.size());
+		if (index >= 0 && index < count)
+		{
+			return mKeys[index];
+		}
+		if (!mClosed)
+		{
+			return mKeys[index < 0 ? 0 : count - 1];
+		}
+
+		float turns = mKeys.back().yaw - mKeys.front().yaw;
+		Key key		= mKeys[index < 0 ? count - 2 : 1];
+		key.yaw += index < 0 ? -turns : turns;
+		return key;
+	}
+
+	void CameraPath::Sample(float time, glm::vec3& position, float& yaw, float& pitch) const
+	{
+		if (mKeys.size() == 1 || GetDuration() <= 0.f)
+		{
+			position = mKeys.front().position;
+			yaw		 = mKeys.front().yaw;
+			pitch	 = mKeys.front().pitch;
+			return;
+		}
+
+		time = mKeys.front().time + std::fmod(std::max(time, 0.f), GetDuration());
+		int segment = 0;
+		while (segment + 2 < static_cast<int>(mKeys.size()) && mKeys[segment + 1].time <= time)
+		{
+			++segment;
+		}
+
+		Key		   k0 = _Neighbour(segment - 1);
+		const Key& k1 = mKeys[segment];
+		const Key& k2 = mKeys[segment + 1];
+		Key		   k3 = _Neighbour(segment + 2);
+		float t = (time - k1.time) / (k2.time - k1.time);
+
+		position = _CatmullRom(k0.position, k1.position, k2.position, k3.position, t);
+		yaw		 = _CatmullRom(k0.yaw, k1.yaw, k2.yaw, k3.yaw, t);
+		pitch	 = _CatmullRom(k0.pitch, k1.pitch, k2.pitch, k3.pitch, t);
+	}
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
+#include "gl_state.hpp"
 
 namespace gl
 {
@@ -10,7 +11,7 @@ namespace gl
 	{
 		unsigned int texID;
 		glGenTextures(1, &texID);
-		glBindTexture(GL_TEXTURE_CUBE_MAP, texID);
+		GLState::Instance()->BindTexture(GL_TEXTURE_CUBE_MAP, texID);
 
 		for (unsigned int i = 0; i < tFaces.size(); i++)
 		{
@@ -67,7 +68,7 @@ namespace gl
 				dataFormat = GL_RGBA;
 			}
 
-			glBindTexture(GL_TEXTURE_2D, texID);
+			GLState::Instance()->BindTexture(GL_TEXTURE_2D, texID);
 			glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, dataFormat, GL_UNSIGNED_BYTE, data);
 			glGenerateMipmap(GL_TEXTURE_2D);
 
@@ -97,7 +98,7 @@ namespace gl
 		{
 
 			glGenTextures(1, &texID);
-			glBindTexture(GL_TEXTURE_2D, texID);
+			GLState::Instance()->BindTexture(GL_TEXTURE_2D, texID);
 			// Note how we specify the texture's data value to be float
 			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, width, height, 0, GL_RGB, GL_FLOAT, pData);
 
@@ -119,7 +120,7 @@ namespace gl
 	{
 		GLuint emptyCubeMap;
 		glGenTextures(1, &emptyCubeMap);
-		glBindTexture(GL_TEXTURE_CUBE_MAP, emptyCubeMap);
+		GLState::Instance()->BindTexture(GL_TEXTURE_CUBE_MAP, emptyCubeMap);
 		for (unsigned int i = 0; i < 6; ++i)
 		{
 			glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, nullptr);
@@ -137,7 +138,7 @@ namespace gl
 	{
 		GLuint emptyCubeMap;
 		glGenTextures(1, &emptyCubeMap);
-		glBindTexture(GL_TEXTURE_CUBE_MAP, emptyCubeMap);
+		GLState::Instance()->BindTexture(GL_TEXTURE_CUBE_MAP, emptyCubeMap);
 		for (unsigned int i = 0; i < 6; ++i)
 		{
 			glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, size, size, 0, GL_RGB, GL_FLOAT, nullptr);
@@ -157,7 +158,7 @@ namespace gl
 	{
 		// make sure the viewport matches the new window dimensions; note that width and 
 		// height will be significantly larger than specified on retina displays.
-		glViewport(0, 0, width, height);
+		GLState::Instance()->SetViewport(0, 0, width, height);
 	}
 
 	void MouseCallback(GLFWwindow* window, double xpos, double ypos)
@@ -1,279 +1,108 @@
 #pragma once
 #include <glad/glad.h>
 #include <vector>
+#include "bounds.hpp"
+#include "instancing.hpp"
+#include "geometry_registry.hpp"
+#include "draw_list.hpp"
 
 namespace gl
 {
+	// A view of one primitive in the GeometryRegistry. Constructing a mesh allocates nothing on the GPU; all
+	// meshes of a kind share the registry's buffers and the VAO of their vertex layout.
 	class BaseMesh
 	{
 	public:
-		BaseMesh() : mVao(0), mIndexCount(0)
+		BaseMesh(Primitive primitive, Tessellation tessellation, VertexLayout layout)
+			: mLayout(layout), mRange(GeometryRegistry::Instance()->Get(primitive, tessellation))
 		{
 		}
 
-		virtual void Draw() const = 0;
-
-	protected:
-		GLuint mVao;
-		GLuint mIndexCount;
-	};
+		virtual void Draw() const
+		{
+			GeometryRegistry::Instance()->Draw(mRange, mLayout);
+		}
 
-	class PlaneMesh : public BaseMesh
-	{
-	public:
-		PlaneMesh()
+		// Draws every instance in the buffer with a single call
+		virtual void DrawInstanced(const InstanceBuffer& instances) const
 		{
-			glGenVertexArrays(1, &mVao);
-			glBindVertexArray(mVao);
-			{
-				float floor[] = {
-					// vertex           // normal		// uv
-					1.0f, 0.f,  1.0f,  0.f, 1.f, 0.f,  1.f, 1.f,
-					-1.0f, 0.f,  1.0f,  0.f, 1.f, 0.f,  0.f, 1.f,
-					-1.0f, 0.f, -1.0f,  0.f, 1.f, 0.f,  0.f, 0.f,
+			instances.Attach(GeometryRegistry::Instance()->GetVao(mLayout));
+			GeometryRegistry::Instance()->DrawInstanced(mRange, mLayout, instances.count());
+		}
 
-					1.0f, 0.f,  1.0f,  0.f, 1.f, 0.f,  1.f, 1.f,
-					-1.0f, 0.f, -1.0f,  0.f, 1.f, 0.f,  0.f, 0.f,
-					1.0f, 0.f, -1.0f,  0.f, 1.f, 0.f,  1.f, 0.f,
-				};
-				GLuint vbo;
-				glGenBuffers(1, &vbo);
-				glBindBuffer(GL_ARRAY_BUFFER, vbo);
-				glBufferData(GL_ARRAY_BUFFER, sizeof(floor), &floor, GL_STATIC_DRAW);
-				glEnableVertexAttribArray(0);
-				glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-				glEnableVertexAttribArray(1);
-				glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-				glEnableVertexAttribArray(2);
-				glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-			}
-			glBindVertexArray(0);
+		// Draws count instances that fetch their own data by gl_InstanceID
+		virtual void DrawInstanced(GLsizei count) const
+		{
+			GeometryRegistry::Instance()->DrawInstanced(mRange, mLayout, count);
 		}
 
-		virtual void Draw() const override
+		// A DrawList packet for this mesh; textures, material and model are left to the caller
+		DrawPacket GetPacket(GLuint program) const
 		{
-			glBindVertexArray(mVao);
-			{
-				glDrawArrays(GL_TRIANGLES, 0, 6);
-			}
-			glBindVertexArray(0);
+			DrawPacket packet;
+			packet.program	  = program;
+			packet.vao		  = GeometryRegistry::Instance()->GetVao(mLayout);
+			packet.mode		  = mRange.mode;
+			packet.count	  = mRange.indexCount;
+			packet.firstIndex = mRange.firstIndex;
+			packet.baseVertex = mRange.baseVertex;
+			return packet;
 		}
+
+		// Model space bounds
+		const AABB&			  GetBounds()		  const { return mRange.bounds; }
+		const BoundingSphere& GetBoundingSphere() const { return mRange.boundingSphere; }
+
+	protected:
+		VertexLayout  mLayout;
+		GeometryRange mRange;
 	};
 
-	class CubeMesh : public BaseMesh
+	class PlaneMesh : public BaseMesh
 	{
 	public:
-		CubeMesh()
+		PlaneMesh(Tessellation tessellation = TESSELLATION_LOW) : BaseMesh(PRIMITIVE_PLANE, tessellation, LAYOUT_POS_NORMAL_UV)
 		{
-			glGenVertexArrays(1, &mVao);
-			glBindVertexArray(mVao);
-			{
-				GLfloat vertices[] = {
-					// Back face
-					-0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, // Bottom-left
-					0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 1.0f, 1.0f, // top-right
-					0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 1.0f, 0.0f, // bottom-right         
-					0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 1.0f, 1.0f,  // top-right
-					-0.5f, -0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f,  // bottom-left
-					-0.5f, 0.5f, -0.5f, 0.0f, 0.0f, -1.0f, 0.0f, 1.0f,// top-left
-					// Front face
-					-0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, // bottom-left
-					0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f,  // bottom-right
-					0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f,  // top-right
-					0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, // top-right
-					-0.5f, 0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f,  // top-left
-					-0.5f, -0.5f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,  // bottom-left
-					// Left face
-					-0.5f, 0.5f, 0.5f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f, // top-right
-					-0.5f, 0.5f, -0.5f, -1.0f, 0.0f, 0.0f, 1.0f, 1.0f, // top-left
-					-0.5f, -0.5f, -0.5f, -1.0f, 0.0f, 0.0f, 0.0f, 1.0f,  // bottom-left
-					-0.5f, -0.5f, -0.5f, -1.0f, 0.0f, 0.0f, 0.0f, 1.0f, // bottom-left
-					-0.5f, -0.5f, 0.5f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f,  // bottom-right
-					-0.5f, 0.5f, 0.5f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f, // top-right
-					// Right face
-					0.5f, 0.5f, 0.5f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, // top-left
-					0.5f, -0.5f, -0.5f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, // bottom-right
-					0.5f, 0.5f, -0.5f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, // top-right         
-					0.5f, -0.5f, -0.5f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f,  // bottom-right
-					0.5f, 0.5f, 0.5f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,  // top-left
-					0.5f, -0.5f, 0.5f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, // bottom-left     
-					// Bottom face
-					-0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 0.0f, 1.0f, // top-right
-					0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 1.0f, 1.0f, // top-left
-					0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 1.0f, 0.0f,// bottom-left
-					0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 1.0f, 0.0f, // bottom-left
-					-0.5f, -0.5f, 0.5f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f, // bottom-right
-					-0.5f, -0.5f, -0.5f, 0.0f, -1.0f, 0.0f, 0.0f, 1.0f, // top-right
-					// Top face
-					-0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,// top-left
-					0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, // bottom-right
-					0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, // top-right     
-					0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, // bottom-right
-					-0.5f, 0.5f, -0.5f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,// top-left
-					-0.5f, 0.5f, 0.5f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f // bottom-left        
-				};
-				GLuint vbo;
-				glGenBuffers(1, &vbo);
-				glBindBuffer(GL_ARRAY_BUFFER, vbo);
-				glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-				glEnableVertexAttribArray(0);
-				glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(GLfloat), (GLvoid*)0);
-				glEnableVertexAttribArray(1);
-				glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-				glEnableVertexAttribArray(2);
-				glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(GLfloat), (GLvoid*)(6 * sizeof(GLfloat)));
-				glBindBuffer(GL_ARRAY_BUFFER, 0);
-			}
-			glBindVertexArray(0);
 		}
+	};
 
-		virtual void Draw() const override
+	class CubeMesh : public BaseMesh
+	{
+	public:
+		CubeMesh(Tessellation tessellation = TESSELLATION_LOW) : BaseMesh(PRIMITIVE_CUBE, tessellation, LAYOUT_POS_NORMAL_UV)
 		{
-			glBindVertexArray(mVao);
-			{
-				glDrawArrays(GL_TRIANGLES, 0, 36);
-			}
-			glBindVertexArray(0);
 		}
 	};
 
 	class QuadMesh : public BaseMesh
 	{
 	public:
-		QuadMesh()
+		QuadMesh() : BaseMesh(PRIMITIVE_QUAD, TESSELLATION_LOW, LAYOUT_POS_UV)
 		{
-			glGenVertexArrays(1, &mVao);
-			glBindVertexArray(mVao);
-			{
-				GLfloat quadVertices[] = {
-					// Positions        // Texture Coords
-					-1.0f, 1.0f, 0.0f, 0.0f, 1.0f,
-					-1.0f, -1.0f, 0.0f, 0.0f, 0.0f,
-					1.0f, 1.0f, 0.0f, 1.0f, 1.0f,
-					1.0f, -1.0f, 0.0f, 1.0f, 0.0f,
-				};
-
-				GLuint vbo;
-				glGenBuffers(1, &vbo);
-				glBindBuffer(GL_ARRAY_BUFFER, vbo);
-				glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), &quadVertices, GL_STATIC_DRAW);
-				glEnableVertexAttribArray(0);
-				glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), (GLvoid*)0);
-				glEnableVertexAttribArray(1);
-				glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-			}
-			glBindVertexArray(0);
 		}
+	};
 
-		virtual void Draw() const override
+	class Sphere : public BaseMesh
+	{
+	public:
+		Sphere(Tessellation tessellation = TESSELLATION_HIGH) : BaseMesh(PRIMITIVE_SPHERE, tessellation, LAYOUT_POS_UV_NORMAL)
 		{
-			glBindVertexArray(mVao);
-			{
-				glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-			}
-			glBindVertexArray(0);
 		}
 	};
 
-	class Sphere : public BaseMesh
+	class CylinderMesh : public BaseMesh
 	{
 	public:
-		Sphere()
+		CylinderMesh(Tessellation tessellation = TESSELLATION_MEDIUM) : BaseMesh(PRIMITIVE_CYLINDER, tessellation, LAYOUT_POS_NORMAL_UV)
 		{
-			glGenVertexArrays(1, &mVao);
-			glBindVertexArray(mVao);
-			{
-				std::vector<glm::vec3> positions;
-				std::vector<glm::vec2> uv;
-				std::vector<glm::vec3> normals;
-				std::vector<unsigned>  indices;
-
-				const unsigned int X_SEGMENTS = 64;
-				const unsigned int Y_SEGMENTS = 64;
-				const float PI = 3.14159265359;
-				for (unsigned int y = 0; y <= Y_SEGMENTS; ++y)
-				{
-					for (unsigned int x = 0; x <= X_SEGMENTS; ++x)
-					{
-						float xSegment = (float)x / (float)X_SEGMENTS;
-						float ySegment = (float)y / (float)Y_SEGMENTS;
-						float xPos = std::cos(xSegment * 2.0f * PI) * std::sin(ySegment * PI);
-						float yPos = std::cos(ySegment * PI);
-						float zPos = std::sin(xSegment * 2.0f * PI) * std::sin(ySegment * PI);
-
-						positions.push_back(glm::vec3(xPos, yPos, zPos));
-						uv.push_back(glm::vec2(xSegment, ySegment));
-						normals.push_back(glm::vec3(xPos, yPos, zPos));
-					}
-				}
-
-				bool oddRow = false;
-				for (unsigned int y = 0; y < Y_SEGMENTS; ++y)
-				{
-					if (!oddRow) // even rows: y == 0, y == 2; and so on
-					{
-						for (int x = 0; x <= X_SEGMENTS; ++x)
-						{
-							indices.push_back(y       * (X_SEGMENTS + 1) + x);
-							indices.push_back((y + 1) * (X_SEGMENTS + 1) + x);
-						}
-					}
-					else
-					{
-						for (int x = X_SEGMENTS; x >= 0; --x)
-						{
-							indices.push_back((y + 1) * (X_SEGMENTS + 1) + x);
-							indices.push_back(y       * (X_SEGMENTS + 1) + x);
-						}
-					}
-					oddRow = !oddRow;
-				}
-				mIndexCount = indices.size();
-
-				std::vector<float> data;
-				for (unsigned int i = 0; i < positions.size(); ++i)
-				{
-					data.push_back(positions[i].x);
-					data.push_back(positions[i].y);
-					data.push_back(positions[i].z);
-					if (uv.size() > 0)
-					{
-						data.push_back(uv[i].x);
-						data.push_back(uv[i].y);
-					}
-					if (normals.size() > 0)
-					{
-						data.push_back(normals[i].x);
-						data.push_back(normals[i].y);
-						data.push_back(normals[i].z);
-					}
-				}
-
-				GLuint vbo, ebo;
-				glGenBuffers(1, &vbo);
-				glGenBuffers(1, &ebo);
-				glBindBuffer(GL_ARRAY_BUFFER, vbo);
-				glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), &data[0], GL_STATIC_DRAW);
-				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-				glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
-				float stride = (3 + 2 + 3) * sizeof(float);
-				glEnableVertexAttribArray(0);
-				glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
-				glEnableVertexAttribArray(1);
-				glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
-				glEnableVertexAttribArray(2);
-				glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, stride, (void*)(5 * sizeof(float)));
-			}
-			glBindVertexArray(0);
 		}
+	};
 
-		virtual void Draw() const override
+	class TorusMesh : public BaseMesh
+	{
+	public:
+		TorusMesh(Tessellation tessellation = TESSELLATION_MEDIUM) : BaseMesh(PRIMITIVE_TORUS, tessellation, LAYOUT_POS_NORMAL_UV)
 		{
-			glBindVertexArray(mVao);
-			{
-				glDrawElements(GL_TRIANGLE_STRIP, mIndexCount, GL_UNSIGNED_INT, 0);
-			}
-			glBindVertexArray(0);
 		}
 	};
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 #include "camera.hpp"
+#include "camera_path.hpp"
+#include <string>
+#include <fstream>
+#include <iostream>
 
 namespace gl
 {
@@ -22,6 +26,10 @@ namespace gl
 
 		void MouseCallback(GLdouble xpos, GLdouble ypos)
 		{
+			if (IsPlayingBack())
+			{
+				return;
+			}
 			if (mFirstMouse)
 			{
 				mLastX = xpos;
@@ -35,6 +43,10 @@ namespace gl
 			mLastX = xpos;
 			mLastY = ypos;
 
+			if (mRecord.is_open())
+			{
+				mRecord << "M " << xoffset << " " << yoffset << "\n";
+			}
 			mCamera.ProcessMouseMovement(xoffset, yoffset);
 		}
 
@@ -43,27 +55,154 @@ namespace gl
 			if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
 				glfwSetWindowShouldClose(window, true);
 
+			GLuint keys = 0;
 			if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
-				mCamera.ProcessKeyboard(FORWARD, tDeltaTime);
+				keys |= 1 << FORWARD;
 			if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
-				mCamera.ProcessKeyboard(BACKWARD, tDeltaTime);
+				keys |= 1 << BACKWARD;
 			if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
-				mCamera.ProcessKeyboard(LEFT, tDeltaTime);
+				keys |= 1 << LEFT;
 			if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
-				mCamera.ProcessKeyboard(RIGHT, tDeltaTime);
+				keys |= 1 << RIGHT;
+
+			if (mRecord.is_open())
+			{
+				mRecord << "F " << tDeltaTime << " " << keys << "\n";
+			}
+			_ApplyKeys(keys, tDeltaTime);
+		}
+
+		// Input recordings are text, one line per event in the order the camera saw them:
+		//
+		//     M <x offset> <y offset>      a cursor movement, after the first-mouse handling
+		//     F <delta time> <keys>        the end of a frame's input: the camera moves by the keys held
+		//                                  (bit Camera_Movement set per key) over the frame's delta time
+		//
+		// Playing one back from the same starting pose repeats the camera path exactly, whatever the frame rate.
+		bool StartRecording(const std::string& path)
+		{
+			mRecord.open(path);
+			if (!mRecord)
+			{
+				std::cerr << "Failed to open input recording " << path << std::endl;
+				return false;
+			}
+			mRecord.precision(17);
+			mRecord << "GLINPUT 1\n";
+			return true;
+		}
+
+		void StopRecording()
+		{
+			mRecord.close();
+		}
+
+		bool StartPlayback(const std::string& path)
+		{
+			mPlayback.open(path);
+			std::string magic;
+			GLuint version = 0;
+			if (!(mPlayback >> magic >> version) || magic != "GLINPUT" || version != 1)
+			{
+				std::cerr << "Failed to open input recording " << path << std::endl;
+				mPlayback.close();
+				return false;
+			}
+			mPlaybackDone = false;
+			return true;
+		}
+
+		bool IsPlayingBack() const { return mPlayback.is_open(); }
+		bool IsPlaybackDone() const { return mPlaybackDone; }
+
+		// Applies the next recorded frame in place of ProcessInput; at the end of the recording the camera stays put
+		void PlaybackFrame()
+		{
+			std::string event;
+			while (!mPlaybackDone && mPlayback >> event)
+			{
+				if (event == "M")
+				{
+					GLdouble xoffset, yoffset;
+					mPlayback >> xoffset >> yoffset;
+					mCamera.ProcessMouseMovement(xoffset, yoffset);
+				}
+				else if (event == "F")
+				{
+					GLfloat deltaTime;
+					GLuint	keys;
+					mPlayback >> deltaTime >> keys;
+					_ApplyKeys(keys, deltaTime);
+					return;
+				}
+				else
+				{
+					std::cerr << "Unknown input event " << event << ", stopping playback" << std::endl;
+					break;
+				}
+			}
+			mPlaybackDone = true;
+		}
+
+		// Authored path (see CameraPath) that replaces input while loaded
+		bool LoadCameraPath(const std::string& path) { return mCameraPath.Load(path); }
+		bool HasCameraPath() const { return !mCameraPath.IsEmpty(); }
+
+		void FollowCameraPath(GLfloat tTime)
+		{
+			GLfloat yaw, pitch;
+			mCameraPath.Sample(tTime, mCamera.Position, yaw, pitch);
+			mCamera.SetOrientation(yaw, pitch);
+		}
+
+		// Scripted camera for unattended runs: from the pose the camera has when the path begins, it sways left and
+		// right while turning and slowly dollies in, so every run of a sample renders the same views
+		void BeginScriptedPath()
+		{
+			mPathOrigin = mCamera.Position;
+			mPathFront	= mCamera.Front;
+			mPathRight	= mCamera.Right;
+			mPathYaw	= mCamera.Yaw;
+			mPathPitch	= mCamera.Pitch;
+		}
+
+		void FollowScriptedPath(GLfloat tTime)
+		{
+			mCamera.Position = mPathOrigin + mPathRight * (0.5f * glm::sin(tTime * 0.5f)) + mPathFront * (0.5f * (1.0f - glm::cos(tTime * 0.25f)));
+			mCamera.SetOrientation(mPathYaw - 15.0f * glm::sin(tTime * 0.5f), mPathPitch + 5.0f * glm::sin(tTime * 0.7f));
 		}
 
 		const Camera& GetCamera() const { return mCamera; }
 		void ResetCamera(const glm::vec3& pos, const glm::vec3& up) { mCamera.Reset(pos, up); }
 
 	protected:
-		Controller() : mCamera(glm::vec3(0.0f, 0.0f, 3.0f)), mFirstMouse(true) {}
+		Controller() : mCamera(glm::vec3(0.0f, 0.0f, 3.0f)), mFirstMouse(true), mPathYaw(YAW), mPathPitch(PITCH), mPlaybackDone(false) {}
 
 	private:
+		void _ApplyKeys(GLuint keys, GLfloat tDeltaTime)
+		{
+			for (auto movement : { FORWARD, BACKWARD, LEFT, RIGHT })
+			{
+				if (keys & (1 << movement))
+				{
+					mCamera.ProcessKeyboard(movement, tDeltaTime);
+				}
+			}
+		}
+
 		GLdouble	mLastX;
 		GLdouble	mLastY;
 		GLboolean	mFirstMouse;
 		Camera		mCamera;
+		glm::vec3	mPathOrigin;
+		glm::vec3	mPathFront;
+		glm::vec3	mPathRight;
+		GLfloat		mPathYaw;
+		GLfloat		mPathPitch;
+		std::ofstream	mRecord;
+		std::ifstream	mPlayback;
+		GLboolean		mPlaybackDone;
+		CameraPath		mCameraPath;
 
 		static Controller* mInstance;
 	};
@@ -0,0 +1,297 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include "gl_state.hpp"
+
+namespace gl
+{
+	enum DrawLayer
+	{
+		DRAW_LAYER_OPAQUE = 0,		// sorted by state, then front to back
+		DRAW_LAYER_BLENDED,			// back to front, alpha blended, no depth writes
+		DRAW_LAYER_COUNT
+	};
+
+	// Everything needed to issue one indexed draw (GL_UNSIGNED_INT indices) without touching the caller's state
+	struct DrawPacket
+	{
+		static const GLuint MAX_TEXTURES = 4;
+
+		GLuint	  program;
+		GLuint	  vao;
+		GLuint	  material;						// any id shared by packets with the same textures, e.g. the first one
+		GLuint	  textures[MAX_TEXTURES];		// GL_TEXTURE_2D per unit; 0 leaves the unit alone
+		GLenum	  mode;
+		GLuint	  count;
+		GLuint	  firstIndex;
+		GLint	  baseVertex;
+
+		// Uploaded to the program's "model" and "params" uniforms, when it has them
+		glm::mat4 model;
+		glm::vec4 params;
+
+		DrawPacket() : program(0), vao(0), material(0), mode(GL_TRIANGLES), count(0), firstIndex(0), baseVertex(0), model(1.0f), params(0.0f)
+		{
+			std::memset(textures, 0, sizeof(textures));
+		}
+	};
+
+	// Program, VAO and texture binds issued for a list of packets
+	struct DrawListStats
+	{
+		GLuint draws;
+		GLuint programs;
+		GLuint vaos;
+		GLuint textures;
+
+		DrawListStats() : draws(0), programs(0), vaos(0), textures(0) {}
+
+		GLuint StateChanges() const { return programs + vaos + textures; }
+	};
+
+	// Passes submit packets in any order; Execute radix sorts them on a 64 bit key and issues them with only the
+	// state changes the sorted order needs.
+	//
+	//   opaque:  layer:4 | program:10 | material:14 | vao:12 | depth:24
+	//   blended: layer:4 | far-to-near depth:24 | program:10 | material:14 | vao:12
+	//
+	// Program, material and VAO names are mapped to small ids the first time they are seen. Depth is the view
+	// distance of the model matrix's origin over the far plane given to Begin.
+	class DrawList
+	{
+	public:
+		DrawList() : mFarPlane(1.f) {}
+
+		void Begin(const glm::mat4& view, GLfloat farPlane);
+		void Submit(const DrawPacket& packet, DrawLayer layer = DRAW_LAYER_OPAQUE);
+		void Execute();
+
+		size_t size() const { return mPackets.size(); }
+
+		// What Execute issued, and what the same packets would have cost in submission order
+		const DrawListStats& GetStats()			  const { return mStats; }
+		const DrawListStats& GetSubmissionStats() const { return mSubmissionStats; }
+
+	private:
+		struct Uniforms
+		{
+			GLint model;
+			GLint params;
+		};
+
+		static GLuint _Id(std::unordered_map<GLuint, GLuint>& ids, GLuint name, GLuint bits);
+		static DrawListStats _CountStates(const std::vector<DrawPacket>& packets, const GLuint* order);
+		void _Sort();
+		static PipelineState _LayerPipeline(const PipelineState& base, DrawLayer layer);
+
+		glm::mat4 mView;
+		GLfloat	  mFarPlane;
+
+		std::vector<DrawPacket>	mPackets;
+		std::vector<uint64_t>	mKeys;
+		std::vector<GLuint>		mOrder;
+		std::vector<uint64_t>	mSortKeys;
+		std::vector<uint64_t>	mScratchKeys;
+		std::vector<GLuint>		mScratchOrder;
+
+		std::unordered_map<GLuint, GLuint>	 mProgramIds;
+		std::unordered_map<GLuint, GLuint>	 mMaterialIds;
+		std::unordered_map<GLuint, GLuint>	 mVaoIds;
+		std::unordered_map<GLuint, Uniforms> mUniforms;
+
+		DrawListStats mStats;
+		DrawListStats mSubmissionStats;
+	};
+
+	inline void DrawList::Begin(const glm::mat4& view, GLfloat farPlane)
+	{
+		mView	  = view;
+		mFarPlane = farPlane;
+		mPackets.clear();
+		mKeys.clear();
+	}
+
+	void DrawList::Submit(const DrawPacket& packet, DrawLayer layer)
+	{
+		const uint64_t DEPTH_MASK = (1ull << 24) - 1;
+
+		GLfloat distance = -(mView * packet.model[3]).z;
+		uint64_t depth	  = static_cast<uint64_t>(glm::clamp(distance / mFarPlane, 0.f, 1.f) * DEPTH_MASK);
+		uint64_t program  = _Id(mProgramIds, packet.program, 10);
+		uint64_t material = _Id(mMaterialIds, packet.material, 14);
+		uint64_t vao	  = _Id(mVaoIds, packet.vao, 12);
+
+		uint64_t key = static_cast<uint64_t>(layer) << 60;
+		if (layer == DRAW_LAYER_BLENDED)
+		{
+			key |= (DEPTH_MASK - depth) << 36 | program << 26 | material << 12 | vao;
+		}
+		else
+		{
+			key |= program << 50 | material << 36 | vao << 24 | depth;
+		}
+
+		mPackets.push_back(packet);
+		mKeys.push_back(key);
+	}
+
+	void DrawList::Execute()
+	{
+		_Sort();
+		mStats			 = _CountStates(mPackets, mOrder.data());
+		mSubmissionStats = _CountStates(mPackets, nullptr);
+
+		GLState* state = GLState::Instance();
+		PipelineState pipeline = state->GetPipeline();
+
+		GLuint program = 0, vao = 0;
+		GLuint textures[DrawPacket::MAX_TEXTURES] = {};
+		Uniforms uniforms = { -1, -1 };
+		int layer = -1;
+		for (auto index : mOrder)
+		{
+			const DrawPacket& packet = mPackets[index];
+
+			int packetLayer = static_cast<int>(mKeys[index] >> 60);
+			if (packetLayer != layer)
+			{
+				layer = packetLayer;
+				state->SetPipeline(_LayerPipeline(pipeline, static_cast<DrawLayer>(layer)));
+			}
+			if (packet.program != program)
+			{
+				program = packet.program;
+				state->UseProgram(program);
+
+				auto found = mUniforms.find(program);
+				if (found == mUniforms.end())
+				{
+					Uniforms located = { glGetUniformLocation(program, "model"), glGetUniformLocation(program, "params") };
+					found = mUniforms.emplace(program, located).first;
+				}
+				uniforms = found->second;
+			}
+			if (packet.vao != vao)
+			{
+				vao = packet.vao;
+				state->BindVertexArray(vao);
+			}
+			for (GLuint unit = 0; unit < DrawPacket::MAX_TEXTURES; ++unit)
+			{
+				if (packet.textures[unit] && packet.textures[unit] != textures[unit])
+				{
+					textures[unit] = packet.textures[unit];
+					state->BindTexture(unit, GL_TEXTURE_2D, textures[unit]);
+				}
+			}
+
+			if (uniforms.model >= 0)
+			{
+				glUniformMatrix4fv(uniforms.model, 1, GL_FALSE, glm::value_ptr(packet.model));
+			}
+			if (uniforms.params >= 0)
+			{
+				glUniform4fv(uniforms.params, 1, glm::value_ptr(packet.params));
+			}
+			glDrawElementsBaseVertex(packet.mode, packet.count, GL_UNSIGNED_INT, (void*)(packet.firstIndex * sizeof(GLuint)), packet.baseVertex);
+		}
+
+		state->SetPipeline(pipeline);
+	}
+
+	// LSD radix sort of (key, packet) pairs, a byte per pass; passes where every key has the same byte are skipped
+	void DrawList::_Sort()
+	{
+		size_t count = mKeys.size();
+		mOrder.resize(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			mOrder[i] = static_cast<GLuint>(i);
+		}
+		mSortKeys.assign(mKeys.begin(), mKeys.end());
+		mScratchKeys.resize(count);
+		mScratchOrder.resize(count);
+
+		for (GLuint shift = 0; shift < 64; shift += 8)
+		{
+			size_t offsets[256] = {};
+			for (auto key : mSortKeys)
+			{
+				++offsets[(key >> shift) & 0xFF];
+			}
+			if (count == 0 || offsets[(mSortKeys[0] >> shift) & 0xFF] == count)
+			{
+				continue;
+			}
+
+			size_t sum = 0;
+			for (auto& offset : offsets)
+			{
+				size_t bucket = offset;
+				offset = sum;
+				sum += bucket;
+			}
+			for (size_t i = 0; i < count; ++i)
+			{
+				size_t target = offsets[(mSortKeys[i] >> shift) & 0xFF]++;
+				mScratchKeys[target]  = mSortKeys[i];
+				mScratchOrder[target] = mOrder[i];
+			}
+			mSortKeys.swap(mScratchKeys);
+			mOrder.swap(mScratchOrder);
+		}
+	}
+
+	// Layers only change blending and depth writes; depth testing and culling stay as the caller set them
+	inline PipelineState DrawList::_LayerPipeline(const PipelineState& base, DrawLayer layer)
+	{
+		if (layer == DRAW_LAYER_BLENDED)
+		{
+			return base.WithBlend(true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA).WithDepthWrite(false);
+		}
+		return base.WithBlend(false).WithDepthWrite(true);
+	}
+
+	// order == nullptr walks the packets as submitted
+	DrawListStats DrawList::_CountStates(const std::vector<DrawPacket>& packets, const GLuint* order)
+	{
+		DrawListStats stats;
+		GLuint program = 0, vao = 0;
+		GLuint textures[DrawPacket::MAX_TEXTURES] = {};
+		for (size_t i = 0; i < packets.size(); ++i)
+		{
+			const DrawPacket& packet = packets[order ? order[i] : i];
+			stats.programs += packet.program != program;
+			stats.vaos	   += packet.vao != vao;
+			program = packet.program;
+			vao		= packet.vao;
+			for (GLuint unit = 0; unit < DrawPacket::MAX_TEXTURES; ++unit)
+			{
+				if (packet.textures[unit] && packet.textures[unit] != textures[unit])
+				{
+					textures[unit] = packet.textures[unit];
+					++stats.textures;
+				}
+			}
+			++stats.draws;
+		}
+		return stats;
+	}
+
+	// Ids wrap past the key field's width; colliding names are then only sorted less tightly
+	inline GLuint DrawList::_Id(std::unordered_map<GLuint, GLuint>& ids, GLuint name, GLuint bits)
+	{
+		auto found = ids.find(name);
+		if (found == ids.end())
+		{
+			found = ids.emplace(name, static_cast<GLuint>(ids.size())).first;
+		}
+		return found->second & ((1u << bits) - 1);
+	}
+}
\ No newline at end of file
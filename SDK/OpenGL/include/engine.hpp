@@ -3,9 +3,21 @@
 #include <GLFW/glfw3.h>
 #include <exception>
 #include <vector>
+#include <algorithm>
+#include <string>
 #include <functional>
+#include <typeinfo>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
 #include "renderpass.hpp"
 #include "controller.hpp"
+#include "gl_state.hpp"
+#include "gl_profiler.hpp"
+#include "gl_mock.hpp"
+#include "gl_capture.hpp"
+#include "gl_benchmark.hpp"
+#include "gl_golden.hpp"
 
 namespace gl
 {
@@ -18,6 +30,30 @@ namespace gl
 		Engine();
 		virtual ~Engine();
 
+		// Runs the passes for a fixed number of frames against GLMock instead of a window and driver, to time the
+		// CPU side of submission. Call before Init; setting GL_MOCK_FRAMES in the environment does the same.
+		void UseMockBackend(GLuint frames);
+		// Writes every GL call of the setup and the first frames frames to path, for the Replay tool. Call
+		// before Init; GL_CAPTURE_FILE (and optionally GL_CAPTURE_FRAMES, default 60) in the environment do the same.
+		void CaptureFrames(const std::string& path, GLuint frames);
+		// Renders warmup + frames frames in a hidden window with vsync off and the camera on the input playback
+		// or camera path if one is set, else on the Controller's scripted path, then writes startup and frame
+		// time statistics to path as JSON and returns from Render.
+		// Call before Init; GL_BENCHMARK_FILE in the environment does the same, with GL_BENCHMARK_WARMUP (default
+		// 60), GL_BENCHMARK_FRAMES (default 600) and GL_BENCHMARK_SIZE (WxH, overrides the size given to Init).
+		void RunBenchmark(const std::string& path, GLuint warmup, GLuint frames);
+		// Renders in a hidden window with the camera where the passes put it and time at a fixed 60Hz, writes
+		// the default framebuffer after every pass of frame `frame` to directory as PNGs (see GLGolden) and
+		// returns from Render. Call before Init; GL_GOLDEN_DIR in the environment does the same, with
+		// GL_GOLDEN_FRAME (default 10) and GL_GOLDEN_SIZE (WxH, overrides the size given to Init).
+		void RenderGolden(const std::string& directory, GLuint frame);
+		// Camera input for repeatable runs (see Controller). A recording keeps the live frame times; playback and
+		// camera paths run at a fixed 60Hz, and Render returns when a playback ends unless a benchmark is running.
+		// GL_INPUT_RECORD, GL_INPUT_PLAYBACK and GL_CAMERA_PATH in the environment do the same.
+		void RecordInput(const std::string& path);
+		void PlaybackInput(const std::string& path);
+		void FollowCameraPath(const std::string& path);
+
 		void Init(GLuint width, GLuint height);
 		void Render();
 
@@ -26,17 +62,81 @@ namespace gl
 		void SetCursorPosCallback(CursorPosCallFunc tCallback);
 
 	private:
+		void _CreateWindow(GLuint width, GLuint height, bool visible);
+		void _ForceSize(const char* size);
+		bool _KeepRunning(GLuint frame);
+		void _MoveCamera();
+
 		STime						mTime;
 		SContext					mContext;
 		GLfloat						mLastTime;
 		GLfloat						mStartTime;
 		GLFWwindow*					mWindow;
+		GLuint						mMockFrames;
+		std::string					mCapturePath;
+		GLuint						mCaptureFrames;
+		GLuint						mForcedWidth;
+		GLuint						mForcedHeight;
 		std::vector<RenderPass*>	mRenderPasses;
 	};
 
-	Engine::Engine() : mWindow(nullptr)
+	Engine::Engine() : mWindow(nullptr), mMockFrames(0), mCaptureFrames(60), mForcedWidth(0), mForcedHeight(0)
 	{
+		if (const char* frames = std::getenv("GL_MOCK_FRAMES"))
+		{
+			mMockFrames = static_cast<GLuint>(std::strtoul(frames, nullptr, 10));
+		}
+		if (const char* path = std::getenv("GL_CAPTURE_FILE"))
+		{
+			mCapturePath = path;
+		}
+		if (const char* frames = std::getenv("GL_CAPTURE_FRAMES"))
+		{
+			mCaptureFrames = static_cast<GLuint>(std::strtoul(frames, nullptr, 10));
+		}
+		if (const char* path = std::getenv("GL_BENCHMARK_FILE"))
+		{
+			const char* warmup = std::getenv("GL_BENCHMARK_WARMUP");
+			const char* frames = std::getenv("GL_BENCHMARK_FRAMES");
+			RunBenchmark(path, warmup ? static_cast<GLuint>(std::strtoul(warmup, nullptr, 10)) : 60,
+						 frames ? static_cast<GLuint>(std::strtoul(frames, nullptr, 10)) : 600);
+		}
+		if (const char* directory = std::getenv("GL_GOLDEN_DIR"))
+		{
+			const char* frame = std::getenv("GL_GOLDEN_FRAME");
+			RenderGolden(directory, frame ? static_cast<GLuint>(std::strtoul(frame, nullptr, 10)) : 10);
+		}
+		if (const char* path = std::getenv("GL_INPUT_RECORD"))
+		{
+			RecordInput(path);
+		}
+		if (const char* path = std::getenv("GL_INPUT_PLAYBACK"))
+		{
+			PlaybackInput(path);
+		}
+		if (const char* path = std::getenv("GL_CAMERA_PATH"))
+		{
+			FollowCameraPath(path);
+		}
+		if (GLGolden::Instance()->IsEnabled())
+		{
+			_ForceSize(std::getenv("GL_GOLDEN_SIZE"));
+		}
+		else if (GLBenchmark::Instance()->IsEnabled())
+		{
+			_ForceSize(std::getenv("GL_BENCHMARK_SIZE"));
+		}
+	}
 
+	void Engine::_ForceSize(const char* size)
+	{
+		if (!size)
+		{
+			return;
+		}
+		char* height  = nullptr;
+		mForcedWidth  = static_cast<GLuint>(std::strtoul(size, &height, 10));
+		mForcedHeight = *height == 'x' ? static_cast<GLuint>(std::strtoul(height + 1, nullptr, 10)) : 0;
 	}
 
 	Engine::~Engine()
@@ -44,12 +144,93 @@ namespace gl
 
 	}
 
+	inline void Engine::UseMockBackend(GLuint frames)
+	{
+		mMockFrames = frames;
+	}
+
+	inline void Engine::CaptureFrames(const std::string& path, GLuint frames)
+	{
+		mCapturePath   = path;
+		mCaptureFrames = frames;
+	}
+
+	inline void Engine::RunBenchmark(const std::string& path, GLuint warmup, GLuint frames)
+	{
+		GLBenchmark::Instance()->Configure(path, warmup, frames);
+	}
+
+	inline void Engine::RenderGolden(const std::string& directory, GLuint frame)
+	{
+		GLGolden::Instance()->Configure(directory, std::max<GLuint>(frame, 1));
+	}
+
+	inline void Engine::RecordInput(const std::string& path)
+	{
+		Controller::Instance()->StartRecording(path);
+	}
+
+	inline void Engine::PlaybackInput(const std::string& path)
+	{
+		Controller::Instance()->StartPlayback(path);
+	}
+
+	inline void Engine::FollowCameraPath(const std::string& path)
+	{
+		Controller::Instance()->LoadCameraPath(path);
+	}
+
 	void Engine::Init(GLuint width, GLuint height)
+	{
+		GLBenchmark* benchmark = GLBenchmark::Instance();
+		bool unattended = benchmark->IsEnabled() || GLGolden::Instance()->IsEnabled();
+		if (benchmark->IsEnabled())
+		{
+			benchmark->BeginStartup();
+		}
+		if (unattended && mForcedWidth && mForcedHeight)
+		{
+			width  = mForcedWidth;
+			height = mForcedHeight;
+		}
+
+		// Init context
+		mContext.width = width;
+		mContext.height = height;
+
+		GLADloadproc load = GLMock::GetProcAddress;
+		if (!mMockFrames)
+		{
+			_CreateWindow(width, height, !unattended);
+			load = (GLADloadproc)glfwGetProcAddress;
+		}
+		if (!mCapturePath.empty() && mCaptureFrames)
+		{
+			GLCapture* capture = GLCapture::Instance();
+			capture->Begin(mCapturePath, mCaptureFrames, width, height, load);
+			if (capture->IsRecording())
+			{
+				load = GLCapture::GetProcAddress;
+			}
+		}
+
+		// glad: load all OpenGL function pointers
+		// ---------------------------------------
+		if (!gladLoadGLLoader(load))
+		{
+			throw std::exception("Failed to init GLAD...");
+		}
+		GLState::Instance()->Invalidate();
+		GLProfiler::Instance()->Attach();
+	}
+
+	void Engine::_CreateWindow(GLuint width, GLuint height, bool visible)
 	{
 		glfwInit();
 		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
 		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
 		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
 
 #ifdef __APPLE__
 		glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE); // uncomment this statement to fix compilation on OS X
@@ -62,20 +243,14 @@ namespace gl
 			throw std::exception("Failed to init GLFW...");
 		}
 		glfwMakeContextCurrent(mWindow);
-
-		// glad: load all OpenGL function pointers
-		// ---------------------------------------
-		if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+		if (!visible)
 		{
-			throw std::exception("Failed to init GLAD...");
+			// Unattended runs measure frame times, not the refresh rate
+			glfwSwapInterval(0);
 		}
 
 		// Options
 		// glfwSetInputMode(mWindow, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
-
-		// Init context
-		mContext.width = width;
-		mContext.height = height;
 	}
 
 	void Engine::Render()
@@ -85,32 +260,137 @@ namespace gl
 			pass->Init(mContext);
 		}
 
-		mLastTime = mStartTime = glfwGetTime();
-		while (!glfwWindowShouldClose(mWindow))
+		// Mock, benchmark, golden and replayed frames advance time at a fixed 60Hz so every run submits the same work
+		using Clock = std::chrono::steady_clock;
+		auto mockStart = Clock::now();
+		GLuint frame = 0;
+
+		GLBenchmark* benchmark	= GLBenchmark::Instance();
+		GLGolden*	 golden		= GLGolden::Instance();
+		Controller*	 controller = Controller::Instance();
+		bool fixedStep = mMockFrames || benchmark->IsEnabled() || golden->IsEnabled() || controller->IsPlayingBack() ||
+						 controller->HasCameraPath();
+		controller->BeginScriptedPath();
+
+		mLastTime = mStartTime = fixedStep ? 0.f : glfwGetTime();
+		while (_KeepRunning(frame))
 		{
 			// set times
-			auto current = glfwGetTime();
+			auto current = fixedStep ? (frame + 1) / 60.f : glfwGetTime();
 			mTime.SetTime(current - mStartTime);
 			mTime.SetDeltalTime(current - mLastTime);
 			mLastTime  = current;
+			++frame;
 
-			Controller::Instance()->ProcessInput(mWindow, mTime._DeltaTime.x);
+			// Golden images keep the camera where the passes put it
+			if (!golden->IsEnabled())
+			{
+				_MoveCamera();
+			}
+			if (benchmark->IsEnabled())
+			{
+				benchmark->BeginFrame();
+			}
 
-			glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+			// glClear honours the depth mask, so a pass that ended with depth writes off would keep last frame's depth
+			GLProfiler* profiler = GLProfiler::Instance();
+			GLCapture*	capture	 = GLCapture::Instance();
+			profiler->BeginFrame();
+			capture->BeginFrame();
+
+			GLState* state = GLState::Instance();
+			state->NextFrame();
+			state->BindFramebuffer(GL_FRAMEBUFFER, 0);
+			state->SetPipeline(state->GetPipeline().WithDepthWrite(true));
+			GLState::Instance()->SetClearColor(0.05f, 0.05f, 0.05f, 1.0f);
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-			for (auto& pass : mRenderPasses)
+			for (GLuint i = 0; i < mRenderPasses.size(); ++i)
 			{
+				RenderPass* pass = mRenderPasses[i];
+				profiler->BeginPass(typeid(*pass).name());
+				capture->BeginPass(typeid(*pass).name());
 				pass->Update(mContext, mTime);
+				capture->EndPass();
+				profiler->EndPass();
+				if (golden->IsEnabled())
+				{
+					golden->CapturePass(frame, i, typeid(*pass).name(), mContext.width, mContext.height);
+				}
+			}
+			capture->EndFrame();
+			profiler->EndFrame();
+			if (benchmark->IsEnabled())
+			{
+				benchmark->EndFrame();
+			}
+			if (golden->IsEnabled())
+			{
+				golden->EndFrame(frame);
 			}
 
-			glfwSwapBuffers(mWindow);
-			glfwPollEvents();
+			if (mWindow)
+			{
+				glfwSwapBuffers(mWindow);
+				glfwPollEvents();
+			}
 		}
 
+		GLProfiler::Instance()->CloseCsv();
+		controller->StopRecording();
+		if (benchmark->IsEnabled())
+		{
+			benchmark->Finish(mContext.width, mContext.height);
+		}
+		if (mMockFrames)
+		{
+			double seconds = std::chrono::duration<double>(Clock::now() - mockStart).count();
+			GLMock* mock = GLMock::Instance();
+			std::cout << "GLMock: " << frame << " frames, " << seconds * 1000.0 / frame << " ms/frame CPU, "
+					  << mock->GetTotalCalls() / frame << " GL calls/frame, " << mock->GetErrors().size() << " errors" << std::endl;
+			return;
+		}
 		glfwTerminate();
 	}
 
+	bool Engine::_KeepRunning(GLuint frame)
+	{
+		if (GLGolden::Instance()->IsEnabled())
+		{
+			return !GLGolden::Instance()->IsDone();
+		}
+		if (GLBenchmark::Instance()->IsEnabled())
+		{
+			return !GLBenchmark::Instance()->IsDone();
+		}
+		if (Controller::Instance()->IsPlaybackDone())
+		{
+			return false;
+		}
+		return mMockFrames ? frame < mMockFrames : !glfwWindowShouldClose(mWindow);
+	}
+
+	void Engine::_MoveCamera()
+	{
+		Controller* controller = Controller::Instance();
+		if (controller->IsPlayingBack())
+		{
+			controller->PlaybackFrame();
+		}
+		else if (controller->HasCameraPath())
+		{
+			controller->FollowCameraPath(mTime._Time.y);
+		}
+		else if (GLBenchmark::Instance()->IsEnabled())
+		{
+			controller->FollowScriptedPath(mTime._Time.y);
+		}
+		else if (mWindow)
+		{
+			controller->ProcessInput(mWindow, mTime._DeltaTime.x);
+		}
+	}
+
 	inline void Engine::AddPass(RenderPass* pass)
 	{
 		mRenderPasses.emplace_back(pass);
@@ -118,6 +398,10 @@ namespace gl
 
 	inline void Engine::SetFrameBufferSizeCallback(FrameBufferSizeFunc tCallback)
 	{
+		if (mMockFrames)
+		{
+			return;
+		}
 		if (!mWindow)
 		{
 			throw std::exception("Please call Engine::Init() first...");
@@ -127,6 +411,10 @@ namespace gl
 
 	inline void Engine::SetCursorPosCallback(CursorPosCallFunc tCallback)
 	{
+		if (mMockFrames)
+		{
+			return;
+		}
 		if (!mWindow)
 		{
 			throw std::exception("Please call Engine::Init() first...");
@@ -0,0 +1,434 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <glm/glm.hpp>
+#include "bounds.hpp"
+#include "gl_state.hpp"
+
+namespace gl
+{
+	enum Primitive
+	{
+		PRIMITIVE_PLANE,	// [-1, 1] in XZ, facing +Y
+		PRIMITIVE_CUBE,		// [-0.5, 0.5]
+		PRIMITIVE_QUAD,		// [-1, 1] in XY strip, for full screen passes; not tessellated
+		PRIMITIVE_SPHERE,	// radius 1
+		PRIMITIVE_CYLINDER,	// radius 1, Y in [-1, 1], capped
+		PRIMITIVE_TORUS,	// ring radius 1, tube radius 0.25, around Y
+		PRIMITIVE_COUNT
+	};
+
+	enum Tessellation
+	{
+		TESSELLATION_LOW,
+		TESSELLATION_MEDIUM,
+		TESSELLATION_HIGH,
+		TESSELLATION_COUNT
+	};
+
+	// Which attribute locations a VAO exposes. The shared buffer always stores position/normal/uv; the layouts only
+	// differ in where they point the shader inputs, matching what the samples' shaders were written against.
+	enum VertexLayout
+	{
+		LAYOUT_POS_NORMAL_UV,	// 0 position, 1 normal, 2 uv
+		LAYOUT_POS_UV,			// 0 position, 1 uv
+		LAYOUT_POS_UV_NORMAL,	// 0 position, 1 uv, 2 normal
+		LAYOUT_COUNT
+	};
+
+	struct GeometryVertex
+	{
+		glm::vec3 position;
+		glm::vec3 normal;
+		glm::vec2 uv;
+	};
+
+	// Where one primitive lives in the shared buffers
+	struct GeometryRange
+	{
+		GLenum	mode;
+		GLuint	firstIndex;
+		GLuint	indexCount;
+		GLint	baseVertex;
+
+		AABB		   bounds;
+		BoundingSphere boundingSphere;
+
+		GeometryRange() : mode(GL_TRIANGLES), firstIndex(0), indexCount(0), baseVertex(0) {}
+	};
+
+	// Every procedural primitive at every tessellation tier, generated once per context into one VBO/IBO.
+	// Meshes only keep a range and a per-layout VAO, so any number of passes can use a primitive for free.
+	class GeometryRegistry
+	{
+	public:
+		static GeometryRegistry* Instance()
+		{
+			if (!mInstance)
+			{
+				mInstance = new GeometryRegistry();
+			}
+			return mInstance;
+		}
+
+		const GeometryRange& Get(Primitive primitive, Tessellation tessellation = TESSELLATION_LOW) const { return mRanges[primitive][tessellation]; }
+		GLuint GetVao(VertexLayout layout) const { return mVaos[layout]; }
+
+		void Draw(const GeometryRange& range, VertexLayout layout) const;
+		void DrawInstanced(const GeometryRange& range, VertexLayout layout, GLsizei instanceCount) const;
+
+	private:
+		GeometryRegistry();
+
+		struct Counts
+		{
+			GLenum mode;
+			GLuint vertexCount;
+			GLuint indexCount;
+		};
+
+		static GLuint _Segments(Primitive primitive, Tessellation tessellation);
+		static Counts _Count(Primitive primitive, GLuint segments);
+		static void _Generate(Primitive primitive, GLuint segments, GeometryVertex* pVertices, GLuint* pIndices);
+
+		static void _GridIndices(GLuint*& pIndices, GLuint base, GLuint uSegments, GLuint vSegments, bool flip);
+		static void _Face(GeometryVertex*& pVertices, GLuint*& pIndices, GLuint base, const glm::vec3& center, const glm::vec3& u, const glm::vec3& v, const glm::vec3& normal, GLuint segments, bool flip);
+		static void _SinCos(GLuint segments, float turn, std::vector<glm::vec2>& table);
+
+		GLuint			mVbo;
+		GLuint			mEbo;
+		GLuint			mVaos[LAYOUT_COUNT];
+		GeometryRange	mRanges[PRIMITIVE_COUNT][TESSELLATION_COUNT];
+
+		static GeometryRegistry* mInstance;
+	};
+
+	GeometryRegistry* GeometryRegistry::mInstance = nullptr;
+
+	GeometryRegistry::GeometryRegistry() : mVbo(0), mEbo(0)
+	{
+		// Size everything up front so the generators write straight into the final arrays
+		Counts counts[PRIMITIVE_COUNT][TESSELLATION_COUNT];
+		GLuint vertexTotal = 0;
+		GLuint indexTotal  = 0;
+		for (int p = 0; p < PRIMITIVE_COUNT; ++p)
+		{
+			for (int t = 0; t < TESSELLATION_COUNT; ++t)
+			{
+				counts[p][t] = _Count(Primitive(p), _Segments(Primitive(p), Tessellation(t)));
+				vertexTotal += counts[p][t].vertexCount;
+				indexTotal  += counts[p][t].indexCount;
+			}
+		}
+
+		std::vector<GeometryVertex> vertices(vertexTotal);
+		std::vector<GLuint>			indices(indexTotal);
+		GLuint vertexOffset = 0;
+		GLuint indexOffset  = 0;
+		for (int p = 0; p < PRIMITIVE_COUNT; ++p)
+		{
+			for (int t = 0; t < TESSELLATION_COUNT; ++t)
+			{
+				const Counts& count = counts[p][t];
+				_Generate(Primitive(p), _Segments(Primitive(p), Tessellation(t)), &vertices[vertexOffset], &indices[indexOffset]);
+
+				GeometryRange& range = mRanges[p][t];
+				range.mode		 = count.mode;
+				range.firstIndex = indexOffset;
+				range.indexCount = count.indexCount;
+				range.baseVertex = static_cast<GLint>(vertexOffset);
+				for (GLuint i = 0; i < count.vertexCount; ++i)
+				{
+					range.bounds.Expand(vertices[vertexOffset + i].position);
+				}
+				range.boundingSphere = BoundingSphere::FromPoints(range.bounds, &vertices[vertexOffset].position, sizeof(GeometryVertex), count.vertexCount);
+
+				vertexOffset += count.vertexCount;
+				indexOffset  += count.indexCount;
+			}
+		}
+
+		glGenBuffers(1, &mVbo);
+		glBindBuffer(GL_ARRAY_BUFFER, mVbo);
+		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GeometryVertex), vertices.data(), GL_STATIC_DRAW);
+
+		glGenVertexArrays(LAYOUT_COUNT, mVaos);
+		for (int layout = 0; layout < LAYOUT_COUNT; ++layout)
+		{
+			GLState::Instance()->BindVertexArray(mVaos[layout]);
+			if (layout == 0)
+			{
+				glGenBuffers(1, &mEbo);
+				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mEbo);
+				glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
+			}
+			else
+			{
+				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mEbo);
+			}
+
+			GLuint uvLocation	  = layout == LAYOUT_POS_NORMAL_UV ? 2 : 1;
+			GLuint normalLocation = layout == LAYOUT_POS_NORMAL_UV ? 1 : 2;
+			glEnableVertexAttribArray(0);
+			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GeometryVertex), (void*)offsetof(GeometryVertex, position));
+			glEnableVertexAttribArray(uvLocation);
+			glVertexAttribPointer(uvLocation, 2, GL_FLOAT, GL_FALSE, sizeof(GeometryVertex), (void*)offsetof(GeometryVertex, uv));
+			if (layout != LAYOUT_POS_UV)
+			{
+				glEnableVertexAttribArray(normalLocation);
+				glVertexAttribPointer(normalLocation, 3, GL_FLOAT, GL_FALSE, sizeof(GeometryVertex), (void*)offsetof(GeometryVertex, normal));
+			}
+		}
+		GLState::Instance()->BindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	inline void GeometryRegistry::Draw(const GeometryRange& range, VertexLayout layout) const
+	{
+		GLState::Instance()->BindVertexArray(mVaos[layout]);
+		glDrawElementsBaseVertex(range.mode, range.indexCount, GL_UNSIGNED_INT, (void*)(range.firstIndex * sizeof(GLuint)), range.baseVertex);
+	}
+
+	inline void GeometryRegistry::DrawInstanced(const GeometryRange& range, VertexLayout layout, GLsizei instanceCount) const
+	{
+		GLState::Instance()->BindVertexArray(mVaos[layout]);
+		glDrawElementsInstancedBaseVertex(range.mode, range.indexCount, GL_UNSIGNED_INT, (void*)(range.firstIndex * sizeof(GLuint)), instanceCount, range.baseVertex);
+	}
+
+	GLuint GeometryRegistry::_Segments(Primitive primitive, Tessellation tessellation)
+	{
+		// LOW plane/cube and HIGH sphere match the meshes the samples were built with
+		static const GLuint segments[PRIMITIVE_COUNT][TESSELLATION_COUNT] = {
+			{ 1,  8,  32 },	// plane, per side
+			{ 1,  4,  16 },	// cube, per face side
+			{ 1,  1,  1  },	// quad
+			{ 16, 32, 64 },	// sphere, around and top to bottom
+			{ 16, 32, 64 },	// cylinder, around
+			{ 16, 32, 64 },	// torus, around the ring; the tube gets half
+		};
+		return segments[primitive][tessellation];
+	}
+
+	GeometryRegistry::Counts GeometryRegistry::_Count(Primitive primitive, GLuint segments)
+	{
+		switch (primitive)
+		{
+		case PRIMITIVE_PLANE:
+			return { GL_TRIANGLES, (segments + 1) * (segments + 1), segments * segments * 6 };
+		case PRIMITIVE_CUBE:
+			return { GL_TRIANGLES, 6 * (segments + 1) * (segments + 1), 6 * segments * segments * 6 };
+		case PRIMITIVE_QUAD:
+			return { GL_TRIANGLE_STRIP, 4, 4 };
+		case PRIMITIVE_SPHERE:
+			return { GL_TRIANGLE_STRIP, (segments + 1) * (segments + 1), segments * (segments + 1) * 2 };
+		case PRIMITIVE_CYLINDER:
+			// side rows at both ends, plus a center and a rim per cap
+			return { GL_TRIANGLES, 2 * (segments + 1) + 2 * (segments + 2), segments * 6 + 2 * segments * 3 };
+		case PRIMITIVE_TORUS:
+			return { GL_TRIANGLES, (segments + 1) * (segments / 2 + 1), segments * (segments / 2) * 6 };
+		default:
+			return { GL_TRIANGLES, 0, 0 };
+		}
+	}
+
+	void GeometryRegistry::_Generate(Primitive primitive, GLuint segments, GeometryVertex* pVertices, GLuint* pIndices)
+	{
+		const float PI = 3.14159265359f;
+
+		switch (primitive)
+		{
+		case PRIMITIVE_PLANE:
+		{
+			// Winds the same way as the original two-triangle floor
+			_Face(pVertices, pIndices, 0, glm::vec3(0.f), glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 0.f, 1.f), glm::vec3(0.f, 1.f, 0.f), segments, false);
+			break;
+		}
+		case PRIMITIVE_CUBE:
+		{
+			// normal, then the axes u and v follow on each face; counter-clockwise seen from outside
+			static const glm::vec3 faces[6][3] = {
+				{ glm::vec3( 0.f,  0.f, -1.f), glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 1.f,  0.f) },	// back
+				{ glm::vec3( 0.f,  0.f,  1.f), glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 1.f,  0.f) },	// front
+				{ glm::vec3(-1.f,  0.f,  0.f), glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, 0.f, -1.f) },	// left
+				{ glm::vec3( 1.f,  0.f,  0.f), glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, 0.f, -1.f) },	// right
+				{ glm::vec3( 0.f, -1.f,  0.f), glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 0.f, -1.f) },	// bottom
+				{ glm::vec3( 0.f,  1.f,  0.f), glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 0.f, -1.f) },	// top
+			};
+			GLuint base = 0;
+			for (auto& face : faces)
+			{
+				bool flip = glm::dot(glm::cross(face[1], face[2]), face[0]) < 0.f;
+				_Face(pVertices, pIndices, base, face[0] * 0.5f, face[1] * 0.5f, face[2] * 0.5f, face[0], segments, flip);
+				base += (segments + 1) * (segments + 1);
+			}
+			break;
+		}
+		case PRIMITIVE_QUAD:
+		{
+			const glm::vec2 corners[4] = { glm::vec2(-1.f, 1.f), glm::vec2(-1.f, -1.f), glm::vec2(1.f, 1.f), glm::vec2(1.f, -1.f) };
+			for (GLuint i = 0; i < 4; ++i)
+			{
+				pVertices[i].position = glm::vec3(corners[i], 0.f);
+				pVertices[i].normal	  = glm::vec3(0.f, 0.f, 1.f);
+				pVertices[i].uv		  = corners[i] * 0.5f + 0.5f;
+				pIndices[i] = i;
+			}
+			break;
+		}
+		case PRIMITIVE_SPHERE:
+		{
+			// One sin/cos per column and per row instead of three per vertex
+			std::vector<glm::vec2> around, down;
+			_SinCos(segments, 2.f * PI, around);
+			_SinCos(segments, PI, down);
+
+			for (GLuint y = 0; y <= segments; ++y)
+			{
+				for (GLuint x = 0; x <= segments; ++x)
+				{
+					glm::vec3 position(around[x].x * down[y].y, down[y].x, around[x].y * down[y].y);
+					pVertices->position = position;
+					pVertices->normal	= position;
+					pVertices->uv		= glm::vec2(float(x) / segments, float(y) / segments);
+					++pVertices;
+				}
+			}
+
+			// A single strip that snakes back along every other row
+			for (GLuint y = 0; y < segments; ++y)
+			{
+				for (GLuint i = 0; i <= segments; ++i)
+				{
+					GLuint x = (y % 2 == 0) ? i : segments - i;
+					GLuint upper = y * (segments + 1) + x;
+					GLuint lower = (y + 1) * (segments + 1) + x;
+					*pIndices++ = (y % 2 == 0) ? upper : lower;
+					*pIndices++ = (y % 2 == 0) ? lower : upper;
+				}
+			}
+			break;
+		}
+		case PRIMITIVE_CYLINDER:
+		{
+			std::vector<glm::vec2> around;
+			_SinCos(segments, 2.f * PI, around);
+
+			for (GLuint row = 0; row < 2; ++row)
+			{
+				for (GLuint x = 0; x <= segments; ++x)
+				{
+					pVertices->position = glm::vec3(around[x].x, row ? 1.f : -1.f, around[x].y);
+					pVertices->normal	= glm::vec3(around[x].x, 0.f, around[x].y);
+					pVertices->uv		= glm::vec2(float(x) / segments, float(row));
+					++pVertices;
+				}
+			}
+			_GridIndices(pIndices, 0, segments, 1, true);
+
+			GLuint base = 2 * (segments + 1);
+			for (GLuint cap = 0; cap < 2; ++cap)
+			{
+				float y = cap ? 1.f : -1.f;
+				pVertices->position = glm::vec3(0.f, y, 0.f);
+				pVertices->normal	= glm::vec3(0.f, y, 0.f);
+				pVertices->uv		= glm::vec2(0.5f);
+				++pVertices;
+				for (GLuint x = 0; x <= segments; ++x)
+				{
+					pVertices->position = glm::vec3(around[x].x, y, around[x].y);
+					pVertices->normal	= glm::vec3(0.f, y, 0.f);
+					pVertices->uv		= glm::vec2(around[x].x, around[x].y) * 0.5f + 0.5f;
+					++pVertices;
+				}
+				for (GLuint x = 0; x < segments; ++x)
+				{
+					*pIndices++ = base;
+					*pIndices++ = base + 1 + (cap ? x + 1 : x);
+					*pIndices++ = base + 1 + (cap ? x : x + 1);
+				}
+				base += segments + 2;
+			}
+			break;
+		}
+		case PRIMITIVE_TORUS:
+		{
+			const float ringRadius = 1.f;
+			const float tubeRadius = 0.25f;
+			GLuint tubeSegments = segments / 2;
+
+			std::vector<glm::vec2> around, tube;
+			_SinCos(segments, 2.f * PI, around);
+			_SinCos(tubeSegments, 2.f * PI, tube);
+
+			for (GLuint t = 0; t <= tubeSegments; ++t)
+			{
+				for (GLuint x = 0; x <= segments; ++x)
+				{
+					glm::vec3 normal(tube[t].y * around[x].y, tube[t].x, tube[t].y * around[x].x);
+					pVertices->position = glm::vec3(ringRadius * around[x].y, 0.f, ringRadius * around[x].x) + tubeRadius * normal;
+					pVertices->normal	= normal;
+					pVertices->uv		= glm::vec2(float(x) / segments, float(t) / tubeSegments);
+					++pVertices;
+				}
+			}
+			_GridIndices(pIndices, 0, segments, tubeSegments, true);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	void GeometryRegistry::_GridIndices(GLuint*& pIndices, GLuint base, GLuint uSegments, GLuint vSegments, bool flip)
+	{
+		// Cells of a (uSegments + 1) x (vSegments + 1) vertex grid, u varying fastest. Unflipped triangles wind
+		// around u x v.
+		for (GLuint v = 0; v < vSegments; ++v)
+		{
+			for (GLuint u = 0; u < uSegments; ++u)
+			{
+				GLuint p00 = base + v * (uSegments + 1) + u;
+				GLuint p10 = p00 + 1;
+				GLuint p01 = p00 + uSegments + 1;
+				GLuint p11 = p01 + 1;
+
+				*pIndices++ = p00;
+				*pIndices++ = flip ? p11 : p10;
+				*pIndices++ = flip ? p10 : p11;
+				*pIndices++ = p00;
+				*pIndices++ = flip ? p01 : p11;
+				*pIndices++ = flip ? p11 : p01;
+			}
+		}
+	}
+
+	void GeometryRegistry::_Face(GeometryVertex*& pVertices, GLuint*& pIndices, GLuint base, const glm::vec3& center, const glm::vec3& u, const glm::vec3& v, const glm::vec3& normal, GLuint segments, bool flip)
+	{
+		// center +- u +- v, uv running from 0 at -u/-v to 1 at +u/+v
+		for (GLuint j = 0; j <= segments; ++j)
+		{
+			for (GLuint i = 0; i <= segments; ++i)
+			{
+				glm::vec2 uv(float(i) / segments, float(j) / segments);
+				pVertices->position = center + u * (uv.x * 2.f - 1.f) + v * (uv.y * 2.f - 1.f);
+				pVertices->normal	= normal;
+				pVertices->uv		= uv;
+				++pVertices;
+			}
+		}
+		_GridIndices(pIndices, base, segments, segments, flip);
+	}
+
+	void GeometryRegistry::_SinCos(GLuint segments, float turn, std::vector<glm::vec2>& table)
+	{
+		// (cos, sin) at every step; the last entry repeats the seam so it closes exactly
+		table.resize(segments + 1);
+		for (GLuint i = 0; i <= segments; ++i)
+		{
+			float angle = turn * i / segments;
+			table[i] = glm::vec2(std::cos(angle), std::sin(angle));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,426 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cctype>
+
+namespace gl
+{
+	// Mean and nearest-rank percentiles of a series of frame times
+	struct BenchmarkStats
+	{
+		double mean;
+		double p50;
+		double p95;
+		double p99;
+
+		BenchmarkStats() : mean(0.0), p50(0.0), p95(0.0), p99(0.0) {}
+
+		static BenchmarkStats Of(std::vector<double> samples);
+	};
+
+	inline BenchmarkStats BenchmarkStats::Of(std::vector<double> samples)
+	{
+		BenchmarkStats stats;
+		if (samples.empty())
+		{
+			return stats;
+		}
+
+		std::sort(samples.begin(), samples.end());
+		auto percentile = [&samples](double p)
+		{
+			size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * samples.size()));
+			return samples[std::max<size_t>(rank, 1) - 1];
+		};
+
+		double sum = 0.0;
+		for (double sample : samples)
+		{
+			sum += sample;
+		}
+		stats.mean = sum / samples.size();
+		stats.p50  = percentile(50.0);
+		stats.p95  = percentile(95.0);
+		stats.p99  = percentile(99.0);
+		return stats;
+	}
+
+	// Times an unattended run of Engine::Render: startup (Engine::Init until the first frame is finished on the
+	// GPU, so shader compiles and texture uploads deferred by the driver are included), then after the warmup
+	// frames the CPU submission time, the frame-to-frame time including the swap, and the GPU time of every
+	// frame from GL_TIME_ELAPSED queries. The queries rotate through a small ring and are read a few frames
+	// later, so measuring never waits for the GPU.
+	class GLBenchmark
+	{
+	public:
+		static GLBenchmark* Instance()
+		{
+			if (!mInstance)
+			{
+				mInstance = new GLBenchmark();
+			}
+			return mInstance;
+		}
+
+		// Writes the results to path as JSON once warmup + frames frames have been rendered
+		void Configure(const std::string& path, GLuint warmup, GLuint frames);
+		bool IsEnabled() const { return !mPath.empty(); }
+		bool IsDone() const { return IsEnabled() && mFrame >= mWarmup + mFrames; }
+
+		void BeginStartup();
+		void BeginFrame();
+		void EndFrame();
+		// Reads the outstanding queries and writes the results; call after the last frame
+		bool Finish(GLuint width, GLuint height);
+
+		const BenchmarkStats& GetCpuStats() const { return mCpu; }
+		const BenchmarkStats& GetFrameStats() const { return mFrameTime; }
+		const BenchmarkStats& GetGpuStats() const { return mGpu; }
+		double GetStartupMs() const { return mStartupMs; }
+
+	private:
+		GLBenchmark() : mWarmup(0), mFrames(0), mFrame(0), mStartupMs(0.0)
+		{
+			for (auto& frame : mPending)
+			{
+				frame = -1;
+			}
+		}
+
+		using Clock = std::chrono::steady_clock;
+		static double _Ms(Clock::time_point from, Clock::time_point to)
+		{
+			return std::chrono::duration<double, std::milli>(to - from).count();
+		}
+
+		void _Collect(GLuint slot);
+		static void _WriteStats(std::ostream& out, const char* name, const BenchmarkStats& stats);
+
+		static const GLuint QUERY_RING = 4;
+
+		std::string			mPath;
+		GLuint				mWarmup;
+		GLuint				mFrames;
+		GLuint				mFrame;
+		GLuint				mQueries[QUERY_RING];
+		GLint				mPending[QUERY_RING];	// frame each query is timing, -1 if none
+		Clock::time_point	mStartup;
+		Clock::time_point	mFrameStart;
+		Clock::time_point	mLastFrameStart;
+		double				mStartupMs;
+		std::vector<double> mCpuMs;
+		std::vector<double> mFrameMs;
+		std::vector<double> mGpuMs;
+		BenchmarkStats		mCpu;
+		BenchmarkStats		mFrameTime;
+		BenchmarkStats		mGpu;
+
+		static GLBenchmark* mInstance;
+	};
+
+	GLBenchmark* GLBenchmark::mInstance = nullptr;
+
+	inline void GLBenchmark::Configure(const std::string& path, GLuint warmup, GLuint frames)
+	{
+		mPath	= path;
+		mWarmup = std::max<GLuint>(warmup, 1);		// the first frame ends startup
+		mFrames = std::max<GLuint>(frames, 1);
+		mCpuMs.reserve(mFrames);
+		mFrameMs.reserve(mFrames);
+		mGpuMs.reserve(mFrames);
+	}
+
+	inline void GLBenchmark::BeginStartup()
+	{
+		mStartup = Clock::now();
+	}
+
+	void GLBenchmark::BeginFrame()
+	{
+		if (mFrame == 0)
+		{
+			glGenQueries(QUERY_RING, mQueries);
+		}
+
+		GLuint slot = mFrame % QUERY_RING;
+		_Collect(slot);
+
+		mLastFrameStart = mFrameStart;
+		mFrameStart		= Clock::now();
+		if (mFrame > mWarmup)
+		{
+			mFrameMs.push_back(_Ms(mLastFrameStart, mFrameStart));
+		}
+
+		glBeginQuery(GL_TIME_ELAPSED, mQueries[slot]);
+		mPending[slot] = mFrame;
+	}
+
+	void GLBenchmark::EndFrame()
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+
+		if (mFrame >= mWarmup)
+		{
+			mCpuMs.push_back(_Ms(mFrameStart, Clock::now()));
+		}
+		if (mFrame == 0)
+		{
+			glFinish();
+			mStartupMs = _Ms(mStartup, Clock::now());
+		}
+		++mFrame;
+	}
+
+	void GLBenchmark::_Collect(GLuint slot)
+	{
+		if (mPending[slot] < 0)
+		{
+			return;
+		}
+
+		GLuint64 nanoseconds = 0;
+		glGetQueryObjectui64v(mQueries[slot], GL_QUERY_RESULT, &nanoseconds);
+		if (static_cast<GLuint>(mPending[slot]) >= mWarmup)
+		{
+			mGpuMs.push_back(nanoseconds / 1e6);
+		}
+		mPending[slot] = -1;
+	}
+
+	bool GLBenchmark::Finish(GLuint width, GLuint height)
+	{
+		// The frame time of the last frame ends where the next one would start
+		mFrameMs.push_back(_Ms(mFrameStart, Clock::now()));
+		for (GLuint i = 0; i < QUERY_RING; ++i)
+		{
+			_Collect((mFrame + i) % QUERY_RING);
+		}
+		glDeleteQueries(QUERY_RING, mQueries);
+
+		mCpu	   = BenchmarkStats::Of(mCpuMs);
+		mFrameTime = BenchmarkStats::Of(mFrameMs);
+		mGpu	   = BenchmarkStats::Of(mGpuMs);
+
+		std::printf("Benchmark: %ux%u, %u frames, startup %.1f ms, CPU %.3f ms (p99 %.3f), frame %.3f ms (p99 %.3f), GPU %.3f ms (p99 %.3f)\n",
+					width, height, mFrames, mStartupMs, mCpu.mean, mCpu.p99, mFrameTime.mean, mFrameTime.p99, mGpu.mean, mGpu.p99);
+
+		std::ofstream out(mPath);
+		if (!out)
+		{
+			std::cerr << "Failed to open benchmark file " << mPath << std::endl;
+			return false;
+		}
+		out << "{\n"
+			<< "\t\"width\": " << width << ",\n"
+			<< "\t\"height\": " << height << ",\n"
+			<< "\t\"warmup\": " << mWarmup << ",\n"
+			<< "\t\"frames\": " << mFrames << ",\n"
+			<< "\t\"startup_ms\": " << mStartupMs << ",\n";
+		_WriteStats(out, "cpu_ms", mCpu);
+		out << ",\n";
+		_WriteStats(out, "frame_ms", mFrameTime);
+		out << ",\n";
+		_WriteStats(out, "gpu_ms", mGpu);
+		out << "\n}\n";
+		return true;
+	}
+
+	inline void GLBenchmark::_WriteStats(std::ostream& out, const char* name, const BenchmarkStats& stats)
+	{
+		out << "\t\"" << name << "\": { \"mean\": " << stats.mean << ", \"p50\": " << stats.p50 << ", \"p95\": " << stats.p95
+			<< ", \"p99\": " << stats.p99 << " }";
+	}
+
+	// Benchmark JSON flattened to dotted keys ("PBR.gpu_ms.p95"), numbers only. Reads what GLBenchmark and the
+	// Benchmark suite runner write; strings, booleans and arrays are skipped.
+	class BenchmarkResults
+	{
+	public:
+		bool Load(const std::string& path);
+		bool Parse(const std::string& json);
+
+		const std::map<std::string, double>& GetValues() const { return mValues; }
+
+		// Prints every timing (the *_ms keys) of current against this baseline and returns how many grew by more
+		// than thresholdPercent. Timings missing from current are listed but not counted.
+		GLuint Compare(const BenchmarkResults& current, double thresholdPercent, std::ostream& out) const;
+
+	private:
+		void _SkipSpace();
+		bool _Value(const std::string& key);
+		bool _String(std::string& value);
+
+		std::map<std::string, double>	mValues;
+		std::string						mJson;
+		size_t							mPos;
+	};
+
+	inline bool BenchmarkResults::Load(const std::string& path)
+	{
+		std::ifstream in(path);
+		if (!in)
+		{
+			std::cerr << "Failed to open benchmark file " << path << std::endl;
+			return false;
+		}
+		std::stringstream json;
+		json << in.rdbuf();
+		if (!Parse(json.str()))
+		{
+			std::cerr << "Failed to parse benchmark file " << path << " near offset " << mPos << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	inline bool BenchmarkResults::Parse(const std::string& json)
+	{
+		mValues.clear();
+		mJson = json;
+		mPos  = 0;
+		if (!_Value(""))
+		{
+			return false;
+		}
+		_SkipSpace();
+		return mPos == mJson.size();
+	}
+
+	inline void BenchmarkResults::_SkipSpace()
+	{
+		while (mPos < mJson.size() && std::isspace(static_cast<unsigned char>(mJson[mPos])))
+		{
+			++mPos;
+		}
+	}
+
+	bool BenchmarkResults::_String(std::string& value)
+	{
+		if (mJson[mPos] != '"')
+		{
+			return false;
+		}
+		value.clear();
+		for (++mPos; mPos < mJson.size() && mJson[mPos] != '"'; ++mPos)
+		{
+			if (mJson[mPos] == '\\' && ++mPos == mJson.size())
+			{
+				return false;
+			}
+			value += mJson[mPos];
+		}
+		return mPos++ < mJson.size();
+	}
+
+	bool BenchmarkResults::_Value(const std::string& key)
+	{
+		_SkipSpace();
+		if (mPos >= mJson.size())
+		{
+			return false;
+		}
+
+		char c = mJson[mPos];
+		if (c == '{' || c == '[')
+		{
+			char close = c == '{' ? '}' : ']';
+			++mPos;
+			_SkipSpace();
+			for (GLuint index = 0; mPos < mJson.size() && mJson[mPos] != close; ++index)
+			{
+				std::string name = std::to_string(index);
+				if (c == '{')
+				{
+					if (!_String(name))
+					{
+						return false;
+					}
+					_SkipSpace();
+					if (mPos >= mJson.size() || mJson[mPos++] != ':')
+					{
+						return false;
+					}
+				}
+				if (!_Value(key.empty() ? name : key + "." + name))
+				{
+					return false;
+				}
+				_SkipSpace();
+				if (mPos < mJson.size() && mJson[mPos] == ',')
+				{
+					++mPos;
+					_SkipSpace();
+				}
+			}
+			return mPos++ < mJson.size();
+		}
+		if (c == '"')
+		{
+			std::string ignored;
+			return _String(ignored);
+		}
+
+		const char* start = mJson.c_str() + mPos;
+		char* end		  = nullptr;
+		double value	  = std::strtod(start, &end);
+		if (end != start)
+		{
+			mValues[key] = value;
+			mPos += end - start;
+			return true;
+		}
+		// true, false, null
+		while (mPos < mJson.size() && std::isalpha(static_cast<unsigned char>(mJson[mPos])))
+		{
+			++mPos;
+		}
+		return mJson.c_str() + mPos != start;
+	}
+
+	GLuint BenchmarkResults::Compare(const BenchmarkResults& current, double thresholdPercent, std::ostream& out) const
+	{
+		char line[256];
+		GLuint regressions = 0;
+		for (const auto& baseline : mValues)
+		{
+			const std::string& key = baseline.first;
+			if (key.find("_ms") == std::string::npos)
+			{
+				// Different sizes or frame counts make the timings incomparable, so say so up front
+				auto value = current.mValues.find(key);
+				if (value != current.mValues.end() && value->second != baseline.second)
+				{
+					out << "warning: " << key << " is " << value->second << ", baseline " << baseline.second << std::endl;
+				}
+				continue;
+			}
+
+			auto value = current.mValues.find(key);
+			if (value == current.mValues.end())
+			{
+				std::snprintf(line, sizeof(line), "%-40s %12.3f %12s\n", key.c_str(), baseline.second, "missing");
+				out << line;
+				continue;
+			}
+
+			double change	 = baseline.second > 0.0 ? (value->second - baseline.second) / baseline.second * 100.0 : 0.0;
+			bool   regressed = change > thresholdPercent;
+			regressions += regressed;
+			std::snprintf(line, sizeof(line), "%-40s %12.3f %12.3f %+8.1f%%%s\n", key.c_str(), baseline.second, value->second,
+						  change, regressed ? "  REGRESSION" : "");
+			out << line;
+		}
+		return regressions;
+	}
+}
\ No newline at end of file
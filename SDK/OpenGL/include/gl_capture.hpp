@@ -0,0 +1,438 @@
+#pragma once
+#include <glad/glad.h>
+#include <glad/glad_functions.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <type_traits>
+#include <fstream>
+#include <iostream>
+#include <cstdint>
+#include <cstring>
+#include "gl_trace.hpp"
+
+namespace gl
+{
+	// Records every GL call of the first N frames, with the data they upload, into a trace GLReplay can run
+	// again (see gl_trace.hpp for the format). It sits between glad and the real loader: load through
+	// GLCapture::GetProcAddress after Begin, and every function glad resolves is a wrapper that records its
+	// arguments and forwards to the driver. Once the frames are written the wrappers only forward.
+	class GLCapture
+	{
+	public:
+		static GLCapture* Instance()
+		{
+			if (!mInstance)
+			{
+				mInstance = new GLCapture();
+			}
+			return mInstance;
+		}
+
+		// load is what glad would otherwise use (glfwGetProcAddress, GLMock::GetProcAddress); width and height
+		// are the default framebuffer's, for the replay window
+		void Begin(const std::string& path, GLuint frames, GLuint width, GLuint height, GLADloadproc load);
+
+		// GLADloadproc
+		static void* GetProcAddress(const char* name);
+
+		bool IsRecording() const { return mRecording; }
+
+		// Called by Engine::Render
+		void BeginFrame();
+		void BeginPass(const char* name);
+		void EndPass();
+		void EndFrame();
+
+	private:
+		enum Function
+		{
+#define GL_CAPTURE_ENUM(ret, name, params, args) FUNCTION_##name,
+			GLAD_FUNCTIONS(GL_CAPTURE_ENUM)
+#undef GL_CAPTURE_ENUM
+			FUNCTION_COUNT
+		};
+
+		static const size_t FLUSH_BYTES = 1 << 20;
+
+		// A wrapper's call: records, forwards and records the results
+		template <typename R, typename... A>
+		struct _Invocation
+		{
+			GLCapture*		  capture;
+			Function		  function;
+			R (APIENTRY*	  real)(A...);
+
+			R operator()(A... args) const
+			{
+				if (!capture->mRecording)
+				{
+					return real(args...);
+				}
+				capture->_BeginCall(function, args...);
+				return _Forward(std::is_void<R>(), capture, real, args...);
+			}
+		};
+
+		template <typename R, typename... A>
+		static R _Forward(std::false_type, GLCapture* capture, R (APIENTRY* real)(A...), A... args)
+		{
+			R result = real(args...);
+			capture->_WriteResult(result);
+			capture->_EndCall(args...);
+			return result;
+		}
+		template <typename R, typename... A>
+		static void _Forward(std::true_type, GLCapture* capture, R (APIENTRY* real)(A...), A... args)
+		{
+			real(args...);
+			capture->_EndCall(args...);
+		}
+
+		GLCapture() : mRecording(false), mFramesLeft(0), mFunction(FUNCTION_COUNT), mArgs(nullptr), mPointers(nullptr), mCalls(0), mBlobBytes(0), mSharedBytes(0) {}
+
+		template <typename R, typename... A>
+		_Invocation<R, A...> _Invoke(Function function, R (APIENTRY* real)(A...)) { return _Invocation<R, A...>{ this, function, real }; }
+
+		template <typename... A>
+		void _BeginCall(Function function, A... args);
+		template <typename... A>
+		void _EndCall(A... args);
+
+		template <typename T>
+		static int64_t _Integer(T value, typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr) { return static_cast<int64_t>(value); }
+		template <typename T>
+		static int64_t _Integer(T*) { return 0; }
+		template <typename T>
+		static const void* _Pointer(T, typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr) { return nullptr; }
+		template <typename T>
+		static const void* _Pointer(T* value) { return value; }
+
+		template <typename T>
+		typename std::enable_if<std::is_arithmetic<T>::value>::type _Write(T value) { _Raw(&value, sizeof(T)); }
+		void _Write(const GLchar* text);
+		void _Write(const GLchar* const* texts);
+		void _Write(const void* data);
+		void _Write(const void* const* offsets);
+		void _Write(GLsync sync);
+		template <typename T>
+		void _Write(const T* values);
+		// Outputs
+		template <typename T>
+		void _Write(T*) {}
+
+		template <typename T>
+		typename std::enable_if<std::is_arithmetic<T>::value>::type _WriteResult(T value) { _Raw(&value, sizeof(T)); }
+		void _WriteResult(GLsync sync) { _Write(sync); }
+		// Strings and mapped pointers are not replayed
+		template <typename T>
+		void _WriteResult(T*) {}
+
+		void _Generated(GLsizei count, GLuint* names);
+		template <typename... A>
+		void _Generated(A...) {}
+
+		void _Raw(const void* data, size_t size);
+		void _String(const GLchar* text, size_t length);
+		void _Blob(uint64_t hash, const void* data, size_t size);
+		void _Marker(TraceOp op);
+		void _Flush();
+		void _Finish();
+
+		// Forwards to the real function while nothing is recorded
+#define GL_CAPTURE_WRAPPER(ret, name, params, args) \
+		static ret APIENTRY _Capture##name params { return mInstance->_Invoke(FUNCTION_##name, reinterpret_cast<decltype(glad_gl##name)>(mInstance->mReal[FUNCTION_##name])) args; }
+		GLAD_FUNCTIONS(GL_CAPTURE_WRAPPER)
+#undef GL_CAPTURE_WRAPPER
+
+		std::string						mPath;
+		std::ofstream					mFile;
+		GLADloadproc					mLoad;
+		bool							mRecording;
+		GLuint							mFramesLeft;
+
+		void*							mReal[FUNCTION_COUNT];
+		TraceRule						mRules[FUNCTION_COUNT];
+
+		// The call being recorded; blobs it uploads go to mOutput ahead of it
+		Function						mFunction;
+		const int64_t*					mArgs;
+		const void* const*				mPointers;
+		std::vector<char>				mCall;
+		std::vector<char>				mOutput;
+		std::unordered_set<uint64_t>	mBlobs;
+
+		uint64_t						mCalls;
+		uint64_t						mBlobBytes;
+		uint64_t						mSharedBytes;	// uploads that matched a blob already written
+
+		static GLCapture*				mInstance;
+	};
+
+	GLCapture* GLCapture::mInstance = nullptr;
+
+	void GLCapture::Begin(const std::string& path, GLuint frames, GLuint width, GLuint height, GLADloadproc load)
+	{
+		mFile.open(path, std::ios::binary);
+		if (!mFile)
+		{
+			std::cerr << "GLCapture: can't write " << path << std::endl;
+			return;
+		}
+		mPath		= path;
+		mLoad		= load;
+		mFramesLeft = frames;
+		mRecording	= true;
+
+		static const char* names[] = {
+#define GL_CAPTURE_NAME(ret, name, params, args) #name,
+			GLAD_FUNCTIONS(GL_CAPTURE_NAME)
+#undef GL_CAPTURE_NAME
+		};
+
+		uint32_t header[] = { TRACE_MAGIC, TRACE_VERSION, width, height, FUNCTION_COUNT };
+		_Raw(header, sizeof(header));
+		for (int function = 0; function < FUNCTION_COUNT; ++function)
+		{
+			mRules[function] = TraceRule::For(names[function]);
+
+			std::string name = std::string("gl") + names[function];
+			uint16_t length = static_cast<uint16_t>(name.size());
+			_Raw(&length, sizeof(length));
+			_Raw(name.data(), name.size());
+		}
+		// The header was built where calls are; it goes out ahead of the first one
+		mOutput.swap(mCall);
+	}
+
+	void* GLCapture::GetProcAddress(const char* name)
+	{
+		struct Entry
+		{
+			Function function;
+			void*	 wrapper;
+		};
+		static std::unordered_map<std::string, Entry> table;
+		if (table.empty())
+		{
+#define GL_CAPTURE_ENTRY(ret, name, params, args) table["gl" #name] = Entry{ FUNCTION_##name, reinterpret_cast<void*>(&_Capture##name) };
+			GLAD_FUNCTIONS(GL_CAPTURE_ENTRY)
+#undef GL_CAPTURE_ENTRY
+		}
+
+		auto found = table.find(name);
+		if (found == table.end() || !mInstance || !mInstance->mLoad)
+		{
+			return nullptr;
+		}
+		void* real = mInstance->mLoad(name);
+		mInstance->mReal[found->second.function] = real;
+		// Functions the driver lacks stay missing for glad
+		return real ? found->second.wrapper : nullptr;
+	}
+
+	template <typename... A>
+	void GLCapture::_BeginCall(Function function, A... args)
+	{
+		int64_t		integers[] = { _Integer(args)..., 0 };
+		const void* pointers[] = { _Pointer(args)..., nullptr };
+		mFunction = function;
+		mArgs	  = integers;
+		mPointers = pointers;
+
+		mCall.clear();
+		uint16_t op = static_cast<uint16_t>(function);
+		_Raw(&op, sizeof(op));
+		int order[] = { 0, (_Write(args), 0)... };
+		(void)order;
+	}
+
+	template <typename... A>
+	void GLCapture::_EndCall(A... args)
+	{
+		if (mRules[mFunction].generates)
+		{
+			_Generated(args...);
+		}
+		mOutput.insert(mOutput.end(), mCall.begin(), mCall.end());
+		++mCalls;
+		if (mOutput.size() >= FLUSH_BYTES)
+		{
+			_Flush();
+		}
+	}
+
+	inline void GLCapture::_Generated(GLsizei count, GLuint* names)
+	{
+		_Raw(names, sizeof(GLuint) * count);
+	}
+
+	inline void GLCapture::_Raw(const void* data, size_t size)
+	{
+		const char* bytes = static_cast<const char*>(data);
+		mCall.insert(mCall.end(), bytes, bytes + size);
+	}
+
+	void GLCapture::_String(const GLchar* text, size_t length)
+	{
+		uint32_t size = static_cast<uint32_t>(length);
+		_Raw(&size, sizeof(size));
+		_Raw(text, length);
+		mCall.push_back('\0');
+	}
+
+	void GLCapture::_Write(const GLchar* text)
+	{
+		if (!text)
+		{
+			_Raw(&TRACE_NULL, sizeof(TRACE_NULL));
+			return;
+		}
+		_String(text, std::strlen(text));
+	}
+
+	void GLCapture::_Write(const GLchar* const* texts)
+	{
+		uint32_t count = static_cast<uint32_t>(mRules[mFunction].Count(mArgs));
+		_Raw(&count, sizeof(count));
+
+		// glShaderSource may pass lengths instead of terminated strings
+		const GLint* lengths = mFunction == FUNCTION_ShaderSource ? static_cast<const GLint*>(mPointers[3]) : nullptr;
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (lengths && lengths[i] >= 0)
+			{
+				_String(texts[i], lengths[i]);
+			}
+			else
+			{
+				_Write(texts[i]);
+			}
+		}
+	}
+
+	void GLCapture::_Write(const void* data)
+	{
+		const TraceRule& rule = mRules[mFunction];
+		uint8_t kind = !data ? TRACE_POINTER_NULL : rule.IsData() ? TRACE_POINTER_BLOB : TRACE_POINTER_OFFSET;
+		_Raw(&kind, sizeof(kind));
+
+		uint64_t value = reinterpret_cast<uintptr_t>(data);
+		if (kind == TRACE_POINTER_BLOB)
+		{
+			size_t size = static_cast<size_t>(rule.Count(mArgs));
+			value = TraceHash(data, size);
+			_Blob(value, data, size);
+		}
+		if (kind != TRACE_POINTER_NULL)
+		{
+			_Raw(&value, sizeof(value));
+		}
+	}
+
+	void GLCapture::_Write(const void* const* offsets)
+	{
+		uint32_t count = static_cast<uint32_t>(mRules[mFunction].Count(mArgs));
+		_Raw(&count, sizeof(count));
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			uint64_t offset = reinterpret_cast<uintptr_t>(offsets[i]);
+			_Raw(&offset, sizeof(offset));
+		}
+	}
+
+	inline void GLCapture::_Write(GLsync sync)
+	{
+		uint64_t handle = reinterpret_cast<uintptr_t>(sync);
+		_Raw(&handle, sizeof(handle));
+	}
+
+	template <typename T>
+	void GLCapture::_Write(const T* values)
+	{
+		uint32_t size = values ? static_cast<uint32_t>(mRules[mFunction].Count(mArgs) * sizeof(T)) : TRACE_NULL;
+		_Raw(&size, sizeof(size));
+		if (values)
+		{
+			_Raw(values, size);
+		}
+	}
+
+	void GLCapture::_Blob(uint64_t hash, const void* data, size_t size)
+	{
+		if (!mBlobs.insert(hash).second)
+		{
+			mSharedBytes += size;
+			return;
+		}
+		mBlobBytes += size;
+
+		uint16_t op		 = TRACE_OP_BLOB;
+		uint64_t header[] = { hash, size };
+		const char* bytes = static_cast<const char*>(data);
+		mOutput.insert(mOutput.end(), reinterpret_cast<const char*>(&op), reinterpret_cast<const char*>(&op + 1));
+		mOutput.insert(mOutput.end(), reinterpret_cast<const char*>(header), reinterpret_cast<const char*>(header + 2));
+		mOutput.insert(mOutput.end(), bytes, bytes + size);
+	}
+
+	inline void GLCapture::_Marker(TraceOp op)
+	{
+		uint16_t value = static_cast<uint16_t>(op);
+		mOutput.insert(mOutput.end(), reinterpret_cast<const char*>(&value), reinterpret_cast<const char*>(&value + 1));
+	}
+
+	inline void GLCapture::_Flush()
+	{
+		mFile.write(mOutput.data(), mOutput.size());
+		mOutput.clear();
+	}
+
+	inline void GLCapture::BeginFrame()
+	{
+		if (mRecording)
+		{
+			_Marker(TRACE_OP_FRAME);
+		}
+	}
+
+	void GLCapture::BeginPass(const char* name)
+	{
+		if (!mRecording)
+		{
+			return;
+		}
+		_Marker(TRACE_OP_PASS_BEGIN);
+		uint16_t length = static_cast<uint16_t>(std::strlen(name));
+		mOutput.insert(mOutput.end(), reinterpret_cast<const char*>(&length), reinterpret_cast<const char*>(&length + 1));
+		mOutput.insert(mOutput.end(), name, name + length);
+	}
+
+	inline void GLCapture::EndPass()
+	{
+		if (mRecording)
+		{
+			_Marker(TRACE_OP_PASS_END);
+		}
+	}
+
+	inline void GLCapture::EndFrame()
+	{
+		if (mRecording && --mFramesLeft == 0)
+		{
+			_Finish();
+		}
+	}
+
+	void GLCapture::_Finish()
+	{
+		_Marker(TRACE_OP_END);
+		_Flush();
+		uint64_t size = static_cast<uint64_t>(mFile.tellp());
+		mFile.close();
+		mRecording = false;
+
+		std::cout << "GLCapture: " << mCalls << " calls, " << size / 1024 << " KB written to " << mPath << " ("
+				  << mBlobBytes / 1024 << " KB of uploads, " << mSharedBytes / 1024 << " KB more shared by content)" << std::endl;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <cctype>
+#include "gl_state.hpp"
+
+// The one definition of stb_image_write for a sample; undefined again so samples can include the header too
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+#undef STB_IMAGE_WRITE_IMPLEMENTATION
+
+namespace gl
+{
+	// Renders a sample to reference images for the golden-image check of the Benchmark tool. On frame `frame`
+	// the default framebuffer is read into a pixel pack buffer after every RenderPass, a fence follows the
+	// frame, and the frames after it keep rendering until the fence has passed, so the readback never stalls
+	// the frame that is captured. The images are then written top row first as RGB PNGs named
+	// "<pass index>_<pass class>.png" to the output directory, listed one per line in golden.txt.
+	class GLGolden
+	{
+	public:
+		static GLGolden* Instance()
+		{
+			if (!mInstance)
+			{
+				mInstance = new GLGolden();
+			}
+			return mInstance;
+		}
+
+		void Configure(const std::string& directory, GLuint frame);
+		bool IsEnabled() const { return !mDirectory.empty(); }
+		bool IsDone() const { return mDone; }
+
+		// Called by Engine after every pass and at the end of every frame
+		void CapturePass(GLuint frame, GLuint index, const char* name, GLuint width, GLuint height);
+		void EndFrame(GLuint frame);
+
+	private:
+		struct Readback
+		{
+			std::string name;
+			GLuint		buffer;
+			GLuint		width;
+			GLuint		height;
+		};
+
+		GLGolden() : mFrame(0), mFence(nullptr), mDone(false) {}
+
+		static std::string _FileName(GLuint index, const char* name);
+		void _Write();
+
+		std::string				mDirectory;
+		GLuint					mFrame;
+		GLsync					mFence;
+		bool					mDone;
+		std::vector<Readback>	mReadbacks;
+
+		static GLGolden* mInstance;
+	};
+
+	GLGolden* GLGolden::mInstance = nullptr;
+
+	inline void GLGolden::Configure(const std::string& directory, GLuint frame)
+	{
+		mDirectory = directory;
+		mFrame	   = frame;
+	}
+
+	std::string GLGolden::_FileName(GLuint index, const char* name)
+	{
+		// "class gl::PBRPass" from MSVC's typeid: keep the class name only
+		const char* start = name;
+		for (const char* c = name; *c; ++c)
+		{
+			if (*c == ':' || *c == ' ')
+			{
+				start = c + 1;
+			}
+		}
+
+		std::string file = std::to_string(index) + "_";
+		for (const char* c = start; *c; ++c)
+		{
+			file += std::isalnum(static_cast<unsigned char>(*c)) ? *c : '_';
+		}
+		return file + ".png";
+	}
+
+	void GLGolden::CapturePass(GLuint frame, GLuint index, const char* name, GLuint width, GLuint height)
+	{
+		if (frame != mFrame)
+		{
+			return;
+		}
+
+		Readback readback = { _FileName(index, name), 0, width, height };
+		glGenBuffers(1, &readback.buffer);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+		glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(width) * height * 4, nullptr, GL_STREAM_READ);
+
+		GLState::Instance()->BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+		glReadBuffer(GL_BACK);
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		mReadbacks.push_back(readback);
+	}
+
+	void GLGolden::EndFrame(GLuint frame)
+	{
+		if (frame == mFrame)
+		{
+			mFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			return;
+		}
+		if (frame < mFrame || mDone)
+		{
+			return;
+		}
+
+		// Anything but a timeout means the copies are done or waiting cannot help
+		if (glClientWaitSync(mFence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED)
+		{
+			return;
+		}
+		glDeleteSync(mFence);
+		mFence = nullptr;
+
+		_Write();
+		mDone = true;
+	}
+
+	void GLGolden::_Write()
+	{
+		std::ofstream manifest(mDirectory + "/golden.txt");
+		if (!manifest)
+		{
+			std::cerr << "Failed to write golden images to " << mDirectory << std::endl;
+		}
+
+		std::vector<unsigned char> rgb;
+		for (auto& readback : mReadbacks)
+		{
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+			auto rgba = static_cast<const unsigned char*>(glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+			if (rgba && manifest)
+			{
+				// GL rows start at the bottom; alpha of the default framebuffer is not meaningful
+				rgb.resize(static_cast<size_t>(readback.width) * readback.height * 3);
+				for (GLuint y = 0; y < readback.height; ++y)
+				{
+					const unsigned char* src = rgba + static_cast<size_t>(readback.height - 1 - y) * readback.width * 4;
+					unsigned char*		 dst = &rgb[static_cast<size_t>(y) * readback.width * 3];
+					for (GLuint x = 0; x < readback.width; ++x, src += 4, dst += 3)
+					{
+						dst[0] = src[0];
+						dst[1] = src[1];
+						dst[2] = src[2];
+					}
+				}
+
+				std::string path = mDirectory + "/" + readback.name;
+				if (stbi_write_png(path.c_str(), readback.width, readback.height, 3, rgb.data(), readback.width * 3))
+				{
+					manifest << readback.name << "\n";
+				}
+				else
+				{
+					std::cerr << "Failed to write " << path << std::endl;
+				}
+			}
+			if (rgba)
+			{
+				glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			}
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			glDeleteBuffers(1, &readback.buffer);
+		}
+		std::cout << "Golden: " << mReadbacks.size() << " images written to " << mDirectory << std::endl;
+		mReadbacks.clear();
+	}
+}
\ No newline at end of file
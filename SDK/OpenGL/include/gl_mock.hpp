@@ -0,0 +1,1006 @@
+#pragma once
+#include <glad/glad.h>
+#include <glad/glad_functions.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+
+namespace gl
+{
+	// A stand-in for the GL driver, loaded through gladLoadGLLoader(GLMock::GetProcAddress). Every function returns
+	// at once; the few whose results the SDK reads (object names, uniform locations, compile and link status,
+	// framebuffer status, state queries) answer like a GL 4.0 core driver would. Calls are counted per function,
+	// and basic misuse (binding names that were never generated, drawing without a program or VAO) is reported
+	// once per message on std::cerr and through glGetError.
+	class GLMock
+	{
+	public:
+		static const size_t MAX_REPORTED_ERRORS = 64;
+
+		static GLMock* Instance()
+		{
+			if (!mInstance)
+			{
+				mInstance = new GLMock();
+			}
+			return mInstance;
+		}
+
+		// GLADloadproc
+		static void* GetProcAddress(const char* name);
+
+		// Calls of one function ("glDrawElements") or of all of them since the last Reset
+		uint64_t GetCallCount(const char* name) const;
+		uint64_t GetTotalCalls() const;
+		// Validation failures since the last Reset, each message once
+		const std::vector<std::string>& GetErrors() const { return mErrors; }
+
+		// Clears the counters and errors; objects and bindings are kept
+		void Reset();
+
+	private:
+		enum Function
+		{
+#define GL_MOCK_ENUM(ret, name, params, args) FUNCTION_##name,
+			GLAD_FUNCTIONS(GL_MOCK_ENUM)
+#undef GL_MOCK_ENUM
+			FUNCTION_COUNT
+		};
+
+		enum ObjectKind
+		{
+			OBJECT_BUFFER = 0,
+			OBJECT_TEXTURE,
+			OBJECT_VERTEX_ARRAY,
+			OBJECT_FRAMEBUFFER,
+			OBJECT_RENDERBUFFER,
+			OBJECT_QUERY,
+			OBJECT_TRANSFORM_FEEDBACK,
+			OBJECT_SAMPLER,
+			OBJECT_SHADER,				// shaders and programs share one namespace
+			OBJECT_PROGRAM,
+			OBJECT_KIND_COUNT
+		};
+
+		GLMock();
+
+		static const char* _Name(Function function);
+		template <typename T>
+		static T _Zero() { return T(); }
+
+		void _Generate(ObjectKind kind, GLsizei count, GLuint* names);
+		void _Delete(ObjectKind kind, GLsizei count, const GLuint* names);
+		GLuint _Create(ObjectKind kind);
+		bool _IsLive(ObjectKind kind, GLuint name) const;
+		bool _Check(ObjectKind kind, GLuint name, Function function);
+		void _CheckDraw(Function function);
+		void _Fail(Function function, GLenum error, const std::string& message);
+
+		// Functions whose result nobody reads just count the call
+#define GL_MOCK_DEFAULT(ret, name, params, args) static ret APIENTRY _Default##name params { ++mCalls[FUNCTION_##name]; return _Zero<ret>(); }
+		GLAD_FUNCTIONS(GL_MOCK_DEFAULT)
+#undef GL_MOCK_DEFAULT
+
+		static void APIENTRY _GenBuffers(GLsizei n, GLuint* buffers);
+		static void APIENTRY _GenTextures(GLsizei n, GLuint* textures);
+		static void APIENTRY _GenVertexArrays(GLsizei n, GLuint* arrays);
+		static void APIENTRY _GenFramebuffers(GLsizei n, GLuint* framebuffers);
+		static void APIENTRY _GenRenderbuffers(GLsizei n, GLuint* renderbuffers);
+		static void APIENTRY _GenQueries(GLsizei n, GLuint* ids);
+		static void APIENTRY _GenTransformFeedbacks(GLsizei n, GLuint* ids);
+		static void APIENTRY _GenSamplers(GLsizei count, GLuint* samplers);
+		static GLuint APIENTRY _CreateShader(GLenum type);
+		static GLuint APIENTRY _CreateProgram();
+
+		static void APIENTRY _DeleteBuffers(GLsizei n, const GLuint* buffers);
+		static void APIENTRY _DeleteTextures(GLsizei n, const GLuint* textures);
+		static void APIENTRY _DeleteVertexArrays(GLsizei n, const GLuint* arrays);
+		static void APIENTRY _DeleteFramebuffers(GLsizei n, const GLuint* framebuffers);
+		static void APIENTRY _DeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers);
+		static void APIENTRY _DeleteShader(GLuint shader);
+		static void APIENTRY _DeleteProgram(GLuint program);
+
+		static void APIENTRY _BindBuffer(GLenum target, GLuint buffer);
+		static void APIENTRY _BindBufferBase(GLenum target, GLuint index, GLuint buffer);
+		static void APIENTRY _BindTexture(GLenum target, GLuint texture);
+		static void APIENTRY _BindVertexArray(GLuint array);
+		static void APIENTRY _BindFramebuffer(GLenum target, GLuint framebuffer);
+		static void APIENTRY _BindRenderbuffer(GLenum target, GLuint renderbuffer);
+		static void APIENTRY _BindTransformFeedback(GLenum target, GLuint id);
+		static void APIENTRY _UseProgram(GLuint program);
+		static void APIENTRY _ActiveTexture(GLenum texture);
+
+		static void APIENTRY _Enable(GLenum cap);
+		static void APIENTRY _Disable(GLenum cap);
+		static GLboolean APIENTRY _IsEnabled(GLenum cap);
+		static void APIENTRY _DepthFunc(GLenum func);
+		static void APIENTRY _DepthMask(GLboolean flag);
+		static void APIENTRY _BlendFunc(GLenum sfactor, GLenum dfactor);
+		static void APIENTRY _CullFace(GLenum mode);
+		static void APIENTRY _Viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+		static void APIENTRY _ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+
+		static void APIENTRY _DrawArrays(GLenum mode, GLint first, GLsizei count);
+		static void APIENTRY _DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
+		static void APIENTRY _DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices);
+		static void APIENTRY _DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount);
+		static void APIENTRY _DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex);
+		static void APIENTRY _DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex);
+		static void APIENTRY _DrawElementsIndirect(GLenum mode, GLenum type, const void* indirect);
+		static void APIENTRY _DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream);
+
+		static void APIENTRY _BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage);
+		static void* APIENTRY _MapBuffer(GLenum target, GLenum access);
+		static void* APIENTRY _MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+		static GLboolean APIENTRY _UnmapBuffer(GLenum target);
+
+		static GLenum APIENTRY _GetError();
+		static const GLubyte* APIENTRY _GetString(GLenum name);
+		static const GLubyte* APIENTRY _GetStringi(GLenum name, GLuint index);
+		static void APIENTRY _GetIntegerv(GLenum pname, GLint* data);
+		static void APIENTRY _GetBooleanv(GLenum pname, GLboolean* data);
+		static void APIENTRY _GetFloatv(GLenum pname, GLfloat* data);
+		static void APIENTRY _GetShaderiv(GLuint shader, GLenum pname, GLint* params);
+		static void APIENTRY _GetProgramiv(GLuint program, GLenum pname, GLint* params);
+		static void APIENTRY _GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog);
+		static void APIENTRY _GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog);
+		static GLint APIENTRY _GetUniformLocation(GLuint program, const GLchar* name);
+		static GLint APIENTRY _GetAttribLocation(GLuint program, const GLchar* name);
+		static GLuint APIENTRY _GetUniformBlockIndex(GLuint program, const GLchar* uniformBlockName);
+		static GLenum APIENTRY _CheckFramebufferStatus(GLenum target);
+		static GLboolean APIENTRY _IsBuffer(GLuint buffer);
+		static GLboolean APIENTRY _IsTexture(GLuint texture);
+		static GLboolean APIENTRY _IsVertexArray(GLuint array);
+		static GLboolean APIENTRY _IsFramebuffer(GLuint framebuffer);
+		static GLboolean APIENTRY _IsProgram(GLuint program);
+		static GLboolean APIENTRY _IsShader(GLuint shader);
+
+		GLuint					mNext[OBJECT_KIND_COUNT];
+		std::vector<bool>		mLive[OBJECT_KIND_COUNT];
+
+		GLuint					mProgram;
+		GLuint					mVertexArray;
+		GLuint					mDrawFramebuffer;
+		GLuint					mReadFramebuffer;
+		GLuint					mRenderbuffer;
+		GLenum					mActiveTexture;
+		GLint					mViewport[4];
+		GLfloat					mClearColor[4];
+		GLenum					mDepthFunc;
+		GLboolean				mDepthMask;
+		GLenum					mBlendSrc;
+		GLenum					mBlendDst;
+		GLenum					mCullFace;
+		GLenum					mError;
+
+		std::unordered_map<GLenum, bool>	mCaps;
+		std::unordered_map<GLenum, GLuint>	mBuffers;			// by target
+		std::unordered_map<GLuint, size_t>	mBufferSizes;
+		std::unordered_map<GLuint, std::vector<char>> mMappings;
+		std::unordered_map<GLuint, std::unordered_map<std::string, GLint>> mLocations;
+
+		std::vector<std::string> mErrors;
+
+		static uint64_t mCalls[FUNCTION_COUNT];
+		static GLMock* mInstance;
+	};
+
+	GLMock*  GLMock::mInstance = nullptr;
+	uint64_t GLMock::mCalls[GLMock::FUNCTION_COUNT] = {};
+
+	GLMock::GLMock()
+		: mProgram(0), mVertexArray(0), mDrawFramebuffer(0), mReadFramebuffer(0), mRenderbuffer(0), mActiveTexture(GL_TEXTURE0),
+		  mDepthFunc(GL_LESS), mDepthMask(GL_TRUE), mBlendSrc(GL_ONE), mBlendDst(GL_ZERO), mCullFace(GL_BACK), mError(GL_NO_ERROR)
+	{
+		std::memset(mNext, 0, sizeof(mNext));
+		std::memset(mViewport, 0, sizeof(mViewport));
+		std::memset(mClearColor, 0, sizeof(mClearColor));
+	}
+
+	void* GLMock::GetProcAddress(const char* name)
+	{
+		static std::unordered_map<std::string, void*> table;
+		if (table.empty())
+		{
+#define GL_MOCK_DEFAULT(ret, name, params, args) table["gl" #name] = reinterpret_cast<void*>(&_Default##name);
+			GLAD_FUNCTIONS(GL_MOCK_DEFAULT)
+#undef GL_MOCK_DEFAULT
+
+			// The cast fails to compile if an override's signature does not match glad's
+#define GL_MOCK_OVERRIDE(name) table["gl" #name] = reinterpret_cast<void*>(static_cast<decltype(glad_gl##name)>(&_##name));
+			GL_MOCK_OVERRIDE(GenBuffers)
+			GL_MOCK_OVERRIDE(GenTextures)
+			GL_MOCK_OVERRIDE(GenVertexArrays)
+			GL_MOCK_OVERRIDE(GenFramebuffers)
+			GL_MOCK_OVERRIDE(GenRenderbuffers)
+			GL_MOCK_OVERRIDE(GenQueries)
+			GL_MOCK_OVERRIDE(GenTransformFeedbacks)
+			GL_MOCK_OVERRIDE(GenSamplers)
+			GL_MOCK_OVERRIDE(CreateShader)
+			GL_MOCK_OVERRIDE(CreateProgram)
+			GL_MOCK_OVERRIDE(DeleteBuffers)
+			GL_MOCK_OVERRIDE(DeleteTextures)
+			GL_MOCK_OVERRIDE(DeleteVertexArrays)
+			GL_MOCK_OVERRIDE(DeleteFramebuffers)
+			GL_MOCK_OVERRIDE(DeleteRenderbuffers)
+			GL_MOCK_OVERRIDE(DeleteShader)
+			GL_MOCK_OVERRIDE(DeleteProgram)
+			GL_MOCK_OVERRIDE(BindBuffer)
+			GL_MOCK_OVERRIDE(BindBufferBase)
+			GL_MOCK_OVERRIDE(BindTexture)
+			GL_MOCK_OVERRIDE(BindVertexArray)
+			GL_MOCK_OVERRIDE(BindFramebuffer)
+			GL_MOCK_OVERRIDE(BindRenderbuffer)
+			GL_MOCK_OVERRIDE(BindTransformFeedback)
+			GL_MOCK_OVERRIDE(UseProgram)
+			GL_MOCK_OVERRIDE(ActiveTexture)
+			GL_MOCK_OVERRIDE(Enable)
+			GL_MOCK_OVERRIDE(Disable)
+			GL_MOCK_OVERRIDE(IsEnabled)
+			GL_MOCK_OVERRIDE(DepthFunc)
+			GL_MOCK_OVERRIDE(DepthMask)
+			GL_MOCK_OVERRIDE(BlendFunc)
+			GL_MOCK_OVERRIDE(CullFace)
+			GL_MOCK_OVERRIDE(Viewport)
+			GL_MOCK_OVERRIDE(ClearColor)
+			GL_MOCK_OVERRIDE(DrawArrays)
+			GL_MOCK_OVERRIDE(DrawArraysInstanced)
+			GL_MOCK_OVERRIDE(DrawElements)
+			GL_MOCK_OVERRIDE(DrawElementsInstanced)
+			GL_MOCK_OVERRIDE(DrawElementsBaseVertex)
+			GL_MOCK_OVERRIDE(DrawElementsInstancedBaseVertex)
+			GL_MOCK_OVERRIDE(DrawElementsIndirect)
+			GL_MOCK_OVERRIDE(DrawTransformFeedbackStream)
+			GL_MOCK_OVERRIDE(BufferData)
+			GL_MOCK_OVERRIDE(MapBuffer)
+			GL_MOCK_OVERRIDE(MapBufferRange)
+			GL_MOCK_OVERRIDE(UnmapBuffer)
+			GL_MOCK_OVERRIDE(GetError)
+			GL_MOCK_OVERRIDE(GetString)
+			GL_MOCK_OVERRIDE(GetStringi)
+			GL_MOCK_OVERRIDE(GetIntegerv)
+			GL_MOCK_OVERRIDE(GetBooleanv)
+			GL_MOCK_OVERRIDE(GetFloatv)
+			GL_MOCK_OVERRIDE(GetShaderiv)
+			GL_MOCK_OVERRIDE(GetProgramiv)
+			GL_MOCK_OVERRIDE(GetShaderInfoLog)
+			GL_MOCK_OVERRIDE(GetProgramInfoLog)
+			GL_MOCK_OVERRIDE(GetUniformLocation)
+			GL_MOCK_OVERRIDE(GetAttribLocation)
+			GL_MOCK_OVERRIDE(GetUniformBlockIndex)
+			GL_MOCK_OVERRIDE(CheckFramebufferStatus)
+			GL_MOCK_OVERRIDE(IsBuffer)
+			GL_MOCK_OVERRIDE(IsTexture)
+			GL_MOCK_OVERRIDE(IsVertexArray)
+			GL_MOCK_OVERRIDE(IsFramebuffer)
+			GL_MOCK_OVERRIDE(IsProgram)
+			GL_MOCK_OVERRIDE(IsShader)
+#undef GL_MOCK_OVERRIDE
+		}
+
+		auto found = table.find(name);
+		return found != table.end() ? found->second : nullptr;
+	}
+
+	uint64_t GLMock::GetCallCount(const char* name) const
+	{
+		for (int function = 0; function < FUNCTION_COUNT; ++function)
+		{
+			if (std::strcmp(_Name(static_cast<Function>(function)), name) == 0)
+			{
+				return mCalls[function];
+			}
+		}
+		return 0;
+	}
+
+	uint64_t GLMock::GetTotalCalls() const
+	{
+		uint64_t total = 0;
+		for (auto calls : mCalls)
+		{
+			total += calls;
+		}
+		return total;
+	}
+
+	void GLMock::Reset()
+	{
+		std::memset(mCalls, 0, sizeof(mCalls));
+		mErrors.clear();
+		mError = GL_NO_ERROR;
+	}
+
+	inline const char* GLMock::_Name(Function function)
+	{
+		static const char* names[] = {
+#define GL_MOCK_NAME(ret, name, params, args) "gl" #name,
+			GLAD_FUNCTIONS(GL_MOCK_NAME)
+#undef GL_MOCK_NAME
+		};
+		return names[function];
+	}
+
+	void GLMock::_Generate(ObjectKind kind, GLsizei count, GLuint* names)
+	{
+		// Shaders and programs draw from the same counter
+		GLuint& next = mNext[kind == OBJECT_SHADER ? OBJECT_PROGRAM : kind];
+		auto& live = mLive[kind];
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			names[i] = ++next;
+			if (live.size() <= names[i])
+			{
+				live.resize(names[i] * 2);
+			}
+			live[names[i]] = true;
+		}
+	}
+
+	inline GLuint GLMock::_Create(ObjectKind kind)
+	{
+		GLuint name;
+		_Generate(kind, 1, &name);
+		return name;
+	}
+
+	void GLMock::_Delete(ObjectKind kind, GLsizei count, const GLuint* names)
+	{
+		auto& live = mLive[kind];
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			// Unused names and 0 are silently ignored, as in GL
+			if (names[i] < live.size())
+			{
+				live[names[i]] = false;
+			}
+		}
+	}
+
+	inline bool GLMock::_IsLive(ObjectKind kind, GLuint name) const
+	{
+		return name < mLive[kind].size() && mLive[kind][name];
+	}
+
+	inline bool GLMock::_Check(ObjectKind kind, GLuint name, Function function)
+	{
+		if (name == 0 || _IsLive(kind, name))
+		{
+			return true;
+		}
+		_Fail(function, GL_INVALID_OPERATION, std::to_string(name) + " was never generated or has been deleted");
+		return false;
+	}
+
+	void GLMock::_CheckDraw(Function function)
+	{
+		if (mProgram == 0)
+		{
+			_Fail(function, GL_INVALID_OPERATION, "no program in use");
+		}
+		if (mVertexArray == 0)
+		{
+			_Fail(function, GL_INVALID_OPERATION, "no vertex array bound (required by the core profile)");
+		}
+	}
+
+	void GLMock::_Fail(Function function, GLenum error, const std::string& message)
+	{
+		if (mError == GL_NO_ERROR)
+		{
+			mError = error;
+		}
+
+		std::string text = std::string(_Name(function)) + ": " + message;
+		if (mErrors.size() < MAX_REPORTED_ERRORS && std::find(mErrors.begin(), mErrors.end(), text) == mErrors.end())
+		{
+			std::cerr << "GLMock: " << text << std::endl;
+			mErrors.push_back(text);
+		}
+	}
+
+	void APIENTRY GLMock::_GenBuffers(GLsizei n, GLuint* buffers)
+	{
+		++mCalls[FUNCTION_GenBuffers];
+		Instance()->_Generate(OBJECT_BUFFER, n, buffers);
+	}
+
+	void APIENTRY GLMock::_GenTextures(GLsizei n, GLuint* textures)
+	{
+		++mCalls[FUNCTION_GenTextures];
+		Instance()->_Generate(OBJECT_TEXTURE, n, textures);
+	}
+
+	void APIENTRY GLMock::_GenVertexArrays(GLsizei n, GLuint* arrays)
+	{
+		++mCalls[FUNCTION_GenVertexArrays];
+		Instance()->_Generate(OBJECT_VERTEX_ARRAY, n, arrays);
+	}
+
+	void APIENTRY GLMock::_GenFramebuffers(GLsizei n, GLuint* framebuffers)
+	{
+		++mCalls[FUNCTION_GenFramebuffers];
+		Instance()->_Generate(OBJECT_FRAMEBUFFER, n, framebuffers);
+	}
+
+	void APIENTRY GLMock::_GenRenderbuffers(GLsizei n, GLuint* renderbuffers)
+	{
+		++mCalls[FUNCTION_GenRenderbuffers];
+		Instance()->_Generate(OBJECT_RENDERBUFFER, n, renderbuffers);
+	}
+
+	void APIENTRY GLMock::_GenQueries(GLsizei n, GLuint* ids)
+	{
+		++mCalls[FUNCTION_GenQueries];
+		Instance()->_Generate(OBJECT_QUERY, n, ids);
+	}
+
+	void APIENTRY GLMock::_GenTransformFeedbacks(GLsizei n, GLuint* ids)
+	{
+		++mCalls[FUNCTION_GenTransformFeedbacks];
+		Instance()->_Generate(OBJECT_TRANSFORM_FEEDBACK, n, ids);
+	}
+
+	void APIENTRY GLMock::_GenSamplers(GLsizei count, GLuint* samplers)
+	{
+		++mCalls[FUNCTION_GenSamplers];
+		Instance()->_Generate(OBJECT_SAMPLER, count, samplers);
+	}
+
+	GLuint APIENTRY GLMock::_CreateShader(GLenum type)
+	{
+		++mCalls[FUNCTION_CreateShader];
+		return Instance()->_Create(OBJECT_SHADER);
+	}
+
+	GLuint APIENTRY GLMock::_CreateProgram()
+	{
+		++mCalls[FUNCTION_CreateProgram];
+		return Instance()->_Create(OBJECT_PROGRAM);
+	}
+
+	void APIENTRY GLMock::_DeleteBuffers(GLsizei n, const GLuint* buffers)
+	{
+		++mCalls[FUNCTION_DeleteBuffers];
+		Instance()->_Delete(OBJECT_BUFFER, n, buffers);
+	}
+
+	void APIENTRY GLMock::_DeleteTextures(GLsizei n, const GLuint* textures)
+	{
+		++mCalls[FUNCTION_DeleteTextures];
+		Instance()->_Delete(OBJECT_TEXTURE, n, textures);
+	}
+
+	void APIENTRY GLMock::_DeleteVertexArrays(GLsizei n, const GLuint* arrays)
+	{
+		++mCalls[FUNCTION_DeleteVertexArrays];
+		GLMock* mock = Instance();
+		mock->_Delete(OBJECT_VERTEX_ARRAY, n, arrays);
+		if (!mock->_IsLive(OBJECT_VERTEX_ARRAY, mock->mVertexArray))
+		{
+			mock->mVertexArray = 0;
+		}
+	}
+
+	void APIENTRY GLMock::_DeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
+	{
+		++mCalls[FUNCTION_DeleteFramebuffers];
+		GLMock* mock = Instance();
+		mock->_Delete(OBJECT_FRAMEBUFFER, n, framebuffers);
+		if (!mock->_IsLive(OBJECT_FRAMEBUFFER, mock->mDrawFramebuffer))
+		{
+			mock->mDrawFramebuffer = 0;
+		}
+		if (!mock->_IsLive(OBJECT_FRAMEBUFFER, mock->mReadFramebuffer))
+		{
+			mock->mReadFramebuffer = 0;
+		}
+	}
+
+	void APIENTRY GLMock::_DeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
+	{
+		++mCalls[FUNCTION_DeleteRenderbuffers];
+		Instance()->_Delete(OBJECT_RENDERBUFFER, n, renderbuffers);
+	}
+
+	void APIENTRY GLMock::_DeleteShader(GLuint shader)
+	{
+		++mCalls[FUNCTION_DeleteShader];
+		Instance()->_Delete(OBJECT_SHADER, 1, &shader);
+	}
+
+	// A program in use stays usable after glDeleteProgram until it is replaced
+	void APIENTRY GLMock::_DeleteProgram(GLuint program)
+	{
+		++mCalls[FUNCTION_DeleteProgram];
+		Instance()->_Delete(OBJECT_PROGRAM, 1, &program);
+	}
+
+	void APIENTRY GLMock::_BindBuffer(GLenum target, GLuint buffer)
+	{
+		++mCalls[FUNCTION_BindBuffer];
+		GLMock* mock = Instance();
+		if (mock->_Check(OBJECT_BUFFER, buffer, FUNCTION_BindBuffer))
+		{
+			mock->mBuffers[target] = buffer;
+		}
+	}
+
+	void APIENTRY GLMock::_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+	{
+		++mCalls[FUNCTION_BindBufferBase];
+		GLMock* mock = Instance();
+		if (mock->_Check(OBJECT_BUFFER, buffer, FUNCTION_BindBufferBase))
+		{
+			mock->mBuffers[target] = buffer;
+		}
+	}
+
+	void APIENTRY GLMock::_BindTexture(GLenum target, GLuint texture)
+	{
+		++mCalls[FUNCTION_BindTexture];
+		Instance()->_Check(OBJECT_TEXTURE, texture, FUNCTION_BindTexture);
+	}
+
+	void APIENTRY GLMock::_BindVertexArray(GLuint array)
+	{
+		++mCalls[FUNCTION_BindVertexArray];
+		GLMock* mock = Instance();
+		if (mock->_Check(OBJECT_VERTEX_ARRAY, array, FUNCTION_BindVertexArray))
+		{
+			mock->mVertexArray = array;
+		}
+	}
+
+	void APIENTRY GLMock::_BindFramebuffer(GLenum target, GLuint framebuffer)
+	{
+		++mCalls[FUNCTION_BindFramebuffer];
+		GLMock* mock = Instance();
+		if (!mock->_Check(OBJECT_FRAMEBUFFER, framebuffer, FUNCTION_BindFramebuffer))
+		{
+			return;
+		}
+		if (target != GL_READ_FRAMEBUFFER)
+		{
+			mock->mDrawFramebuffer = framebuffer;
+		}
+		if (target != GL_DRAW_FRAMEBUFFER)
+		{
+			mock->mReadFramebuffer = framebuffer;
+		}
+	}
+
+	void APIENTRY GLMock::_BindRenderbuffer(GLenum target, GLuint renderbuffer)
+	{
+		++mCalls[FUNCTION_BindRenderbuffer];
+		GLMock* mock = Instance();
+		if (mock->_Check(OBJECT_RENDERBUFFER, renderbuffer, FUNCTION_BindRenderbuffer))
+		{
+			mock->mRenderbuffer = renderbuffer;
+		}
+	}
+
+	void APIENTRY GLMock::_BindTransformFeedback(GLenum target, GLuint id)
+	{
+		++mCalls[FUNCTION_BindTransformFeedback];
+		Instance()->_Check(OBJECT_TRANSFORM_FEEDBACK, id, FUNCTION_BindTransformFeedback);
+	}
+
+	void APIENTRY GLMock::_UseProgram(GLuint program)
+	{
+		++mCalls[FUNCTION_UseProgram];
+		GLMock* mock = Instance();
+		if (mock->_Check(OBJECT_PROGRAM, program, FUNCTION_UseProgram))
+		{
+			mock->mProgram = program;
+		}
+	}
+
+	void APIENTRY GLMock::_ActiveTexture(GLenum texture)
+	{
+		++mCalls[FUNCTION_ActiveTexture];
+		GLMock* mock = Instance();
+		if (texture < GL_TEXTURE0 || texture > GL_TEXTURE31)
+		{
+			mock->_Fail(FUNCTION_ActiveTexture, GL_INVALID_ENUM, "unit out of range");
+			return;
+		}
+		mock->mActiveTexture = texture;
+	}
+
+	void APIENTRY GLMock::_Enable(GLenum cap)
+	{
+		++mCalls[FUNCTION_Enable];
+		Instance()->mCaps[cap] = true;
+	}
+
+	void APIENTRY GLMock::_Disable(GLenum cap)
+	{
+		++mCalls[FUNCTION_Disable];
+		Instance()->mCaps[cap] = false;
+	}
+
+	GLboolean APIENTRY GLMock::_IsEnabled(GLenum cap)
+	{
+		++mCalls[FUNCTION_IsEnabled];
+		GLMock* mock = Instance();
+		auto found = mock->mCaps.find(cap);
+		// Dithering is the only capability GL starts with enabled
+		bool enabled = found != mock->mCaps.end() ? found->second : cap == GL_DITHER;
+		return enabled ? GL_TRUE : GL_FALSE;
+	}
+
+	void APIENTRY GLMock::_DepthFunc(GLenum func)
+	{
+		++mCalls[FUNCTION_DepthFunc];
+		Instance()->mDepthFunc = func;
+	}
+
+	void APIENTRY GLMock::_DepthMask(GLboolean flag)
+	{
+		++mCalls[FUNCTION_DepthMask];
+		Instance()->mDepthMask = flag;
+	}
+
+	void APIENTRY GLMock::_BlendFunc(GLenum sfactor, GLenum dfactor)
+	{
+		++mCalls[FUNCTION_BlendFunc];
+		GLMock* mock = Instance();
+		mock->mBlendSrc = sfactor;
+		mock->mBlendDst = dfactor;
+	}
+
+	void APIENTRY GLMock::_CullFace(GLenum mode)
+	{
+		++mCalls[FUNCTION_CullFace];
+		Instance()->mCullFace = mode;
+	}
+
+	void APIENTRY GLMock::_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		++mCalls[FUNCTION_Viewport];
+		GLint* viewport = Instance()->mViewport;
+		viewport[0] = x;
+		viewport[1] = y;
+		viewport[2] = width;
+		viewport[3] = height;
+	}
+
+	void APIENTRY GLMock::_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+	{
+		++mCalls[FUNCTION_ClearColor];
+		GLfloat* color = Instance()->mClearColor;
+		color[0] = red;
+		color[1] = green;
+		color[2] = blue;
+		color[3] = alpha;
+	}
+
+	void APIENTRY GLMock::_DrawArrays(GLenum mode, GLint first, GLsizei count)
+	{
+		++mCalls[FUNCTION_DrawArrays];
+		Instance()->_CheckDraw(FUNCTION_DrawArrays);
+	}
+
+	void APIENTRY GLMock::_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+	{
+		++mCalls[FUNCTION_DrawArraysInstanced];
+		Instance()->_CheckDraw(FUNCTION_DrawArraysInstanced);
+	}
+
+	void APIENTRY GLMock::_DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+	{
+		++mCalls[FUNCTION_DrawElements];
+		Instance()->_CheckDraw(FUNCTION_DrawElements);
+	}
+
+	void APIENTRY GLMock::_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount)
+	{
+		++mCalls[FUNCTION_DrawElementsInstanced];
+		Instance()->_CheckDraw(FUNCTION_DrawElementsInstanced);
+	}
+
+	void APIENTRY GLMock::_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex)
+	{
+		++mCalls[FUNCTION_DrawElementsBaseVertex];
+		Instance()->_CheckDraw(FUNCTION_DrawElementsBaseVertex);
+	}
+
+	void APIENTRY GLMock::_DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex)
+	{
+		++mCalls[FUNCTION_DrawElementsInstancedBaseVertex];
+		Instance()->_CheckDraw(FUNCTION_DrawElementsInstancedBaseVertex);
+	}
+
+	void APIENTRY GLMock::_DrawElementsIndirect(GLenum mode, GLenum type, const void* indirect)
+	{
+		++mCalls[FUNCTION_DrawElementsIndirect];
+		GLMock* mock = Instance();
+		mock->_CheckDraw(FUNCTION_DrawElementsIndirect);
+		if (mock->mBuffers[GL_DRAW_INDIRECT_BUFFER] == 0)
+		{
+			mock->_Fail(FUNCTION_DrawElementsIndirect, GL_INVALID_OPERATION, "no draw indirect buffer bound");
+		}
+	}
+
+	void APIENTRY GLMock::_DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
+	{
+		++mCalls[FUNCTION_DrawTransformFeedbackStream];
+		GLMock* mock = Instance();
+		mock->_CheckDraw(FUNCTION_DrawTransformFeedbackStream);
+		mock->_Check(OBJECT_TRANSFORM_FEEDBACK, id, FUNCTION_DrawTransformFeedbackStream);
+	}
+
+	void APIENTRY GLMock::_BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+	{
+		++mCalls[FUNCTION_BufferData];
+		GLMock* mock = Instance();
+		GLuint buffer = mock->mBuffers[target];
+		if (buffer == 0)
+		{
+			mock->_Fail(FUNCTION_BufferData, GL_INVALID_OPERATION, "no buffer bound to the target");
+			return;
+		}
+		mock->mBufferSizes[buffer] = static_cast<size_t>(size);
+	}
+
+	// Mappings point at scratch memory of the buffer's size; what is written there goes nowhere
+	void* APIENTRY GLMock::_MapBuffer(GLenum target, GLenum access)
+	{
+		++mCalls[FUNCTION_MapBuffer];
+		GLMock* mock = Instance();
+		GLuint buffer = mock->mBuffers[target];
+		if (buffer == 0)
+		{
+			mock->_Fail(FUNCTION_MapBuffer, GL_INVALID_OPERATION, "no buffer bound to the target");
+			return nullptr;
+		}
+		auto& mapping = mock->mMappings[buffer];
+		mapping.resize(std::max<size_t>(mock->mBufferSizes[buffer], 1));
+		return mapping.data();
+	}
+
+	void* APIENTRY GLMock::_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+	{
+		++mCalls[FUNCTION_MapBufferRange];
+		GLMock* mock = Instance();
+		GLuint buffer = mock->mBuffers[target];
+		if (buffer == 0 || static_cast<size_t>(offset + length) > mock->mBufferSizes[buffer])
+		{
+			mock->_Fail(FUNCTION_MapBufferRange, GL_INVALID_VALUE, "range outside the bound buffer");
+			return nullptr;
+		}
+		auto& mapping = mock->mMappings[buffer];
+		mapping.resize(std::max<size_t>(mock->mBufferSizes[buffer], 1));
+		return mapping.data() + offset;
+	}
+
+	GLboolean APIENTRY GLMock::_UnmapBuffer(GLenum target)
+	{
+		++mCalls[FUNCTION_UnmapBuffer];
+		return GL_TRUE;
+	}
+
+	GLenum APIENTRY GLMock::_GetError()
+	{
+		++mCalls[FUNCTION_GetError];
+		GLMock* mock = Instance();
+		GLenum error = mock->mError;
+		mock->mError = GL_NO_ERROR;
+		return error;
+	}
+
+	const GLubyte* APIENTRY GLMock::_GetString(GLenum name)
+	{
+		++mCalls[FUNCTION_GetString];
+		switch (name)
+		{
+		case GL_VENDOR:						return reinterpret_cast<const GLubyte*>("GLMock");
+		case GL_RENDERER:					return reinterpret_cast<const GLubyte*>("GLMock (no GPU)");
+		case GL_VERSION:					return reinterpret_cast<const GLubyte*>("4.0.0 GLMock");
+		case GL_SHADING_LANGUAGE_VERSION:	return reinterpret_cast<const GLubyte*>("4.00 GLMock");
+		default:
+			Instance()->_Fail(FUNCTION_GetString, GL_INVALID_ENUM, "unknown name");
+			return nullptr;
+		}
+	}
+
+	// glad fails to load when a 3.0+ context reports no extensions, so there is one placeholder
+	const GLubyte* APIENTRY GLMock::_GetStringi(GLenum name, GLuint index)
+	{
+		++mCalls[FUNCTION_GetStringi];
+		if (name != GL_EXTENSIONS || index != 0)
+		{
+			Instance()->_Fail(FUNCTION_GetStringi, GL_INVALID_VALUE, "index past GL_NUM_EXTENSIONS");
+			return nullptr;
+		}
+		return reinterpret_cast<const GLubyte*>("GL_MOCK_no_gpu");
+	}
+
+	void APIENTRY GLMock::_GetIntegerv(GLenum pname, GLint* data)
+	{
+		++mCalls[FUNCTION_GetIntegerv];
+		GLMock* mock = Instance();
+		switch (pname)
+		{
+		case GL_MAJOR_VERSION:						*data = 4; break;
+		case GL_MINOR_VERSION:						*data = 0; break;
+		case GL_NUM_EXTENSIONS:						*data = 1; break;
+		case GL_CURRENT_PROGRAM:					*data = mock->mProgram; break;
+		case GL_VERTEX_ARRAY_BINDING:				*data = mock->mVertexArray; break;
+		case GL_DRAW_FRAMEBUFFER_BINDING:			*data = mock->mDrawFramebuffer; break;
+		case GL_READ_FRAMEBUFFER_BINDING:			*data = mock->mReadFramebuffer; break;
+		case GL_RENDERBUFFER_BINDING:				*data = mock->mRenderbuffer; break;
+		case GL_ARRAY_BUFFER_BINDING:				*data = mock->mBuffers[GL_ARRAY_BUFFER]; break;
+		case GL_ACTIVE_TEXTURE:						*data = mock->mActiveTexture; break;
+		case GL_DEPTH_FUNC:							*data = mock->mDepthFunc; break;
+		case GL_BLEND_SRC_RGB:
+		case GL_BLEND_SRC_ALPHA:					*data = mock->mBlendSrc; break;
+		case GL_BLEND_DST_RGB:
+		case GL_BLEND_DST_ALPHA:					*data = mock->mBlendDst; break;
+		case GL_CULL_FACE_MODE:						*data = mock->mCullFace; break;
+		case GL_VIEWPORT:							std::memcpy(data, mock->mViewport, sizeof(mock->mViewport)); break;
+		case GL_MAX_VIEWPORT_DIMS:					data[0] = data[1] = 16384; break;
+		case GL_MAX_TEXTURE_SIZE:
+		case GL_MAX_CUBE_MAP_TEXTURE_SIZE:
+		case GL_MAX_RENDERBUFFER_SIZE:				*data = 16384; break;
+		case GL_MAX_3D_TEXTURE_SIZE:
+		case GL_MAX_ARRAY_TEXTURE_LAYERS:			*data = 2048; break;
+		case GL_MAX_TEXTURE_BUFFER_SIZE:			*data = 1 << 27; break;
+		case GL_MAX_TEXTURE_IMAGE_UNITS:
+		case GL_MAX_VERTEX_ATTRIBS:					*data = 16; break;
+		case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:	*data = 80; break;
+		case GL_MAX_COLOR_ATTACHMENTS:
+		case GL_MAX_DRAW_BUFFERS:
+		case GL_MAX_SAMPLES:						*data = 8; break;
+		case GL_MAX_UNIFORM_BLOCK_SIZE:				*data = 65536; break;
+		case GL_MAX_UNIFORM_BUFFER_BINDINGS:		*data = 36; break;
+		case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:	*data = 256; break;
+		case GL_MAX_TRANSFORM_FEEDBACK_BUFFERS:
+		case GL_MAX_VERTEX_STREAMS:					*data = 4; break;
+		case GL_MAX_GEOMETRY_OUTPUT_VERTICES:		*data = 256; break;
+		default:									*data = 0; break;
+		}
+	}
+
+	void APIENTRY GLMock::_GetBooleanv(GLenum pname, GLboolean* data)
+	{
+		++mCalls[FUNCTION_GetBooleanv];
+		*data = pname == GL_DEPTH_WRITEMASK ? Instance()->mDepthMask : GL_FALSE;
+	}
+
+	void APIENTRY GLMock::_GetFloatv(GLenum pname, GLfloat* data)
+	{
+		++mCalls[FUNCTION_GetFloatv];
+		if (pname == GL_COLOR_CLEAR_VALUE)
+		{
+			std::memcpy(data, Instance()->mClearColor, sizeof(mInstance->mClearColor));
+		}
+		else
+		{
+			*data = 0.f;
+		}
+	}
+
+	// Every shader compiles and every program links
+	void APIENTRY GLMock::_GetShaderiv(GLuint shader, GLenum pname, GLint* params)
+	{
+		++mCalls[FUNCTION_GetShaderiv];
+		if (Instance()->_Check(OBJECT_SHADER, shader, FUNCTION_GetShaderiv))
+		{
+			*params = pname == GL_COMPILE_STATUS ? GL_TRUE : 0;
+		}
+	}
+
+	void APIENTRY GLMock::_GetProgramiv(GLuint program, GLenum pname, GLint* params)
+	{
+		++mCalls[FUNCTION_GetProgramiv];
+		if (Instance()->_Check(OBJECT_PROGRAM, program, FUNCTION_GetProgramiv))
+		{
+			*params = pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS ? GL_TRUE : 0;
+		}
+	}
+
+	void APIENTRY GLMock::_GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+	{
+		++mCalls[FUNCTION_GetShaderInfoLog];
+		if (length)
+		{
+			*length = 0;
+		}
+		if (bufSize > 0)
+		{
+			infoLog[0] = '\0';
+		}
+	}
+
+	void APIENTRY GLMock::_GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+	{
+		++mCalls[FUNCTION_GetProgramInfoLog];
+		if (length)
+		{
+			*length = 0;
+		}
+		if (bufSize > 0)
+		{
+			infoLog[0] = '\0';
+		}
+	}
+
+	// Any name is an active uniform; each gets the next location of its program
+	GLint APIENTRY GLMock::_GetUniformLocation(GLuint program, const GLchar* name)
+	{
+		++mCalls[FUNCTION_GetUniformLocation];
+		GLMock* mock = Instance();
+		if (!mock->_IsLive(OBJECT_PROGRAM, program))
+		{
+			mock->_Fail(FUNCTION_GetUniformLocation, GL_INVALID_OPERATION, "not a program");
+			return -1;
+		}
+		auto& locations = mock->mLocations[program];
+		auto found = locations.find(name);
+		if (found == locations.end())
+		{
+			found = locations.emplace(name, static_cast<GLint>(locations.size())).first;
+		}
+		return found->second;
+	}
+
+	GLint APIENTRY GLMock::_GetAttribLocation(GLuint program, const GLchar* name)
+	{
+		++mCalls[FUNCTION_GetAttribLocation];
+		return 0;
+	}
+
+	GLuint APIENTRY GLMock::_GetUniformBlockIndex(GLuint program, const GLchar* uniformBlockName)
+	{
+		++mCalls[FUNCTION_GetUniformBlockIndex];
+		return 0;
+	}
+
+	GLenum APIENTRY GLMock::_CheckFramebufferStatus(GLenum target)
+	{
+		++mCalls[FUNCTION_CheckFramebufferStatus];
+		return GL_FRAMEBUFFER_COMPLETE;
+	}
+
+	GLboolean APIENTRY GLMock::_IsBuffer(GLuint buffer)
+	{
+		++mCalls[FUNCTION_IsBuffer];
+		return Instance()->_IsLive(OBJECT_BUFFER, buffer) ? GL_TRUE : GL_FALSE;
+	}
+
+	GLboolean APIENTRY GLMock::_IsTexture(GLuint texture)
+	{
+		++mCalls[FUNCTION_IsTexture];
+		return Instance()->_IsLive(OBJECT_TEXTURE, texture) ? GL_TRUE : GL_FALSE;
+	}
+
+	GLboolean APIENTRY GLMock::_IsVertexArray(GLuint array)
+	{
+		++mCalls[FUNCTION_IsVertexArray];
+		return Instance()->_IsLive(OBJECT_VERTEX_ARRAY, array) ? GL_TRUE : GL_FALSE;
+	}
+
+	GLboolean APIENTRY GLMock::_IsFramebuffer(GLuint framebuffer)
+	{
+		++mCalls[FUNCTION_IsFramebuffer];
+		return Instance()->_IsLive(OBJECT_FRAMEBUFFER, framebuffer) ? GL_TRUE : GL_FALSE;
+	}
+
+	GLboolean APIENTRY GLMock::_IsProgram(GLuint program)
+	{
+		++mCalls[FUNCTION_IsProgram];
+		return Instance()->_IsLive(OBJECT_PROGRAM, program) ? GL_TRUE : GL_FALSE;
+	}
+
+	GLboolean APIENTRY GLMock::_IsShader(GLuint shader)
+	{
+		++mCalls[FUNCTION_IsShader];
+		return Instance()->_IsLive(OBJECT_SHADER, shader) ? GL_TRUE : GL_FALSE;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,501 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <cstdarg>
+#include <cstdint>
+#include <cstring>
+
+namespace gl
+{
+	// GL work issued by one pass in one frame
+	struct GLCallStats
+	{
+		GLuint	 calls;
+		GLuint	 draws;
+		uint64_t triangles;		// from the arguments of direct draws; indirect and transform feedback draws add none
+		uint64_t uploadBytes;	// glBufferData/glBufferSubData and glTex(Sub)Image2D/3D with client memory
+		GLuint	 stateChanges;	// binds, enables, blend/depth/cull/viewport state
+
+		GLCallStats() : calls(0), draws(0), triangles(0), uploadBytes(0), stateChanges(0) {}
+	};
+
+	struct GLPassCalls
+	{
+		std::string								  pass;
+		GLCallStats								  stats;
+		std::unordered_map<const char*, GLuint>	  functions;	// glad passes each function's name as the same literal every call
+	};
+
+	// Bytes per texel of client pixel data in format/type; row padding from GL_UNPACK_ALIGNMENT is not included
+	inline uint64_t TexelBytes(GLenum format, GLenum type)
+	{
+		switch (type)
+		{
+		case GL_UNSIGNED_SHORT_5_6_5:
+		case GL_UNSIGNED_SHORT_4_4_4_4:
+		case GL_UNSIGNED_SHORT_5_5_5_1:
+			return 2;
+		case GL_UNSIGNED_INT_8_8_8_8:
+		case GL_UNSIGNED_INT_10_10_10_2:
+		case GL_UNSIGNED_INT_2_10_10_10_REV:
+		case GL_UNSIGNED_INT_24_8:
+		case GL_UNSIGNED_INT_10F_11F_11F_REV:
+		case GL_UNSIGNED_INT_5_9_9_9_REV:
+			return 4;
+		case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+			return 8;
+		default:
+			break;
+		}
+
+		uint64_t components;
+		switch (format)
+		{
+		case GL_RG:
+		case GL_RG_INTEGER:
+			components = 2;
+			break;
+		case GL_RGB:
+		case GL_BGR:
+		case GL_RGB_INTEGER:
+		case GL_BGR_INTEGER:
+			components = 3;
+			break;
+		case GL_RGBA:
+		case GL_BGRA:
+		case GL_RGBA_INTEGER:
+		case GL_BGRA_INTEGER:
+			components = 4;
+			break;
+		default:
+			components = 1;
+			break;
+		}
+
+		switch (type)
+		{
+		case GL_SHORT:
+		case GL_UNSIGNED_SHORT:
+		case GL_HALF_FLOAT:
+			return components * 2;
+		case GL_INT:
+		case GL_UNSIGNED_INT:
+		case GL_FLOAT:
+			return components * 4;
+		default:
+			return components;
+		}
+	}
+
+#ifdef GLAD_DEBUG
+	// Counts every GL call that goes through glad, using the pre-call callback of the GLAD_DEBUG build of glad.c.
+	// Engine::Render buckets the calls per RenderPass; work outside passes (the frame clear) goes to the first
+	// bucket. Without GLAD_DEBUG every member below is an empty inline and glad calls GL directly.
+	class GLProfiler
+	{
+	public:
+		static GLProfiler* Instance()
+		{
+			if (!mInstance)
+			{
+				mInstance = new GLProfiler();
+			}
+			return mInstance;
+		}
+
+		// Installs the callback; call once glad is loaded
+		void Attach();
+
+		void BeginFrame();
+		void BeginPass(const char* name);
+		void EndPass();
+		void EndFrame();
+
+		// The last finished frame, outside-passes bucket first
+		const std::vector<GLPassCalls>& GetFrame() const { return mFrame; }
+		void Report(std::ostream& out) const;
+		// Prints the frame to std::cout every `frames` frames; 0 stops
+		void SetReportInterval(GLuint frames) { mReportInterval = frames; }
+
+		// One row per pass per frame until CloseCsv
+		bool OpenCsv(const std::string& path);
+		void CloseCsv();
+		// Calls per pass and function name over the whole run
+		bool WriteFunctionCsv(const std::string& path) const;
+
+	private:
+		enum CallKind
+		{
+			CALL_OTHER = 0,
+			CALL_STATE,
+			CALL_DRAW,							// no triangle count in the arguments
+			CALL_DRAW_ARRAYS,
+			CALL_DRAW_ARRAYS_INSTANCED,
+			CALL_DRAW_ELEMENTS,
+			CALL_DRAW_ELEMENTS_INSTANCED,
+			CALL_DRAW_RANGE_ELEMENTS,
+			CALL_BUFFER_DATA,
+			CALL_BUFFER_SUB_DATA,
+			CALL_TEX_IMAGE_2D,
+			CALL_TEX_SUB_IMAGE_2D,
+			CALL_TEX_IMAGE_3D,
+			CALL_TEX_SUB_IMAGE_3D
+		};
+
+		static const char* OUTSIDE_PASSES;
+
+		GLProfiler() : mCurrent(0), mFrameIndex(0), mReportInterval(0) { mBuckets.resize(1); mBuckets[0].pass = OUTSIDE_PASSES; }
+
+		static void _PreCall(const char* name, void* funcptr, int argCount, ...);
+		void _Count(const char* name, va_list args);
+		CallKind _Kind(const char* name);
+
+		static CallKind _Classify(const char* name);
+		static uint64_t _Triangles(GLenum mode, uint64_t count, uint64_t instances);
+
+		std::vector<GLPassCalls>				  mBuckets;
+		std::vector<GLPassCalls>				  mFrame;
+		size_t									  mCurrent;
+		std::unordered_map<const char*, CallKind> mKinds;
+
+		std::map<std::pair<std::string, std::string>, uint64_t> mRunCalls;
+
+		uint64_t	  mFrameIndex;
+		GLuint		  mReportInterval;
+		std::ofstream mCsv;
+
+		static GLProfiler* mInstance;
+	};
+
+	GLProfiler* GLProfiler::mInstance		= nullptr;
+	const char* GLProfiler::OUTSIDE_PASSES = "(outside passes)";
+
+	inline void GLProfiler::Attach()
+	{
+		glad_set_pre_callback(&GLProfiler::_PreCall);
+	}
+
+	void GLProfiler::BeginFrame()
+	{
+		mBuckets.resize(1);
+		mBuckets[0].stats = GLCallStats();
+		mBuckets[0].functions.clear();
+		mCurrent = 0;
+	}
+
+	void GLProfiler::BeginPass(const char* name)
+	{
+		mBuckets.emplace_back();
+		mBuckets.back().pass = name;
+		mCurrent = mBuckets.size() - 1;
+	}
+
+	inline void GLProfiler::EndPass()
+	{
+		mCurrent = 0;
+	}
+
+	void GLProfiler::EndFrame()
+	{
+		mFrame = mBuckets;
+		for (auto& bucket : mFrame)
+		{
+			for (auto& function : bucket.functions)
+			{
+				mRunCalls[std::make_pair(bucket.pass, std::string(function.first))] += function.second;
+			}
+			if (mCsv.is_open())
+			{
+				const GLCallStats& stats = bucket.stats;
+				mCsv << mFrameIndex << ",\"" << bucket.pass << "\"," << stats.calls << ',' << stats.draws << ',' << stats.triangles << ','
+					 << stats.uploadBytes << ',' << stats.stateChanges << '\n';
+			}
+		}
+		if (mReportInterval && mFrameIndex % mReportInterval == 0)
+		{
+			std::cout << "Frame " << mFrameIndex << std::endl;
+			Report(std::cout);
+		}
+		++mFrameIndex;
+	}
+
+	void GLProfiler::Report(std::ostream& out) const
+	{
+		const size_t TOP_FUNCTIONS = 5;
+
+		for (auto& bucket : mFrame)
+		{
+			const GLCallStats& stats = bucket.stats;
+			out << "  " << bucket.pass << ": " << stats.calls << " calls, " << stats.draws << " draws, " << stats.triangles << " triangles, "
+				<< stats.uploadBytes << " bytes uploaded, " << stats.stateChanges << " state changes" << std::endl;
+
+			std::vector<std::pair<const char*, GLuint>> functions(bucket.functions.begin(), bucket.functions.end());
+			size_t shown = std::min(functions.size(), TOP_FUNCTIONS);
+			std::partial_sort(functions.begin(), functions.begin() + shown, functions.end(), [](const std::pair<const char*, GLuint>& a, const std::pair<const char*, GLuint>& b)
+			{
+				return a.second > b.second;
+			});
+			for (size_t i = 0; i < shown; ++i)
+			{
+				out << "    " << functions[i].first << " x" << functions[i].second << std::endl;
+			}
+		}
+	}
+
+	bool GLProfiler::OpenCsv(const std::string& path)
+	{
+		mCsv.open(path);
+		if (!mCsv)
+		{
+			std::cerr << "Failed to open " << path << std::endl;
+			return false;
+		}
+		mCsv << "frame,pass,calls,draws,triangles,upload_bytes,state_changes\n";
+		return true;
+	}
+
+	inline void GLProfiler::CloseCsv()
+	{
+		mCsv.close();
+	}
+
+	bool GLProfiler::WriteFunctionCsv(const std::string& path) const
+	{
+		std::ofstream file(path);
+		if (!file)
+		{
+			std::cerr << "Failed to open " << path << std::endl;
+			return false;
+		}
+		file << "pass,function,calls\n";
+		for (auto& entry : mRunCalls)
+		{
+			file << '"' << entry.first.first << "\"," << entry.first.second << ',' << entry.second << '\n';
+		}
+		return true;
+	}
+
+	void GLProfiler::_PreCall(const char* name, void*, int argCount, ...)
+	{
+		va_list args;
+		va_start(args, argCount);
+		Instance()->_Count(name, args);
+		va_end(args);
+	}
+
+	// glad forwards the arguments as passed, so they are read back with their promoted GL types
+	void GLProfiler::_Count(const char* name, va_list args)
+	{
+		GLPassCalls& bucket = mBuckets[mCurrent];
+		GLCallStats& stats	= bucket.stats;
+		++stats.calls;
+		++bucket.functions[name];
+
+		CallKind kind = _Kind(name);
+		switch (kind)
+		{
+		case CALL_STATE:
+			++stats.stateChanges;
+			break;
+		case CALL_DRAW:
+			++stats.draws;
+			break;
+		case CALL_DRAW_ARRAYS:
+		case CALL_DRAW_ARRAYS_INSTANCED:
+		{
+			GLenum mode = va_arg(args, GLenum);
+			va_arg(args, GLint);
+			GLsizei count	  = va_arg(args, GLsizei);
+			GLsizei instances = kind == CALL_DRAW_ARRAYS_INSTANCED ? va_arg(args, GLsizei) : 1;
+			++stats.draws;
+			stats.triangles += _Triangles(mode, count, instances);
+			break;
+		}
+		case CALL_DRAW_ELEMENTS:
+		case CALL_DRAW_ELEMENTS_INSTANCED:
+		{
+			GLenum mode	  = va_arg(args, GLenum);
+			GLsizei count = va_arg(args, GLsizei);
+			va_arg(args, GLenum);
+			va_arg(args, const void*);
+			GLsizei instances = kind == CALL_DRAW_ELEMENTS_INSTANCED ? va_arg(args, GLsizei) : 1;
+			++stats.draws;
+			stats.triangles += _Triangles(mode, count, instances);
+			break;
+		}
+		case CALL_DRAW_RANGE_ELEMENTS:
+		{
+			GLenum mode = va_arg(args, GLenum);
+			va_arg(args, GLuint);
+			va_arg(args, GLuint);
+			GLsizei count = va_arg(args, GLsizei);
+			++stats.draws;
+			stats.triangles += _Triangles(mode, count, 1);
+			break;
+		}
+		case CALL_BUFFER_DATA:
+		{
+			va_arg(args, GLenum);
+			GLsizeiptr size = va_arg(args, GLsizeiptr);
+			if (va_arg(args, const void*))
+			{
+				stats.uploadBytes += size;
+			}
+			break;
+		}
+		case CALL_BUFFER_SUB_DATA:
+		{
+			va_arg(args, GLenum);
+			va_arg(args, GLintptr);
+			stats.uploadBytes += va_arg(args, GLsizeiptr);
+			break;
+		}
+		case CALL_TEX_IMAGE_2D:
+		case CALL_TEX_SUB_IMAGE_2D:
+		case CALL_TEX_IMAGE_3D:
+		case CALL_TEX_SUB_IMAGE_3D:
+		{
+			bool sub	= kind == CALL_TEX_SUB_IMAGE_2D || kind == CALL_TEX_SUB_IMAGE_3D;
+			bool volume = kind == CALL_TEX_IMAGE_3D || kind == CALL_TEX_SUB_IMAGE_3D;
+
+			// (target, level, internalformat | xoffset, yoffset[, zoffset]), width, height[, depth], (border), format, type, pixels
+			va_arg(args, GLenum);
+			va_arg(args, GLint);
+			for (int i = sub ? (volume ? 3 : 2) : 1; i > 0; --i)
+			{
+				va_arg(args, GLint);
+			}
+			uint64_t texels = va_arg(args, GLsizei);
+			texels *= va_arg(args, GLsizei);
+			if (volume)
+			{
+				texels *= va_arg(args, GLsizei);
+			}
+			if (!sub)
+			{
+				va_arg(args, GLint);
+			}
+			GLenum format = va_arg(args, GLenum);
+			GLenum type	  = va_arg(args, GLenum);
+			if (va_arg(args, const void*))
+			{
+				stats.uploadBytes += texels * TexelBytes(format, type);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	inline GLProfiler::CallKind GLProfiler::_Kind(const char* name)
+	{
+		auto found = mKinds.find(name);
+		if (found == mKinds.end())
+		{
+			found = mKinds.emplace(name, _Classify(name)).first;
+		}
+		return found->second;
+	}
+
+	GLProfiler::CallKind GLProfiler::_Classify(const char* name)
+	{
+		static const std::pair<const char*, CallKind> exact[] = {
+			{ "glDrawArrays",							CALL_DRAW_ARRAYS },
+			{ "glDrawArraysInstanced",				CALL_DRAW_ARRAYS_INSTANCED },
+			{ "glDrawElements",						CALL_DRAW_ELEMENTS },
+			{ "glDrawElementsBaseVertex",				CALL_DRAW_ELEMENTS },
+			{ "glDrawElementsInstanced",				CALL_DRAW_ELEMENTS_INSTANCED },
+			{ "glDrawElementsInstancedBaseVertex",	CALL_DRAW_ELEMENTS_INSTANCED },
+			{ "glDrawRangeElements",					CALL_DRAW_RANGE_ELEMENTS },
+			{ "glDrawRangeElementsBaseVertex",		CALL_DRAW_RANGE_ELEMENTS },
+			{ "glBufferData",							CALL_BUFFER_DATA },
+			{ "glBufferSubData",						CALL_BUFFER_SUB_DATA },
+			{ "glTexImage2D",							CALL_TEX_IMAGE_2D },
+			{ "glTexSubImage2D",						CALL_TEX_SUB_IMAGE_2D },
+			{ "glTexImage3D",							CALL_TEX_IMAGE_3D },
+			{ "glTexSubImage3D",						CALL_TEX_SUB_IMAGE_3D },
+		};
+		static const char* drawPrefixes[]  = { "glDraw", "glMultiDraw" };
+		static const char* statePrefixes[] = {
+			"glBind", "glUseProgram", "glActiveTexture", "glEnable", "glDisable", "glBlend", "glDepthFunc", "glDepthMask",
+			"glCullFace", "glFrontFace", "glViewport", "glScissor", "glColorMask", "glStencil", "glPolygonMode", "glPolygonOffset"
+		};
+
+		for (auto& entry : exact)
+		{
+			if (std::strcmp(name, entry.first) == 0)
+			{
+				return entry.second;
+			}
+		}
+		for (auto prefix : drawPrefixes)
+		{
+			if (std::strncmp(name, prefix, std::strlen(prefix)) == 0)
+			{
+				return CALL_DRAW;
+			}
+		}
+		for (auto prefix : statePrefixes)
+		{
+			if (std::strncmp(name, prefix, std::strlen(prefix)) == 0)
+			{
+				return CALL_STATE;
+			}
+		}
+		return CALL_OTHER;
+	}
+
+	uint64_t GLProfiler::_Triangles(GLenum mode, uint64_t count, uint64_t instances)
+	{
+		switch (mode)
+		{
+		case GL_TRIANGLES:
+			return count / 3 * instances;
+		case GL_TRIANGLE_STRIP:
+		case GL_TRIANGLE_FAN:
+			return (count > 2 ? count - 2 : 0) * instances;
+		case GL_TRIANGLES_ADJACENCY:
+			return count / 6 * instances;
+		case GL_TRIANGLE_STRIP_ADJACENCY:
+			return (count > 4 ? (count - 4) / 2 : 0) * instances;
+		default:
+			return 0;
+		}
+	}
+#else
+	// Release builds: glad calls GL directly and nothing is counted
+	class GLProfiler
+	{
+	public:
+		static GLProfiler* Instance()
+		{
+			static GLProfiler profiler;
+			return &profiler;
+		}
+
+		void Attach() {}
+		void BeginFrame() {}
+		void BeginPass(const char*) {}
+		void EndPass() {}
+		void EndFrame() {}
+
+		const std::vector<GLPassCalls>& GetFrame() const { return mFrame; }
+		void Report(std::ostream&) const {}
+		void SetReportInterval(GLuint) {}
+
+		bool OpenCsv(const std::string&) { return false; }
+		void CloseCsv() {}
+		bool WriteFunctionCsv(const std::string&) const { return false; }
+
+	private:
+		std::vector<GLPassCalls> mFrame;
+	};
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,594 @@
+#pragma once
+#include <glad/glad.h>
+#include <glad/glad_functions.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <tuple>
+#include <utility>
+#include <unordered_map>
+#include <type_traits>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include "gl_trace.hpp"
+
+namespace gl
+{
+	// Cursor over a loaded trace. Strings, arrays and blobs are handed out as pointers into the trace itself,
+	// so they stay valid for as long as the trace is loaded.
+	class TraceReader
+	{
+	public:
+		// Room for the largest output a call may write, up to a glReadPixels of a 4K RGBA8 frame
+		static const size_t SCRATCH_BYTES = 64 << 20;
+
+		TraceReader() : mCursor(0), mScratch(SCRATCH_BYTES) {}
+
+		bool Load(const std::string& path);
+		size_t Tell() const { return mCursor; }
+		void Seek(size_t cursor) { mCursor = cursor; }
+
+		template <typename T>
+		T Value()
+		{
+			T value;
+			std::memcpy(&value, _Take(sizeof(T)), sizeof(T));
+			return value;
+		}
+		// uint16 length and the bytes: function and pass names
+		std::string Name();
+		const GLchar* String();
+		const GLchar* const* Strings();
+		const void* Pointer();
+		const void* const* Offsets();
+		const void* Array();
+		GLsync Sync();
+		void* Scratch() { return mScratch.data(); }
+
+		void Blob();
+		// Replays of glFenceSync map the captured handle to the new one
+		void MapSync(uint64_t handle, GLsync sync) { mSyncs[handle] = sync; }
+
+		// Drops the string and offset arrays of the last call
+		void NextCall() { mArrays.clear(); }
+
+	private:
+		const char* _Take(size_t size);
+
+		std::vector<char>							 mData;
+		size_t										 mCursor;
+		std::vector<char>							 mScratch;		// outputs nobody reads
+		std::unordered_map<uint64_t, const char*>	 mBlobs;
+		std::unordered_map<uint64_t, GLsync>		 mSyncs;
+		std::deque<std::vector<const void*>>		 mArrays;
+	};
+
+	// Argument decoding by parameter type; the counterpart of GLCapture::_Write
+	template <typename T, typename Enable = void>
+	struct TraceArg;
+
+	template <typename T>
+	struct TraceArg<T, typename std::enable_if<std::is_arithmetic<T>::value>::type>
+	{
+		static T Read(TraceReader& reader) { return reader.Value<T>(); }
+	};
+
+	template <>
+	struct TraceArg<const GLchar*>
+	{
+		static const GLchar* Read(TraceReader& reader) { return reader.String(); }
+	};
+
+	template <>
+	struct TraceArg<const GLchar* const*>
+	{
+		static const GLchar* const* Read(TraceReader& reader) { return reader.Strings(); }
+	};
+
+	template <>
+	struct TraceArg<const void*>
+	{
+		static const void* Read(TraceReader& reader) { return reader.Pointer(); }
+	};
+
+	template <>
+	struct TraceArg<const void* const*>
+	{
+		static const void* const* Read(TraceReader& reader) { return reader.Offsets(); }
+	};
+
+	template <>
+	struct TraceArg<GLsync>
+	{
+		static GLsync Read(TraceReader& reader) { return reader.Sync(); }
+	};
+
+	template <typename T>
+	struct TraceArg<const T*>
+	{
+		static const T* Read(TraceReader& reader) { return static_cast<const T*>(reader.Array()); }
+	};
+
+	template <typename T>
+	struct TraceArg<T*>
+	{
+		static T* Read(TraceReader& reader) { return static_cast<T*>(reader.Scratch()); }
+	};
+
+	struct GLReplayCalls
+	{
+		std::string name;
+		uint64_t	calls;
+		double		ms;
+
+		GLReplayCalls() : calls(0), ms(0.0) {}
+	};
+
+	// Runs a trace written by GLCapture on the current context: Setup executes everything before the first
+	// frame (resource creation, uploads), ReplayFrames the captured frames, and can be called again to time
+	// the same frames repeatedly. Each call is timed on the CPU; with finish, glFinish also runs at every pass
+	// boundary so the pass times include the GPU.
+	class GLReplay
+	{
+	public:
+		GLReplay() : mWidth(0), mHeight(0), mFramesStart(0), mFrames(0), mDivergences(0), mFrameMs(0.0), mPass(-1) {}
+
+		// False if the file can't be read or is not a trace of this version
+		bool Load(const std::string& path);
+		GLuint GetWidth() const { return mWidth; }
+		GLuint GetHeight() const { return mHeight; }
+
+		void Setup();
+		void ReplayFrames(bool finish = false);
+
+		// Results (names, uniform locations) that came out different from the capture; anything but 0 means
+		// the replay is not running the captured workload
+		GLuint GetDivergences() const { return mDivergences; }
+		void Report(std::ostream& out, size_t functions = 20) const;
+
+	private:
+		enum Function
+		{
+#define GL_REPLAY_ENUM(ret, name, params, args) FUNCTION_##name,
+			GLAD_FUNCTIONS(GL_REPLAY_ENUM)
+#undef GL_REPLAY_ENUM
+			FUNCTION_COUNT
+		};
+
+		using Clock = std::chrono::high_resolution_clock;
+
+		// Runs records up to the first frame (setup) or to the end of the trace
+		void _Run(bool frames, bool finish);
+		void _Call(uint16_t op);
+
+		template <typename R, typename... A>
+		void _Execute(Function function, R (APIENTRY* real)(A...));
+		// Array initialisers run in order, so the arguments are read in parameter order
+		template <typename... A, size_t... I>
+		void _Decode(std::tuple<A...>& args, std::index_sequence<I...>)
+		{
+			int order[] = { 0, (std::get<I>(args) = TraceArg<A>::Read(mReader), 0)... };
+			(void)order;
+		}
+		template <typename R, typename... A, size_t... I>
+		double _Invoke(std::false_type, Function function, R (APIENTRY* real)(A...), std::tuple<A...>& args, std::index_sequence<I...> indices);
+		template <typename R, typename... A, size_t... I>
+		double _Invoke(std::true_type, Function function, R (APIENTRY* real)(A...), std::tuple<A...>& args, std::index_sequence<I...> indices);
+
+		template <typename T>
+		typename std::enable_if<std::is_arithmetic<T>::value, bool>::type _Matches(T result) { return mReader.Value<T>() == result; }
+		bool _Matches(GLsync sync);
+		template <typename T>
+		bool _Matches(T*) { return true; }
+
+		template <typename... A, size_t... I>
+		bool _Generated(std::tuple<A...>& args, std::index_sequence<I...>) { return _Names(std::get<I>(args)...); }
+		bool _Names(GLsizei count, GLuint* names);
+		template <typename... A>
+		bool _Names(A...) { return true; }
+
+		void _Diverged(Function function);
+
+		TraceReader					mReader;
+		GLuint						mWidth;
+		GLuint						mHeight;
+		size_t						mFramesStart;
+
+		std::vector<int>			mFunctions;		// trace index to Function, -1 for functions this glad lacks
+		std::vector<std::string>	mNames;
+		TraceRule					mRules[FUNCTION_COUNT];
+
+		GLuint						mFrames;
+		GLuint						mDivergences;
+		double						mFrameMs;
+		GLReplayCalls				mCalls[FUNCTION_COUNT];
+		std::vector<GLReplayCalls>	mPasses;		// calls per pass, in the order passes first ran
+		int							mPass;
+	};
+
+	bool TraceReader::Load(const std::string& path)
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			return false;
+		}
+		mData.resize(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(mData.data(), mData.size());
+		mCursor = 0;
+		return static_cast<bool>(file);
+	}
+
+	inline const char* TraceReader::_Take(size_t size)
+	{
+		if (mCursor + size > mData.size())
+		{
+			throw std::runtime_error("GLReplay: the trace is truncated");
+		}
+		const char* data = mData.data() + mCursor;
+		mCursor += size;
+		return data;
+	}
+
+	inline std::string TraceReader::Name()
+	{
+		uint16_t length = Value<uint16_t>();
+		return std::string(_Take(length), length);
+	}
+
+	const GLchar* TraceReader::String()
+	{
+		uint32_t length = Value<uint32_t>();
+		if (length == TRACE_NULL)
+		{
+			return nullptr;
+		}
+		return _Take(length + 1);
+	}
+
+	const GLchar* const* TraceReader::Strings()
+	{
+		uint32_t count = Value<uint32_t>();
+		mArrays.emplace_back();
+		auto& strings = mArrays.back();
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			strings.push_back(String());
+		}
+		return reinterpret_cast<const GLchar* const*>(strings.data());
+	}
+
+	const void* TraceReader::Pointer()
+	{
+		uint8_t kind = Value<uint8_t>();
+		if (kind == TRACE_POINTER_NULL)
+		{
+			return nullptr;
+		}
+		uint64_t value = Value<uint64_t>();
+		if (kind == TRACE_POINTER_OFFSET)
+		{
+			return reinterpret_cast<const void*>(static_cast<uintptr_t>(value));
+		}
+
+		auto found = mBlobs.find(value);
+		if (found == mBlobs.end())
+		{
+			throw std::runtime_error("GLReplay: a call uses a blob the trace does not define");
+		}
+		return found->second;
+	}
+
+	const void* const* TraceReader::Offsets()
+	{
+		uint32_t count = Value<uint32_t>();
+		mArrays.emplace_back();
+		auto& offsets = mArrays.back();
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			offsets.push_back(reinterpret_cast<const void*>(static_cast<uintptr_t>(Value<uint64_t>())));
+		}
+		return offsets.data();
+	}
+
+	// Arrays are copied out, as the trace does not keep them aligned
+	const void* TraceReader::Array()
+	{
+		uint32_t size = Value<uint32_t>();
+		if (size == TRACE_NULL)
+		{
+			return nullptr;
+		}
+		mArrays.emplace_back((size + sizeof(void*) - 1) / sizeof(void*));
+		std::memcpy(mArrays.back().data(), _Take(size), size);
+		return mArrays.back().data();
+	}
+
+	GLsync TraceReader::Sync()
+	{
+		auto found = mSyncs.find(Value<uint64_t>());
+		return found != mSyncs.end() ? found->second : nullptr;
+	}
+
+	void TraceReader::Blob()
+	{
+		uint64_t hash = Value<uint64_t>();
+		uint64_t size = Value<uint64_t>();
+		mBlobs[hash] = _Take(static_cast<size_t>(size));
+	}
+
+	bool GLReplay::Load(const std::string& path)
+	{
+		if (!mReader.Load(path))
+		{
+			std::cerr << "GLReplay: can't read " << path << std::endl;
+			return false;
+		}
+
+		uint32_t header[5];
+		for (auto& value : header)
+		{
+			value = mReader.Value<uint32_t>();
+		}
+		if (header[0] != TRACE_MAGIC || header[1] != TRACE_VERSION)
+		{
+			std::cerr << "GLReplay: " << path << " is not a version " << TRACE_VERSION << " trace" << std::endl;
+			return false;
+		}
+		mWidth	= header[2];
+		mHeight = header[3];
+
+		static const char* names[] = {
+#define GL_REPLAY_NAME(ret, name, params, args) "gl" #name,
+			GLAD_FUNCTIONS(GL_REPLAY_NAME)
+#undef GL_REPLAY_NAME
+		};
+		std::unordered_map<std::string, int> known;
+		for (int function = 0; function < FUNCTION_COUNT; ++function)
+		{
+			known[names[function]] = function;
+			mCalls[function].name  = names[function];
+			mRules[function]	   = TraceRule::For(names[function] + 2);
+		}
+
+		mFunctions.clear();
+		mNames.clear();
+		for (uint32_t i = 0; i < header[4]; ++i)
+		{
+			mNames.push_back(mReader.Name());
+			auto found = known.find(mNames.back());
+			mFunctions.push_back(found != known.end() ? found->second : -1);
+		}
+		mFramesStart = mReader.Tell();
+		return true;
+	}
+
+	inline void GLReplay::Setup()
+	{
+		mReader.Seek(mFramesStart);
+		_Run(false, false);
+	}
+
+	inline void GLReplay::ReplayFrames(bool finish)
+	{
+		mReader.Seek(mFramesStart);
+		_Run(true, finish);
+	}
+
+	void GLReplay::_Run(bool frames, bool finish)
+	{
+		Clock::time_point frameStart;
+		Clock::time_point passStart;
+		bool inFrame = false;
+
+		auto endFrame = [&]()
+		{
+			if (inFrame)
+			{
+				if (finish)
+				{
+					glFinish();
+				}
+				mFrameMs += std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+				++mFrames;
+			}
+		};
+
+		while (true)
+		{
+			size_t record = mReader.Tell();
+			uint16_t op = mReader.Value<uint16_t>();
+			switch (op)
+			{
+			case TRACE_OP_BLOB:
+				mReader.Blob();
+				break;
+			case TRACE_OP_FRAME:
+				if (!frames)
+				{
+					mFramesStart = record;
+					return;
+				}
+				endFrame();
+				inFrame	   = true;
+				frameStart = Clock::now();
+				break;
+			case TRACE_OP_PASS_BEGIN:
+			{
+				std::string name = mReader.Name();
+				auto found = std::find_if(mPasses.begin(), mPasses.end(), [&name](const GLReplayCalls& pass) { return pass.name == name; });
+				if (found == mPasses.end())
+				{
+					mPasses.emplace_back();
+					mPasses.back().name = name;
+					found = mPasses.end() - 1;
+				}
+				mPass = static_cast<int>(found - mPasses.begin());
+				if (finish)
+				{
+					glFinish();
+				}
+				passStart = Clock::now();
+				break;
+			}
+			case TRACE_OP_PASS_END:
+				if (finish)
+				{
+					glFinish();
+				}
+				if (mPass >= 0)
+				{
+					mPasses[mPass].ms += std::chrono::duration<double, std::milli>(Clock::now() - passStart).count();
+				}
+				mPass = -1;
+				break;
+			case TRACE_OP_END:
+				if (!frames)
+				{
+					mFramesStart = record;
+				}
+				endFrame();
+				return;
+			default:
+				_Call(op);
+				break;
+			}
+		}
+	}
+
+	void GLReplay::_Call(uint16_t op)
+	{
+		int function = op < mFunctions.size() ? mFunctions[op] : -1;
+		if (function < 0)
+		{
+			// Its arguments can't be decoded, so nothing after it can be either
+			throw std::runtime_error("GLReplay: the trace calls " + (op < mNames.size() ? mNames[op] : std::to_string(op)) + ", which this build does not know");
+		}
+
+		switch (function)
+		{
+#define GL_REPLAY_CASE(ret, name, params, args) case FUNCTION_##name: _Execute(FUNCTION_##name, glad_gl##name); break;
+			GLAD_FUNCTIONS(GL_REPLAY_CASE)
+#undef GL_REPLAY_CASE
+		default:
+			break;
+		}
+		mReader.NextCall();
+	}
+
+	template <typename R, typename... A>
+	void GLReplay::_Execute(Function function, R (APIENTRY* real)(A...))
+	{
+		if (!real)
+		{
+			throw std::runtime_error("GLReplay: " + mCalls[function].name + " is not available on this driver");
+		}
+
+		std::tuple<A...> args;
+		_Decode(args, std::index_sequence_for<A...>());
+		double ms = _Invoke(std::is_void<R>(), function, real, args, std::index_sequence_for<A...>());
+
+		GLReplayCalls& calls = mCalls[function];
+		++calls.calls;
+		calls.ms += ms;
+		if (mPass >= 0)
+		{
+			++mPasses[mPass].calls;
+		}
+		if (mRules[function].generates && !_Generated(args, std::index_sequence_for<A...>()))
+		{
+			_Diverged(function);
+		}
+	}
+
+	template <typename R, typename... A, size_t... I>
+	double GLReplay::_Invoke(std::false_type, Function function, R (APIENTRY* real)(A...), std::tuple<A...>& args, std::index_sequence<I...>)
+	{
+		auto start = Clock::now();
+		R result = real(std::get<I>(args)...);
+		double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+		if (!_Matches(result) && mRules[function].verify)
+		{
+			_Diverged(function);
+		}
+		return ms;
+	}
+
+	template <typename R, typename... A, size_t... I>
+	double GLReplay::_Invoke(std::true_type, Function, R (APIENTRY* real)(A...), std::tuple<A...>& args, std::index_sequence<I...>)
+	{
+		auto start = Clock::now();
+		real(std::get<I>(args)...);
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	inline bool GLReplay::_Matches(GLsync sync)
+	{
+		mReader.MapSync(mReader.Value<uint64_t>(), sync);
+		return true;
+	}
+
+	inline bool GLReplay::_Names(GLsizei count, GLuint* names)
+	{
+		bool same = true;
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			same &= mReader.Value<GLuint>() == names[i];
+		}
+		return same;
+	}
+
+	void GLReplay::_Diverged(Function function)
+	{
+		static const GLuint MAX_REPORTED = 10;
+		if (++mDivergences <= MAX_REPORTED)
+		{
+			std::cerr << "GLReplay: " << mCalls[function].name << " returned something else than during the capture" << std::endl;
+		}
+	}
+
+	void GLReplay::Report(std::ostream& out, size_t functions) const
+	{
+		double frames = std::max<GLuint>(mFrames, 1);
+		out << "GLReplay: " << mFrames << " frames, " << std::fixed << std::setprecision(3) << mFrameMs / frames << " ms/frame";
+		if (mDivergences)
+		{
+			out << ", " << mDivergences << " results differ from the capture";
+		}
+		out << std::endl;
+
+		out << std::left << std::setw(40) << "pass" << std::right << std::setw(12) << "ms/frame" << std::setw(14) << "calls/frame" << std::endl;
+		for (auto& pass : mPasses)
+		{
+			out << std::left << std::setw(40) << pass.name << std::right << std::setw(12) << pass.ms / frames
+				<< std::setw(14) << std::setprecision(1) << pass.calls / frames << std::setprecision(3) << std::endl;
+		}
+
+		std::vector<const GLReplayCalls*> sorted;
+		for (auto& calls : mCalls)
+		{
+			if (calls.calls)
+			{
+				sorted.push_back(&calls);
+			}
+		}
+		std::sort(sorted.begin(), sorted.end(), [](const GLReplayCalls* a, const GLReplayCalls* b) { return a->ms > b->ms; });
+		sorted.resize(std::min(sorted.size(), functions));
+
+		out << std::left << std::setw(40) << "function" << std::right << std::setw(12) << "calls" << std::setw(14) << "ms" << std::setw(14) << "ns/call" << std::endl;
+		for (auto calls : sorted)
+		{
+			out << std::left << std::setw(40) << calls->name << std::right << std::setw(12) << calls->calls << std::setw(14) << calls->ms
+				<< std::setw(14) << std::setprecision(1) << calls->ms * 1e6 / calls->calls << std::setprecision(3) << std::endl;
+		}
+		out << std::defaultfloat;
+	}
+}
\ No newline at end of file
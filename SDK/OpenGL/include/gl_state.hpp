@@ -0,0 +1,498 @@
+#pragma once
+#include <glad/glad.h>
+#include <unordered_map>
+
+namespace gl
+{
+	// Depth, blend and cull state set as one value. Presets and the With* functions return new states; a state is
+	// never changed once made, so passes can keep theirs as constants.
+	class PipelineState
+	{
+	public:
+		// GL's initial state: no depth test, no blending, no culling
+		PipelineState()
+			: mDepthTest(false), mDepthWrite(true), mDepthFunc(GL_LESS), mBlend(false), mBlendSrc(GL_ONE), mBlendDst(GL_ZERO),
+			  mCull(false), mCullFace(GL_BACK) {}
+
+		static PipelineState Opaque()		{ return PipelineState().WithDepthTest(true); }
+		static PipelineState AlphaBlended() { return Opaque().WithDepthWrite(false).WithBlend(true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); }
+		static PipelineState Additive()		{ return Opaque().WithDepthWrite(false).WithBlend(true, GL_ONE, GL_ONE); }
+		// Fullscreen passes: nothing tested or written
+		static PipelineState Overlay()		{ return PipelineState().WithDepthWrite(false); }
+
+		PipelineState WithDepthTest(bool enable, GLenum func = GL_LESS) const { PipelineState s(*this); s.mDepthTest = enable; s.mDepthFunc = func; return s; }
+		PipelineState WithDepthWrite(bool enable) const						  { PipelineState s(*this); s.mDepthWrite = enable; return s; }
+		PipelineState WithBlend(bool enable, GLenum src = GL_SRC_ALPHA, GLenum dst = GL_ONE_MINUS_SRC_ALPHA) const
+		{
+			PipelineState s(*this);
+			s.mBlend	= enable;
+			s.mBlendSrc = src;
+			s.mBlendDst = dst;
+			return s;
+		}
+		PipelineState WithCull(bool enable, GLenum face = GL_BACK) const { PipelineState s(*this); s.mCull = enable; s.mCullFace = face; return s; }
+
+		bool   DepthTest()	const { return mDepthTest; }
+		bool   DepthWrite() const { return mDepthWrite; }
+		GLenum DepthFunc()	const { return mDepthFunc; }
+		bool   Blend()		const { return mBlend; }
+		GLenum BlendSrc()	const { return mBlendSrc; }
+		GLenum BlendDst()	const { return mBlendDst; }
+		bool   Cull()		const { return mCull; }
+		GLenum CullFace()	const { return mCullFace; }
+
+	private:
+		bool   mDepthTest;
+		bool   mDepthWrite;
+		GLenum mDepthFunc;
+		bool   mBlend;
+		GLenum mBlendSrc;
+		GLenum mBlendDst;
+		bool   mCull;
+		GLenum mCullFace;
+	};
+
+	struct GLStateStats
+	{
+		GLuint issued;		// calls that reached GL
+		GLuint elided;		// calls skipped because the state was already set
+
+		GLStateStats() : issued(0), elided(0) {}
+	};
+
+	// Shadow of the binding and pipeline state, so redundant calls never reach the driver. Everything that binds
+	// programs, VAOs, textures or framebuffers, or changes depth/blend/cull state, the viewport or the clear color,
+	// has to go through here; after
+	// raw GL calls (or glDelete*, which unbinds), call Invalidate so the next call of each kind is issued again.
+	class GLState
+	{
+	public:
+		static const GLuint MAX_TEXTURE_UNITS = 32;
+
+		static GLState* Instance()
+		{
+			if (!mInstance)
+			{
+				mInstance = new GLState();
+			}
+			return mInstance;
+		}
+
+		void UseProgram(GLuint program);
+		void BindVertexArray(GLuint vao);
+		// Same meaning as glActiveTexture/glBindTexture: BindTexture binds to the active unit
+		void ActiveTexture(GLenum unit);
+		void BindTexture(GLenum target, GLuint texture);
+		// Activates unit (0 based) and binds texture to it
+		void BindTexture(GLuint unit, GLenum target, GLuint texture);
+		// GL_FRAMEBUFFER sets both the draw and the read binding
+		void BindFramebuffer(GLenum target, GLuint framebuffer);
+		void SetPipeline(const PipelineState& state);
+		// Same meaning as glViewport/glClearColor
+		void SetViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+		void SetClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+
+		// What is bound now, for passes that restore it afterwards; GL is only queried after an Invalidate
+		GLuint				 GetProgram();
+		GLuint				 GetVertexArray();
+		GLuint				 GetDrawFramebuffer();
+		const PipelineState& GetPipeline();
+		void				 GetViewport(GLint viewport[4]);
+		void				 GetClearColor(GLfloat color[4]);
+
+		// Which buffer a VAO's per-instance attributes source from (see InstanceBuffer::Attach), 0 if none is known.
+		// Only the CPU side keeps this, so asking costs no driver round trip.
+		GLuint GetInstanceBuffer(GLuint vao) const;
+		void   SetInstanceBuffer(GLuint vao, GLuint buffer);
+
+		// glDeleteBuffers/glDeleteVertexArrays that also drop what is shadowed for the names, so a reused name
+		// doesn't inherit it
+		void DeleteBuffer(GLuint buffer);
+		void DeleteVertexArray(GLuint vao);
+
+		// Forgets everything; the next call of each kind is issued whatever it sets
+		void Invalidate();
+
+		// Called once per frame by Engine; GetFrameStats then covers the frame that just ended
+		void NextFrame();
+		const GLStateStats& GetFrameStats() const { return mFrameStats; }
+
+	private:
+		// Tracked texture targets; others pass straight through
+		enum TextureSlot { SLOT_2D = 0, SLOT_CUBE_MAP, SLOT_2D_ARRAY, SLOT_BUFFER, SLOT_COUNT, SLOT_NONE = SLOT_COUNT };
+
+		// Shadowed values nothing can be bound to, so the first real call always goes through
+		static const GLuint UNKNOWN = 0xFFFFFFFFu;
+
+		GLState() { Invalidate(); }
+
+		static TextureSlot _Slot(GLenum target);
+		bool _Changed(GLuint& shadow, GLuint value);
+		static GLuint _Query(GLuint& shadow, GLenum binding);
+		void _SetCap(GLenum cap, bool enable);
+
+		GLuint mProgram;
+		GLuint mVao;
+		GLuint mActiveUnit;
+		GLuint mTextures[MAX_TEXTURE_UNITS][SLOT_COUNT];
+		GLuint mDrawFramebuffer;
+		GLuint mReadFramebuffer;
+
+		PipelineState mPipeline;
+		bool		  mPipelineKnown;
+		GLint		  mViewport[4];
+		bool		  mViewportKnown;
+		GLfloat		  mClearColor[4];
+		bool		  mClearColorKnown;
+
+		std::unordered_map<GLuint, GLuint> mInstanceBuffers;		// vao -> instance buffer
+
+		GLStateStats mStats;
+		GLStateStats mFrameStats;
+
+		static GLState* mInstance;
+	};
+
+	GLState* GLState::mInstance = nullptr;
+
+	inline bool GLState::_Changed(GLuint& shadow, GLuint value)
+	{
+		if (shadow == value)
+		{
+			++mStats.elided;
+			return false;
+		}
+		shadow = value;
+		++mStats.issued;
+		return true;
+	}
+
+	inline void GLState::UseProgram(GLuint program)
+	{
+		if (_Changed(mProgram, program))
+		{
+			glUseProgram(program);
+		}
+	}
+
+	inline void GLState::BindVertexArray(GLuint vao)
+	{
+		if (_Changed(mVao, vao))
+		{
+			glBindVertexArray(vao);
+		}
+	}
+
+	inline void GLState::ActiveTexture(GLenum unit)
+	{
+		if (_Changed(mActiveUnit, unit - GL_TEXTURE0))
+		{
+			glActiveTexture(unit);
+		}
+	}
+
+	inline void GLState::BindTexture(GLenum target, GLuint texture)
+	{
+		TextureSlot slot = _Slot(target);
+		if (slot == SLOT_NONE || mActiveUnit >= MAX_TEXTURE_UNITS)
+		{
+			++mStats.issued;
+			glBindTexture(target, texture);
+			return;
+		}
+		if (_Changed(mTextures[mActiveUnit][slot], texture))
+		{
+			glBindTexture(target, texture);
+		}
+	}
+
+	inline void GLState::BindTexture(GLuint unit, GLenum target, GLuint texture)
+	{
+		ActiveTexture(GL_TEXTURE0 + unit);
+		BindTexture(target, texture);
+	}
+
+	inline void GLState::BindFramebuffer(GLenum target, GLuint framebuffer)
+	{
+		if (target == GL_FRAMEBUFFER)
+		{
+			if (mDrawFramebuffer == framebuffer && mReadFramebuffer == framebuffer)
+			{
+				++mStats.elided;
+				return;
+			}
+			mDrawFramebuffer = mReadFramebuffer = framebuffer;
+			++mStats.issued;
+			glBindFramebuffer(target, framebuffer);
+		}
+		else if (_Changed(target == GL_READ_FRAMEBUFFER ? mReadFramebuffer : mDrawFramebuffer, framebuffer))
+		{
+			glBindFramebuffer(target, framebuffer);
+		}
+	}
+
+	void GLState::SetPipeline(const PipelineState& state)
+	{
+		bool known = mPipelineKnown;
+		const PipelineState& current = mPipeline;
+
+		if (!known || state.DepthTest() != current.DepthTest())
+		{
+			_SetCap(GL_DEPTH_TEST, state.DepthTest());
+		}
+		else
+		{
+			++mStats.elided;
+		}
+		if (!known || state.DepthWrite() != current.DepthWrite())
+		{
+			++mStats.issued;
+			glDepthMask(state.DepthWrite() ? GL_TRUE : GL_FALSE);
+		}
+		else
+		{
+			++mStats.elided;
+		}
+		if (!known || state.DepthFunc() != current.DepthFunc())
+		{
+			++mStats.issued;
+			glDepthFunc(state.DepthFunc());
+		}
+		else
+		{
+			++mStats.elided;
+		}
+		if (!known || state.Blend() != current.Blend())
+		{
+			_SetCap(GL_BLEND, state.Blend());
+		}
+		else
+		{
+			++mStats.elided;
+		}
+		if (!known || state.BlendSrc() != current.BlendSrc() || state.BlendDst() != current.BlendDst())
+		{
+			++mStats.issued;
+			glBlendFunc(state.BlendSrc(), state.BlendDst());
+		}
+		else
+		{
+			++mStats.elided;
+		}
+		if (!known || state.Cull() != current.Cull())
+		{
+			_SetCap(GL_CULL_FACE, state.Cull());
+		}
+		else
+		{
+			++mStats.elided;
+		}
+		if (!known || state.CullFace() != current.CullFace())
+		{
+			++mStats.issued;
+			glCullFace(state.CullFace());
+		}
+		else
+		{
+			++mStats.elided;
+		}
+
+		mPipeline	   = state;
+		mPipelineKnown = true;
+	}
+
+	void GLState::SetViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		if (mViewportKnown && mViewport[0] == x && mViewport[1] == y && mViewport[2] == width && mViewport[3] == height)
+		{
+			++mStats.elided;
+			return;
+		}
+		mViewport[0]   = x;
+		mViewport[1]   = y;
+		mViewport[2]   = width;
+		mViewport[3]   = height;
+		mViewportKnown = true;
+		++mStats.issued;
+		glViewport(x, y, width, height);
+	}
+
+	void GLState::SetClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+	{
+		if (mClearColorKnown && mClearColor[0] == red && mClearColor[1] == green && mClearColor[2] == blue && mClearColor[3] == alpha)
+		{
+			++mStats.elided;
+			return;
+		}
+		mClearColor[0]	 = red;
+		mClearColor[1]	 = green;
+		mClearColor[2]	 = blue;
+		mClearColor[3]	 = alpha;
+		mClearColorKnown = true;
+		++mStats.issued;
+		glClearColor(red, green, blue, alpha);
+	}
+
+	inline void GLState::_SetCap(GLenum cap, bool enable)
+	{
+		++mStats.issued;
+		if (enable)
+		{
+			glEnable(cap);
+		}
+		else
+		{
+			glDisable(cap);
+		}
+	}
+
+	void GLState::Invalidate()
+	{
+		mProgram		 = UNKNOWN;
+		mVao			 = UNKNOWN;
+		mActiveUnit		 = UNKNOWN;
+		mDrawFramebuffer = UNKNOWN;
+		mReadFramebuffer = UNKNOWN;
+		for (auto& unit : mTextures)
+		{
+			for (auto& texture : unit)
+			{
+				texture = UNKNOWN;
+			}
+		}
+		mPipelineKnown	 = false;
+		mViewportKnown	 = false;
+		mClearColorKnown = false;
+		mInstanceBuffers.clear();
+	}
+
+	inline GLuint GLState::GetInstanceBuffer(GLuint vao) const
+	{
+		auto it = mInstanceBuffers.find(vao);
+		return it != mInstanceBuffers.end() ? it->second : 0;
+	}
+
+	inline void GLState::SetInstanceBuffer(GLuint vao, GLuint buffer)
+	{
+		mInstanceBuffers[vao] = buffer;
+	}
+
+	void GLState::DeleteBuffer(GLuint buffer)
+	{
+		for (auto it = mInstanceBuffers.begin(); it != mInstanceBuffers.end();)
+		{
+			if (it->second == buffer)
+			{
+				it = mInstanceBuffers.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+		glDeleteBuffers(1, &buffer);
+	}
+
+	void GLState::DeleteVertexArray(GLuint vao)
+	{
+		mInstanceBuffers.erase(vao);
+		// Deleting the bound VAO binds 0
+		if (mVao == vao)
+		{
+			mVao = 0;
+		}
+		glDeleteVertexArrays(1, &vao);
+	}
+
+	inline GLuint GLState::_Query(GLuint& shadow, GLenum binding)
+	{
+		if (shadow == UNKNOWN)
+		{
+			GLint bound = 0;
+			glGetIntegerv(binding, &bound);
+			shadow = static_cast<GLuint>(bound);
+		}
+		return shadow;
+	}
+
+	inline GLuint GLState::GetProgram()
+	{
+		return _Query(mProgram, GL_CURRENT_PROGRAM);
+	}
+
+	inline GLuint GLState::GetVertexArray()
+	{
+		return _Query(mVao, GL_VERTEX_ARRAY_BINDING);
+	}
+
+	inline GLuint GLState::GetDrawFramebuffer()
+	{
+		return _Query(mDrawFramebuffer, GL_DRAW_FRAMEBUFFER_BINDING);
+	}
+
+	const PipelineState& GLState::GetPipeline()
+	{
+		if (!mPipelineKnown)
+		{
+			GLint depthFunc, blendSrc, blendDst, cullFace;
+			GLboolean depthWrite;
+			glGetIntegerv(GL_DEPTH_FUNC, &depthFunc);
+			glGetIntegerv(GL_BLEND_SRC_RGB, &blendSrc);
+			glGetIntegerv(GL_BLEND_DST_RGB, &blendDst);
+			glGetIntegerv(GL_CULL_FACE_MODE, &cullFace);
+			glGetBooleanv(GL_DEPTH_WRITEMASK, &depthWrite);
+
+			mPipeline = PipelineState()
+				.WithDepthTest(glIsEnabled(GL_DEPTH_TEST) == GL_TRUE, depthFunc)
+				.WithDepthWrite(depthWrite == GL_TRUE)
+				.WithBlend(glIsEnabled(GL_BLEND) == GL_TRUE, blendSrc, blendDst)
+				.WithCull(glIsEnabled(GL_CULL_FACE) == GL_TRUE, cullFace);
+			mPipelineKnown = true;
+		}
+		return mPipeline;
+	}
+
+	void GLState::GetViewport(GLint viewport[4])
+	{
+		if (!mViewportKnown)
+		{
+			glGetIntegerv(GL_VIEWPORT, mViewport);
+			mViewportKnown = true;
+		}
+		for (int i = 0; i < 4; ++i)
+		{
+			viewport[i] = mViewport[i];
+		}
+	}
+
+	void GLState::GetClearColor(GLfloat color[4])
+	{
+		if (!mClearColorKnown)
+		{
+			glGetFloatv(GL_COLOR_CLEAR_VALUE, mClearColor);
+			mClearColorKnown = true;
+		}
+		for (int i = 0; i < 4; ++i)
+		{
+			color[i] = mClearColor[i];
+		}
+	}
+
+	inline void GLState::NextFrame()
+	{
+		mFrameStats = mStats;
+		mStats = GLStateStats();
+	}
+
+	inline GLState::TextureSlot GLState::_Slot(GLenum target)
+	{
+		switch (target)
+		{
+		case GL_TEXTURE_2D:		  return SLOT_2D;
+		case GL_TEXTURE_CUBE_MAP: return SLOT_CUBE_MAP;
+		case GL_TEXTURE_2D_ARRAY: return SLOT_2D_ARRAY;
+		case GL_TEXTURE_BUFFER:	  return SLOT_BUFFER;
+		default:				  return SLOT_NONE;
+		}
+	}
+}
\ No newline at end of file
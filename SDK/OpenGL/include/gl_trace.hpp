@@ -0,0 +1,253 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+#include "gl_profiler.hpp"
+
+namespace gl
+{
+	// Binary GL trace written by GLCapture and read by GLReplay. The header is
+	//
+	//     uint32 TRACE_MAGIC, uint32 TRACE_VERSION, uint32 width, uint32 height,
+	//     uint32 function count, then per function a uint16 length and the name ("glDrawArrays")
+	//
+	// followed by records, each starting with a uint16: an index into the function names for a call, or a TRACE_OP.
+	// A call's arguments follow in parameter order:
+	//
+	//     scalars               raw bytes
+	//     const GLchar*         uint32 length (TRACE_NULL for nullptr), the bytes and a '\0'
+	//     const GLchar* const*  uint32 count, then that many strings
+	//     const void*           uint8 TracePointer, then uint64 offset or blob hash
+	//     const void* const*    uint32 count, then that many uint64 offsets
+	//     other const T*        uint32 bytes (TRACE_NULL for nullptr), then the bytes
+	//     GLsync                uint64 handle
+	//     non-const pointers    nothing; they are outputs
+	//
+	// then the return value if it is a scalar or GLsync, then for glGen* the generated names as uint32s.
+	static const uint32_t TRACE_MAGIC	= 0x52544C47;		// "GLTR"
+	static const uint32_t TRACE_VERSION = 1;
+	static const uint32_t TRACE_NULL	= 0xFFFFFFFFu;
+
+	enum TraceOp
+	{
+		TRACE_OP_BLOB = 0xFFF0,		// uint64 hash, uint64 size, bytes: upload data, written once per content
+		TRACE_OP_FRAME,				// start of a frame; everything before the first one is setup
+		TRACE_OP_PASS_BEGIN,		// uint16 length and the pass name
+		TRACE_OP_PASS_END,
+		TRACE_OP_END = 0xFFFF
+	};
+
+	enum TracePointer
+	{
+		TRACE_POINTER_NULL = 0,
+		TRACE_POINTER_OFFSET,		// into a bound buffer (vertex attributes, indices, indirect commands)
+		TRACE_POINTER_BLOB			// client memory, stored as a blob
+	};
+
+	// FNV-1a
+	inline uint64_t TraceHash(const void* data, size_t size)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		uint64_t hash = 14695981039346656037ull;
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash = (hash ^ bytes[i]) * 1099511628211ull;
+		}
+		return hash;
+	}
+
+	// How much client memory a function's pointer arguments cover, worked out from its name and its scalar
+	// arguments. Pointers not covered by a rule are outputs (non-const) or buffer offsets (const void*).
+	struct TraceRule
+	{
+		enum Kind
+		{
+			FIXED = 0,			// scale elements
+			ARG,				// args[arg] * scale elements
+			BYTES,				// args[arg] bytes of const void* data
+			PIXELS,				// const void* image of dims[]/format/type, rows aligned to 4 bytes
+			PNAME,				// 1, 2 or 4 elements depending on the pname at args[arg]
+			CLEAR				// 4 elements for GL_COLOR, else 1
+		};
+
+		Kind	kind;
+		int		arg;
+		GLuint	scale;
+		int		dims[3];
+		int		format;
+		int		type;
+		bool	generates;		// glGen*: the names are written after the call
+		bool	verify;			// results replay has to reproduce (names, locations)
+
+		TraceRule() : kind(FIXED), arg(0), scale(1), format(0), type(0), generates(false), verify(false)
+		{
+			dims[0] = dims[1] = dims[2] = -1;
+		}
+
+		// Whether const void* arguments are client data rather than offsets
+		bool IsData() const { return kind == BYTES || kind == PIXELS; }
+		// Elements behind each const T* argument, or bytes behind a const void* one
+		uint64_t Count(const int64_t* args) const;
+
+		// name without the gl prefix
+		static TraceRule For(const char* name);
+
+	private:
+		static TraceRule _Make(Kind kind, int arg, GLuint scale = 1);
+		static TraceRule _Pixels(int width, int height, int depth, int format, int type);
+	};
+
+	inline TraceRule TraceRule::_Make(Kind kind, int arg, GLuint scale)
+	{
+		TraceRule rule;
+		rule.kind  = kind;
+		rule.arg   = arg;
+		rule.scale = scale;
+		return rule;
+	}
+
+	inline TraceRule TraceRule::_Pixels(int width, int height, int depth, int format, int type)
+	{
+		TraceRule rule;
+		rule.kind	 = PIXELS;
+		rule.dims[0] = width;
+		rule.dims[1] = height;
+		rule.dims[2] = depth;
+		rule.format	 = format;
+		rule.type	 = type;
+		return rule;
+	}
+
+	TraceRule TraceRule::For(const char* name)
+	{
+		auto starts = [name](const char* prefix) { return std::strncmp(name, prefix, std::strlen(prefix)) == 0; };
+		auto is		= [name](const char* other) { return std::strcmp(name, other) == 0; };
+		size_t length = std::strlen(name);
+		bool vector	  = name[length - 1] == 'v';
+
+		if (starts("Gen") && !starts("Generate"))
+		{
+			TraceRule rule = _Make(ARG, 0);
+			rule.generates = rule.verify = true;
+			return rule;
+		}
+		if (starts("Create"))
+		{
+			TraceRule rule;
+			rule.verify = true;
+			return rule;
+		}
+		if (starts("Get") && (std::strstr(name, "Location") || std::strstr(name, "Index")))
+		{
+			TraceRule rule;
+			rule.verify = true;
+			return rule;
+		}
+		if (starts("Delete") || is("DrawBuffers"))
+		{
+			return _Make(ARG, 0);
+		}
+		if (starts("UniformMatrix"))
+		{
+			GLuint columns = name[13] - '0';
+			GLuint rows	   = name[14] == 'x' ? name[15] - '0' : columns;
+			return _Make(ARG, 1, columns * rows);
+		}
+		if (starts("Uniform") && std::isdigit(name[7]) && vector)
+		{
+			return _Make(ARG, 1, name[7] - '0');
+		}
+		if (is("ShaderSource") || is("TransformFeedbackVaryings") || is("GetActiveUniformsiv") || is("GetUniformIndices") ||
+			is("UniformSubroutinesuiv"))
+		{
+			return _Make(ARG, 1);
+		}
+		if (is("MultiDrawArrays"))
+		{
+			return _Make(ARG, 3);
+		}
+		if (starts("MultiDrawElements"))
+		{
+			return _Make(ARG, 4);
+		}
+		if (starts("VertexAttrib") && vector)
+		{
+			// VertexAttrib4fv, VertexAttribI4uiv, ...; the packed VertexAttribP* read one value
+			const char* digit = name + 12;
+			while (*digit && !std::isdigit(*digit))
+			{
+				++digit;
+			}
+			return _Make(FIXED, 0, name[12] == 'P' || !*digit ? 1 : *digit - '0');
+		}
+		if (starts("ClearBuffer") && vector)
+		{
+			return _Make(CLEAR, 0);
+		}
+		if (std::strstr(name, "Parameter") && vector)
+		{
+			// (pname, values) for point and patch parameters, (object, pname, values) for the rest
+			return _Make(PNAME, starts("PointParameter") || starts("PatchParameter") ? 0 : 1);
+		}
+
+		if (is("BufferData"))					return _Make(BYTES, 1);
+		if (is("BufferSubData"))				return _Make(BYTES, 2);
+		if (is("CompressedTexImage1D"))			return _Make(BYTES, 5);
+		if (is("CompressedTexImage2D"))			return _Make(BYTES, 6);
+		if (is("CompressedTexImage3D"))			return _Make(BYTES, 7);
+		if (is("CompressedTexSubImage1D"))		return _Make(BYTES, 5);
+		if (is("CompressedTexSubImage2D"))		return _Make(BYTES, 7);
+		if (is("CompressedTexSubImage3D"))		return _Make(BYTES, 9);
+		if (is("TexImage1D"))					return _Pixels(3, -1, -1, 5, 6);
+		if (is("TexImage2D"))					return _Pixels(3, 4, -1, 6, 7);
+		if (is("TexImage3D"))					return _Pixels(3, 4, 5, 7, 8);
+		if (is("TexSubImage1D"))				return _Pixels(3, -1, -1, 4, 5);
+		if (is("TexSubImage2D"))				return _Pixels(4, 5, -1, 6, 7);
+		if (is("TexSubImage3D"))				return _Pixels(5, 6, 7, 8, 9);
+
+		// Everything else reads at most one value through a const pointer (ColorP3uiv, ...)
+		return TraceRule();
+	}
+
+	uint64_t TraceRule::Count(const int64_t* args) const
+	{
+		switch (kind)
+		{
+		case FIXED:
+			return scale;
+		case ARG:
+		case BYTES:
+			return args[arg] > 0 ? static_cast<uint64_t>(args[arg]) * scale : 0;
+		case PIXELS:
+		{
+			uint64_t width	= dims[0] >= 0 ? args[dims[0]] : 1;
+			uint64_t height = dims[1] >= 0 ? args[dims[1]] : 1;
+			uint64_t depth	= dims[2] >= 0 ? args[dims[2]] : 1;
+			if (width == 0 || height == 0 || depth == 0)
+			{
+				return 0;
+			}
+			// The default GL_UNPACK_ALIGNMENT pads every row but the last to 4 bytes
+			uint64_t row = width * TexelBytes(static_cast<GLenum>(args[format]), static_cast<GLenum>(args[type]));
+			return (row + 3) / 4 * 4 * (height * depth - 1) + row;
+		}
+		case PNAME:
+			switch (args[arg])
+			{
+			case GL_TEXTURE_BORDER_COLOR:
+			case GL_TEXTURE_SWIZZLE_RGBA:
+			case GL_PATCH_DEFAULT_OUTER_LEVEL:
+				return 4;
+			case GL_PATCH_DEFAULT_INNER_LEVEL:
+				return 2;
+			default:
+				return 1;
+			}
+		case CLEAR:
+			return args[0] == GL_COLOR ? 4 : 1;
+		default:
+			return 0;
+		}
+	}
+}
\ No newline at end of file
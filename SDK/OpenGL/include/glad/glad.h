@@ -17,6 +17,10 @@
         --profile="core" --api="gl=4.0" --generator="c" --spec="gl" --extensions=""
     Online:
         https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D4.0
+
+    Merged with the output of --generator="c-debug": defining GLAD_DEBUG routes every call through
+    glad_debug_* wrappers that invoke the pre/post callbacks. Without it the macros call the loaded
+    pointers directly, exactly as the plain generator emits them.
 */
 
 
@@ -92,6 +96,14 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+#ifdef GLAD_DEBUG
+/* Every GL call is bracketed by these callbacks; the defaults do nothing before the call and report glGetError after it */
+typedef void (* GLADcallback)(const char *name, void *funcptr, int len_args, ...);
+
+GLAPI void glad_set_pre_callback(GLADcallback cb);
+GLAPI void glad_set_post_callback(GLADcallback cb);
+#endif
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -1040,1313 +1052,3413 @@ typedef void (APIENTRY *GLVULKANPROCNV)(void);
 GLAPI int GLAD_GL_VERSION_1_0;
 typedef void (APIENTRYP PFNGLCULLFACEPROC)(GLenum mode);
 GLAPI PFNGLCULLFACEPROC glad_glCullFace;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCULLFACEPROC glad_debug_glCullFace;
+#define glCullFace glad_debug_glCullFace
+#else
 #define glCullFace glad_glCullFace
+#endif
 typedef void (APIENTRYP PFNGLFRONTFACEPROC)(GLenum mode);
 GLAPI PFNGLFRONTFACEPROC glad_glFrontFace;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFRONTFACEPROC glad_debug_glFrontFace;
+#define glFrontFace glad_debug_glFrontFace
+#else
 #define glFrontFace glad_glFrontFace
+#endif
 typedef void (APIENTRYP PFNGLHINTPROC)(GLenum target, GLenum mode);
 GLAPI PFNGLHINTPROC glad_glHint;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLHINTPROC glad_debug_glHint;
+#define glHint glad_debug_glHint
+#else
 #define glHint glad_glHint
+#endif
 typedef void (APIENTRYP PFNGLLINEWIDTHPROC)(GLfloat width);
 GLAPI PFNGLLINEWIDTHPROC glad_glLineWidth;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLLINEWIDTHPROC glad_debug_glLineWidth;
+#define glLineWidth glad_debug_glLineWidth
+#else
 #define glLineWidth glad_glLineWidth
+#endif
 typedef void (APIENTRYP PFNGLPOINTSIZEPROC)(GLfloat size);
 GLAPI PFNGLPOINTSIZEPROC glad_glPointSize;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPOINTSIZEPROC glad_debug_glPointSize;
+#define glPointSize glad_debug_glPointSize
+#else
 #define glPointSize glad_glPointSize
+#endif
 typedef void (APIENTRYP PFNGLPOLYGONMODEPROC)(GLenum face, GLenum mode);
 GLAPI PFNGLPOLYGONMODEPROC glad_glPolygonMode;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPOLYGONMODEPROC glad_debug_glPolygonMode;
+#define glPolygonMode glad_debug_glPolygonMode
+#else
 #define glPolygonMode glad_glPolygonMode
+#endif
 typedef void (APIENTRYP PFNGLSCISSORPROC)(GLint x, GLint y, GLsizei width, GLsizei height);
 GLAPI PFNGLSCISSORPROC glad_glScissor;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSCISSORPROC glad_debug_glScissor;
+#define glScissor glad_debug_glScissor
+#else
 #define glScissor glad_glScissor
+#endif
 typedef void (APIENTRYP PFNGLTEXPARAMETERFPROC)(GLenum target, GLenum pname, GLfloat param);
 GLAPI PFNGLTEXPARAMETERFPROC glad_glTexParameterf;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXPARAMETERFPROC glad_debug_glTexParameterf;
+#define glTexParameterf glad_debug_glTexParameterf
+#else
 #define glTexParameterf glad_glTexParameterf
+#endif
 typedef void (APIENTRYP PFNGLTEXPARAMETERFVPROC)(GLenum target, GLenum pname, const GLfloat *params);
 GLAPI PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXPARAMETERFVPROC glad_debug_glTexParameterfv;
+#define glTexParameterfv glad_debug_glTexParameterfv
+#else
 #define glTexParameterfv glad_glTexParameterfv
+#endif
 typedef void (APIENTRYP PFNGLTEXPARAMETERIPROC)(GLenum target, GLenum pname, GLint param);
 GLAPI PFNGLTEXPARAMETERIPROC glad_glTexParameteri;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXPARAMETERIPROC glad_debug_glTexParameteri;
+#define glTexParameteri glad_debug_glTexParameteri
+#else
 #define glTexParameteri glad_glTexParameteri
+#endif
 typedef void (APIENTRYP PFNGLTEXPARAMETERIVPROC)(GLenum target, GLenum pname, const GLint *params);
 GLAPI PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXPARAMETERIVPROC glad_debug_glTexParameteriv;
+#define glTexParameteriv glad_debug_glTexParameteriv
+#else
 #define glTexParameteriv glad_glTexParameteriv
+#endif
 typedef void (APIENTRYP PFNGLTEXIMAGE1DPROC)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels);
 GLAPI PFNGLTEXIMAGE1DPROC glad_glTexImage1D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXIMAGE1DPROC glad_debug_glTexImage1D;
+#define glTexImage1D glad_debug_glTexImage1D
+#else
 #define glTexImage1D glad_glTexImage1D
+#endif
 typedef void (APIENTRYP PFNGLTEXIMAGE2DPROC)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
 GLAPI PFNGLTEXIMAGE2DPROC glad_glTexImage2D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXIMAGE2DPROC glad_debug_glTexImage2D;
+#define glTexImage2D glad_debug_glTexImage2D
+#else
 #define glTexImage2D glad_glTexImage2D
+#endif
 typedef void (APIENTRYP PFNGLDRAWBUFFERPROC)(GLenum buf);
 GLAPI PFNGLDRAWBUFFERPROC glad_glDrawBuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWBUFFERPROC glad_debug_glDrawBuffer;
+#define glDrawBuffer glad_debug_glDrawBuffer
+#else
 #define glDrawBuffer glad_glDrawBuffer
+#endif
 typedef void (APIENTRYP PFNGLCLEARPROC)(GLbitfield mask);
 GLAPI PFNGLCLEARPROC glad_glClear;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCLEARPROC glad_debug_glClear;
+#define glClear glad_debug_glClear
+#else
 #define glClear glad_glClear
+#endif
 typedef void (APIENTRYP PFNGLCLEARCOLORPROC)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
 GLAPI PFNGLCLEARCOLORPROC glad_glClearColor;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCLEARCOLORPROC glad_debug_glClearColor;
+#define glClearColor glad_debug_glClearColor
+#else
 #define glClearColor glad_glClearColor
+#endif
 typedef void (APIENTRYP PFNGLCLEARSTENCILPROC)(GLint s);
 GLAPI PFNGLCLEARSTENCILPROC glad_glClearStencil;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCLEARSTENCILPROC glad_debug_glClearStencil;
+#define glClearStencil glad_debug_glClearStencil
+#else
 #define glClearStencil glad_glClearStencil
+#endif
 typedef void (APIENTRYP PFNGLCLEARDEPTHPROC)(GLdouble depth);
 GLAPI PFNGLCLEARDEPTHPROC glad_glClearDepth;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCLEARDEPTHPROC glad_debug_glClearDepth;
+#define glClearDepth glad_debug_glClearDepth
+#else
 #define glClearDepth glad_glClearDepth
+#endif
 typedef void (APIENTRYP PFNGLSTENCILMASKPROC)(GLuint mask);
 GLAPI PFNGLSTENCILMASKPROC glad_glStencilMask;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSTENCILMASKPROC glad_debug_glStencilMask;
+#define glStencilMask glad_debug_glStencilMask
+#else
 #define glStencilMask glad_glStencilMask
+#endif
 typedef void (APIENTRYP PFNGLCOLORMASKPROC)(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
 GLAPI PFNGLCOLORMASKPROC glad_glColorMask;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOLORMASKPROC glad_debug_glColorMask;
+#define glColorMask glad_debug_glColorMask
+#else
 #define glColorMask glad_glColorMask
+#endif
 typedef void (APIENTRYP PFNGLDEPTHMASKPROC)(GLboolean flag);
 GLAPI PFNGLDEPTHMASKPROC glad_glDepthMask;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDEPTHMASKPROC glad_debug_glDepthMask;
+#define glDepthMask glad_debug_glDepthMask
+#else
 #define glDepthMask glad_glDepthMask
+#endif
 typedef void (APIENTRYP PFNGLDISABLEPROC)(GLenum cap);
 GLAPI PFNGLDISABLEPROC glad_glDisable;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDISABLEPROC glad_debug_glDisable;
+#define glDisable glad_debug_glDisable
+#else
 #define glDisable glad_glDisable
+#endif
 typedef void (APIENTRYP PFNGLENABLEPROC)(GLenum cap);
 GLAPI PFNGLENABLEPROC glad_glEnable;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLENABLEPROC glad_debug_glEnable;
+#define glEnable glad_debug_glEnable
+#else
 #define glEnable glad_glEnable
+#endif
 typedef void (APIENTRYP PFNGLFINISHPROC)(void);
 GLAPI PFNGLFINISHPROC glad_glFinish;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFINISHPROC glad_debug_glFinish;
+#define glFinish glad_debug_glFinish
+#else
 #define glFinish glad_glFinish
+#endif
 typedef void (APIENTRYP PFNGLFLUSHPROC)(void);
 GLAPI PFNGLFLUSHPROC glad_glFlush;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFLUSHPROC glad_debug_glFlush;
+#define glFlush glad_debug_glFlush
+#else
 #define glFlush glad_glFlush
+#endif
 typedef void (APIENTRYP PFNGLBLENDFUNCPROC)(GLenum sfactor, GLenum dfactor);
 GLAPI PFNGLBLENDFUNCPROC glad_glBlendFunc;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBLENDFUNCPROC glad_debug_glBlendFunc;
+#define glBlendFunc glad_debug_glBlendFunc
+#else
 #define glBlendFunc glad_glBlendFunc
+#endif
 typedef void (APIENTRYP PFNGLLOGICOPPROC)(GLenum opcode);
 GLAPI PFNGLLOGICOPPROC glad_glLogicOp;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLLOGICOPPROC glad_debug_glLogicOp;
+#define glLogicOp glad_debug_glLogicOp
+#else
 #define glLogicOp glad_glLogicOp
+#endif
 typedef void (APIENTRYP PFNGLSTENCILFUNCPROC)(GLenum func, GLint ref, GLuint mask);
 GLAPI PFNGLSTENCILFUNCPROC glad_glStencilFunc;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSTENCILFUNCPROC glad_debug_glStencilFunc;
+#define glStencilFunc glad_debug_glStencilFunc
+#else
 #define glStencilFunc glad_glStencilFunc
+#endif
 typedef void (APIENTRYP PFNGLSTENCILOPPROC)(GLenum fail, GLenum zfail, GLenum zpass);
 GLAPI PFNGLSTENCILOPPROC glad_glStencilOp;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSTENCILOPPROC glad_debug_glStencilOp;
+#define glStencilOp glad_debug_glStencilOp
+#else
 #define glStencilOp glad_glStencilOp
+#endif
 typedef void (APIENTRYP PFNGLDEPTHFUNCPROC)(GLenum func);
 GLAPI PFNGLDEPTHFUNCPROC glad_glDepthFunc;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDEPTHFUNCPROC glad_debug_glDepthFunc;
+#define glDepthFunc glad_debug_glDepthFunc
+#else
 #define glDepthFunc glad_glDepthFunc
+#endif
 typedef void (APIENTRYP PFNGLPIXELSTOREFPROC)(GLenum pname, GLfloat param);
 GLAPI PFNGLPIXELSTOREFPROC glad_glPixelStoref;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPIXELSTOREFPROC glad_debug_glPixelStoref;
+#define glPixelStoref glad_debug_glPixelStoref
+#else
 #define glPixelStoref glad_glPixelStoref
+#endif
 typedef void (APIENTRYP PFNGLPIXELSTOREIPROC)(GLenum pname, GLint param);
 GLAPI PFNGLPIXELSTOREIPROC glad_glPixelStorei;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPIXELSTOREIPROC glad_debug_glPixelStorei;
+#define glPixelStorei glad_debug_glPixelStorei
+#else
 #define glPixelStorei glad_glPixelStorei
+#endif
 typedef void (APIENTRYP PFNGLREADBUFFERPROC)(GLenum src);
 GLAPI PFNGLREADBUFFERPROC glad_glReadBuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLREADBUFFERPROC glad_debug_glReadBuffer;
+#define glReadBuffer glad_debug_glReadBuffer
+#else
 #define glReadBuffer glad_glReadBuffer
+#endif
 typedef void (APIENTRYP PFNGLREADPIXELSPROC)(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
 GLAPI PFNGLREADPIXELSPROC glad_glReadPixels;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLREADPIXELSPROC glad_debug_glReadPixels;
+#define glReadPixels glad_debug_glReadPixels
+#else
 #define glReadPixels glad_glReadPixels
+#endif
 typedef void (APIENTRYP PFNGLGETBOOLEANVPROC)(GLenum pname, GLboolean *data);
 GLAPI PFNGLGETBOOLEANVPROC glad_glGetBooleanv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETBOOLEANVPROC glad_debug_glGetBooleanv;
+#define glGetBooleanv glad_debug_glGetBooleanv
+#else
 #define glGetBooleanv glad_glGetBooleanv
+#endif
 typedef void (APIENTRYP PFNGLGETDOUBLEVPROC)(GLenum pname, GLdouble *data);
 GLAPI PFNGLGETDOUBLEVPROC glad_glGetDoublev;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETDOUBLEVPROC glad_debug_glGetDoublev;
+#define glGetDoublev glad_debug_glGetDoublev
+#else
 #define glGetDoublev glad_glGetDoublev
+#endif
 typedef GLenum (APIENTRYP PFNGLGETERRORPROC)(void);
 GLAPI PFNGLGETERRORPROC glad_glGetError;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETERRORPROC glad_debug_glGetError;
+#define glGetError glad_debug_glGetError
+#else
 #define glGetError glad_glGetError
+#endif
 typedef void (APIENTRYP PFNGLGETFLOATVPROC)(GLenum pname, GLfloat *data);
 GLAPI PFNGLGETFLOATVPROC glad_glGetFloatv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETFLOATVPROC glad_debug_glGetFloatv;
+#define glGetFloatv glad_debug_glGetFloatv
+#else
 #define glGetFloatv glad_glGetFloatv
+#endif
 typedef void (APIENTRYP PFNGLGETINTEGERVPROC)(GLenum pname, GLint *data);
 GLAPI PFNGLGETINTEGERVPROC glad_glGetIntegerv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETINTEGERVPROC glad_debug_glGetIntegerv;
+#define glGetIntegerv glad_debug_glGetIntegerv
+#else
 #define glGetIntegerv glad_glGetIntegerv
+#endif
 typedef const GLubyte * (APIENTRYP PFNGLGETSTRINGPROC)(GLenum name);
 GLAPI PFNGLGETSTRINGPROC glad_glGetString;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSTRINGPROC glad_debug_glGetString;
+#define glGetString glad_debug_glGetString
+#else
 #define glGetString glad_glGetString
+#endif
 typedef void (APIENTRYP PFNGLGETTEXIMAGEPROC)(GLenum target, GLint level, GLenum format, GLenum type, void *pixels);
 GLAPI PFNGLGETTEXIMAGEPROC glad_glGetTexImage;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETTEXIMAGEPROC glad_debug_glGetTexImage;
+#define glGetTexImage glad_debug_glGetTexImage
+#else
 #define glGetTexImage glad_glGetTexImage
+#endif
 typedef void (APIENTRYP PFNGLGETTEXPARAMETERFVPROC)(GLenum target, GLenum pname, GLfloat *params);
 GLAPI PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETTEXPARAMETERFVPROC glad_debug_glGetTexParameterfv;
+#define glGetTexParameterfv glad_debug_glGetTexParameterfv
+#else
 #define glGetTexParameterfv glad_glGetTexParameterfv
+#endif
 typedef void (APIENTRYP PFNGLGETTEXPARAMETERIVPROC)(GLenum target, GLenum pname, GLint *params);
 GLAPI PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETTEXPARAMETERIVPROC glad_debug_glGetTexParameteriv;
+#define glGetTexParameteriv glad_debug_glGetTexParameteriv
+#else
 #define glGetTexParameteriv glad_glGetTexParameteriv
+#endif
 typedef void (APIENTRYP PFNGLGETTEXLEVELPARAMETERFVPROC)(GLenum target, GLint level, GLenum pname, GLfloat *params);
 GLAPI PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETTEXLEVELPARAMETERFVPROC glad_debug_glGetTexLevelParameterfv;
+#define glGetTexLevelParameterfv glad_debug_glGetTexLevelParameterfv
+#else
 #define glGetTexLevelParameterfv glad_glGetTexLevelParameterfv
+#endif
 typedef void (APIENTRYP PFNGLGETTEXLEVELPARAMETERIVPROC)(GLenum target, GLint level, GLenum pname, GLint *params);
 GLAPI PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETTEXLEVELPARAMETERIVPROC glad_debug_glGetTexLevelParameteriv;
+#define glGetTexLevelParameteriv glad_debug_glGetTexLevelParameteriv
+#else
 #define glGetTexLevelParameteriv glad_glGetTexLevelParameteriv
+#endif
 typedef GLboolean (APIENTRYP PFNGLISENABLEDPROC)(GLenum cap);
 GLAPI PFNGLISENABLEDPROC glad_glIsEnabled;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISENABLEDPROC glad_debug_glIsEnabled;
+#define glIsEnabled glad_debug_glIsEnabled
+#else
 #define glIsEnabled glad_glIsEnabled
+#endif
 typedef void (APIENTRYP PFNGLDEPTHRANGEPROC)(GLdouble n, GLdouble f);
 GLAPI PFNGLDEPTHRANGEPROC glad_glDepthRange;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDEPTHRANGEPROC glad_debug_glDepthRange;
+#define glDepthRange glad_debug_glDepthRange
+#else
 #define glDepthRange glad_glDepthRange
+#endif
 typedef void (APIENTRYP PFNGLVIEWPORTPROC)(GLint x, GLint y, GLsizei width, GLsizei height);
 GLAPI PFNGLVIEWPORTPROC glad_glViewport;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVIEWPORTPROC glad_debug_glViewport;
+#define glViewport glad_debug_glViewport
+#else
 #define glViewport glad_glViewport
 #endif
+#endif
 #ifndef GL_VERSION_1_1
 #define GL_VERSION_1_1 1
 GLAPI int GLAD_GL_VERSION_1_1;
 typedef void (APIENTRYP PFNGLDRAWARRAYSPROC)(GLenum mode, GLint first, GLsizei count);
 GLAPI PFNGLDRAWARRAYSPROC glad_glDrawArrays;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWARRAYSPROC glad_debug_glDrawArrays;
+#define glDrawArrays glad_debug_glDrawArrays
+#else
 #define glDrawArrays glad_glDrawArrays
+#endif
 typedef void (APIENTRYP PFNGLDRAWELEMENTSPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices);
 GLAPI PFNGLDRAWELEMENTSPROC glad_glDrawElements;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWELEMENTSPROC glad_debug_glDrawElements;
+#define glDrawElements glad_debug_glDrawElements
+#else
 #define glDrawElements glad_glDrawElements
+#endif
 typedef void (APIENTRYP PFNGLPOLYGONOFFSETPROC)(GLfloat factor, GLfloat units);
 GLAPI PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPOLYGONOFFSETPROC glad_debug_glPolygonOffset;
+#define glPolygonOffset glad_debug_glPolygonOffset
+#else
 #define glPolygonOffset glad_glPolygonOffset
+#endif
 typedef void (APIENTRYP PFNGLCOPYTEXIMAGE1DPROC)(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border);
 GLAPI PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOPYTEXIMAGE1DPROC glad_debug_glCopyTexImage1D;
+#define glCopyTexImage1D glad_debug_glCopyTexImage1D
+#else
 #define glCopyTexImage1D glad_glCopyTexImage1D
+#endif
 typedef void (APIENTRYP PFNGLCOPYTEXIMAGE2DPROC)(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border);
 GLAPI PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOPYTEXIMAGE2DPROC glad_debug_glCopyTexImage2D;
+#define glCopyTexImage2D glad_debug_glCopyTexImage2D
+#else
 #define glCopyTexImage2D glad_glCopyTexImage2D
+#endif
 typedef void (APIENTRYP PFNGLCOPYTEXSUBIMAGE1DPROC)(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);
 GLAPI PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOPYTEXSUBIMAGE1DPROC glad_debug_glCopyTexSubImage1D;
+#define glCopyTexSubImage1D glad_debug_glCopyTexSubImage1D
+#else
 #define glCopyTexSubImage1D glad_glCopyTexSubImage1D
+#endif
 typedef void (APIENTRYP PFNGLCOPYTEXSUBIMAGE2DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
 GLAPI PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOPYTEXSUBIMAGE2DPROC glad_debug_glCopyTexSubImage2D;
+#define glCopyTexSubImage2D glad_debug_glCopyTexSubImage2D
+#else
 #define glCopyTexSubImage2D glad_glCopyTexSubImage2D
+#endif
 typedef void (APIENTRYP PFNGLTEXSUBIMAGE1DPROC)(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels);
 GLAPI PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXSUBIMAGE1DPROC glad_debug_glTexSubImage1D;
+#define glTexSubImage1D glad_debug_glTexSubImage1D
+#else
 #define glTexSubImage1D glad_glTexSubImage1D
+#endif
 typedef void (APIENTRYP PFNGLTEXSUBIMAGE2DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
 GLAPI PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXSUBIMAGE2DPROC glad_debug_glTexSubImage2D;
+#define glTexSubImage2D glad_debug_glTexSubImage2D
+#else
 #define glTexSubImage2D glad_glTexSubImage2D
+#endif
 typedef void (APIENTRYP PFNGLBINDTEXTUREPROC)(GLenum target, GLuint texture);
 GLAPI PFNGLBINDTEXTUREPROC glad_glBindTexture;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDTEXTUREPROC glad_debug_glBindTexture;
+#define glBindTexture glad_debug_glBindTexture
+#else
 #define glBindTexture glad_glBindTexture
+#endif
 typedef void (APIENTRYP PFNGLDELETETEXTURESPROC)(GLsizei n, const GLuint *textures);
 GLAPI PFNGLDELETETEXTURESPROC glad_glDeleteTextures;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETETEXTURESPROC glad_debug_glDeleteTextures;
+#define glDeleteTextures glad_debug_glDeleteTextures
+#else
 #define glDeleteTextures glad_glDeleteTextures
+#endif
 typedef void (APIENTRYP PFNGLGENTEXTURESPROC)(GLsizei n, GLuint *textures);
 GLAPI PFNGLGENTEXTURESPROC glad_glGenTextures;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGENTEXTURESPROC glad_debug_glGenTextures;
+#define glGenTextures glad_debug_glGenTextures
+#else
 #define glGenTextures glad_glGenTextures
+#endif
 typedef GLboolean (APIENTRYP PFNGLISTEXTUREPROC)(GLuint texture);
 GLAPI PFNGLISTEXTUREPROC glad_glIsTexture;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISTEXTUREPROC glad_debug_glIsTexture;
+#define glIsTexture glad_debug_glIsTexture
+#else
 #define glIsTexture glad_glIsTexture
 #endif
+#endif
 #ifndef GL_VERSION_1_2
 #define GL_VERSION_1_2 1
 GLAPI int GLAD_GL_VERSION_1_2;
 typedef void (APIENTRYP PFNGLDRAWRANGEELEMENTSPROC)(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices);
 GLAPI PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWRANGEELEMENTSPROC glad_debug_glDrawRangeElements;
+#define glDrawRangeElements glad_debug_glDrawRangeElements
+#else
 #define glDrawRangeElements glad_glDrawRangeElements
+#endif
 typedef void (APIENTRYP PFNGLTEXIMAGE3DPROC)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels);
 GLAPI PFNGLTEXIMAGE3DPROC glad_glTexImage3D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXIMAGE3DPROC glad_debug_glTexImage3D;
+#define glTexImage3D glad_debug_glTexImage3D
+#else
 #define glTexImage3D glad_glTexImage3D
+#endif
 typedef void (APIENTRYP PFNGLTEXSUBIMAGE3DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels);
 GLAPI PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXSUBIMAGE3DPROC glad_debug_glTexSubImage3D;
+#define glTexSubImage3D glad_debug_glTexSubImage3D
+#else
 #define glTexSubImage3D glad_glTexSubImage3D
+#endif
 typedef void (APIENTRYP PFNGLCOPYTEXSUBIMAGE3DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height);
 GLAPI PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOPYTEXSUBIMAGE3DPROC glad_debug_glCopyTexSubImage3D;
+#define glCopyTexSubImage3D glad_debug_glCopyTexSubImage3D
+#else
 #define glCopyTexSubImage3D glad_glCopyTexSubImage3D
 #endif
+#endif
 #ifndef GL_VERSION_1_3
 #define GL_VERSION_1_3 1
 GLAPI int GLAD_GL_VERSION_1_3;
 typedef void (APIENTRYP PFNGLACTIVETEXTUREPROC)(GLenum texture);
 GLAPI PFNGLACTIVETEXTUREPROC glad_glActiveTexture;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLACTIVETEXTUREPROC glad_debug_glActiveTexture;
+#define glActiveTexture glad_debug_glActiveTexture
+#else
 #define glActiveTexture glad_glActiveTexture
+#endif
 typedef void (APIENTRYP PFNGLSAMPLECOVERAGEPROC)(GLfloat value, GLboolean invert);
 GLAPI PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSAMPLECOVERAGEPROC glad_debug_glSampleCoverage;
+#define glSampleCoverage glad_debug_glSampleCoverage
+#else
 #define glSampleCoverage glad_glSampleCoverage
+#endif
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXIMAGE3DPROC)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data);
 GLAPI PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_debug_glCompressedTexImage3D;
+#define glCompressedTexImage3D glad_debug_glCompressedTexImage3D
+#else
 #define glCompressedTexImage3D glad_glCompressedTexImage3D
+#endif
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXIMAGE2DPROC)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data);
 GLAPI PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_debug_glCompressedTexImage2D;
+#define glCompressedTexImage2D glad_debug_glCompressedTexImage2D
+#else
 #define glCompressedTexImage2D glad_glCompressedTexImage2D
+#endif
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXIMAGE1DPROC)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data);
 GLAPI PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_debug_glCompressedTexImage1D;
+#define glCompressedTexImage1D glad_debug_glCompressedTexImage1D
+#else
 #define glCompressedTexImage1D glad_glCompressedTexImage1D
+#endif
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data);
 GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_debug_glCompressedTexSubImage3D;
+#define glCompressedTexSubImage3D glad_debug_glCompressedTexSubImage3D
+#else
 #define glCompressedTexSubImage3D glad_glCompressedTexSubImage3D
+#endif
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data);
 GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_debug_glCompressedTexSubImage2D;
+#define glCompressedTexSubImage2D glad_debug_glCompressedTexSubImage2D
+#else
 #define glCompressedTexSubImage2D glad_glCompressedTexSubImage2D
+#endif
 typedef void (APIENTRYP PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data);
 GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_debug_glCompressedTexSubImage1D;
+#define glCompressedTexSubImage1D glad_debug_glCompressedTexSubImage1D
+#else
 #define glCompressedTexSubImage1D glad_glCompressedTexSubImage1D
+#endif
 typedef void (APIENTRYP PFNGLGETCOMPRESSEDTEXIMAGEPROC)(GLenum target, GLint level, void *img);
 GLAPI PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_debug_glGetCompressedTexImage;
+#define glGetCompressedTexImage glad_debug_glGetCompressedTexImage
+#else
 #define glGetCompressedTexImage glad_glGetCompressedTexImage
 #endif
+#endif
 #ifndef GL_VERSION_1_4
 #define GL_VERSION_1_4 1
 GLAPI int GLAD_GL_VERSION_1_4;
 typedef void (APIENTRYP PFNGLBLENDFUNCSEPARATEPROC)(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
 GLAPI PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBLENDFUNCSEPARATEPROC glad_debug_glBlendFuncSeparate;
+#define glBlendFuncSeparate glad_debug_glBlendFuncSeparate
+#else
 #define glBlendFuncSeparate glad_glBlendFuncSeparate
+#endif
 typedef void (APIENTRYP PFNGLMULTIDRAWARRAYSPROC)(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount);
 GLAPI PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTIDRAWARRAYSPROC glad_debug_glMultiDrawArrays;
+#define glMultiDrawArrays glad_debug_glMultiDrawArrays
+#else
 #define glMultiDrawArrays glad_glMultiDrawArrays
+#endif
 typedef void (APIENTRYP PFNGLMULTIDRAWELEMENTSPROC)(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount);
 GLAPI PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTIDRAWELEMENTSPROC glad_debug_glMultiDrawElements;
+#define glMultiDrawElements glad_debug_glMultiDrawElements
+#else
 #define glMultiDrawElements glad_glMultiDrawElements
+#endif
 typedef void (APIENTRYP PFNGLPOINTPARAMETERFPROC)(GLenum pname, GLfloat param);
 GLAPI PFNGLPOINTPARAMETERFPROC glad_glPointParameterf;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPOINTPARAMETERFPROC glad_debug_glPointParameterf;
+#define glPointParameterf glad_debug_glPointParameterf
+#else
 #define glPointParameterf glad_glPointParameterf
+#endif
 typedef void (APIENTRYP PFNGLPOINTPARAMETERFVPROC)(GLenum pname, const GLfloat *params);
 GLAPI PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPOINTPARAMETERFVPROC glad_debug_glPointParameterfv;
+#define glPointParameterfv glad_debug_glPointParameterfv
+#else
 #define glPointParameterfv glad_glPointParameterfv
+#endif
 typedef void (APIENTRYP PFNGLPOINTPARAMETERIPROC)(GLenum pname, GLint param);
 GLAPI PFNGLPOINTPARAMETERIPROC glad_glPointParameteri;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPOINTPARAMETERIPROC glad_debug_glPointParameteri;
+#define glPointParameteri glad_debug_glPointParameteri
+#else
 #define glPointParameteri glad_glPointParameteri
+#endif
 typedef void (APIENTRYP PFNGLPOINTPARAMETERIVPROC)(GLenum pname, const GLint *params);
 GLAPI PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPOINTPARAMETERIVPROC glad_debug_glPointParameteriv;
+#define glPointParameteriv glad_debug_glPointParameteriv
+#else
 #define glPointParameteriv glad_glPointParameteriv
+#endif
 typedef void (APIENTRYP PFNGLBLENDCOLORPROC)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
 GLAPI PFNGLBLENDCOLORPROC glad_glBlendColor;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBLENDCOLORPROC glad_debug_glBlendColor;
+#define glBlendColor glad_debug_glBlendColor
+#else
 #define glBlendColor glad_glBlendColor
+#endif
 typedef void (APIENTRYP PFNGLBLENDEQUATIONPROC)(GLenum mode);
 GLAPI PFNGLBLENDEQUATIONPROC glad_glBlendEquation;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBLENDEQUATIONPROC glad_debug_glBlendEquation;
+#define glBlendEquation glad_debug_glBlendEquation
+#else
 #define glBlendEquation glad_glBlendEquation
 #endif
+#endif
 #ifndef GL_VERSION_1_5
 #define GL_VERSION_1_5 1
 GLAPI int GLAD_GL_VERSION_1_5;
 typedef void (APIENTRYP PFNGLGENQUERIESPROC)(GLsizei n, GLuint *ids);
 GLAPI PFNGLGENQUERIESPROC glad_glGenQueries;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGENQUERIESPROC glad_debug_glGenQueries;
+#define glGenQueries glad_debug_glGenQueries
+#else
 #define glGenQueries glad_glGenQueries
+#endif
 typedef void (APIENTRYP PFNGLDELETEQUERIESPROC)(GLsizei n, const GLuint *ids);
 GLAPI PFNGLDELETEQUERIESPROC glad_glDeleteQueries;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETEQUERIESPROC glad_debug_glDeleteQueries;
+#define glDeleteQueries glad_debug_glDeleteQueries
+#else
 #define glDeleteQueries glad_glDeleteQueries
+#endif
 typedef GLboolean (APIENTRYP PFNGLISQUERYPROC)(GLuint id);
 GLAPI PFNGLISQUERYPROC glad_glIsQuery;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISQUERYPROC glad_debug_glIsQuery;
+#define glIsQuery glad_debug_glIsQuery
+#else
 #define glIsQuery glad_glIsQuery
+#endif
 typedef void (APIENTRYP PFNGLBEGINQUERYPROC)(GLenum target, GLuint id);
 GLAPI PFNGLBEGINQUERYPROC glad_glBeginQuery;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBEGINQUERYPROC glad_debug_glBeginQuery;
+#define glBeginQuery glad_debug_glBeginQuery
+#else
 #define glBeginQuery glad_glBeginQuery
+#endif
 typedef void (APIENTRYP PFNGLENDQUERYPROC)(GLenum target);
 GLAPI PFNGLENDQUERYPROC glad_glEndQuery;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLENDQUERYPROC glad_debug_glEndQuery;
+#define glEndQuery glad_debug_glEndQuery
+#else
 #define glEndQuery glad_glEndQuery
+#endif
 typedef void (APIENTRYP PFNGLGETQUERYIVPROC)(GLenum target, GLenum pname, GLint *params);
 GLAPI PFNGLGETQUERYIVPROC glad_glGetQueryiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETQUERYIVPROC glad_debug_glGetQueryiv;
+#define glGetQueryiv glad_debug_glGetQueryiv
+#else
 #define glGetQueryiv glad_glGetQueryiv
+#endif
 typedef void (APIENTRYP PFNGLGETQUERYOBJECTIVPROC)(GLuint id, GLenum pname, GLint *params);
 GLAPI PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETQUERYOBJECTIVPROC glad_debug_glGetQueryObjectiv;
+#define glGetQueryObjectiv glad_debug_glGetQueryObjectiv
+#else
 #define glGetQueryObjectiv glad_glGetQueryObjectiv
+#endif
 typedef void (APIENTRYP PFNGLGETQUERYOBJECTUIVPROC)(GLuint id, GLenum pname, GLuint *params);
 GLAPI PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETQUERYOBJECTUIVPROC glad_debug_glGetQueryObjectuiv;
+#define glGetQueryObjectuiv glad_debug_glGetQueryObjectuiv
+#else
 #define glGetQueryObjectuiv glad_glGetQueryObjectuiv
+#endif
 typedef void (APIENTRYP PFNGLBINDBUFFERPROC)(GLenum target, GLuint buffer);
 GLAPI PFNGLBINDBUFFERPROC glad_glBindBuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDBUFFERPROC glad_debug_glBindBuffer;
+#define glBindBuffer glad_debug_glBindBuffer
+#else
 #define glBindBuffer glad_glBindBuffer
+#endif
 typedef void (APIENTRYP PFNGLDELETEBUFFERSPROC)(GLsizei n, const GLuint *buffers);
 GLAPI PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETEBUFFERSPROC glad_debug_glDeleteBuffers;
+#define glDeleteBuffers glad_debug_glDeleteBuffers
+#else
 #define glDeleteBuffers glad_glDeleteBuffers
+#endif
 typedef void (APIENTRYP PFNGLGENBUFFERSPROC)(GLsizei n, GLuint *buffers);
 GLAPI PFNGLGENBUFFERSPROC glad_glGenBuffers;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGENBUFFERSPROC glad_debug_glGenBuffers;
+#define glGenBuffers glad_debug_glGenBuffers
+#else
 #define glGenBuffers glad_glGenBuffers
+#endif
 typedef GLboolean (APIENTRYP PFNGLISBUFFERPROC)(GLuint buffer);
 GLAPI PFNGLISBUFFERPROC glad_glIsBuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISBUFFERPROC glad_debug_glIsBuffer;
+#define glIsBuffer glad_debug_glIsBuffer
+#else
 #define glIsBuffer glad_glIsBuffer
+#endif
 typedef void (APIENTRYP PFNGLBUFFERDATAPROC)(GLenum target, GLsizeiptr size, const void *data, GLenum usage);
 GLAPI PFNGLBUFFERDATAPROC glad_glBufferData;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBUFFERDATAPROC glad_debug_glBufferData;
+#define glBufferData glad_debug_glBufferData
+#else
 #define glBufferData glad_glBufferData
+#endif
 typedef void (APIENTRYP PFNGLBUFFERSUBDATAPROC)(GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
 GLAPI PFNGLBUFFERSUBDATAPROC glad_glBufferSubData;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBUFFERSUBDATAPROC glad_debug_glBufferSubData;
+#define glBufferSubData glad_debug_glBufferSubData
+#else
 #define glBufferSubData glad_glBufferSubData
+#endif
 typedef void (APIENTRYP PFNGLGETBUFFERSUBDATAPROC)(GLenum target, GLintptr offset, GLsizeiptr size, void *data);
 GLAPI PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETBUFFERSUBDATAPROC glad_debug_glGetBufferSubData;
+#define glGetBufferSubData glad_debug_glGetBufferSubData
+#else
 #define glGetBufferSubData glad_glGetBufferSubData
+#endif
 typedef void * (APIENTRYP PFNGLMAPBUFFERPROC)(GLenum target, GLenum access);
 GLAPI PFNGLMAPBUFFERPROC glad_glMapBuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMAPBUFFERPROC glad_debug_glMapBuffer;
+#define glMapBuffer glad_debug_glMapBuffer
+#else
 #define glMapBuffer glad_glMapBuffer
+#endif
 typedef GLboolean (APIENTRYP PFNGLUNMAPBUFFERPROC)(GLenum target);
 GLAPI PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNMAPBUFFERPROC glad_debug_glUnmapBuffer;
+#define glUnmapBuffer glad_debug_glUnmapBuffer
+#else
 #define glUnmapBuffer glad_glUnmapBuffer
+#endif
 typedef void (APIENTRYP PFNGLGETBUFFERPARAMETERIVPROC)(GLenum target, GLenum pname, GLint *params);
 GLAPI PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETBUFFERPARAMETERIVPROC glad_debug_glGetBufferParameteriv;
+#define glGetBufferParameteriv glad_debug_glGetBufferParameteriv
+#else
 #define glGetBufferParameteriv glad_glGetBufferParameteriv
+#endif
 typedef void (APIENTRYP PFNGLGETBUFFERPOINTERVPROC)(GLenum target, GLenum pname, void **params);
 GLAPI PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETBUFFERPOINTERVPROC glad_debug_glGetBufferPointerv;
+#define glGetBufferPointerv glad_debug_glGetBufferPointerv
+#else
 #define glGetBufferPointerv glad_glGetBufferPointerv
 #endif
+#endif
 #ifndef GL_VERSION_2_0
 #define GL_VERSION_2_0 1
 GLAPI int GLAD_GL_VERSION_2_0;
 typedef void (APIENTRYP PFNGLBLENDEQUATIONSEPARATEPROC)(GLenum modeRGB, GLenum modeAlpha);
 GLAPI PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBLENDEQUATIONSEPARATEPROC glad_debug_glBlendEquationSeparate;
+#define glBlendEquationSeparate glad_debug_glBlendEquationSeparate
+#else
 #define glBlendEquationSeparate glad_glBlendEquationSeparate
+#endif
 typedef void (APIENTRYP PFNGLDRAWBUFFERSPROC)(GLsizei n, const GLenum *bufs);
 GLAPI PFNGLDRAWBUFFERSPROC glad_glDrawBuffers;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWBUFFERSPROC glad_debug_glDrawBuffers;
+#define glDrawBuffers glad_debug_glDrawBuffers
+#else
 #define glDrawBuffers glad_glDrawBuffers
+#endif
 typedef void (APIENTRYP PFNGLSTENCILOPSEPARATEPROC)(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass);
 GLAPI PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSTENCILOPSEPARATEPROC glad_debug_glStencilOpSeparate;
+#define glStencilOpSeparate glad_debug_glStencilOpSeparate
+#else
 #define glStencilOpSeparate glad_glStencilOpSeparate
+#endif
 typedef void (APIENTRYP PFNGLSTENCILFUNCSEPARATEPROC)(GLenum face, GLenum func, GLint ref, GLuint mask);
 GLAPI PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSTENCILFUNCSEPARATEPROC glad_debug_glStencilFuncSeparate;
+#define glStencilFuncSeparate glad_debug_glStencilFuncSeparate
+#else
 #define glStencilFuncSeparate glad_glStencilFuncSeparate
+#endif
 typedef void (APIENTRYP PFNGLSTENCILMASKSEPARATEPROC)(GLenum face, GLuint mask);
 GLAPI PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSTENCILMASKSEPARATEPROC glad_debug_glStencilMaskSeparate;
+#define glStencilMaskSeparate glad_debug_glStencilMaskSeparate
+#else
 #define glStencilMaskSeparate glad_glStencilMaskSeparate
+#endif
 typedef void (APIENTRYP PFNGLATTACHSHADERPROC)(GLuint program, GLuint shader);
 GLAPI PFNGLATTACHSHADERPROC glad_glAttachShader;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLATTACHSHADERPROC glad_debug_glAttachShader;
+#define glAttachShader glad_debug_glAttachShader
+#else
 #define glAttachShader glad_glAttachShader
+#endif
 typedef void (APIENTRYP PFNGLBINDATTRIBLOCATIONPROC)(GLuint program, GLuint index, const GLchar *name);
 GLAPI PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDATTRIBLOCATIONPROC glad_debug_glBindAttribLocation;
+#define glBindAttribLocation glad_debug_glBindAttribLocation
+#else
 #define glBindAttribLocation glad_glBindAttribLocation
+#endif
 typedef void (APIENTRYP PFNGLCOMPILESHADERPROC)(GLuint shader);
 GLAPI PFNGLCOMPILESHADERPROC glad_glCompileShader;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOMPILESHADERPROC glad_debug_glCompileShader;
+#define glCompileShader glad_debug_glCompileShader
+#else
 #define glCompileShader glad_glCompileShader
+#endif
 typedef GLuint (APIENTRYP PFNGLCREATEPROGRAMPROC)(void);
 GLAPI PFNGLCREATEPROGRAMPROC glad_glCreateProgram;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCREATEPROGRAMPROC glad_debug_glCreateProgram;
+#define glCreateProgram glad_debug_glCreateProgram
+#else
 #define glCreateProgram glad_glCreateProgram
+#endif
 typedef GLuint (APIENTRYP PFNGLCREATESHADERPROC)(GLenum type);
 GLAPI PFNGLCREATESHADERPROC glad_glCreateShader;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCREATESHADERPROC glad_debug_glCreateShader;
+#define glCreateShader glad_debug_glCreateShader
+#else
 #define glCreateShader glad_glCreateShader
+#endif
 typedef void (APIENTRYP PFNGLDELETEPROGRAMPROC)(GLuint program);
 GLAPI PFNGLDELETEPROGRAMPROC glad_glDeleteProgram;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETEPROGRAMPROC glad_debug_glDeleteProgram;
+#define glDeleteProgram glad_debug_glDeleteProgram
+#else
 #define glDeleteProgram glad_glDeleteProgram
+#endif
 typedef void (APIENTRYP PFNGLDELETESHADERPROC)(GLuint shader);
 GLAPI PFNGLDELETESHADERPROC glad_glDeleteShader;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETESHADERPROC glad_debug_glDeleteShader;
+#define glDeleteShader glad_debug_glDeleteShader
+#else
 #define glDeleteShader glad_glDeleteShader
+#endif
 typedef void (APIENTRYP PFNGLDETACHSHADERPROC)(GLuint program, GLuint shader);
 GLAPI PFNGLDETACHSHADERPROC glad_glDetachShader;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDETACHSHADERPROC glad_debug_glDetachShader;
+#define glDetachShader glad_debug_glDetachShader
+#else
 #define glDetachShader glad_glDetachShader
+#endif
 typedef void (APIENTRYP PFNGLDISABLEVERTEXATTRIBARRAYPROC)(GLuint index);
 GLAPI PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_debug_glDisableVertexAttribArray;
+#define glDisableVertexAttribArray glad_debug_glDisableVertexAttribArray
+#else
 #define glDisableVertexAttribArray glad_glDisableVertexAttribArray
+#endif
 typedef void (APIENTRYP PFNGLENABLEVERTEXATTRIBARRAYPROC)(GLuint index);
 GLAPI PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLENABLEVERTEXATTRIBARRAYPROC glad_debug_glEnableVertexAttribArray;
+#define glEnableVertexAttribArray glad_debug_glEnableVertexAttribArray
+#else
 #define glEnableVertexAttribArray glad_glEnableVertexAttribArray
+#endif
 typedef void (APIENTRYP PFNGLGETACTIVEATTRIBPROC)(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
 GLAPI PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETACTIVEATTRIBPROC glad_debug_glGetActiveAttrib;
+#define glGetActiveAttrib glad_debug_glGetActiveAttrib
+#else
 #define glGetActiveAttrib glad_glGetActiveAttrib
+#endif
 typedef void (APIENTRYP PFNGLGETACTIVEUNIFORMPROC)(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
 GLAPI PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETACTIVEUNIFORMPROC glad_debug_glGetActiveUniform;
+#define glGetActiveUniform glad_debug_glGetActiveUniform
+#else
 #define glGetActiveUniform glad_glGetActiveUniform
+#endif
 typedef void (APIENTRYP PFNGLGETATTACHEDSHADERSPROC)(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders);
 GLAPI PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETATTACHEDSHADERSPROC glad_debug_glGetAttachedShaders;
+#define glGetAttachedShaders glad_debug_glGetAttachedShaders
+#else
 #define glGetAttachedShaders glad_glGetAttachedShaders
+#endif
 typedef GLint (APIENTRYP PFNGLGETATTRIBLOCATIONPROC)(GLuint program, const GLchar *name);
 GLAPI PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETATTRIBLOCATIONPROC glad_debug_glGetAttribLocation;
+#define glGetAttribLocation glad_debug_glGetAttribLocation
+#else
 #define glGetAttribLocation glad_glGetAttribLocation
+#endif
 typedef void (APIENTRYP PFNGLGETPROGRAMIVPROC)(GLuint program, GLenum pname, GLint *params);
 GLAPI PFNGLGETPROGRAMIVPROC glad_glGetProgramiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETPROGRAMIVPROC glad_debug_glGetProgramiv;
+#define glGetProgramiv glad_debug_glGetProgramiv
+#else
 #define glGetProgramiv glad_glGetProgramiv
+#endif
 typedef void (APIENTRYP PFNGLGETPROGRAMINFOLOGPROC)(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
 GLAPI PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETPROGRAMINFOLOGPROC glad_debug_glGetProgramInfoLog;
+#define glGetProgramInfoLog glad_debug_glGetProgramInfoLog
+#else
 #define glGetProgramInfoLog glad_glGetProgramInfoLog
+#endif
 typedef void (APIENTRYP PFNGLGETSHADERIVPROC)(GLuint shader, GLenum pname, GLint *params);
 GLAPI PFNGLGETSHADERIVPROC glad_glGetShaderiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSHADERIVPROC glad_debug_glGetShaderiv;
+#define glGetShaderiv glad_debug_glGetShaderiv
+#else
 #define glGetShaderiv glad_glGetShaderiv
+#endif
 typedef void (APIENTRYP PFNGLGETSHADERINFOLOGPROC)(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
 GLAPI PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSHADERINFOLOGPROC glad_debug_glGetShaderInfoLog;
+#define glGetShaderInfoLog glad_debug_glGetShaderInfoLog
+#else
 #define glGetShaderInfoLog glad_glGetShaderInfoLog
+#endif
 typedef void (APIENTRYP PFNGLGETSHADERSOURCEPROC)(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source);
 GLAPI PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSHADERSOURCEPROC glad_debug_glGetShaderSource;
+#define glGetShaderSource glad_debug_glGetShaderSource
+#else
 #define glGetShaderSource glad_glGetShaderSource
+#endif
 typedef GLint (APIENTRYP PFNGLGETUNIFORMLOCATIONPROC)(GLuint program, const GLchar *name);
 GLAPI PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETUNIFORMLOCATIONPROC glad_debug_glGetUniformLocation;
+#define glGetUniformLocation glad_debug_glGetUniformLocation
+#else
 #define glGetUniformLocation glad_glGetUniformLocation
+#endif
 typedef void (APIENTRYP PFNGLGETUNIFORMFVPROC)(GLuint program, GLint location, GLfloat *params);
 GLAPI PFNGLGETUNIFORMFVPROC glad_glGetUniformfv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETUNIFORMFVPROC glad_debug_glGetUniformfv;
+#define glGetUniformfv glad_debug_glGetUniformfv
+#else
 #define glGetUniformfv glad_glGetUniformfv
+#endif
 typedef void (APIENTRYP PFNGLGETUNIFORMIVPROC)(GLuint program, GLint location, GLint *params);
 GLAPI PFNGLGETUNIFORMIVPROC glad_glGetUniformiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETUNIFORMIVPROC glad_debug_glGetUniformiv;
+#define glGetUniformiv glad_debug_glGetUniformiv
+#else
 #define glGetUniformiv glad_glGetUniformiv
+#endif
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBDVPROC)(GLuint index, GLenum pname, GLdouble *params);
 GLAPI PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETVERTEXATTRIBDVPROC glad_debug_glGetVertexAttribdv;
+#define glGetVertexAttribdv glad_debug_glGetVertexAttribdv
+#else
 #define glGetVertexAttribdv glad_glGetVertexAttribdv
+#endif
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBFVPROC)(GLuint index, GLenum pname, GLfloat *params);
 GLAPI PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETVERTEXATTRIBFVPROC glad_debug_glGetVertexAttribfv;
+#define glGetVertexAttribfv glad_debug_glGetVertexAttribfv
+#else
 #define glGetVertexAttribfv glad_glGetVertexAttribfv
+#endif
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBIVPROC)(GLuint index, GLenum pname, GLint *params);
 GLAPI PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETVERTEXATTRIBIVPROC glad_debug_glGetVertexAttribiv;
+#define glGetVertexAttribiv glad_debug_glGetVertexAttribiv
+#else
 #define glGetVertexAttribiv glad_glGetVertexAttribiv
+#endif
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBPOINTERVPROC)(GLuint index, GLenum pname, void **pointer);
 GLAPI PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETVERTEXATTRIBPOINTERVPROC glad_debug_glGetVertexAttribPointerv;
+#define glGetVertexAttribPointerv glad_debug_glGetVertexAttribPointerv
+#else
 #define glGetVertexAttribPointerv glad_glGetVertexAttribPointerv
+#endif
 typedef GLboolean (APIENTRYP PFNGLISPROGRAMPROC)(GLuint program);
 GLAPI PFNGLISPROGRAMPROC glad_glIsProgram;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISPROGRAMPROC glad_debug_glIsProgram;
+#define glIsProgram glad_debug_glIsProgram
+#else
 #define glIsProgram glad_glIsProgram
+#endif
 typedef GLboolean (APIENTRYP PFNGLISSHADERPROC)(GLuint shader);
 GLAPI PFNGLISSHADERPROC glad_glIsShader;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISSHADERPROC glad_debug_glIsShader;
+#define glIsShader glad_debug_glIsShader
+#else
 #define glIsShader glad_glIsShader
+#endif
 typedef void (APIENTRYP PFNGLLINKPROGRAMPROC)(GLuint program);
 GLAPI PFNGLLINKPROGRAMPROC glad_glLinkProgram;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLLINKPROGRAMPROC glad_debug_glLinkProgram;
+#define glLinkProgram glad_debug_glLinkProgram
+#else
 #define glLinkProgram glad_glLinkProgram
+#endif
 typedef void (APIENTRYP PFNGLSHADERSOURCEPROC)(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length);
 GLAPI PFNGLSHADERSOURCEPROC glad_glShaderSource;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSHADERSOURCEPROC glad_debug_glShaderSource;
+#define glShaderSource glad_debug_glShaderSource
+#else
 #define glShaderSource glad_glShaderSource
+#endif
 typedef void (APIENTRYP PFNGLUSEPROGRAMPROC)(GLuint program);
 GLAPI PFNGLUSEPROGRAMPROC glad_glUseProgram;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUSEPROGRAMPROC glad_debug_glUseProgram;
+#define glUseProgram glad_debug_glUseProgram
+#else
 #define glUseProgram glad_glUseProgram
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM1FPROC)(GLint location, GLfloat v0);
 GLAPI PFNGLUNIFORM1FPROC glad_glUniform1f;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM1FPROC glad_debug_glUniform1f;
+#define glUniform1f glad_debug_glUniform1f
+#else
 #define glUniform1f glad_glUniform1f
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM2FPROC)(GLint location, GLfloat v0, GLfloat v1);
 GLAPI PFNGLUNIFORM2FPROC glad_glUniform2f;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM2FPROC glad_debug_glUniform2f;
+#define glUniform2f glad_debug_glUniform2f
+#else
 #define glUniform2f glad_glUniform2f
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM3FPROC)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
 GLAPI PFNGLUNIFORM3FPROC glad_glUniform3f;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM3FPROC glad_debug_glUniform3f;
+#define glUniform3f glad_debug_glUniform3f
+#else
 #define glUniform3f glad_glUniform3f
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM4FPROC)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
 GLAPI PFNGLUNIFORM4FPROC glad_glUniform4f;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM4FPROC glad_debug_glUniform4f;
+#define glUniform4f glad_debug_glUniform4f
+#else
 #define glUniform4f glad_glUniform4f
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM1IPROC)(GLint location, GLint v0);
 GLAPI PFNGLUNIFORM1IPROC glad_glUniform1i;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM1IPROC glad_debug_glUniform1i;
+#define glUniform1i glad_debug_glUniform1i
+#else
 #define glUniform1i glad_glUniform1i
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM2IPROC)(GLint location, GLint v0, GLint v1);
 GLAPI PFNGLUNIFORM2IPROC glad_glUniform2i;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM2IPROC glad_debug_glUniform2i;
+#define glUniform2i glad_debug_glUniform2i
+#else
 #define glUniform2i glad_glUniform2i
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM3IPROC)(GLint location, GLint v0, GLint v1, GLint v2);
 GLAPI PFNGLUNIFORM3IPROC glad_glUniform3i;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM3IPROC glad_debug_glUniform3i;
+#define glUniform3i glad_debug_glUniform3i
+#else
 #define glUniform3i glad_glUniform3i
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM4IPROC)(GLint location, GLint v0, GLint v1, GLint v2, GLint v3);
 GLAPI PFNGLUNIFORM4IPROC glad_glUniform4i;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM4IPROC glad_debug_glUniform4i;
+#define glUniform4i glad_debug_glUniform4i
+#else
 #define glUniform4i glad_glUniform4i
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM1FVPROC)(GLint location, GLsizei count, const GLfloat *value);
 GLAPI PFNGLUNIFORM1FVPROC glad_glUniform1fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM1FVPROC glad_debug_glUniform1fv;
+#define glUniform1fv glad_debug_glUniform1fv
+#else
 #define glUniform1fv glad_glUniform1fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM2FVPROC)(GLint location, GLsizei count, const GLfloat *value);
 GLAPI PFNGLUNIFORM2FVPROC glad_glUniform2fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM2FVPROC glad_debug_glUniform2fv;
+#define glUniform2fv glad_debug_glUniform2fv
+#else
 #define glUniform2fv glad_glUniform2fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM3FVPROC)(GLint location, GLsizei count, const GLfloat *value);
 GLAPI PFNGLUNIFORM3FVPROC glad_glUniform3fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM3FVPROC glad_debug_glUniform3fv;
+#define glUniform3fv glad_debug_glUniform3fv
+#else
 #define glUniform3fv glad_glUniform3fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM4FVPROC)(GLint location, GLsizei count, const GLfloat *value);
 GLAPI PFNGLUNIFORM4FVPROC glad_glUniform4fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM4FVPROC glad_debug_glUniform4fv;
+#define glUniform4fv glad_debug_glUniform4fv
+#else
 #define glUniform4fv glad_glUniform4fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM1IVPROC)(GLint location, GLsizei count, const GLint *value);
 GLAPI PFNGLUNIFORM1IVPROC glad_glUniform1iv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM1IVPROC glad_debug_glUniform1iv;
+#define glUniform1iv glad_debug_glUniform1iv
+#else
 #define glUniform1iv glad_glUniform1iv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM2IVPROC)(GLint location, GLsizei count, const GLint *value);
 GLAPI PFNGLUNIFORM2IVPROC glad_glUniform2iv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM2IVPROC glad_debug_glUniform2iv;
+#define glUniform2iv glad_debug_glUniform2iv
+#else
 #define glUniform2iv glad_glUniform2iv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM3IVPROC)(GLint location, GLsizei count, const GLint *value);
 GLAPI PFNGLUNIFORM3IVPROC glad_glUniform3iv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM3IVPROC glad_debug_glUniform3iv;
+#define glUniform3iv glad_debug_glUniform3iv
+#else
 #define glUniform3iv glad_glUniform3iv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM4IVPROC)(GLint location, GLsizei count, const GLint *value);
 GLAPI PFNGLUNIFORM4IVPROC glad_glUniform4iv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM4IVPROC glad_debug_glUniform4iv;
+#define glUniform4iv glad_debug_glUniform4iv
+#else
 #define glUniform4iv glad_glUniform4iv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX2FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 GLAPI PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX2FVPROC glad_debug_glUniformMatrix2fv;
+#define glUniformMatrix2fv glad_debug_glUniformMatrix2fv
+#else
 #define glUniformMatrix2fv glad_glUniformMatrix2fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX3FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 GLAPI PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX3FVPROC glad_debug_glUniformMatrix3fv;
+#define glUniformMatrix3fv glad_debug_glUniformMatrix3fv
+#else
 #define glUniformMatrix3fv glad_glUniformMatrix3fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX4FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 GLAPI PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX4FVPROC glad_debug_glUniformMatrix4fv;
+#define glUniformMatrix4fv glad_debug_glUniformMatrix4fv
+#else
 #define glUniformMatrix4fv glad_glUniformMatrix4fv
+#endif
 typedef void (APIENTRYP PFNGLVALIDATEPROGRAMPROC)(GLuint program);
 GLAPI PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVALIDATEPROGRAMPROC glad_debug_glValidateProgram;
+#define glValidateProgram glad_debug_glValidateProgram
+#else
 #define glValidateProgram glad_glValidateProgram
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1DPROC)(GLuint index, GLdouble x);
 GLAPI PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB1DPROC glad_debug_glVertexAttrib1d;
+#define glVertexAttrib1d glad_debug_glVertexAttrib1d
+#else
 #define glVertexAttrib1d glad_glVertexAttrib1d
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1DVPROC)(GLuint index, const GLdouble *v);
 GLAPI PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB1DVPROC glad_debug_glVertexAttrib1dv;
+#define glVertexAttrib1dv glad_debug_glVertexAttrib1dv
+#else
 #define glVertexAttrib1dv glad_glVertexAttrib1dv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1FPROC)(GLuint index, GLfloat x);
 GLAPI PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB1FPROC glad_debug_glVertexAttrib1f;
+#define glVertexAttrib1f glad_debug_glVertexAttrib1f
+#else
 #define glVertexAttrib1f glad_glVertexAttrib1f
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1FVPROC)(GLuint index, const GLfloat *v);
 GLAPI PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB1FVPROC glad_debug_glVertexAttrib1fv;
+#define glVertexAttrib1fv glad_debug_glVertexAttrib1fv
+#else
 #define glVertexAttrib1fv glad_glVertexAttrib1fv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1SPROC)(GLuint index, GLshort x);
 GLAPI PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB1SPROC glad_debug_glVertexAttrib1s;
+#define glVertexAttrib1s glad_debug_glVertexAttrib1s
+#else
 #define glVertexAttrib1s glad_glVertexAttrib1s
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB1SVPROC)(GLuint index, const GLshort *v);
 GLAPI PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB1SVPROC glad_debug_glVertexAttrib1sv;
+#define glVertexAttrib1sv glad_debug_glVertexAttrib1sv
+#else
 #define glVertexAttrib1sv glad_glVertexAttrib1sv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2DPROC)(GLuint index, GLdouble x, GLdouble y);
 GLAPI PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB2DPROC glad_debug_glVertexAttrib2d;
+#define glVertexAttrib2d glad_debug_glVertexAttrib2d
+#else
 #define glVertexAttrib2d glad_glVertexAttrib2d
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2DVPROC)(GLuint index, const GLdouble *v);
 GLAPI PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB2DVPROC glad_debug_glVertexAttrib2dv;
+#define glVertexAttrib2dv glad_debug_glVertexAttrib2dv
+#else
 #define glVertexAttrib2dv glad_glVertexAttrib2dv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2FPROC)(GLuint index, GLfloat x, GLfloat y);
 GLAPI PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB2FPROC glad_debug_glVertexAttrib2f;
+#define glVertexAttrib2f glad_debug_glVertexAttrib2f
+#else
 #define glVertexAttrib2f glad_glVertexAttrib2f
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2FVPROC)(GLuint index, const GLfloat *v);
 GLAPI PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB2FVPROC glad_debug_glVertexAttrib2fv;
+#define glVertexAttrib2fv glad_debug_glVertexAttrib2fv
+#else
 #define glVertexAttrib2fv glad_glVertexAttrib2fv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2SPROC)(GLuint index, GLshort x, GLshort y);
 GLAPI PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB2SPROC glad_debug_glVertexAttrib2s;
+#define glVertexAttrib2s glad_debug_glVertexAttrib2s
+#else
 #define glVertexAttrib2s glad_glVertexAttrib2s
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB2SVPROC)(GLuint index, const GLshort *v);
 GLAPI PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB2SVPROC glad_debug_glVertexAttrib2sv;
+#define glVertexAttrib2sv glad_debug_glVertexAttrib2sv
+#else
 #define glVertexAttrib2sv glad_glVertexAttrib2sv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3DPROC)(GLuint index, GLdouble x, GLdouble y, GLdouble z);
 GLAPI PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB3DPROC glad_debug_glVertexAttrib3d;
+#define glVertexAttrib3d glad_debug_glVertexAttrib3d
+#else
 #define glVertexAttrib3d glad_glVertexAttrib3d
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3DVPROC)(GLuint index, const GLdouble *v);
 GLAPI PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB3DVPROC glad_debug_glVertexAttrib3dv;
+#define glVertexAttrib3dv glad_debug_glVertexAttrib3dv
+#else
 #define glVertexAttrib3dv glad_glVertexAttrib3dv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3FPROC)(GLuint index, GLfloat x, GLfloat y, GLfloat z);
 GLAPI PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB3FPROC glad_debug_glVertexAttrib3f;
+#define glVertexAttrib3f glad_debug_glVertexAttrib3f
+#else
 #define glVertexAttrib3f glad_glVertexAttrib3f
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3FVPROC)(GLuint index, const GLfloat *v);
 GLAPI PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB3FVPROC glad_debug_glVertexAttrib3fv;
+#define glVertexAttrib3fv glad_debug_glVertexAttrib3fv
+#else
 #define glVertexAttrib3fv glad_glVertexAttrib3fv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3SPROC)(GLuint index, GLshort x, GLshort y, GLshort z);
 GLAPI PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB3SPROC glad_debug_glVertexAttrib3s;
+#define glVertexAttrib3s glad_debug_glVertexAttrib3s
+#else
 #define glVertexAttrib3s glad_glVertexAttrib3s
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB3SVPROC)(GLuint index, const GLshort *v);
 GLAPI PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB3SVPROC glad_debug_glVertexAttrib3sv;
+#define glVertexAttrib3sv glad_debug_glVertexAttrib3sv
+#else
 #define glVertexAttrib3sv glad_glVertexAttrib3sv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NBVPROC)(GLuint index, const GLbyte *v);
 GLAPI PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4NBVPROC glad_debug_glVertexAttrib4Nbv;
+#define glVertexAttrib4Nbv glad_debug_glVertexAttrib4Nbv
+#else
 #define glVertexAttrib4Nbv glad_glVertexAttrib4Nbv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NIVPROC)(GLuint index, const GLint *v);
 GLAPI PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4NIVPROC glad_debug_glVertexAttrib4Niv;
+#define glVertexAttrib4Niv glad_debug_glVertexAttrib4Niv
+#else
 #define glVertexAttrib4Niv glad_glVertexAttrib4Niv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NSVPROC)(GLuint index, const GLshort *v);
 GLAPI PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4NSVPROC glad_debug_glVertexAttrib4Nsv;
+#define glVertexAttrib4Nsv glad_debug_glVertexAttrib4Nsv
+#else
 #define glVertexAttrib4Nsv glad_glVertexAttrib4Nsv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NUBPROC)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w);
 GLAPI PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4NUBPROC glad_debug_glVertexAttrib4Nub;
+#define glVertexAttrib4Nub glad_debug_glVertexAttrib4Nub
+#else
 #define glVertexAttrib4Nub glad_glVertexAttrib4Nub
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NUBVPROC)(GLuint index, const GLubyte *v);
 GLAPI PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4NUBVPROC glad_debug_glVertexAttrib4Nubv;
+#define glVertexAttrib4Nubv glad_debug_glVertexAttrib4Nubv
+#else
 #define glVertexAttrib4Nubv glad_glVertexAttrib4Nubv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NUIVPROC)(GLuint index, const GLuint *v);
 GLAPI PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4NUIVPROC glad_debug_glVertexAttrib4Nuiv;
+#define glVertexAttrib4Nuiv glad_debug_glVertexAttrib4Nuiv
+#else
 #define glVertexAttrib4Nuiv glad_glVertexAttrib4Nuiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4NUSVPROC)(GLuint index, const GLushort *v);
 GLAPI PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4NUSVPROC glad_debug_glVertexAttrib4Nusv;
+#define glVertexAttrib4Nusv glad_debug_glVertexAttrib4Nusv
+#else
 #define glVertexAttrib4Nusv glad_glVertexAttrib4Nusv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4BVPROC)(GLuint index, const GLbyte *v);
 GLAPI PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4BVPROC glad_debug_glVertexAttrib4bv;
+#define glVertexAttrib4bv glad_debug_glVertexAttrib4bv
+#else
 #define glVertexAttrib4bv glad_glVertexAttrib4bv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4DPROC)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
 GLAPI PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4DPROC glad_debug_glVertexAttrib4d;
+#define glVertexAttrib4d glad_debug_glVertexAttrib4d
+#else
 #define glVertexAttrib4d glad_glVertexAttrib4d
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4DVPROC)(GLuint index, const GLdouble *v);
 GLAPI PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4DVPROC glad_debug_glVertexAttrib4dv;
+#define glVertexAttrib4dv glad_debug_glVertexAttrib4dv
+#else
 #define glVertexAttrib4dv glad_glVertexAttrib4dv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4FPROC)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
 GLAPI PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4FPROC glad_debug_glVertexAttrib4f;
+#define glVertexAttrib4f glad_debug_glVertexAttrib4f
+#else
 #define glVertexAttrib4f glad_glVertexAttrib4f
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4FVPROC)(GLuint index, const GLfloat *v);
 GLAPI PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4FVPROC glad_debug_glVertexAttrib4fv;
+#define glVertexAttrib4fv glad_debug_glVertexAttrib4fv
+#else
 #define glVertexAttrib4fv glad_glVertexAttrib4fv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4IVPROC)(GLuint index, const GLint *v);
 GLAPI PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4IVPROC glad_debug_glVertexAttrib4iv;
+#define glVertexAttrib4iv glad_debug_glVertexAttrib4iv
+#else
 #define glVertexAttrib4iv glad_glVertexAttrib4iv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4SPROC)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w);
 GLAPI PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4SPROC glad_debug_glVertexAttrib4s;
+#define glVertexAttrib4s glad_debug_glVertexAttrib4s
+#else
 #define glVertexAttrib4s glad_glVertexAttrib4s
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4SVPROC)(GLuint index, const GLshort *v);
 GLAPI PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4SVPROC glad_debug_glVertexAttrib4sv;
+#define glVertexAttrib4sv glad_debug_glVertexAttrib4sv
+#else
 #define glVertexAttrib4sv glad_glVertexAttrib4sv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4UBVPROC)(GLuint index, const GLubyte *v);
 GLAPI PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4UBVPROC glad_debug_glVertexAttrib4ubv;
+#define glVertexAttrib4ubv glad_debug_glVertexAttrib4ubv
+#else
 #define glVertexAttrib4ubv glad_glVertexAttrib4ubv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4UIVPROC)(GLuint index, const GLuint *v);
 GLAPI PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4UIVPROC glad_debug_glVertexAttrib4uiv;
+#define glVertexAttrib4uiv glad_debug_glVertexAttrib4uiv
+#else
 #define glVertexAttrib4uiv glad_glVertexAttrib4uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIB4USVPROC)(GLuint index, const GLushort *v);
 GLAPI PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIB4USVPROC glad_debug_glVertexAttrib4usv;
+#define glVertexAttrib4usv glad_debug_glVertexAttrib4usv
+#else
 #define glVertexAttrib4usv glad_glVertexAttrib4usv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBPOINTERPROC)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
 GLAPI PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBPOINTERPROC glad_debug_glVertexAttribPointer;
+#define glVertexAttribPointer glad_debug_glVertexAttribPointer
+#else
 #define glVertexAttribPointer glad_glVertexAttribPointer
 #endif
+#endif
 #ifndef GL_VERSION_2_1
 #define GL_VERSION_2_1 1
 GLAPI int GLAD_GL_VERSION_2_1;
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX2X3FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 GLAPI PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX2X3FVPROC glad_debug_glUniformMatrix2x3fv;
+#define glUniformMatrix2x3fv glad_debug_glUniformMatrix2x3fv
+#else
 #define glUniformMatrix2x3fv glad_glUniformMatrix2x3fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX3X2FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 GLAPI PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX3X2FVPROC glad_debug_glUniformMatrix3x2fv;
+#define glUniformMatrix3x2fv glad_debug_glUniformMatrix3x2fv
+#else
 #define glUniformMatrix3x2fv glad_glUniformMatrix3x2fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX2X4FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 GLAPI PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX2X4FVPROC glad_debug_glUniformMatrix2x4fv;
+#define glUniformMatrix2x4fv glad_debug_glUniformMatrix2x4fv
+#else
 #define glUniformMatrix2x4fv glad_glUniformMatrix2x4fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX4X2FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 GLAPI PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX4X2FVPROC glad_debug_glUniformMatrix4x2fv;
+#define glUniformMatrix4x2fv glad_debug_glUniformMatrix4x2fv
+#else
 #define glUniformMatrix4x2fv glad_glUniformMatrix4x2fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX3X4FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 GLAPI PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX3X4FVPROC glad_debug_glUniformMatrix3x4fv;
+#define glUniformMatrix3x4fv glad_debug_glUniformMatrix3x4fv
+#else
 #define glUniformMatrix3x4fv glad_glUniformMatrix3x4fv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX4X3FVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
 GLAPI PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX4X3FVPROC glad_debug_glUniformMatrix4x3fv;
+#define glUniformMatrix4x3fv glad_debug_glUniformMatrix4x3fv
+#else
 #define glUniformMatrix4x3fv glad_glUniformMatrix4x3fv
 #endif
+#endif
 #ifndef GL_VERSION_3_0
 #define GL_VERSION_3_0 1
 GLAPI int GLAD_GL_VERSION_3_0;
 typedef void (APIENTRYP PFNGLCOLORMASKIPROC)(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a);
 GLAPI PFNGLCOLORMASKIPROC glad_glColorMaski;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOLORMASKIPROC glad_debug_glColorMaski;
+#define glColorMaski glad_debug_glColorMaski
+#else
 #define glColorMaski glad_glColorMaski
+#endif
 typedef void (APIENTRYP PFNGLGETBOOLEANI_VPROC)(GLenum target, GLuint index, GLboolean *data);
 GLAPI PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETBOOLEANI_VPROC glad_debug_glGetBooleani_v;
+#define glGetBooleani_v glad_debug_glGetBooleani_v
+#else
 #define glGetBooleani_v glad_glGetBooleani_v
+#endif
 typedef void (APIENTRYP PFNGLGETINTEGERI_VPROC)(GLenum target, GLuint index, GLint *data);
 GLAPI PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETINTEGERI_VPROC glad_debug_glGetIntegeri_v;
+#define glGetIntegeri_v glad_debug_glGetIntegeri_v
+#else
 #define glGetIntegeri_v glad_glGetIntegeri_v
+#endif
 typedef void (APIENTRYP PFNGLENABLEIPROC)(GLenum target, GLuint index);
 GLAPI PFNGLENABLEIPROC glad_glEnablei;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLENABLEIPROC glad_debug_glEnablei;
+#define glEnablei glad_debug_glEnablei
+#else
 #define glEnablei glad_glEnablei
+#endif
 typedef void (APIENTRYP PFNGLDISABLEIPROC)(GLenum target, GLuint index);
 GLAPI PFNGLDISABLEIPROC glad_glDisablei;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDISABLEIPROC glad_debug_glDisablei;
+#define glDisablei glad_debug_glDisablei
+#else
 #define glDisablei glad_glDisablei
+#endif
 typedef GLboolean (APIENTRYP PFNGLISENABLEDIPROC)(GLenum target, GLuint index);
 GLAPI PFNGLISENABLEDIPROC glad_glIsEnabledi;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISENABLEDIPROC glad_debug_glIsEnabledi;
+#define glIsEnabledi glad_debug_glIsEnabledi
+#else
 #define glIsEnabledi glad_glIsEnabledi
+#endif
 typedef void (APIENTRYP PFNGLBEGINTRANSFORMFEEDBACKPROC)(GLenum primitiveMode);
 GLAPI PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBEGINTRANSFORMFEEDBACKPROC glad_debug_glBeginTransformFeedback;
+#define glBeginTransformFeedback glad_debug_glBeginTransformFeedback
+#else
 #define glBeginTransformFeedback glad_glBeginTransformFeedback
+#endif
 typedef void (APIENTRYP PFNGLENDTRANSFORMFEEDBACKPROC)(void);
 GLAPI PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLENDTRANSFORMFEEDBACKPROC glad_debug_glEndTransformFeedback;
+#define glEndTransformFeedback glad_debug_glEndTransformFeedback
+#else
 #define glEndTransformFeedback glad_glEndTransformFeedback
+#endif
 typedef void (APIENTRYP PFNGLBINDBUFFERRANGEPROC)(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
 GLAPI PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDBUFFERRANGEPROC glad_debug_glBindBufferRange;
+#define glBindBufferRange glad_debug_glBindBufferRange
+#else
 #define glBindBufferRange glad_glBindBufferRange
+#endif
 typedef void (APIENTRYP PFNGLBINDBUFFERBASEPROC)(GLenum target, GLuint index, GLuint buffer);
 GLAPI PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDBUFFERBASEPROC glad_debug_glBindBufferBase;
+#define glBindBufferBase glad_debug_glBindBufferBase
+#else
 #define glBindBufferBase glad_glBindBufferBase
+#endif
 typedef void (APIENTRYP PFNGLTRANSFORMFEEDBACKVARYINGSPROC)(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode);
 GLAPI PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_debug_glTransformFeedbackVaryings;
+#define glTransformFeedbackVaryings glad_debug_glTransformFeedbackVaryings
+#else
 #define glTransformFeedbackVaryings glad_glTransformFeedbackVaryings
+#endif
 typedef void (APIENTRYP PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name);
 GLAPI PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_debug_glGetTransformFeedbackVarying;
+#define glGetTransformFeedbackVarying glad_debug_glGetTransformFeedbackVarying
+#else
 #define glGetTransformFeedbackVarying glad_glGetTransformFeedbackVarying
+#endif
 typedef void (APIENTRYP PFNGLCLAMPCOLORPROC)(GLenum target, GLenum clamp);
 GLAPI PFNGLCLAMPCOLORPROC glad_glClampColor;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCLAMPCOLORPROC glad_debug_glClampColor;
+#define glClampColor glad_debug_glClampColor
+#else
 #define glClampColor glad_glClampColor
+#endif
 typedef void (APIENTRYP PFNGLBEGINCONDITIONALRENDERPROC)(GLuint id, GLenum mode);
 GLAPI PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBEGINCONDITIONALRENDERPROC glad_debug_glBeginConditionalRender;
+#define glBeginConditionalRender glad_debug_glBeginConditionalRender
+#else
 #define glBeginConditionalRender glad_glBeginConditionalRender
+#endif
 typedef void (APIENTRYP PFNGLENDCONDITIONALRENDERPROC)(void);
 GLAPI PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLENDCONDITIONALRENDERPROC glad_debug_glEndConditionalRender;
+#define glEndConditionalRender glad_debug_glEndConditionalRender
+#else
 #define glEndConditionalRender glad_glEndConditionalRender
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBIPOINTERPROC)(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer);
 GLAPI PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBIPOINTERPROC glad_debug_glVertexAttribIPointer;
+#define glVertexAttribIPointer glad_debug_glVertexAttribIPointer
+#else
 #define glVertexAttribIPointer glad_glVertexAttribIPointer
+#endif
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBIIVPROC)(GLuint index, GLenum pname, GLint *params);
 GLAPI PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETVERTEXATTRIBIIVPROC glad_debug_glGetVertexAttribIiv;
+#define glGetVertexAttribIiv glad_debug_glGetVertexAttribIiv
+#else
 #define glGetVertexAttribIiv glad_glGetVertexAttribIiv
+#endif
 typedef void (APIENTRYP PFNGLGETVERTEXATTRIBIUIVPROC)(GLuint index, GLenum pname, GLuint *params);
 GLAPI PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETVERTEXATTRIBIUIVPROC glad_debug_glGetVertexAttribIuiv;
+#define glGetVertexAttribIuiv glad_debug_glGetVertexAttribIuiv
+#else
 #define glGetVertexAttribIuiv glad_glGetVertexAttribIuiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI1IPROC)(GLuint index, GLint x);
 GLAPI PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI1IPROC glad_debug_glVertexAttribI1i;
+#define glVertexAttribI1i glad_debug_glVertexAttribI1i
+#else
 #define glVertexAttribI1i glad_glVertexAttribI1i
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI2IPROC)(GLuint index, GLint x, GLint y);
 GLAPI PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI2IPROC glad_debug_glVertexAttribI2i;
+#define glVertexAttribI2i glad_debug_glVertexAttribI2i
+#else
 #define glVertexAttribI2i glad_glVertexAttribI2i
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI3IPROC)(GLuint index, GLint x, GLint y, GLint z);
 GLAPI PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI3IPROC glad_debug_glVertexAttribI3i;
+#define glVertexAttribI3i glad_debug_glVertexAttribI3i
+#else
 #define glVertexAttribI3i glad_glVertexAttribI3i
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4IPROC)(GLuint index, GLint x, GLint y, GLint z, GLint w);
 GLAPI PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI4IPROC glad_debug_glVertexAttribI4i;
+#define glVertexAttribI4i glad_debug_glVertexAttribI4i
+#else
 #define glVertexAttribI4i glad_glVertexAttribI4i
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI1UIPROC)(GLuint index, GLuint x);
 GLAPI PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI1UIPROC glad_debug_glVertexAttribI1ui;
+#define glVertexAttribI1ui glad_debug_glVertexAttribI1ui
+#else
 #define glVertexAttribI1ui glad_glVertexAttribI1ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI2UIPROC)(GLuint index, GLuint x, GLuint y);
 GLAPI PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI2UIPROC glad_debug_glVertexAttribI2ui;
+#define glVertexAttribI2ui glad_debug_glVertexAttribI2ui
+#else
 #define glVertexAttribI2ui glad_glVertexAttribI2ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI3UIPROC)(GLuint index, GLuint x, GLuint y, GLuint z);
 GLAPI PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI3UIPROC glad_debug_glVertexAttribI3ui;
+#define glVertexAttribI3ui glad_debug_glVertexAttribI3ui
+#else
 #define glVertexAttribI3ui glad_glVertexAttribI3ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4UIPROC)(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w);
 GLAPI PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI4UIPROC glad_debug_glVertexAttribI4ui;
+#define glVertexAttribI4ui glad_debug_glVertexAttribI4ui
+#else
 #define glVertexAttribI4ui glad_glVertexAttribI4ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI1IVPROC)(GLuint index, const GLint *v);
 GLAPI PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI1IVPROC glad_debug_glVertexAttribI1iv;
+#define glVertexAttribI1iv glad_debug_glVertexAttribI1iv
+#else
 #define glVertexAttribI1iv glad_glVertexAttribI1iv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI2IVPROC)(GLuint index, const GLint *v);
 GLAPI PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI2IVPROC glad_debug_glVertexAttribI2iv;
+#define glVertexAttribI2iv glad_debug_glVertexAttribI2iv
+#else
 #define glVertexAttribI2iv glad_glVertexAttribI2iv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI3IVPROC)(GLuint index, const GLint *v);
 GLAPI PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI3IVPROC glad_debug_glVertexAttribI3iv;
+#define glVertexAttribI3iv glad_debug_glVertexAttribI3iv
+#else
 #define glVertexAttribI3iv glad_glVertexAttribI3iv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4IVPROC)(GLuint index, const GLint *v);
 GLAPI PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI4IVPROC glad_debug_glVertexAttribI4iv;
+#define glVertexAttribI4iv glad_debug_glVertexAttribI4iv
+#else
 #define glVertexAttribI4iv glad_glVertexAttribI4iv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI1UIVPROC)(GLuint index, const GLuint *v);
 GLAPI PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI1UIVPROC glad_debug_glVertexAttribI1uiv;
+#define glVertexAttribI1uiv glad_debug_glVertexAttribI1uiv
+#else
 #define glVertexAttribI1uiv glad_glVertexAttribI1uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI2UIVPROC)(GLuint index, const GLuint *v);
 GLAPI PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI2UIVPROC glad_debug_glVertexAttribI2uiv;
+#define glVertexAttribI2uiv glad_debug_glVertexAttribI2uiv
+#else
 #define glVertexAttribI2uiv glad_glVertexAttribI2uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI3UIVPROC)(GLuint index, const GLuint *v);
 GLAPI PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI3UIVPROC glad_debug_glVertexAttribI3uiv;
+#define glVertexAttribI3uiv glad_debug_glVertexAttribI3uiv
+#else
 #define glVertexAttribI3uiv glad_glVertexAttribI3uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4UIVPROC)(GLuint index, const GLuint *v);
 GLAPI PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI4UIVPROC glad_debug_glVertexAttribI4uiv;
+#define glVertexAttribI4uiv glad_debug_glVertexAttribI4uiv
+#else
 #define glVertexAttribI4uiv glad_glVertexAttribI4uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4BVPROC)(GLuint index, const GLbyte *v);
 GLAPI PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI4BVPROC glad_debug_glVertexAttribI4bv;
+#define glVertexAttribI4bv glad_debug_glVertexAttribI4bv
+#else
 #define glVertexAttribI4bv glad_glVertexAttribI4bv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4SVPROC)(GLuint index, const GLshort *v);
 GLAPI PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI4SVPROC glad_debug_glVertexAttribI4sv;
+#define glVertexAttribI4sv glad_debug_glVertexAttribI4sv
+#else
 #define glVertexAttribI4sv glad_glVertexAttribI4sv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4UBVPROC)(GLuint index, const GLubyte *v);
 GLAPI PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI4UBVPROC glad_debug_glVertexAttribI4ubv;
+#define glVertexAttribI4ubv glad_debug_glVertexAttribI4ubv
+#else
 #define glVertexAttribI4ubv glad_glVertexAttribI4ubv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBI4USVPROC)(GLuint index, const GLushort *v);
 GLAPI PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBI4USVPROC glad_debug_glVertexAttribI4usv;
+#define glVertexAttribI4usv glad_debug_glVertexAttribI4usv
+#else
 #define glVertexAttribI4usv glad_glVertexAttribI4usv
+#endif
 typedef void (APIENTRYP PFNGLGETUNIFORMUIVPROC)(GLuint program, GLint location, GLuint *params);
 GLAPI PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETUNIFORMUIVPROC glad_debug_glGetUniformuiv;
+#define glGetUniformuiv glad_debug_glGetUniformuiv
+#else
 #define glGetUniformuiv glad_glGetUniformuiv
+#endif
 typedef void (APIENTRYP PFNGLBINDFRAGDATALOCATIONPROC)(GLuint program, GLuint color, const GLchar *name);
 GLAPI PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDFRAGDATALOCATIONPROC glad_debug_glBindFragDataLocation;
+#define glBindFragDataLocation glad_debug_glBindFragDataLocation
+#else
 #define glBindFragDataLocation glad_glBindFragDataLocation
+#endif
 typedef GLint (APIENTRYP PFNGLGETFRAGDATALOCATIONPROC)(GLuint program, const GLchar *name);
 GLAPI PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETFRAGDATALOCATIONPROC glad_debug_glGetFragDataLocation;
+#define glGetFragDataLocation glad_debug_glGetFragDataLocation
+#else
 #define glGetFragDataLocation glad_glGetFragDataLocation
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM1UIPROC)(GLint location, GLuint v0);
 GLAPI PFNGLUNIFORM1UIPROC glad_glUniform1ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM1UIPROC glad_debug_glUniform1ui;
+#define glUniform1ui glad_debug_glUniform1ui
+#else
 #define glUniform1ui glad_glUniform1ui
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM2UIPROC)(GLint location, GLuint v0, GLuint v1);
 GLAPI PFNGLUNIFORM2UIPROC glad_glUniform2ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM2UIPROC glad_debug_glUniform2ui;
+#define glUniform2ui glad_debug_glUniform2ui
+#else
 #define glUniform2ui glad_glUniform2ui
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM3UIPROC)(GLint location, GLuint v0, GLuint v1, GLuint v2);
 GLAPI PFNGLUNIFORM3UIPROC glad_glUniform3ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM3UIPROC glad_debug_glUniform3ui;
+#define glUniform3ui glad_debug_glUniform3ui
+#else
 #define glUniform3ui glad_glUniform3ui
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM4UIPROC)(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3);
 GLAPI PFNGLUNIFORM4UIPROC glad_glUniform4ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM4UIPROC glad_debug_glUniform4ui;
+#define glUniform4ui glad_debug_glUniform4ui
+#else
 #define glUniform4ui glad_glUniform4ui
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM1UIVPROC)(GLint location, GLsizei count, const GLuint *value);
 GLAPI PFNGLUNIFORM1UIVPROC glad_glUniform1uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM1UIVPROC glad_debug_glUniform1uiv;
+#define glUniform1uiv glad_debug_glUniform1uiv
+#else
 #define glUniform1uiv glad_glUniform1uiv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM2UIVPROC)(GLint location, GLsizei count, const GLuint *value);
 GLAPI PFNGLUNIFORM2UIVPROC glad_glUniform2uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM2UIVPROC glad_debug_glUniform2uiv;
+#define glUniform2uiv glad_debug_glUniform2uiv
+#else
 #define glUniform2uiv glad_glUniform2uiv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM3UIVPROC)(GLint location, GLsizei count, const GLuint *value);
 GLAPI PFNGLUNIFORM3UIVPROC glad_glUniform3uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM3UIVPROC glad_debug_glUniform3uiv;
+#define glUniform3uiv glad_debug_glUniform3uiv
+#else
 #define glUniform3uiv glad_glUniform3uiv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM4UIVPROC)(GLint location, GLsizei count, const GLuint *value);
 GLAPI PFNGLUNIFORM4UIVPROC glad_glUniform4uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM4UIVPROC glad_debug_glUniform4uiv;
+#define glUniform4uiv glad_debug_glUniform4uiv
+#else
 #define glUniform4uiv glad_glUniform4uiv
+#endif
 typedef void (APIENTRYP PFNGLTEXPARAMETERIIVPROC)(GLenum target, GLenum pname, const GLint *params);
 GLAPI PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXPARAMETERIIVPROC glad_debug_glTexParameterIiv;
+#define glTexParameterIiv glad_debug_glTexParameterIiv
+#else
 #define glTexParameterIiv glad_glTexParameterIiv
+#endif
 typedef void (APIENTRYP PFNGLTEXPARAMETERIUIVPROC)(GLenum target, GLenum pname, const GLuint *params);
 GLAPI PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXPARAMETERIUIVPROC glad_debug_glTexParameterIuiv;
+#define glTexParameterIuiv glad_debug_glTexParameterIuiv
+#else
 #define glTexParameterIuiv glad_glTexParameterIuiv
+#endif
 typedef void (APIENTRYP PFNGLGETTEXPARAMETERIIVPROC)(GLenum target, GLenum pname, GLint *params);
 GLAPI PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETTEXPARAMETERIIVPROC glad_debug_glGetTexParameterIiv;
+#define glGetTexParameterIiv glad_debug_glGetTexParameterIiv
+#else
 #define glGetTexParameterIiv glad_glGetTexParameterIiv
+#endif
 typedef void (APIENTRYP PFNGLGETTEXPARAMETERIUIVPROC)(GLenum target, GLenum pname, GLuint *params);
 GLAPI PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETTEXPARAMETERIUIVPROC glad_debug_glGetTexParameterIuiv;
+#define glGetTexParameterIuiv glad_debug_glGetTexParameterIuiv
+#else
 #define glGetTexParameterIuiv glad_glGetTexParameterIuiv
+#endif
 typedef void (APIENTRYP PFNGLCLEARBUFFERIVPROC)(GLenum buffer, GLint drawbuffer, const GLint *value);
 GLAPI PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCLEARBUFFERIVPROC glad_debug_glClearBufferiv;
+#define glClearBufferiv glad_debug_glClearBufferiv
+#else
 #define glClearBufferiv glad_glClearBufferiv
+#endif
 typedef void (APIENTRYP PFNGLCLEARBUFFERUIVPROC)(GLenum buffer, GLint drawbuffer, const GLuint *value);
 GLAPI PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCLEARBUFFERUIVPROC glad_debug_glClearBufferuiv;
+#define glClearBufferuiv glad_debug_glClearBufferuiv
+#else
 #define glClearBufferuiv glad_glClearBufferuiv
+#endif
 typedef void (APIENTRYP PFNGLCLEARBUFFERFVPROC)(GLenum buffer, GLint drawbuffer, const GLfloat *value);
 GLAPI PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCLEARBUFFERFVPROC glad_debug_glClearBufferfv;
+#define glClearBufferfv glad_debug_glClearBufferfv
+#else
 #define glClearBufferfv glad_glClearBufferfv
+#endif
 typedef void (APIENTRYP PFNGLCLEARBUFFERFIPROC)(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil);
 GLAPI PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCLEARBUFFERFIPROC glad_debug_glClearBufferfi;
+#define glClearBufferfi glad_debug_glClearBufferfi
+#else
 #define glClearBufferfi glad_glClearBufferfi
+#endif
 typedef const GLubyte * (APIENTRYP PFNGLGETSTRINGIPROC)(GLenum name, GLuint index);
 GLAPI PFNGLGETSTRINGIPROC glad_glGetStringi;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSTRINGIPROC glad_debug_glGetStringi;
+#define glGetStringi glad_debug_glGetStringi
+#else
 #define glGetStringi glad_glGetStringi
+#endif
 typedef GLboolean (APIENTRYP PFNGLISRENDERBUFFERPROC)(GLuint renderbuffer);
 GLAPI PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISRENDERBUFFERPROC glad_debug_glIsRenderbuffer;
+#define glIsRenderbuffer glad_debug_glIsRenderbuffer
+#else
 #define glIsRenderbuffer glad_glIsRenderbuffer
+#endif
 typedef void (APIENTRYP PFNGLBINDRENDERBUFFERPROC)(GLenum target, GLuint renderbuffer);
 GLAPI PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDRENDERBUFFERPROC glad_debug_glBindRenderbuffer;
+#define glBindRenderbuffer glad_debug_glBindRenderbuffer
+#else
 #define glBindRenderbuffer glad_glBindRenderbuffer
+#endif
 typedef void (APIENTRYP PFNGLDELETERENDERBUFFERSPROC)(GLsizei n, const GLuint *renderbuffers);
 GLAPI PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETERENDERBUFFERSPROC glad_debug_glDeleteRenderbuffers;
+#define glDeleteRenderbuffers glad_debug_glDeleteRenderbuffers
+#else
 #define glDeleteRenderbuffers glad_glDeleteRenderbuffers
+#endif
 typedef void (APIENTRYP PFNGLGENRENDERBUFFERSPROC)(GLsizei n, GLuint *renderbuffers);
 GLAPI PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGENRENDERBUFFERSPROC glad_debug_glGenRenderbuffers;
+#define glGenRenderbuffers glad_debug_glGenRenderbuffers
+#else
 #define glGenRenderbuffers glad_glGenRenderbuffers
+#endif
 typedef void (APIENTRYP PFNGLRENDERBUFFERSTORAGEPROC)(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
 GLAPI PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLRENDERBUFFERSTORAGEPROC glad_debug_glRenderbufferStorage;
+#define glRenderbufferStorage glad_debug_glRenderbufferStorage
+#else
 #define glRenderbufferStorage glad_glRenderbufferStorage
+#endif
 typedef void (APIENTRYP PFNGLGETRENDERBUFFERPARAMETERIVPROC)(GLenum target, GLenum pname, GLint *params);
 GLAPI PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_debug_glGetRenderbufferParameteriv;
+#define glGetRenderbufferParameteriv glad_debug_glGetRenderbufferParameteriv
+#else
 #define glGetRenderbufferParameteriv glad_glGetRenderbufferParameteriv
+#endif
 typedef GLboolean (APIENTRYP PFNGLISFRAMEBUFFERPROC)(GLuint framebuffer);
 GLAPI PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISFRAMEBUFFERPROC glad_debug_glIsFramebuffer;
+#define glIsFramebuffer glad_debug_glIsFramebuffer
+#else
 #define glIsFramebuffer glad_glIsFramebuffer
+#endif
 typedef void (APIENTRYP PFNGLBINDFRAMEBUFFERPROC)(GLenum target, GLuint framebuffer);
 GLAPI PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDFRAMEBUFFERPROC glad_debug_glBindFramebuffer;
+#define glBindFramebuffer glad_debug_glBindFramebuffer
+#else
 #define glBindFramebuffer glad_glBindFramebuffer
+#endif
 typedef void (APIENTRYP PFNGLDELETEFRAMEBUFFERSPROC)(GLsizei n, const GLuint *framebuffers);
 GLAPI PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETEFRAMEBUFFERSPROC glad_debug_glDeleteFramebuffers;
+#define glDeleteFramebuffers glad_debug_glDeleteFramebuffers
+#else
 #define glDeleteFramebuffers glad_glDeleteFramebuffers
+#endif
 typedef void (APIENTRYP PFNGLGENFRAMEBUFFERSPROC)(GLsizei n, GLuint *framebuffers);
 GLAPI PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGENFRAMEBUFFERSPROC glad_debug_glGenFramebuffers;
+#define glGenFramebuffers glad_debug_glGenFramebuffers
+#else
 #define glGenFramebuffers glad_glGenFramebuffers
+#endif
 typedef GLenum (APIENTRYP PFNGLCHECKFRAMEBUFFERSTATUSPROC)(GLenum target);
 GLAPI PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_debug_glCheckFramebufferStatus;
+#define glCheckFramebufferStatus glad_debug_glCheckFramebufferStatus
+#else
 #define glCheckFramebufferStatus glad_glCheckFramebufferStatus
+#endif
 typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURE1DPROC)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
 GLAPI PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFRAMEBUFFERTEXTURE1DPROC glad_debug_glFramebufferTexture1D;
+#define glFramebufferTexture1D glad_debug_glFramebufferTexture1D
+#else
 #define glFramebufferTexture1D glad_glFramebufferTexture1D
+#endif
 typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURE2DPROC)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
 GLAPI PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFRAMEBUFFERTEXTURE2DPROC glad_debug_glFramebufferTexture2D;
+#define glFramebufferTexture2D glad_debug_glFramebufferTexture2D
+#else
 #define glFramebufferTexture2D glad_glFramebufferTexture2D
+#endif
 typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURE3DPROC)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset);
 GLAPI PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFRAMEBUFFERTEXTURE3DPROC glad_debug_glFramebufferTexture3D;
+#define glFramebufferTexture3D glad_debug_glFramebufferTexture3D
+#else
 #define glFramebufferTexture3D glad_glFramebufferTexture3D
+#endif
 typedef void (APIENTRYP PFNGLFRAMEBUFFERRENDERBUFFERPROC)(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
 GLAPI PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_debug_glFramebufferRenderbuffer;
+#define glFramebufferRenderbuffer glad_debug_glFramebufferRenderbuffer
+#else
 #define glFramebufferRenderbuffer glad_glFramebufferRenderbuffer
+#endif
 typedef void (APIENTRYP PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)(GLenum target, GLenum attachment, GLenum pname, GLint *params);
 GLAPI PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetFramebufferAttachmentParameteriv;
+#define glGetFramebufferAttachmentParameteriv glad_debug_glGetFramebufferAttachmentParameteriv
+#else
 #define glGetFramebufferAttachmentParameteriv glad_glGetFramebufferAttachmentParameteriv
+#endif
 typedef void (APIENTRYP PFNGLGENERATEMIPMAPPROC)(GLenum target);
 GLAPI PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGENERATEMIPMAPPROC glad_debug_glGenerateMipmap;
+#define glGenerateMipmap glad_debug_glGenerateMipmap
+#else
 #define glGenerateMipmap glad_glGenerateMipmap
+#endif
 typedef void (APIENTRYP PFNGLBLITFRAMEBUFFERPROC)(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
 GLAPI PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBLITFRAMEBUFFERPROC glad_debug_glBlitFramebuffer;
+#define glBlitFramebuffer glad_debug_glBlitFramebuffer
+#else
 #define glBlitFramebuffer glad_glBlitFramebuffer
+#endif
 typedef void (APIENTRYP PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height);
 GLAPI PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glRenderbufferStorageMultisample;
+#define glRenderbufferStorageMultisample glad_debug_glRenderbufferStorageMultisample
+#else
 #define glRenderbufferStorageMultisample glad_glRenderbufferStorageMultisample
+#endif
 typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURELAYERPROC)(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer);
 GLAPI PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_debug_glFramebufferTextureLayer;
+#define glFramebufferTextureLayer glad_debug_glFramebufferTextureLayer
+#else
 #define glFramebufferTextureLayer glad_glFramebufferTextureLayer
+#endif
 typedef void * (APIENTRYP PFNGLMAPBUFFERRANGEPROC)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
 GLAPI PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMAPBUFFERRANGEPROC glad_debug_glMapBufferRange;
+#define glMapBufferRange glad_debug_glMapBufferRange
+#else
 #define glMapBufferRange glad_glMapBufferRange
+#endif
 typedef void (APIENTRYP PFNGLFLUSHMAPPEDBUFFERRANGEPROC)(GLenum target, GLintptr offset, GLsizeiptr length);
 GLAPI PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_debug_glFlushMappedBufferRange;
+#define glFlushMappedBufferRange glad_debug_glFlushMappedBufferRange
+#else
 #define glFlushMappedBufferRange glad_glFlushMappedBufferRange
+#endif
 typedef void (APIENTRYP PFNGLBINDVERTEXARRAYPROC)(GLuint array);
 GLAPI PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDVERTEXARRAYPROC glad_debug_glBindVertexArray;
+#define glBindVertexArray glad_debug_glBindVertexArray
+#else
 #define glBindVertexArray glad_glBindVertexArray
+#endif
 typedef void (APIENTRYP PFNGLDELETEVERTEXARRAYSPROC)(GLsizei n, const GLuint *arrays);
 GLAPI PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETEVERTEXARRAYSPROC glad_debug_glDeleteVertexArrays;
+#define glDeleteVertexArrays glad_debug_glDeleteVertexArrays
+#else
 #define glDeleteVertexArrays glad_glDeleteVertexArrays
+#endif
 typedef void (APIENTRYP PFNGLGENVERTEXARRAYSPROC)(GLsizei n, GLuint *arrays);
 GLAPI PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGENVERTEXARRAYSPROC glad_debug_glGenVertexArrays;
+#define glGenVertexArrays glad_debug_glGenVertexArrays
+#else
 #define glGenVertexArrays glad_glGenVertexArrays
+#endif
 typedef GLboolean (APIENTRYP PFNGLISVERTEXARRAYPROC)(GLuint array);
 GLAPI PFNGLISVERTEXARRAYPROC glad_glIsVertexArray;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISVERTEXARRAYPROC glad_debug_glIsVertexArray;
+#define glIsVertexArray glad_debug_glIsVertexArray
+#else
 #define glIsVertexArray glad_glIsVertexArray
 #endif
+#endif
 #ifndef GL_VERSION_3_1
 #define GL_VERSION_3_1 1
 GLAPI int GLAD_GL_VERSION_3_1;
 typedef void (APIENTRYP PFNGLDRAWARRAYSINSTANCEDPROC)(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
 GLAPI PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWARRAYSINSTANCEDPROC glad_debug_glDrawArraysInstanced;
+#define glDrawArraysInstanced glad_debug_glDrawArraysInstanced
+#else
 #define glDrawArraysInstanced glad_glDrawArraysInstanced
+#endif
 typedef void (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
 GLAPI PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWELEMENTSINSTANCEDPROC glad_debug_glDrawElementsInstanced;
+#define glDrawElementsInstanced glad_debug_glDrawElementsInstanced
+#else
 #define glDrawElementsInstanced glad_glDrawElementsInstanced
+#endif
 typedef void (APIENTRYP PFNGLTEXBUFFERPROC)(GLenum target, GLenum internalformat, GLuint buffer);
 GLAPI PFNGLTEXBUFFERPROC glad_glTexBuffer;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXBUFFERPROC glad_debug_glTexBuffer;
+#define glTexBuffer glad_debug_glTexBuffer
+#else
 #define glTexBuffer glad_glTexBuffer
+#endif
 typedef void (APIENTRYP PFNGLPRIMITIVERESTARTINDEXPROC)(GLuint index);
 GLAPI PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPRIMITIVERESTARTINDEXPROC glad_debug_glPrimitiveRestartIndex;
+#define glPrimitiveRestartIndex glad_debug_glPrimitiveRestartIndex
+#else
 #define glPrimitiveRestartIndex glad_glPrimitiveRestartIndex
+#endif
 typedef void (APIENTRYP PFNGLCOPYBUFFERSUBDATAPROC)(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
 GLAPI PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOPYBUFFERSUBDATAPROC glad_debug_glCopyBufferSubData;
+#define glCopyBufferSubData glad_debug_glCopyBufferSubData
+#else
 #define glCopyBufferSubData glad_glCopyBufferSubData
+#endif
 typedef void (APIENTRYP PFNGLGETUNIFORMINDICESPROC)(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices);
 GLAPI PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETUNIFORMINDICESPROC glad_debug_glGetUniformIndices;
+#define glGetUniformIndices glad_debug_glGetUniformIndices
+#else
 #define glGetUniformIndices glad_glGetUniformIndices
+#endif
 typedef void (APIENTRYP PFNGLGETACTIVEUNIFORMSIVPROC)(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params);
 GLAPI PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETACTIVEUNIFORMSIVPROC glad_debug_glGetActiveUniformsiv;
+#define glGetActiveUniformsiv glad_debug_glGetActiveUniformsiv
+#else
 #define glGetActiveUniformsiv glad_glGetActiveUniformsiv
+#endif
 typedef void (APIENTRYP PFNGLGETACTIVEUNIFORMNAMEPROC)(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName);
 GLAPI PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETACTIVEUNIFORMNAMEPROC glad_debug_glGetActiveUniformName;
+#define glGetActiveUniformName glad_debug_glGetActiveUniformName
+#else
 #define glGetActiveUniformName glad_glGetActiveUniformName
+#endif
 typedef GLuint (APIENTRYP PFNGLGETUNIFORMBLOCKINDEXPROC)(GLuint program, const GLchar *uniformBlockName);
 GLAPI PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETUNIFORMBLOCKINDEXPROC glad_debug_glGetUniformBlockIndex;
+#define glGetUniformBlockIndex glad_debug_glGetUniformBlockIndex
+#else
 #define glGetUniformBlockIndex glad_glGetUniformBlockIndex
+#endif
 typedef void (APIENTRYP PFNGLGETACTIVEUNIFORMBLOCKIVPROC)(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params);
 GLAPI PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_debug_glGetActiveUniformBlockiv;
+#define glGetActiveUniformBlockiv glad_debug_glGetActiveUniformBlockiv
+#else
 #define glGetActiveUniformBlockiv glad_glGetActiveUniformBlockiv
+#endif
 typedef void (APIENTRYP PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName);
 GLAPI PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_debug_glGetActiveUniformBlockName;
+#define glGetActiveUniformBlockName glad_debug_glGetActiveUniformBlockName
+#else
 #define glGetActiveUniformBlockName glad_glGetActiveUniformBlockName
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMBLOCKBINDINGPROC)(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
 GLAPI PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMBLOCKBINDINGPROC glad_debug_glUniformBlockBinding;
+#define glUniformBlockBinding glad_debug_glUniformBlockBinding
+#else
 #define glUniformBlockBinding glad_glUniformBlockBinding
 #endif
+#endif
 #ifndef GL_VERSION_3_2
 #define GL_VERSION_3_2 1
 GLAPI int GLAD_GL_VERSION_3_2;
 typedef void (APIENTRYP PFNGLDRAWELEMENTSBASEVERTEXPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
 GLAPI PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWELEMENTSBASEVERTEXPROC glad_debug_glDrawElementsBaseVertex;
+#define glDrawElementsBaseVertex glad_debug_glDrawElementsBaseVertex
+#else
 #define glDrawElementsBaseVertex glad_glDrawElementsBaseVertex
+#endif
 typedef void (APIENTRYP PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex);
 GLAPI PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_debug_glDrawRangeElementsBaseVertex;
+#define glDrawRangeElementsBaseVertex glad_debug_glDrawRangeElementsBaseVertex
+#else
 #define glDrawRangeElementsBaseVertex glad_glDrawRangeElementsBaseVertex
+#endif
 typedef void (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex);
 GLAPI PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_debug_glDrawElementsInstancedBaseVertex;
+#define glDrawElementsInstancedBaseVertex glad_debug_glDrawElementsInstancedBaseVertex
+#else
 #define glDrawElementsInstancedBaseVertex glad_glDrawElementsInstancedBaseVertex
+#endif
 typedef void (APIENTRYP PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex);
 GLAPI PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_debug_glMultiDrawElementsBaseVertex;
+#define glMultiDrawElementsBaseVertex glad_debug_glMultiDrawElementsBaseVertex
+#else
 #define glMultiDrawElementsBaseVertex glad_glMultiDrawElementsBaseVertex
+#endif
 typedef void (APIENTRYP PFNGLPROVOKINGVERTEXPROC)(GLenum mode);
 GLAPI PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPROVOKINGVERTEXPROC glad_debug_glProvokingVertex;
+#define glProvokingVertex glad_debug_glProvokingVertex
+#else
 #define glProvokingVertex glad_glProvokingVertex
+#endif
 typedef GLsync (APIENTRYP PFNGLFENCESYNCPROC)(GLenum condition, GLbitfield flags);
 GLAPI PFNGLFENCESYNCPROC glad_glFenceSync;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFENCESYNCPROC glad_debug_glFenceSync;
+#define glFenceSync glad_debug_glFenceSync
+#else
 #define glFenceSync glad_glFenceSync
+#endif
 typedef GLboolean (APIENTRYP PFNGLISSYNCPROC)(GLsync sync);
 GLAPI PFNGLISSYNCPROC glad_glIsSync;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISSYNCPROC glad_debug_glIsSync;
+#define glIsSync glad_debug_glIsSync
+#else
 #define glIsSync glad_glIsSync
+#endif
 typedef void (APIENTRYP PFNGLDELETESYNCPROC)(GLsync sync);
 GLAPI PFNGLDELETESYNCPROC glad_glDeleteSync;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETESYNCPROC glad_debug_glDeleteSync;
+#define glDeleteSync glad_debug_glDeleteSync
+#else
 #define glDeleteSync glad_glDeleteSync
+#endif
 typedef GLenum (APIENTRYP PFNGLCLIENTWAITSYNCPROC)(GLsync sync, GLbitfield flags, GLuint64 timeout);
 GLAPI PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCLIENTWAITSYNCPROC glad_debug_glClientWaitSync;
+#define glClientWaitSync glad_debug_glClientWaitSync
+#else
 #define glClientWaitSync glad_glClientWaitSync
+#endif
 typedef void (APIENTRYP PFNGLWAITSYNCPROC)(GLsync sync, GLbitfield flags, GLuint64 timeout);
 GLAPI PFNGLWAITSYNCPROC glad_glWaitSync;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLWAITSYNCPROC glad_debug_glWaitSync;
+#define glWaitSync glad_debug_glWaitSync
+#else
 #define glWaitSync glad_glWaitSync
+#endif
 typedef void (APIENTRYP PFNGLGETINTEGER64VPROC)(GLenum pname, GLint64 *data);
 GLAPI PFNGLGETINTEGER64VPROC glad_glGetInteger64v;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETINTEGER64VPROC glad_debug_glGetInteger64v;
+#define glGetInteger64v glad_debug_glGetInteger64v
+#else
 #define glGetInteger64v glad_glGetInteger64v
+#endif
 typedef void (APIENTRYP PFNGLGETSYNCIVPROC)(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values);
 GLAPI PFNGLGETSYNCIVPROC glad_glGetSynciv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSYNCIVPROC glad_debug_glGetSynciv;
+#define glGetSynciv glad_debug_glGetSynciv
+#else
 #define glGetSynciv glad_glGetSynciv
+#endif
 typedef void (APIENTRYP PFNGLGETINTEGER64I_VPROC)(GLenum target, GLuint index, GLint64 *data);
 GLAPI PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETINTEGER64I_VPROC glad_debug_glGetInteger64i_v;
+#define glGetInteger64i_v glad_debug_glGetInteger64i_v
+#else
 #define glGetInteger64i_v glad_glGetInteger64i_v
+#endif
 typedef void (APIENTRYP PFNGLGETBUFFERPARAMETERI64VPROC)(GLenum target, GLenum pname, GLint64 *params);
 GLAPI PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETBUFFERPARAMETERI64VPROC glad_debug_glGetBufferParameteri64v;
+#define glGetBufferParameteri64v glad_debug_glGetBufferParameteri64v
+#else
 #define glGetBufferParameteri64v glad_glGetBufferParameteri64v
+#endif
 typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTUREPROC)(GLenum target, GLenum attachment, GLuint texture, GLint level);
 GLAPI PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLFRAMEBUFFERTEXTUREPROC glad_debug_glFramebufferTexture;
+#define glFramebufferTexture glad_debug_glFramebufferTexture
+#else
 #define glFramebufferTexture glad_glFramebufferTexture
+#endif
 typedef void (APIENTRYP PFNGLTEXIMAGE2DMULTISAMPLEPROC)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);
 GLAPI PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_debug_glTexImage2DMultisample;
+#define glTexImage2DMultisample glad_debug_glTexImage2DMultisample
+#else
 #define glTexImage2DMultisample glad_glTexImage2DMultisample
+#endif
 typedef void (APIENTRYP PFNGLTEXIMAGE3DMULTISAMPLEPROC)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);
 GLAPI PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_debug_glTexImage3DMultisample;
+#define glTexImage3DMultisample glad_debug_glTexImage3DMultisample
+#else
 #define glTexImage3DMultisample glad_glTexImage3DMultisample
+#endif
 typedef void (APIENTRYP PFNGLGETMULTISAMPLEFVPROC)(GLenum pname, GLuint index, GLfloat *val);
 GLAPI PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETMULTISAMPLEFVPROC glad_debug_glGetMultisamplefv;
+#define glGetMultisamplefv glad_debug_glGetMultisamplefv
+#else
 #define glGetMultisamplefv glad_glGetMultisamplefv
+#endif
 typedef void (APIENTRYP PFNGLSAMPLEMASKIPROC)(GLuint maskNumber, GLbitfield mask);
 GLAPI PFNGLSAMPLEMASKIPROC glad_glSampleMaski;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSAMPLEMASKIPROC glad_debug_glSampleMaski;
+#define glSampleMaski glad_debug_glSampleMaski
+#else
 #define glSampleMaski glad_glSampleMaski
 #endif
+#endif
 #ifndef GL_VERSION_3_3
 #define GL_VERSION_3_3 1
 GLAPI int GLAD_GL_VERSION_3_3;
 typedef void (APIENTRYP PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name);
 GLAPI PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_debug_glBindFragDataLocationIndexed;
+#define glBindFragDataLocationIndexed glad_debug_glBindFragDataLocationIndexed
+#else
 #define glBindFragDataLocationIndexed glad_glBindFragDataLocationIndexed
+#endif
 typedef GLint (APIENTRYP PFNGLGETFRAGDATAINDEXPROC)(GLuint program, const GLchar *name);
 GLAPI PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETFRAGDATAINDEXPROC glad_debug_glGetFragDataIndex;
+#define glGetFragDataIndex glad_debug_glGetFragDataIndex
+#else
 #define glGetFragDataIndex glad_glGetFragDataIndex
+#endif
 typedef void (APIENTRYP PFNGLGENSAMPLERSPROC)(GLsizei count, GLuint *samplers);
 GLAPI PFNGLGENSAMPLERSPROC glad_glGenSamplers;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGENSAMPLERSPROC glad_debug_glGenSamplers;
+#define glGenSamplers glad_debug_glGenSamplers
+#else
 #define glGenSamplers glad_glGenSamplers
+#endif
 typedef void (APIENTRYP PFNGLDELETESAMPLERSPROC)(GLsizei count, const GLuint *samplers);
 GLAPI PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETESAMPLERSPROC glad_debug_glDeleteSamplers;
+#define glDeleteSamplers glad_debug_glDeleteSamplers
+#else
 #define glDeleteSamplers glad_glDeleteSamplers
+#endif
 typedef GLboolean (APIENTRYP PFNGLISSAMPLERPROC)(GLuint sampler);
 GLAPI PFNGLISSAMPLERPROC glad_glIsSampler;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISSAMPLERPROC glad_debug_glIsSampler;
+#define glIsSampler glad_debug_glIsSampler
+#else
 #define glIsSampler glad_glIsSampler
+#endif
 typedef void (APIENTRYP PFNGLBINDSAMPLERPROC)(GLuint unit, GLuint sampler);
 GLAPI PFNGLBINDSAMPLERPROC glad_glBindSampler;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDSAMPLERPROC glad_debug_glBindSampler;
+#define glBindSampler glad_debug_glBindSampler
+#else
 #define glBindSampler glad_glBindSampler
+#endif
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERIPROC)(GLuint sampler, GLenum pname, GLint param);
 GLAPI PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSAMPLERPARAMETERIPROC glad_debug_glSamplerParameteri;
+#define glSamplerParameteri glad_debug_glSamplerParameteri
+#else
 #define glSamplerParameteri glad_glSamplerParameteri
+#endif
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERIVPROC)(GLuint sampler, GLenum pname, const GLint *param);
 GLAPI PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSAMPLERPARAMETERIVPROC glad_debug_glSamplerParameteriv;
+#define glSamplerParameteriv glad_debug_glSamplerParameteriv
+#else
 #define glSamplerParameteriv glad_glSamplerParameteriv
+#endif
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERFPROC)(GLuint sampler, GLenum pname, GLfloat param);
 GLAPI PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSAMPLERPARAMETERFPROC glad_debug_glSamplerParameterf;
+#define glSamplerParameterf glad_debug_glSamplerParameterf
+#else
 #define glSamplerParameterf glad_glSamplerParameterf
+#endif
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERFVPROC)(GLuint sampler, GLenum pname, const GLfloat *param);
 GLAPI PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSAMPLERPARAMETERFVPROC glad_debug_glSamplerParameterfv;
+#define glSamplerParameterfv glad_debug_glSamplerParameterfv
+#else
 #define glSamplerParameterfv glad_glSamplerParameterfv
+#endif
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERIIVPROC)(GLuint sampler, GLenum pname, const GLint *param);
 GLAPI PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSAMPLERPARAMETERIIVPROC glad_debug_glSamplerParameterIiv;
+#define glSamplerParameterIiv glad_debug_glSamplerParameterIiv
+#else
 #define glSamplerParameterIiv glad_glSamplerParameterIiv
+#endif
 typedef void (APIENTRYP PFNGLSAMPLERPARAMETERIUIVPROC)(GLuint sampler, GLenum pname, const GLuint *param);
 GLAPI PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSAMPLERPARAMETERIUIVPROC glad_debug_glSamplerParameterIuiv;
+#define glSamplerParameterIuiv glad_debug_glSamplerParameterIuiv
+#else
 #define glSamplerParameterIuiv glad_glSamplerParameterIuiv
+#endif
 typedef void (APIENTRYP PFNGLGETSAMPLERPARAMETERIVPROC)(GLuint sampler, GLenum pname, GLint *params);
 GLAPI PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSAMPLERPARAMETERIVPROC glad_debug_glGetSamplerParameteriv;
+#define glGetSamplerParameteriv glad_debug_glGetSamplerParameteriv
+#else
 #define glGetSamplerParameteriv glad_glGetSamplerParameteriv
+#endif
 typedef void (APIENTRYP PFNGLGETSAMPLERPARAMETERIIVPROC)(GLuint sampler, GLenum pname, GLint *params);
 GLAPI PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSAMPLERPARAMETERIIVPROC glad_debug_glGetSamplerParameterIiv;
+#define glGetSamplerParameterIiv glad_debug_glGetSamplerParameterIiv
+#else
 #define glGetSamplerParameterIiv glad_glGetSamplerParameterIiv
+#endif
 typedef void (APIENTRYP PFNGLGETSAMPLERPARAMETERFVPROC)(GLuint sampler, GLenum pname, GLfloat *params);
 GLAPI PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSAMPLERPARAMETERFVPROC glad_debug_glGetSamplerParameterfv;
+#define glGetSamplerParameterfv glad_debug_glGetSamplerParameterfv
+#else
 #define glGetSamplerParameterfv glad_glGetSamplerParameterfv
+#endif
 typedef void (APIENTRYP PFNGLGETSAMPLERPARAMETERIUIVPROC)(GLuint sampler, GLenum pname, GLuint *params);
 GLAPI PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSAMPLERPARAMETERIUIVPROC glad_debug_glGetSamplerParameterIuiv;
+#define glGetSamplerParameterIuiv glad_debug_glGetSamplerParameterIuiv
+#else
 #define glGetSamplerParameterIuiv glad_glGetSamplerParameterIuiv
+#endif
 typedef void (APIENTRYP PFNGLQUERYCOUNTERPROC)(GLuint id, GLenum target);
 GLAPI PFNGLQUERYCOUNTERPROC glad_glQueryCounter;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLQUERYCOUNTERPROC glad_debug_glQueryCounter;
+#define glQueryCounter glad_debug_glQueryCounter
+#else
 #define glQueryCounter glad_glQueryCounter
+#endif
 typedef void (APIENTRYP PFNGLGETQUERYOBJECTI64VPROC)(GLuint id, GLenum pname, GLint64 *params);
 GLAPI PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETQUERYOBJECTI64VPROC glad_debug_glGetQueryObjecti64v;
+#define glGetQueryObjecti64v glad_debug_glGetQueryObjecti64v
+#else
 #define glGetQueryObjecti64v glad_glGetQueryObjecti64v
+#endif
 typedef void (APIENTRYP PFNGLGETQUERYOBJECTUI64VPROC)(GLuint id, GLenum pname, GLuint64 *params);
 GLAPI PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETQUERYOBJECTUI64VPROC glad_debug_glGetQueryObjectui64v;
+#define glGetQueryObjectui64v glad_debug_glGetQueryObjectui64v
+#else
 #define glGetQueryObjectui64v glad_glGetQueryObjectui64v
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBDIVISORPROC)(GLuint index, GLuint divisor);
 GLAPI PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBDIVISORPROC glad_debug_glVertexAttribDivisor;
+#define glVertexAttribDivisor glad_debug_glVertexAttribDivisor
+#else
 #define glVertexAttribDivisor glad_glVertexAttribDivisor
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP1UIPROC)(GLuint index, GLenum type, GLboolean normalized, GLuint value);
 GLAPI PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBP1UIPROC glad_debug_glVertexAttribP1ui;
+#define glVertexAttribP1ui glad_debug_glVertexAttribP1ui
+#else
 #define glVertexAttribP1ui glad_glVertexAttribP1ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP1UIVPROC)(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 GLAPI PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBP1UIVPROC glad_debug_glVertexAttribP1uiv;
+#define glVertexAttribP1uiv glad_debug_glVertexAttribP1uiv
+#else
 #define glVertexAttribP1uiv glad_glVertexAttribP1uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP2UIPROC)(GLuint index, GLenum type, GLboolean normalized, GLuint value);
 GLAPI PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBP2UIPROC glad_debug_glVertexAttribP2ui;
+#define glVertexAttribP2ui glad_debug_glVertexAttribP2ui
+#else
 #define glVertexAttribP2ui glad_glVertexAttribP2ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP2UIVPROC)(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 GLAPI PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBP2UIVPROC glad_debug_glVertexAttribP2uiv;
+#define glVertexAttribP2uiv glad_debug_glVertexAttribP2uiv
+#else
 #define glVertexAttribP2uiv glad_glVertexAttribP2uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP3UIPROC)(GLuint index, GLenum type, GLboolean normalized, GLuint value);
 GLAPI PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBP3UIPROC glad_debug_glVertexAttribP3ui;
+#define glVertexAttribP3ui glad_debug_glVertexAttribP3ui
+#else
 #define glVertexAttribP3ui glad_glVertexAttribP3ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP3UIVPROC)(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 GLAPI PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBP3UIVPROC glad_debug_glVertexAttribP3uiv;
+#define glVertexAttribP3uiv glad_debug_glVertexAttribP3uiv
+#else
 #define glVertexAttribP3uiv glad_glVertexAttribP3uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP4UIPROC)(GLuint index, GLenum type, GLboolean normalized, GLuint value);
 GLAPI PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBP4UIPROC glad_debug_glVertexAttribP4ui;
+#define glVertexAttribP4ui glad_debug_glVertexAttribP4ui
+#else
 #define glVertexAttribP4ui glad_glVertexAttribP4ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXATTRIBP4UIVPROC)(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 GLAPI PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXATTRIBP4UIVPROC glad_debug_glVertexAttribP4uiv;
+#define glVertexAttribP4uiv glad_debug_glVertexAttribP4uiv
+#else
 #define glVertexAttribP4uiv glad_glVertexAttribP4uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXP2UIPROC)(GLenum type, GLuint value);
 GLAPI PFNGLVERTEXP2UIPROC glad_glVertexP2ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXP2UIPROC glad_debug_glVertexP2ui;
+#define glVertexP2ui glad_debug_glVertexP2ui
+#else
 #define glVertexP2ui glad_glVertexP2ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXP2UIVPROC)(GLenum type, const GLuint *value);
 GLAPI PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXP2UIVPROC glad_debug_glVertexP2uiv;
+#define glVertexP2uiv glad_debug_glVertexP2uiv
+#else
 #define glVertexP2uiv glad_glVertexP2uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXP3UIPROC)(GLenum type, GLuint value);
 GLAPI PFNGLVERTEXP3UIPROC glad_glVertexP3ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXP3UIPROC glad_debug_glVertexP3ui;
+#define glVertexP3ui glad_debug_glVertexP3ui
+#else
 #define glVertexP3ui glad_glVertexP3ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXP3UIVPROC)(GLenum type, const GLuint *value);
 GLAPI PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXP3UIVPROC glad_debug_glVertexP3uiv;
+#define glVertexP3uiv glad_debug_glVertexP3uiv
+#else
 #define glVertexP3uiv glad_glVertexP3uiv
+#endif
 typedef void (APIENTRYP PFNGLVERTEXP4UIPROC)(GLenum type, GLuint value);
 GLAPI PFNGLVERTEXP4UIPROC glad_glVertexP4ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXP4UIPROC glad_debug_glVertexP4ui;
+#define glVertexP4ui glad_debug_glVertexP4ui
+#else
 #define glVertexP4ui glad_glVertexP4ui
+#endif
 typedef void (APIENTRYP PFNGLVERTEXP4UIVPROC)(GLenum type, const GLuint *value);
 GLAPI PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLVERTEXP4UIVPROC glad_debug_glVertexP4uiv;
+#define glVertexP4uiv glad_debug_glVertexP4uiv
+#else
 #define glVertexP4uiv glad_glVertexP4uiv
+#endif
 typedef void (APIENTRYP PFNGLTEXCOORDP1UIPROC)(GLenum type, GLuint coords);
 GLAPI PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXCOORDP1UIPROC glad_debug_glTexCoordP1ui;
+#define glTexCoordP1ui glad_debug_glTexCoordP1ui
+#else
 #define glTexCoordP1ui glad_glTexCoordP1ui
+#endif
 typedef void (APIENTRYP PFNGLTEXCOORDP1UIVPROC)(GLenum type, const GLuint *coords);
 GLAPI PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXCOORDP1UIVPROC glad_debug_glTexCoordP1uiv;
+#define glTexCoordP1uiv glad_debug_glTexCoordP1uiv
+#else
 #define glTexCoordP1uiv glad_glTexCoordP1uiv
+#endif
 typedef void (APIENTRYP PFNGLTEXCOORDP2UIPROC)(GLenum type, GLuint coords);
 GLAPI PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXCOORDP2UIPROC glad_debug_glTexCoordP2ui;
+#define glTexCoordP2ui glad_debug_glTexCoordP2ui
+#else
 #define glTexCoordP2ui glad_glTexCoordP2ui
+#endif
 typedef void (APIENTRYP PFNGLTEXCOORDP2UIVPROC)(GLenum type, const GLuint *coords);
 GLAPI PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXCOORDP2UIVPROC glad_debug_glTexCoordP2uiv;
+#define glTexCoordP2uiv glad_debug_glTexCoordP2uiv
+#else
 #define glTexCoordP2uiv glad_glTexCoordP2uiv
+#endif
 typedef void (APIENTRYP PFNGLTEXCOORDP3UIPROC)(GLenum type, GLuint coords);
 GLAPI PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXCOORDP3UIPROC glad_debug_glTexCoordP3ui;
+#define glTexCoordP3ui glad_debug_glTexCoordP3ui
+#else
 #define glTexCoordP3ui glad_glTexCoordP3ui
+#endif
 typedef void (APIENTRYP PFNGLTEXCOORDP3UIVPROC)(GLenum type, const GLuint *coords);
 GLAPI PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXCOORDP3UIVPROC glad_debug_glTexCoordP3uiv;
+#define glTexCoordP3uiv glad_debug_glTexCoordP3uiv
+#else
 #define glTexCoordP3uiv glad_glTexCoordP3uiv
+#endif
 typedef void (APIENTRYP PFNGLTEXCOORDP4UIPROC)(GLenum type, GLuint coords);
 GLAPI PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXCOORDP4UIPROC glad_debug_glTexCoordP4ui;
+#define glTexCoordP4ui glad_debug_glTexCoordP4ui
+#else
 #define glTexCoordP4ui glad_glTexCoordP4ui
+#endif
 typedef void (APIENTRYP PFNGLTEXCOORDP4UIVPROC)(GLenum type, const GLuint *coords);
 GLAPI PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLTEXCOORDP4UIVPROC glad_debug_glTexCoordP4uiv;
+#define glTexCoordP4uiv glad_debug_glTexCoordP4uiv
+#else
 #define glTexCoordP4uiv glad_glTexCoordP4uiv
+#endif
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP1UIPROC)(GLenum texture, GLenum type, GLuint coords);
 GLAPI PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTITEXCOORDP1UIPROC glad_debug_glMultiTexCoordP1ui;
+#define glMultiTexCoordP1ui glad_debug_glMultiTexCoordP1ui
+#else
 #define glMultiTexCoordP1ui glad_glMultiTexCoordP1ui
+#endif
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP1UIVPROC)(GLenum texture, GLenum type, const GLuint *coords);
 GLAPI PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTITEXCOORDP1UIVPROC glad_debug_glMultiTexCoordP1uiv;
+#define glMultiTexCoordP1uiv glad_debug_glMultiTexCoordP1uiv
+#else
 #define glMultiTexCoordP1uiv glad_glMultiTexCoordP1uiv
+#endif
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP2UIPROC)(GLenum texture, GLenum type, GLuint coords);
 GLAPI PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTITEXCOORDP2UIPROC glad_debug_glMultiTexCoordP2ui;
+#define glMultiTexCoordP2ui glad_debug_glMultiTexCoordP2ui
+#else
 #define glMultiTexCoordP2ui glad_glMultiTexCoordP2ui
+#endif
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP2UIVPROC)(GLenum texture, GLenum type, const GLuint *coords);
 GLAPI PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTITEXCOORDP2UIVPROC glad_debug_glMultiTexCoordP2uiv;
+#define glMultiTexCoordP2uiv glad_debug_glMultiTexCoordP2uiv
+#else
 #define glMultiTexCoordP2uiv glad_glMultiTexCoordP2uiv
+#endif
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP3UIPROC)(GLenum texture, GLenum type, GLuint coords);
 GLAPI PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTITEXCOORDP3UIPROC glad_debug_glMultiTexCoordP3ui;
+#define glMultiTexCoordP3ui glad_debug_glMultiTexCoordP3ui
+#else
 #define glMultiTexCoordP3ui glad_glMultiTexCoordP3ui
+#endif
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP3UIVPROC)(GLenum texture, GLenum type, const GLuint *coords);
 GLAPI PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTITEXCOORDP3UIVPROC glad_debug_glMultiTexCoordP3uiv;
+#define glMultiTexCoordP3uiv glad_debug_glMultiTexCoordP3uiv
+#else
 #define glMultiTexCoordP3uiv glad_glMultiTexCoordP3uiv
+#endif
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP4UIPROC)(GLenum texture, GLenum type, GLuint coords);
 GLAPI PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTITEXCOORDP4UIPROC glad_debug_glMultiTexCoordP4ui;
+#define glMultiTexCoordP4ui glad_debug_glMultiTexCoordP4ui
+#else
 #define glMultiTexCoordP4ui glad_glMultiTexCoordP4ui
+#endif
 typedef void (APIENTRYP PFNGLMULTITEXCOORDP4UIVPROC)(GLenum texture, GLenum type, const GLuint *coords);
 GLAPI PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMULTITEXCOORDP4UIVPROC glad_debug_glMultiTexCoordP4uiv;
+#define glMultiTexCoordP4uiv glad_debug_glMultiTexCoordP4uiv
+#else
 #define glMultiTexCoordP4uiv glad_glMultiTexCoordP4uiv
+#endif
 typedef void (APIENTRYP PFNGLNORMALP3UIPROC)(GLenum type, GLuint coords);
 GLAPI PFNGLNORMALP3UIPROC glad_glNormalP3ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLNORMALP3UIPROC glad_debug_glNormalP3ui;
+#define glNormalP3ui glad_debug_glNormalP3ui
+#else
 #define glNormalP3ui glad_glNormalP3ui
+#endif
 typedef void (APIENTRYP PFNGLNORMALP3UIVPROC)(GLenum type, const GLuint *coords);
 GLAPI PFNGLNORMALP3UIVPROC glad_glNormalP3uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLNORMALP3UIVPROC glad_debug_glNormalP3uiv;
+#define glNormalP3uiv glad_debug_glNormalP3uiv
+#else
 #define glNormalP3uiv glad_glNormalP3uiv
+#endif
 typedef void (APIENTRYP PFNGLCOLORP3UIPROC)(GLenum type, GLuint color);
 GLAPI PFNGLCOLORP3UIPROC glad_glColorP3ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOLORP3UIPROC glad_debug_glColorP3ui;
+#define glColorP3ui glad_debug_glColorP3ui
+#else
 #define glColorP3ui glad_glColorP3ui
+#endif
 typedef void (APIENTRYP PFNGLCOLORP3UIVPROC)(GLenum type, const GLuint *color);
 GLAPI PFNGLCOLORP3UIVPROC glad_glColorP3uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOLORP3UIVPROC glad_debug_glColorP3uiv;
+#define glColorP3uiv glad_debug_glColorP3uiv
+#else
 #define glColorP3uiv glad_glColorP3uiv
+#endif
 typedef void (APIENTRYP PFNGLCOLORP4UIPROC)(GLenum type, GLuint color);
 GLAPI PFNGLCOLORP4UIPROC glad_glColorP4ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOLORP4UIPROC glad_debug_glColorP4ui;
+#define glColorP4ui glad_debug_glColorP4ui
+#else
 #define glColorP4ui glad_glColorP4ui
+#endif
 typedef void (APIENTRYP PFNGLCOLORP4UIVPROC)(GLenum type, const GLuint *color);
 GLAPI PFNGLCOLORP4UIVPROC glad_glColorP4uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLCOLORP4UIVPROC glad_debug_glColorP4uiv;
+#define glColorP4uiv glad_debug_glColorP4uiv
+#else
 #define glColorP4uiv glad_glColorP4uiv
+#endif
 typedef void (APIENTRYP PFNGLSECONDARYCOLORP3UIPROC)(GLenum type, GLuint color);
 GLAPI PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSECONDARYCOLORP3UIPROC glad_debug_glSecondaryColorP3ui;
+#define glSecondaryColorP3ui glad_debug_glSecondaryColorP3ui
+#else
 #define glSecondaryColorP3ui glad_glSecondaryColorP3ui
+#endif
 typedef void (APIENTRYP PFNGLSECONDARYCOLORP3UIVPROC)(GLenum type, const GLuint *color);
 GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_debug_glSecondaryColorP3uiv;
+#define glSecondaryColorP3uiv glad_debug_glSecondaryColorP3uiv
+#else
 #define glSecondaryColorP3uiv glad_glSecondaryColorP3uiv
 #endif
+#endif
 #ifndef GL_VERSION_4_0
 #define GL_VERSION_4_0 1
 GLAPI int GLAD_GL_VERSION_4_0;
 typedef void (APIENTRYP PFNGLMINSAMPLESHADINGPROC)(GLfloat value);
 GLAPI PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLMINSAMPLESHADINGPROC glad_debug_glMinSampleShading;
+#define glMinSampleShading glad_debug_glMinSampleShading
+#else
 #define glMinSampleShading glad_glMinSampleShading
+#endif
 typedef void (APIENTRYP PFNGLBLENDEQUATIONIPROC)(GLuint buf, GLenum mode);
 GLAPI PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBLENDEQUATIONIPROC glad_debug_glBlendEquationi;
+#define glBlendEquationi glad_debug_glBlendEquationi
+#else
 #define glBlendEquationi glad_glBlendEquationi
+#endif
 typedef void (APIENTRYP PFNGLBLENDEQUATIONSEPARATEIPROC)(GLuint buf, GLenum modeRGB, GLenum modeAlpha);
 GLAPI PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBLENDEQUATIONSEPARATEIPROC glad_debug_glBlendEquationSeparatei;
+#define glBlendEquationSeparatei glad_debug_glBlendEquationSeparatei
+#else
 #define glBlendEquationSeparatei glad_glBlendEquationSeparatei
+#endif
 typedef void (APIENTRYP PFNGLBLENDFUNCIPROC)(GLuint buf, GLenum src, GLenum dst);
 GLAPI PFNGLBLENDFUNCIPROC glad_glBlendFunci;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBLENDFUNCIPROC glad_debug_glBlendFunci;
+#define glBlendFunci glad_debug_glBlendFunci
+#else
 #define glBlendFunci glad_glBlendFunci
+#endif
 typedef void (APIENTRYP PFNGLBLENDFUNCSEPARATEIPROC)(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
 GLAPI PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBLENDFUNCSEPARATEIPROC glad_debug_glBlendFuncSeparatei;
+#define glBlendFuncSeparatei glad_debug_glBlendFuncSeparatei
+#else
 #define glBlendFuncSeparatei glad_glBlendFuncSeparatei
+#endif
 typedef void (APIENTRYP PFNGLDRAWARRAYSINDIRECTPROC)(GLenum mode, const void *indirect);
 GLAPI PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWARRAYSINDIRECTPROC glad_debug_glDrawArraysIndirect;
+#define glDrawArraysIndirect glad_debug_glDrawArraysIndirect
+#else
 #define glDrawArraysIndirect glad_glDrawArraysIndirect
+#endif
 typedef void (APIENTRYP PFNGLDRAWELEMENTSINDIRECTPROC)(GLenum mode, GLenum type, const void *indirect);
 GLAPI PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWELEMENTSINDIRECTPROC glad_debug_glDrawElementsIndirect;
+#define glDrawElementsIndirect glad_debug_glDrawElementsIndirect
+#else
 #define glDrawElementsIndirect glad_glDrawElementsIndirect
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM1DPROC)(GLint location, GLdouble x);
 GLAPI PFNGLUNIFORM1DPROC glad_glUniform1d;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM1DPROC glad_debug_glUniform1d;
+#define glUniform1d glad_debug_glUniform1d
+#else
 #define glUniform1d glad_glUniform1d
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM2DPROC)(GLint location, GLdouble x, GLdouble y);
 GLAPI PFNGLUNIFORM2DPROC glad_glUniform2d;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM2DPROC glad_debug_glUniform2d;
+#define glUniform2d glad_debug_glUniform2d
+#else
 #define glUniform2d glad_glUniform2d
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM3DPROC)(GLint location, GLdouble x, GLdouble y, GLdouble z);
 GLAPI PFNGLUNIFORM3DPROC glad_glUniform3d;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM3DPROC glad_debug_glUniform3d;
+#define glUniform3d glad_debug_glUniform3d
+#else
 #define glUniform3d glad_glUniform3d
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM4DPROC)(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
 GLAPI PFNGLUNIFORM4DPROC glad_glUniform4d;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM4DPROC glad_debug_glUniform4d;
+#define glUniform4d glad_debug_glUniform4d
+#else
 #define glUniform4d glad_glUniform4d
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM1DVPROC)(GLint location, GLsizei count, const GLdouble *value);
 GLAPI PFNGLUNIFORM1DVPROC glad_glUniform1dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM1DVPROC glad_debug_glUniform1dv;
+#define glUniform1dv glad_debug_glUniform1dv
+#else
 #define glUniform1dv glad_glUniform1dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM2DVPROC)(GLint location, GLsizei count, const GLdouble *value);
 GLAPI PFNGLUNIFORM2DVPROC glad_glUniform2dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM2DVPROC glad_debug_glUniform2dv;
+#define glUniform2dv glad_debug_glUniform2dv
+#else
 #define glUniform2dv glad_glUniform2dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM3DVPROC)(GLint location, GLsizei count, const GLdouble *value);
 GLAPI PFNGLUNIFORM3DVPROC glad_glUniform3dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM3DVPROC glad_debug_glUniform3dv;
+#define glUniform3dv glad_debug_glUniform3dv
+#else
 #define glUniform3dv glad_glUniform3dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORM4DVPROC)(GLint location, GLsizei count, const GLdouble *value);
 GLAPI PFNGLUNIFORM4DVPROC glad_glUniform4dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORM4DVPROC glad_debug_glUniform4dv;
+#define glUniform4dv glad_debug_glUniform4dv
+#else
 #define glUniform4dv glad_glUniform4dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX2DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
 GLAPI PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX2DVPROC glad_debug_glUniformMatrix2dv;
+#define glUniformMatrix2dv glad_debug_glUniformMatrix2dv
+#else
 #define glUniformMatrix2dv glad_glUniformMatrix2dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX3DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
 GLAPI PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX3DVPROC glad_debug_glUniformMatrix3dv;
+#define glUniformMatrix3dv glad_debug_glUniformMatrix3dv
+#else
 #define glUniformMatrix3dv glad_glUniformMatrix3dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX4DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
 GLAPI PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX4DVPROC glad_debug_glUniformMatrix4dv;
+#define glUniformMatrix4dv glad_debug_glUniformMatrix4dv
+#else
 #define glUniformMatrix4dv glad_glUniformMatrix4dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX2X3DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
 GLAPI PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX2X3DVPROC glad_debug_glUniformMatrix2x3dv;
+#define glUniformMatrix2x3dv glad_debug_glUniformMatrix2x3dv
+#else
 #define glUniformMatrix2x3dv glad_glUniformMatrix2x3dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX2X4DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
 GLAPI PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX2X4DVPROC glad_debug_glUniformMatrix2x4dv;
+#define glUniformMatrix2x4dv glad_debug_glUniformMatrix2x4dv
+#else
 #define glUniformMatrix2x4dv glad_glUniformMatrix2x4dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX3X2DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
 GLAPI PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX3X2DVPROC glad_debug_glUniformMatrix3x2dv;
+#define glUniformMatrix3x2dv glad_debug_glUniformMatrix3x2dv
+#else
 #define glUniformMatrix3x2dv glad_glUniformMatrix3x2dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX3X4DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
 GLAPI PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX3X4DVPROC glad_debug_glUniformMatrix3x4dv;
+#define glUniformMatrix3x4dv glad_debug_glUniformMatrix3x4dv
+#else
 #define glUniformMatrix3x4dv glad_glUniformMatrix3x4dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX4X2DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
 GLAPI PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX4X2DVPROC glad_debug_glUniformMatrix4x2dv;
+#define glUniformMatrix4x2dv glad_debug_glUniformMatrix4x2dv
+#else
 #define glUniformMatrix4x2dv glad_glUniformMatrix4x2dv
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMMATRIX4X3DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
 GLAPI PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMMATRIX4X3DVPROC glad_debug_glUniformMatrix4x3dv;
+#define glUniformMatrix4x3dv glad_debug_glUniformMatrix4x3dv
+#else
 #define glUniformMatrix4x3dv glad_glUniformMatrix4x3dv
+#endif
 typedef void (APIENTRYP PFNGLGETUNIFORMDVPROC)(GLuint program, GLint location, GLdouble *params);
 GLAPI PFNGLGETUNIFORMDVPROC glad_glGetUniformdv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETUNIFORMDVPROC glad_debug_glGetUniformdv;
+#define glGetUniformdv glad_debug_glGetUniformdv
+#else
 #define glGetUniformdv glad_glGetUniformdv
+#endif
 typedef GLint (APIENTRYP PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)(GLuint program, GLenum shadertype, const GLchar *name);
 GLAPI PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_debug_glGetSubroutineUniformLocation;
+#define glGetSubroutineUniformLocation glad_debug_glGetSubroutineUniformLocation
+#else
 #define glGetSubroutineUniformLocation glad_glGetSubroutineUniformLocation
+#endif
 typedef GLuint (APIENTRYP PFNGLGETSUBROUTINEINDEXPROC)(GLuint program, GLenum shadertype, const GLchar *name);
 GLAPI PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETSUBROUTINEINDEXPROC glad_debug_glGetSubroutineIndex;
+#define glGetSubroutineIndex glad_debug_glGetSubroutineIndex
+#else
 #define glGetSubroutineIndex glad_glGetSubroutineIndex
+#endif
 typedef void (APIENTRYP PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values);
 GLAPI PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_debug_glGetActiveSubroutineUniformiv;
+#define glGetActiveSubroutineUniformiv glad_debug_glGetActiveSubroutineUniformiv
+#else
 #define glGetActiveSubroutineUniformiv glad_glGetActiveSubroutineUniformiv
+#endif
 typedef void (APIENTRYP PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name);
 GLAPI PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_debug_glGetActiveSubroutineUniformName;
+#define glGetActiveSubroutineUniformName glad_debug_glGetActiveSubroutineUniformName
+#else
 #define glGetActiveSubroutineUniformName glad_glGetActiveSubroutineUniformName
+#endif
 typedef void (APIENTRYP PFNGLGETACTIVESUBROUTINENAMEPROC)(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name);
 GLAPI PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETACTIVESUBROUTINENAMEPROC glad_debug_glGetActiveSubroutineName;
+#define glGetActiveSubroutineName glad_debug_glGetActiveSubroutineName
+#else
 #define glGetActiveSubroutineName glad_glGetActiveSubroutineName
+#endif
 typedef void (APIENTRYP PFNGLUNIFORMSUBROUTINESUIVPROC)(GLenum shadertype, GLsizei count, const GLuint *indices);
 GLAPI PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLUNIFORMSUBROUTINESUIVPROC glad_debug_glUniformSubroutinesuiv;
+#define glUniformSubroutinesuiv glad_debug_glUniformSubroutinesuiv
+#else
 #define glUniformSubroutinesuiv glad_glUniformSubroutinesuiv
+#endif
 typedef void (APIENTRYP PFNGLGETUNIFORMSUBROUTINEUIVPROC)(GLenum shadertype, GLint location, GLuint *params);
 GLAPI PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_debug_glGetUniformSubroutineuiv;
+#define glGetUniformSubroutineuiv glad_debug_glGetUniformSubroutineuiv
+#else
 #define glGetUniformSubroutineuiv glad_glGetUniformSubroutineuiv
+#endif
 typedef void (APIENTRYP PFNGLGETPROGRAMSTAGEIVPROC)(GLuint program, GLenum shadertype, GLenum pname, GLint *values);
 GLAPI PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETPROGRAMSTAGEIVPROC glad_debug_glGetProgramStageiv;
+#define glGetProgramStageiv glad_debug_glGetProgramStageiv
+#else
 #define glGetProgramStageiv glad_glGetProgramStageiv
+#endif
 typedef void (APIENTRYP PFNGLPATCHPARAMETERIPROC)(GLenum pname, GLint value);
 GLAPI PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPATCHPARAMETERIPROC glad_debug_glPatchParameteri;
+#define glPatchParameteri glad_debug_glPatchParameteri
+#else
 #define glPatchParameteri glad_glPatchParameteri
+#endif
 typedef void (APIENTRYP PFNGLPATCHPARAMETERFVPROC)(GLenum pname, const GLfloat *values);
 GLAPI PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPATCHPARAMETERFVPROC glad_debug_glPatchParameterfv;
+#define glPatchParameterfv glad_debug_glPatchParameterfv
+#else
 #define glPatchParameterfv glad_glPatchParameterfv
+#endif
 typedef void (APIENTRYP PFNGLBINDTRANSFORMFEEDBACKPROC)(GLenum target, GLuint id);
 GLAPI PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBINDTRANSFORMFEEDBACKPROC glad_debug_glBindTransformFeedback;
+#define glBindTransformFeedback glad_debug_glBindTransformFeedback
+#else
 #define glBindTransformFeedback glad_glBindTransformFeedback
+#endif
 typedef void (APIENTRYP PFNGLDELETETRANSFORMFEEDBACKSPROC)(GLsizei n, const GLuint *ids);
 GLAPI PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDELETETRANSFORMFEEDBACKSPROC glad_debug_glDeleteTransformFeedbacks;
+#define glDeleteTransformFeedbacks glad_debug_glDeleteTransformFeedbacks
+#else
 #define glDeleteTransformFeedbacks glad_glDeleteTransformFeedbacks
+#endif
 typedef void (APIENTRYP PFNGLGENTRANSFORMFEEDBACKSPROC)(GLsizei n, GLuint *ids);
 GLAPI PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGENTRANSFORMFEEDBACKSPROC glad_debug_glGenTransformFeedbacks;
+#define glGenTransformFeedbacks glad_debug_glGenTransformFeedbacks
+#else
 #define glGenTransformFeedbacks glad_glGenTransformFeedbacks
+#endif
 typedef GLboolean (APIENTRYP PFNGLISTRANSFORMFEEDBACKPROC)(GLuint id);
 GLAPI PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLISTRANSFORMFEEDBACKPROC glad_debug_glIsTransformFeedback;
+#define glIsTransformFeedback glad_debug_glIsTransformFeedback
+#else
 #define glIsTransformFeedback glad_glIsTransformFeedback
+#endif
 typedef void (APIENTRYP PFNGLPAUSETRANSFORMFEEDBACKPROC)(void);
 GLAPI PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLPAUSETRANSFORMFEEDBACKPROC glad_debug_glPauseTransformFeedback;
+#define glPauseTransformFeedback glad_debug_glPauseTransformFeedback
+#else
 #define glPauseTransformFeedback glad_glPauseTransformFeedback
+#endif
 typedef void (APIENTRYP PFNGLRESUMETRANSFORMFEEDBACKPROC)(void);
 GLAPI PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLRESUMETRANSFORMFEEDBACKPROC glad_debug_glResumeTransformFeedback;
+#define glResumeTransformFeedback glad_debug_glResumeTransformFeedback
+#else
 #define glResumeTransformFeedback glad_glResumeTransformFeedback
+#endif
 typedef void (APIENTRYP PFNGLDRAWTRANSFORMFEEDBACKPROC)(GLenum mode, GLuint id);
 GLAPI PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWTRANSFORMFEEDBACKPROC glad_debug_glDrawTransformFeedback;
+#define glDrawTransformFeedback glad_debug_glDrawTransformFeedback
+#else
 #define glDrawTransformFeedback glad_glDrawTransformFeedback
+#endif
 typedef void (APIENTRYP PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)(GLenum mode, GLuint id, GLuint stream);
 GLAPI PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_debug_glDrawTransformFeedbackStream;
+#define glDrawTransformFeedbackStream glad_debug_glDrawTransformFeedbackStream
+#else
 #define glDrawTransformFeedbackStream glad_glDrawTransformFeedbackStream
+#endif
 typedef void (APIENTRYP PFNGLBEGINQUERYINDEXEDPROC)(GLenum target, GLuint index, GLuint id);
 GLAPI PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLBEGINQUERYINDEXEDPROC glad_debug_glBeginQueryIndexed;
+#define glBeginQueryIndexed glad_debug_glBeginQueryIndexed
+#else
 #define glBeginQueryIndexed glad_glBeginQueryIndexed
+#endif
 typedef void (APIENTRYP PFNGLENDQUERYINDEXEDPROC)(GLenum target, GLuint index);
 GLAPI PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLENDQUERYINDEXEDPROC glad_debug_glEndQueryIndexed;
+#define glEndQueryIndexed glad_debug_glEndQueryIndexed
+#else
 #define glEndQueryIndexed glad_glEndQueryIndexed
+#endif
 typedef void (APIENTRYP PFNGLGETQUERYINDEXEDIVPROC)(GLenum target, GLuint index, GLenum pname, GLint *params);
 GLAPI PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv;
+#ifdef GLAD_DEBUG
+GLAPI PFNGLGETQUERYINDEXEDIVPROC glad_debug_glGetQueryIndexediv;
+#define glGetQueryIndexediv glad_debug_glGetQueryIndexediv
+#else
 #define glGetQueryIndexediv glad_glGetQueryIndexediv
 #endif
+#endif
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,435 @@
+/*
+    Every OpenGL 4.0 core function glad loads, as an X macro:
+
+        X(return type, name without the gl prefix, (parameters), (arguments))
+
+    Generated from glad.h; regenerate together with it. The names are given without the gl prefix so they are
+    never replaced by the glad macros.
+*/
+
+#ifndef __glad_functions_h_
+#define __glad_functions_h_
+
+#define GLAD_FUNCTIONS(X) \
+    X(void, ActiveTexture, (GLenum texture), (texture)) \
+    X(void, AttachShader, (GLuint program, GLuint shader), (program, shader)) \
+    X(void, BeginConditionalRender, (GLuint id, GLenum mode), (id, mode)) \
+    X(void, BeginQuery, (GLenum target, GLuint id), (target, id)) \
+    X(void, BeginQueryIndexed, (GLenum target, GLuint index, GLuint id), (target, index, id)) \
+    X(void, BeginTransformFeedback, (GLenum primitiveMode), (primitiveMode)) \
+    X(void, BindAttribLocation, (GLuint program, GLuint index, const GLchar *name), (program, index, name)) \
+    X(void, BindBuffer, (GLenum target, GLuint buffer), (target, buffer)) \
+    X(void, BindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer)) \
+    X(void, BindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size)) \
+    X(void, BindFragDataLocation, (GLuint program, GLuint color, const GLchar *name), (program, color, name)) \
+    X(void, BindFragDataLocationIndexed, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name)) \
+    X(void, BindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer)) \
+    X(void, BindRenderbuffer, (GLenum target, GLuint renderbuffer), (target, renderbuffer)) \
+    X(void, BindSampler, (GLuint unit, GLuint sampler), (unit, sampler)) \
+    X(void, BindTexture, (GLenum target, GLuint texture), (target, texture)) \
+    X(void, BindTransformFeedback, (GLenum target, GLuint id), (target, id)) \
+    X(void, BindVertexArray, (GLuint array), (array)) \
+    X(void, BlendColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha)) \
+    X(void, BlendEquation, (GLenum mode), (mode)) \
+    X(void, BlendEquationSeparate, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha)) \
+    X(void, BlendEquationSeparatei, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha)) \
+    X(void, BlendEquationi, (GLuint buf, GLenum mode), (buf, mode)) \
+    X(void, BlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor)) \
+    X(void, BlendFuncSeparate, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha)) \
+    X(void, BlendFuncSeparatei, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha)) \
+    X(void, BlendFunci, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst)) \
+    X(void, BlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter)) \
+    X(void, BufferData, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage)) \
+    X(void, BufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data)) \
+    X(GLenum, CheckFramebufferStatus, (GLenum target), (target)) \
+    X(void, ClampColor, (GLenum target, GLenum clamp), (target, clamp)) \
+    X(void, Clear, (GLbitfield mask), (mask)) \
+    X(void, ClearBufferfi, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil)) \
+    X(void, ClearBufferfv, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value)) \
+    X(void, ClearBufferiv, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value)) \
+    X(void, ClearBufferuiv, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value)) \
+    X(void, ClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha)) \
+    X(void, ClearDepth, (GLdouble depth), (depth)) \
+    X(void, ClearStencil, (GLint s), (s)) \
+    X(GLenum, ClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout)) \
+    X(void, ColorMask, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha)) \
+    X(void, ColorMaski, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a)) \
+    X(void, ColorP3ui, (GLenum type, GLuint color), (type, color)) \
+    X(void, ColorP3uiv, (GLenum type, const GLuint *color), (type, color)) \
+    X(void, ColorP4ui, (GLenum type, GLuint color), (type, color)) \
+    X(void, ColorP4uiv, (GLenum type, const GLuint *color), (type, color)) \
+    X(void, CompileShader, (GLuint shader), (shader)) \
+    X(void, CompressedTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data)) \
+    X(void, CompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data)) \
+    X(void, CompressedTexImage3D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data)) \
+    X(void, CompressedTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data)) \
+    X(void, CompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data)) \
+    X(void, CompressedTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data)) \
+    X(void, CopyBufferSubData, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size)) \
+    X(void, CopyTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border)) \
+    X(void, CopyTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border)) \
+    X(void, CopyTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width)) \
+    X(void, CopyTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height)) \
+    X(void, CopyTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height)) \
+    X(GLuint, CreateProgram, (void), ()) \
+    X(GLuint, CreateShader, (GLenum type), (type)) \
+    X(void, CullFace, (GLenum mode), (mode)) \
+    X(void, DeleteBuffers, (GLsizei n, const GLuint *buffers), (n, buffers)) \
+    X(void, DeleteFramebuffers, (GLsizei n, const GLuint *framebuffers), (n, framebuffers)) \
+    X(void, DeleteProgram, (GLuint program), (program)) \
+    X(void, DeleteQueries, (GLsizei n, const GLuint *ids), (n, ids)) \
+    X(void, DeleteRenderbuffers, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers)) \
+    X(void, DeleteSamplers, (GLsizei count, const GLuint *samplers), (count, samplers)) \
+    X(void, DeleteShader, (GLuint shader), (shader)) \
+    X(void, DeleteSync, (GLsync sync), (sync)) \
+    X(void, DeleteTextures, (GLsizei n, const GLuint *textures), (n, textures)) \
+    X(void, DeleteTransformFeedbacks, (GLsizei n, const GLuint *ids), (n, ids)) \
+    X(void, DeleteVertexArrays, (GLsizei n, const GLuint *arrays), (n, arrays)) \
+    X(void, DepthFunc, (GLenum func), (func)) \
+    X(void, DepthMask, (GLboolean flag), (flag)) \
+    X(void, DepthRange, (GLdouble n, GLdouble f), (n, f)) \
+    X(void, DetachShader, (GLuint program, GLuint shader), (program, shader)) \
+    X(void, Disable, (GLenum cap), (cap)) \
+    X(void, DisableVertexAttribArray, (GLuint index), (index)) \
+    X(void, Disablei, (GLenum target, GLuint index), (target, index)) \
+    X(void, DrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count)) \
+    X(void, DrawArraysIndirect, (GLenum mode, const void *indirect), (mode, indirect)) \
+    X(void, DrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount)) \
+    X(void, DrawBuffer, (GLenum buf), (buf)) \
+    X(void, DrawBuffers, (GLsizei n, const GLenum *bufs), (n, bufs)) \
+    X(void, DrawElements, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices)) \
+    X(void, DrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex)) \
+    X(void, DrawElementsIndirect, (GLenum mode, GLenum type, const void *indirect), (mode, type, indirect)) \
+    X(void, DrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount)) \
+    X(void, DrawElementsInstancedBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex)) \
+    X(void, DrawRangeElements, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices)) \
+    X(void, DrawRangeElementsBaseVertex, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex)) \
+    X(void, DrawTransformFeedback, (GLenum mode, GLuint id), (mode, id)) \
+    X(void, DrawTransformFeedbackStream, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream)) \
+    X(void, Enable, (GLenum cap), (cap)) \
+    X(void, EnableVertexAttribArray, (GLuint index), (index)) \
+    X(void, Enablei, (GLenum target, GLuint index), (target, index)) \
+    X(void, EndConditionalRender, (void), ()) \
+    X(void, EndQuery, (GLenum target), (target)) \
+    X(void, EndQueryIndexed, (GLenum target, GLuint index), (target, index)) \
+    X(void, EndTransformFeedback, (void), ()) \
+    X(GLsync, FenceSync, (GLenum condition, GLbitfield flags), (condition, flags)) \
+    X(void, Finish, (void), ()) \
+    X(void, Flush, (void), ()) \
+    X(void, FlushMappedBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length)) \
+    X(void, FramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer)) \
+    X(void, FramebufferTexture, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level)) \
+    X(void, FramebufferTexture1D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level)) \
+    X(void, FramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level)) \
+    X(void, FramebufferTexture3D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset)) \
+    X(void, FramebufferTextureLayer, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer)) \
+    X(void, FrontFace, (GLenum mode), (mode)) \
+    X(void, GenBuffers, (GLsizei n, GLuint *buffers), (n, buffers)) \
+    X(void, GenFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers)) \
+    X(void, GenQueries, (GLsizei n, GLuint *ids), (n, ids)) \
+    X(void, GenRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers)) \
+    X(void, GenSamplers, (GLsizei count, GLuint *samplers), (count, samplers)) \
+    X(void, GenTextures, (GLsizei n, GLuint *textures), (n, textures)) \
+    X(void, GenTransformFeedbacks, (GLsizei n, GLuint *ids), (n, ids)) \
+    X(void, GenVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays)) \
+    X(void, GenerateMipmap, (GLenum target), (target)) \
+    X(void, GetActiveAttrib, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name)) \
+    X(void, GetActiveSubroutineName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name), (program, shadertype, index, bufsize, length, name)) \
+    X(void, GetActiveSubroutineUniformName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name), (program, shadertype, index, bufsize, length, name)) \
+    X(void, GetActiveSubroutineUniformiv, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values), (program, shadertype, index, pname, values)) \
+    X(void, GetActiveUniform, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name)) \
+    X(void, GetActiveUniformBlockName, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName)) \
+    X(void, GetActiveUniformBlockiv, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params)) \
+    X(void, GetActiveUniformName, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName)) \
+    X(void, GetActiveUniformsiv, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params)) \
+    X(void, GetAttachedShaders, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders)) \
+    X(GLint, GetAttribLocation, (GLuint program, const GLchar *name), (program, name)) \
+    X(void, GetBooleani_v, (GLenum target, GLuint index, GLboolean *data), (target, index, data)) \
+    X(void, GetBooleanv, (GLenum pname, GLboolean *data), (pname, data)) \
+    X(void, GetBufferParameteri64v, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params)) \
+    X(void, GetBufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params)) \
+    X(void, GetBufferPointerv, (GLenum target, GLenum pname, void **params), (target, pname, params)) \
+    X(void, GetBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data)) \
+    X(void, GetCompressedTexImage, (GLenum target, GLint level, void *img), (target, level, img)) \
+    X(void, GetDoublev, (GLenum pname, GLdouble *data), (pname, data)) \
+    X(GLenum, GetError, (void), ()) \
+    X(void, GetFloatv, (GLenum pname, GLfloat *data), (pname, data)) \
+    X(GLint, GetFragDataIndex, (GLuint program, const GLchar *name), (program, name)) \
+    X(GLint, GetFragDataLocation, (GLuint program, const GLchar *name), (program, name)) \
+    X(void, GetFramebufferAttachmentParameteriv, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params)) \
+    X(void, GetInteger64i_v, (GLenum target, GLuint index, GLint64 *data), (target, index, data)) \
+    X(void, GetInteger64v, (GLenum pname, GLint64 *data), (pname, data)) \
+    X(void, GetIntegeri_v, (GLenum target, GLuint index, GLint *data), (target, index, data)) \
+    X(void, GetIntegerv, (GLenum pname, GLint *data), (pname, data)) \
+    X(void, GetMultisamplefv, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val)) \
+    X(void, GetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog)) \
+    X(void, GetProgramStageiv, (GLuint program, GLenum shadertype, GLenum pname, GLint *values), (program, shadertype, pname, values)) \
+    X(void, GetProgramiv, (GLuint program, GLenum pname, GLint *params), (program, pname, params)) \
+    X(void, GetQueryIndexediv, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params)) \
+    X(void, GetQueryObjecti64v, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params)) \
+    X(void, GetQueryObjectiv, (GLuint id, GLenum pname, GLint *params), (id, pname, params)) \
+    X(void, GetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params)) \
+    X(void, GetQueryObjectuiv, (GLuint id, GLenum pname, GLuint *params), (id, pname, params)) \
+    X(void, GetQueryiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params)) \
+    X(void, GetRenderbufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params)) \
+    X(void, GetSamplerParameterIiv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params)) \
+    X(void, GetSamplerParameterIuiv, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params)) \
+    X(void, GetSamplerParameterfv, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params)) \
+    X(void, GetSamplerParameteriv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params)) \
+    X(void, GetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog)) \
+    X(void, GetShaderSource, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source)) \
+    X(void, GetShaderiv, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params)) \
+    X(const GLubyte *, GetString, (GLenum name), (name)) \
+    X(const GLubyte *, GetStringi, (GLenum name, GLuint index), (name, index)) \
+    X(GLuint, GetSubroutineIndex, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name)) \
+    X(GLint, GetSubroutineUniformLocation, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name)) \
+    X(void, GetSynciv, (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values), (sync, pname, bufSize, length, values)) \
+    X(void, GetTexImage, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels)) \
+    X(void, GetTexLevelParameterfv, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params)) \
+    X(void, GetTexLevelParameteriv, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params)) \
+    X(void, GetTexParameterIiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params)) \
+    X(void, GetTexParameterIuiv, (GLenum target, GLenum pname, GLuint *params), (target, pname, params)) \
+    X(void, GetTexParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params)) \
+    X(void, GetTexParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params)) \
+    X(void, GetTransformFeedbackVarying, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name)) \
+    X(GLuint, GetUniformBlockIndex, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName)) \
+    X(void, GetUniformIndices, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices)) \
+    X(GLint, GetUniformLocation, (GLuint program, const GLchar *name), (program, name)) \
+    X(void, GetUniformSubroutineuiv, (GLenum shadertype, GLint location, GLuint *params), (shadertype, location, params)) \
+    X(void, GetUniformdv, (GLuint program, GLint location, GLdouble *params), (program, location, params)) \
+    X(void, GetUniformfv, (GLuint program, GLint location, GLfloat *params), (program, location, params)) \
+    X(void, GetUniformiv, (GLuint program, GLint location, GLint *params), (program, location, params)) \
+    X(void, GetUniformuiv, (GLuint program, GLint location, GLuint *params), (program, location, params)) \
+    X(void, GetVertexAttribIiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params)) \
+    X(void, GetVertexAttribIuiv, (GLuint index, GLenum pname, GLuint *params), (index, pname, params)) \
+    X(void, GetVertexAttribPointerv, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer)) \
+    X(void, GetVertexAttribdv, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params)) \
+    X(void, GetVertexAttribfv, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params)) \
+    X(void, GetVertexAttribiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params)) \
+    X(void, Hint, (GLenum target, GLenum mode), (target, mode)) \
+    X(GLboolean, IsBuffer, (GLuint buffer), (buffer)) \
+    X(GLboolean, IsEnabled, (GLenum cap), (cap)) \
+    X(GLboolean, IsEnabledi, (GLenum target, GLuint index), (target, index)) \
+    X(GLboolean, IsFramebuffer, (GLuint framebuffer), (framebuffer)) \
+    X(GLboolean, IsProgram, (GLuint program), (program)) \
+    X(GLboolean, IsQuery, (GLuint id), (id)) \
+    X(GLboolean, IsRenderbuffer, (GLuint renderbuffer), (renderbuffer)) \
+    X(GLboolean, IsSampler, (GLuint sampler), (sampler)) \
+    X(GLboolean, IsShader, (GLuint shader), (shader)) \
+    X(GLboolean, IsSync, (GLsync sync), (sync)) \
+    X(GLboolean, IsTexture, (GLuint texture), (texture)) \
+    X(GLboolean, IsTransformFeedback, (GLuint id), (id)) \
+    X(GLboolean, IsVertexArray, (GLuint array), (array)) \
+    X(void, LineWidth, (GLfloat width), (width)) \
+    X(void, LinkProgram, (GLuint program), (program)) \
+    X(void, LogicOp, (GLenum opcode), (opcode)) \
+    X(void *, MapBuffer, (GLenum target, GLenum access), (target, access)) \
+    X(void *, MapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access)) \
+    X(void, MinSampleShading, (GLfloat value), (value)) \
+    X(void, MultiDrawArrays, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount)) \
+    X(void, MultiDrawElements, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount)) \
+    X(void, MultiDrawElementsBaseVertex, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex)) \
+    X(void, MultiTexCoordP1ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords)) \
+    X(void, MultiTexCoordP1uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords)) \
+    X(void, MultiTexCoordP2ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords)) \
+    X(void, MultiTexCoordP2uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords)) \
+    X(void, MultiTexCoordP3ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords)) \
+    X(void, MultiTexCoordP3uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords)) \
+    X(void, MultiTexCoordP4ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords)) \
+    X(void, MultiTexCoordP4uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords)) \
+    X(void, NormalP3ui, (GLenum type, GLuint coords), (type, coords)) \
+    X(void, NormalP3uiv, (GLenum type, const GLuint *coords), (type, coords)) \
+    X(void, PatchParameterfv, (GLenum pname, const GLfloat *values), (pname, values)) \
+    X(void, PatchParameteri, (GLenum pname, GLint value), (pname, value)) \
+    X(void, PauseTransformFeedback, (void), ()) \
+    X(void, PixelStoref, (GLenum pname, GLfloat param), (pname, param)) \
+    X(void, PixelStorei, (GLenum pname, GLint param), (pname, param)) \
+    X(void, PointParameterf, (GLenum pname, GLfloat param), (pname, param)) \
+    X(void, PointParameterfv, (GLenum pname, const GLfloat *params), (pname, params)) \
+    X(void, PointParameteri, (GLenum pname, GLint param), (pname, param)) \
+    X(void, PointParameteriv, (GLenum pname, const GLint *params), (pname, params)) \
+    X(void, PointSize, (GLfloat size), (size)) \
+    X(void, PolygonMode, (GLenum face, GLenum mode), (face, mode)) \
+    X(void, PolygonOffset, (GLfloat factor, GLfloat units), (factor, units)) \
+    X(void, PrimitiveRestartIndex, (GLuint index), (index)) \
+    X(void, ProvokingVertex, (GLenum mode), (mode)) \
+    X(void, QueryCounter, (GLuint id, GLenum target), (id, target)) \
+    X(void, ReadBuffer, (GLenum src), (src)) \
+    X(void, ReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels)) \
+    X(void, RenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height)) \
+    X(void, RenderbufferStorageMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height)) \
+    X(void, ResumeTransformFeedback, (void), ()) \
+    X(void, SampleCoverage, (GLfloat value, GLboolean invert), (value, invert)) \
+    X(void, SampleMaski, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask)) \
+    X(void, SamplerParameterIiv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param)) \
+    X(void, SamplerParameterIuiv, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param)) \
+    X(void, SamplerParameterf, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param)) \
+    X(void, SamplerParameterfv, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param)) \
+    X(void, SamplerParameteri, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param)) \
+    X(void, SamplerParameteriv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param)) \
+    X(void, Scissor, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height)) \
+    X(void, SecondaryColorP3ui, (GLenum type, GLuint color), (type, color)) \
+    X(void, SecondaryColorP3uiv, (GLenum type, const GLuint *color), (type, color)) \
+    X(void, ShaderSource, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length)) \
+    X(void, StencilFunc, (GLenum func, GLint ref, GLuint mask), (func, ref, mask)) \
+    X(void, StencilFuncSeparate, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask)) \
+    X(void, StencilMask, (GLuint mask), (mask)) \
+    X(void, StencilMaskSeparate, (GLenum face, GLuint mask), (face, mask)) \
+    X(void, StencilOp, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass)) \
+    X(void, StencilOpSeparate, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass)) \
+    X(void, TexBuffer, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer)) \
+    X(void, TexCoordP1ui, (GLenum type, GLuint coords), (type, coords)) \
+    X(void, TexCoordP1uiv, (GLenum type, const GLuint *coords), (type, coords)) \
+    X(void, TexCoordP2ui, (GLenum type, GLuint coords), (type, coords)) \
+    X(void, TexCoordP2uiv, (GLenum type, const GLuint *coords), (type, coords)) \
+    X(void, TexCoordP3ui, (GLenum type, GLuint coords), (type, coords)) \
+    X(void, TexCoordP3uiv, (GLenum type, const GLuint *coords), (type, coords)) \
+    X(void, TexCoordP4ui, (GLenum type, GLuint coords), (type, coords)) \
+    X(void, TexCoordP4uiv, (GLenum type, const GLuint *coords), (type, coords)) \
+    X(void, TexImage1D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels)) \
+    X(void, TexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels)) \
+    X(void, TexImage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations)) \
+    X(void, TexImage3D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels)) \
+    X(void, TexImage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations)) \
+    X(void, TexParameterIiv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params)) \
+    X(void, TexParameterIuiv, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params)) \
+    X(void, TexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param)) \
+    X(void, TexParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params)) \
+    X(void, TexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param)) \
+    X(void, TexParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params)) \
+    X(void, TexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels)) \
+    X(void, TexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels)) \
+    X(void, TexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels)) \
+    X(void, TransformFeedbackVaryings, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode)) \
+    X(void, Uniform1d, (GLint location, GLdouble x), (location, x)) \
+    X(void, Uniform1dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value)) \
+    X(void, Uniform1f, (GLint location, GLfloat v0), (location, v0)) \
+    X(void, Uniform1fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value)) \
+    X(void, Uniform1i, (GLint location, GLint v0), (location, v0)) \
+    X(void, Uniform1iv, (GLint location, GLsizei count, const GLint *value), (location, count, value)) \
+    X(void, Uniform1ui, (GLint location, GLuint v0), (location, v0)) \
+    X(void, Uniform1uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value)) \
+    X(void, Uniform2d, (GLint location, GLdouble x, GLdouble y), (location, x, y)) \
+    X(void, Uniform2dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value)) \
+    X(void, Uniform2f, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1)) \
+    X(void, Uniform2fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value)) \
+    X(void, Uniform2i, (GLint location, GLint v0, GLint v1), (location, v0, v1)) \
+    X(void, Uniform2iv, (GLint location, GLsizei count, const GLint *value), (location, count, value)) \
+    X(void, Uniform2ui, (GLint location, GLuint v0, GLuint v1), (location, v0, v1)) \
+    X(void, Uniform2uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value)) \
+    X(void, Uniform3d, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z)) \
+    X(void, Uniform3dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value)) \
+    X(void, Uniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2)) \
+    X(void, Uniform3fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value)) \
+    X(void, Uniform3i, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2)) \
+    X(void, Uniform3iv, (GLint location, GLsizei count, const GLint *value), (location, count, value)) \
+    X(void, Uniform3ui, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2)) \
+    X(void, Uniform3uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value)) \
+    X(void, Uniform4d, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w)) \
+    X(void, Uniform4dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value)) \
+    X(void, Uniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3)) \
+    X(void, Uniform4fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value)) \
+    X(void, Uniform4i, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3)) \
+    X(void, Uniform4iv, (GLint location, GLsizei count, const GLint *value), (location, count, value)) \
+    X(void, Uniform4ui, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3)) \
+    X(void, Uniform4uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value)) \
+    X(void, UniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding)) \
+    X(void, UniformMatrix2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix2x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix2x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix2x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix2x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix3x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix3x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix3x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix3x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix4x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix4x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix4x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value)) \
+    X(void, UniformMatrix4x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value)) \
+    X(void, UniformSubroutinesuiv, (GLenum shadertype, GLsizei count, const GLuint *indices), (shadertype, count, indices)) \
+    X(GLboolean, UnmapBuffer, (GLenum target), (target)) \
+    X(void, UseProgram, (GLuint program), (program)) \
+    X(void, ValidateProgram, (GLuint program), (program)) \
+    X(void, VertexAttrib1d, (GLuint index, GLdouble x), (index, x)) \
+    X(void, VertexAttrib1dv, (GLuint index, const GLdouble *v), (index, v)) \
+    X(void, VertexAttrib1f, (GLuint index, GLfloat x), (index, x)) \
+    X(void, VertexAttrib1fv, (GLuint index, const GLfloat *v), (index, v)) \
+    X(void, VertexAttrib1s, (GLuint index, GLshort x), (index, x)) \
+    X(void, VertexAttrib1sv, (GLuint index, const GLshort *v), (index, v)) \
+    X(void, VertexAttrib2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y)) \
+    X(void, VertexAttrib2dv, (GLuint index, const GLdouble *v), (index, v)) \
+    X(void, VertexAttrib2f, (GLuint index, GLfloat x, GLfloat y), (index, x, y)) \
+    X(void, VertexAttrib2fv, (GLuint index, const GLfloat *v), (index, v)) \
+    X(void, VertexAttrib2s, (GLuint index, GLshort x, GLshort y), (index, x, y)) \
+    X(void, VertexAttrib2sv, (GLuint index, const GLshort *v), (index, v)) \
+    X(void, VertexAttrib3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z)) \
+    X(void, VertexAttrib3dv, (GLuint index, const GLdouble *v), (index, v)) \
+    X(void, VertexAttrib3f, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z)) \
+    X(void, VertexAttrib3fv, (GLuint index, const GLfloat *v), (index, v)) \
+    X(void, VertexAttrib3s, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z)) \
+    X(void, VertexAttrib3sv, (GLuint index, const GLshort *v), (index, v)) \
+    X(void, VertexAttrib4Nbv, (GLuint index, const GLbyte *v), (index, v)) \
+    X(void, VertexAttrib4Niv, (GLuint index, const GLint *v), (index, v)) \
+    X(void, VertexAttrib4Nsv, (GLuint index, const GLshort *v), (index, v)) \
+    X(void, VertexAttrib4Nub, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w)) \
+    X(void, VertexAttrib4Nubv, (GLuint index, const GLubyte *v), (index, v)) \
+    X(void, VertexAttrib4Nuiv, (GLuint index, const GLuint *v), (index, v)) \
+    X(void, VertexAttrib4Nusv, (GLuint index, const GLushort *v), (index, v)) \
+    X(void, VertexAttrib4bv, (GLuint index, const GLbyte *v), (index, v)) \
+    X(void, VertexAttrib4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w)) \
+    X(void, VertexAttrib4dv, (GLuint index, const GLdouble *v), (index, v)) \
+    X(void, VertexAttrib4f, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w)) \
+    X(void, VertexAttrib4fv, (GLuint index, const GLfloat *v), (index, v)) \
+    X(void, VertexAttrib4iv, (GLuint index, const GLint *v), (index, v)) \
+    X(void, VertexAttrib4s, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w)) \
+    X(void, VertexAttrib4sv, (GLuint index, const GLshort *v), (index, v)) \
+    X(void, VertexAttrib4ubv, (GLuint index, const GLubyte *v), (index, v)) \
+    X(void, VertexAttrib4uiv, (GLuint index, const GLuint *v), (index, v)) \
+    X(void, VertexAttrib4usv, (GLuint index, const GLushort *v), (index, v)) \
+    X(void, VertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor)) \
+    X(void, VertexAttribI1i, (GLuint index, GLint x), (index, x)) \
+    X(void, VertexAttribI1iv, (GLuint index, const GLint *v), (index, v)) \
+    X(void, VertexAttribI1ui, (GLuint index, GLuint x), (index, x)) \
+    X(void, VertexAttribI1uiv, (GLuint index, const GLuint *v), (index, v)) \
+    X(void, VertexAttribI2i, (GLuint index, GLint x, GLint y), (index, x, y)) \
+    X(void, VertexAttribI2iv, (GLuint index, const GLint *v), (index, v)) \
+    X(void, VertexAttribI2ui, (GLuint index, GLuint x, GLuint y), (index, x, y)) \
+    X(void, VertexAttribI2uiv, (GLuint index, const GLuint *v), (index, v)) \
+    X(void, VertexAttribI3i, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z)) \
+    X(void, VertexAttribI3iv, (GLuint index, const GLint *v), (index, v)) \
+    X(void, VertexAttribI3ui, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z)) \
+    X(void, VertexAttribI3uiv, (GLuint index, const GLuint *v), (index, v)) \
+    X(void, VertexAttribI4bv, (GLuint index, const GLbyte *v), (index, v)) \
+    X(void, VertexAttribI4i, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w)) \
+    X(void, VertexAttribI4iv, (GLuint index, const GLint *v), (index, v)) \
+    X(void, VertexAttribI4sv, (GLuint index, const GLshort *v), (index, v)) \
+    X(void, VertexAttribI4ubv, (GLuint index, const GLubyte *v), (index, v)) \
+    X(void, VertexAttribI4ui, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w)) \
+    X(void, VertexAttribI4uiv, (GLuint index, const GLuint *v), (index, v)) \
+    X(void, VertexAttribI4usv, (GLuint index, const GLushort *v), (index, v)) \
+    X(void, VertexAttribIPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer)) \
+    X(void, VertexAttribP1ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value)) \
+    X(void, VertexAttribP1uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value)) \
+    X(void, VertexAttribP2ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value)) \
+    X(void, VertexAttribP2uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value)) \
+    X(void, VertexAttribP3ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value)) \
+    X(void, VertexAttribP3uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value)) \
+    X(void, VertexAttribP4ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value)) \
+    X(void, VertexAttribP4uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value)) \
+    X(void, VertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer)) \
+    X(void, VertexP2ui, (GLenum type, GLuint value), (type, value)) \
+    X(void, VertexP2uiv, (GLenum type, const GLuint *value), (type, value)) \
+    X(void, VertexP3ui, (GLenum type, GLuint value), (type, value)) \
+    X(void, VertexP3uiv, (GLenum type, const GLuint *value), (type, value)) \
+    X(void, VertexP4ui, (GLenum type, GLuint value), (type, value)) \
+    X(void, VertexP4uiv, (GLenum type, const GLuint *value), (type, value)) \
+    X(void, Viewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height)) \
+    X(void, WaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+
+#endif
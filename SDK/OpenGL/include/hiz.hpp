@@ -0,0 +1,606 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <algorithm>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include "shader.hpp"
+#include "bounds.hpp"
+#include "instancing.hpp"
+#include "gl_state.hpp"
+
+namespace gl
+{
+	// Hierarchical depth: an R32F mip chain where every texel holds the farthest depth of the pixels below it.
+	// Level 0 is a plain copy of the depth buffer, so screen space effects (e.g. SSR ray marching) can sample it
+	// like the depth texture itself and take large steps through the coarser levels.
+	//
+	// Build after the geometry pass; the depth texture must not be attached to the bound draw framebuffer.
+	class HiZPyramid
+	{
+	public:
+		HiZPyramid() : mTexture(0), mFbo(0), mVao(0), mWidth(0), mHeight(0), mMipCount(0), mBuilt(false) {}
+
+		void Init(GLuint width, GLuint height);
+
+		// Rebuilds every level from a depth texture of the Init size. viewProjection is the camera the depth was
+		// rendered with; culling against the pyramid projects bounds with it. The bound framebuffer, viewport,
+		// program and depth test/blend states are restored.
+		void Build(GLuint depthTexture, const glm::mat4& viewProjection);
+
+		GLuint			 GetTexture()		 const { return mTexture; }
+		GLuint			 GetWidth()			 const { return mWidth; }
+		GLuint			 GetHeight()		 const { return mHeight; }
+		GLuint			 GetMipCount()		 const { return mMipCount; }
+		const glm::mat4& GetViewProjection() const { return mViewProjection; }
+		// False until the first Build
+		bool			 IsBuilt()			 const { return mBuilt; }
+
+	private:
+		void _RenderLevel(GLuint level);
+
+		GLuint mTexture;
+		GLuint mFbo;
+		GLuint mVao;
+		GLuint mWidth;
+		GLuint mHeight;
+		GLuint mMipCount;
+		bool   mBuilt;
+
+		glm::mat4 mViewProjection;
+		Shader	  mCopyShader;
+		Shader	  mReduceShader;
+	};
+
+	namespace hiz
+	{
+		// One triangle covering the viewport, positions made from gl_VertexID
+		const char* const FULLSCREEN_VS = R"(
+#version 400 core
+void main()
+{
+	vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+		const char* const COPY_FS = R"(
+#version 400 core
+uniform sampler2D uDepth;
+layout (location = 0) out float oDepth;
+void main()
+{
+	oDepth = texelFetch(uDepth, ivec2(gl_FragCoord.xy), 0).r;
+}
+)";
+
+		// BASE_LEVEL is the previous level while this runs, so lod 0 reads it
+		const char* const REDUCE_FS = R"(
+#version 400 core
+uniform sampler2D uPrevious;
+layout (location = 0) out float oDepth;
+float Fetch(ivec2 coord, ivec2 last)
+{
+	return texelFetch(uPrevious, min(coord, last), 0).r;
+}
+void main()
+{
+	ivec2 last = textureSize(uPrevious, 0) - 1;
+	ivec2 src  = ivec2(gl_FragCoord.xy) * 2;
+	float depth = max(max(Fetch(src, last), Fetch(src + ivec2(1, 0), last)), max(Fetch(src + ivec2(0, 1), last), Fetch(src + ivec2(1, 1), last)));
+
+	// An odd size leaves a last column/row no texel of this level starts on; the edge texels take it too
+	bool extraX = (last.x & 1) == 0 && src.x + 2 == last.x;
+	bool extraY = (last.y & 1) == 0 && src.y + 2 == last.y;
+	if (extraX)
+	{
+		depth = max(depth, max(Fetch(ivec2(last.x, src.y), last), Fetch(ivec2(last.x, src.y + 1), last)));
+	}
+	if (extraY)
+	{
+		depth = max(depth, max(Fetch(ivec2(src.x, last.y), last), Fetch(ivec2(src.x + 1, last.y), last)));
+	}
+	if (extraX && extraY)
+	{
+		depth = max(depth, Fetch(last, last));
+	}
+	oDepth = depth;
+}
+)";
+	}
+
+	void HiZPyramid::Init(GLuint width, GLuint height)
+	{
+		mWidth	  = width;
+		mHeight	  = height;
+		mMipCount = 1;
+		while ((std::max(width, height) >> mMipCount) > 0)
+		{
+			++mMipCount;
+		}
+
+		glGenTextures(1, &mTexture);
+		GLState::Instance()->BindTexture(GL_TEXTURE_2D, mTexture);
+		for (GLuint level = 0; level < mMipCount; ++level)
+		{
+			glTexImage2D(GL_TEXTURE_2D, level, GL_R32F, std::max(width >> level, 1u), std::max(height >> level, 1u), 0, GL_RED, GL_FLOAT, NULL);
+		}
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mMipCount - 1);
+
+		glGenFramebuffers(1, &mFbo);
+		glGenVertexArrays(1, &mVao);
+
+		mCopyShader.AttachShaderSource(GL_VERTEX_SHADER, hiz::FULLSCREEN_VS);
+		mCopyShader.AttachShaderSource(GL_FRAGMENT_SHADER, hiz::COPY_FS);
+		mCopyShader.Link();
+		mReduceShader.AttachShaderSource(GL_VERTEX_SHADER, hiz::FULLSCREEN_VS);
+		mReduceShader.AttachShaderSource(GL_FRAGMENT_SHADER, hiz::REDUCE_FS);
+		mReduceShader.Link();
+	}
+
+	void HiZPyramid::Build(GLuint depthTexture, const glm::mat4& viewProjection)
+	{
+		assert(mTexture != 0 && "Init the pyramid before building it");
+
+		GLState* state = GLState::Instance();
+		GLint viewport[4];
+		state->GetViewport(viewport);
+		GLuint framebuffer	   = state->GetDrawFramebuffer();
+		GLuint program		   = state->GetProgram();
+		PipelineState pipeline = state->GetPipeline();
+		state->SetPipeline(PipelineState::Overlay());
+
+		state->BindFramebuffer(GL_FRAMEBUFFER, mFbo);
+		state->BindVertexArray(mVao);
+
+		mCopyShader.Active();
+		mCopyShader.SetValue("uDepth", 0);
+		state->BindTexture(0, GL_TEXTURE_2D, depthTexture);
+		_RenderLevel(0);
+
+		// Each level reads only the one above it, so rendering into the texture is never a feedback loop
+		mReduceShader.Active();
+		mReduceShader.SetValue("uPrevious", 0);
+		state->BindTexture(GL_TEXTURE_2D, mTexture);
+		for (GLuint level = 1; level < mMipCount; ++level)
+		{
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level - 1);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level - 1);
+			_RenderLevel(level);
+		}
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mMipCount - 1);
+
+		state->BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		state->SetViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+		state->UseProgram(program);
+		state->SetPipeline(pipeline);
+
+		mViewProjection = viewProjection;
+		mBuilt = true;
+	}
+
+	inline void HiZPyramid::_RenderLevel(GLuint level)
+	{
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture, level);
+		GLState::Instance()->SetViewport(0, 0, std::max(mWidth >> level, 1u), std::max(mHeight >> level, 1u));
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+	}
+
+	enum CullPhase
+	{
+		CULL_PHASE_FIRST = 0,
+		CULL_PHASE_SECOND,
+		CULL_PHASE_COUNT
+	};
+
+	// GPU occlusion culling of instances against a HiZPyramid, in two phases per frame:
+	//
+	//   culler.SetFrustum(projection, view);
+	//   culler.Cull(CULL_PHASE_FIRST, pyramid);		// against last frame's pyramid
+	//   model.DrawIndirect(shader, culler.GetInstances(CULL_PHASE_FIRST), culler.GetCommands(CULL_PHASE_FIRST));
+	//   pyramid.Build(depth, projection * view);
+	//   culler.Cull(CULL_PHASE_SECOND, pyramid);	// what the first phase rejected, against this frame's pyramid
+	//   model.DrawIndirect(shader, culler.GetInstances(CULL_PHASE_SECOND), culler.GetCommands(CULL_PHASE_SECOND));
+	//
+	// The first phase draws what was visible before; the second catches objects that just came out from behind
+	// something, so nothing pops in a frame late. The tests run in a vertex/geometry shader pair with transform
+	// feedback: stream 0 captures the surviving InstanceData, compacted, and stream 1 a visible flag per instance.
+	// The survivors are counted by drawing the captured points into a 1x1 target, and the count is written into the
+	// indirect commands by a second feedback pass, so no result is ever read back to the CPU.
+	class HiZCuller
+	{
+	public:
+		HiZCuller();
+
+		// commands are the templates to fill in, e.g. Model::indirect_commands(); maxInstances bounds SetInstances
+		void Init(const std::vector<DrawElementsIndirectCommand>& commands, GLuint maxInstances);
+
+		// Every instance is tested with the same model space sphere, placed by its model matrix
+		void SetInstances(const std::vector<InstanceData>& instances, const BoundingSphere& sphere);
+		void SetFrustum(const glm::mat4& projection, const glm::mat4& view);
+
+		// The first phase keeps everything in the frustum until the pyramid has been built once
+		void Cull(CullPhase phase, const HiZPyramid& pyramid);
+
+		const InstanceBuffer& GetInstances(CullPhase phase) const { return mPhases[phase].instances; }
+		// GL_DRAW_INDIRECT_BUFFER contents: the Init templates with instanceCount filled in
+		GLuint				  GetCommands(CullPhase phase)	const { return mPhases[phase].commands; }
+
+	private:
+		struct Phase
+		{
+			InstanceBuffer instances;
+			GLuint		   flags;		// one float per instance: passed this phase's test
+			GLuint		   commands;
+			GLuint		   feedback;	// transform feedback object, so the capture can be drawn back
+			GLuint		   vao;			// reads the candidates (and, in the second phase, the first phase's flags)
+		};
+
+		void _CountSurvivors(const Phase& phase);
+		void _WriteCommands(const Phase& phase);
+
+		Phase	mPhases[CULL_PHASE_COUNT];
+		GLuint	mCandidates;
+		GLuint	mCandidateCount;
+		GLuint	mMaxInstances;
+		GLuint	mCommandCount;
+		GLuint	mTemplates;
+		GLuint	mTemplateVao;
+		GLuint	mCommandFeedback;
+		GLuint	mCountTexture;
+		GLuint	mCountFbo;
+		GLuint	mEmptyVao;
+
+		Frustum	  mFrustum;
+		glm::vec4 mSphere;
+
+		Shader mCullShader;
+		Shader mCountShader;
+		Shader mCommandShader;
+	};
+
+	namespace hiz
+	{
+		const char* const CULL_VS = R"(
+#version 400 core
+layout (location = 0) in mat4  aModel;
+layout (location = 4) in vec4  aParams;
+layout (location = 5) in float aFirstVisible;
+
+uniform vec4	  uSphere;
+uniform vec4	  uPlanes[6];
+uniform mat4	  uHiZViewProjection;
+uniform sampler2D uHiZ;
+uniform int		  uHiZMipCount;
+uniform bool	  uHiZBuilt;
+uniform bool	  uSecondPhase;
+
+out mat4  vModel;
+out vec4  vParams;
+out float vVisible;
+out float vEmit;
+
+// The sphere's box is projected with the camera the pyramid was built from; the level where the box spans at most
+// two texels each way gives four conservative samples
+bool Occluded(vec3 center, float radius)
+{
+	vec3 ndcMin = vec3(1.0);
+	vec3 ndcMax = vec3(-1.0);
+	for (int i = 0; i < 8; ++i)
+	{
+		vec3 corner = center + radius * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+		vec4 clip = uHiZViewProjection * vec4(corner, 1.0);
+		// Crossing the near plane: no screen rect, keep it
+		if (clip.w < 1e-4 || clip.z < -clip.w)
+		{
+			return false;
+		}
+		vec3 ndc = clip.xyz / clip.w;
+		ndcMin = min(ndcMin, ndc);
+		ndcMax = max(ndcMax, ndc);
+	}
+
+	ivec2 size0 = textureSize(uHiZ, 0);
+	vec2  pixelMin = clamp(ndcMin.xy * 0.5 + 0.5, 0.0, 1.0) * vec2(size0);
+	vec2  pixelMax = clamp(ndcMax.xy * 0.5 + 0.5, 0.0, 1.0) * vec2(size0);
+	vec2  extent   = pixelMax - pixelMin;
+	int   level	   = clamp(int(ceil(log2(max(max(extent.x, extent.y), 1.0)))), 0, uHiZMipCount - 1);
+
+	ivec2 last = textureSize(uHiZ, level) - 1;
+	ivec2 lo   = min(ivec2(pixelMin) >> level, last);
+	ivec2 hi   = min(ivec2(pixelMax) >> level, last);
+	float farthest = max(max(texelFetch(uHiZ, lo, level).r, texelFetch(uHiZ, ivec2(hi.x, lo.y), level).r),
+						 max(texelFetch(uHiZ, ivec2(lo.x, hi.y), level).r, texelFetch(uHiZ, hi, level).r));
+	return ndcMin.z * 0.5 + 0.5 > farthest;
+}
+
+void main()
+{
+	vModel  = aModel;
+	vParams = aParams;
+
+	vec3  center = (aModel * vec4(uSphere.xyz, 1.0)).xyz;
+	float scale  = sqrt(max(max(dot(aModel[0].xyz, aModel[0].xyz), dot(aModel[1].xyz, aModel[1].xyz)), dot(aModel[2].xyz, aModel[2].xyz)));
+	float radius = uSphere.w * scale;
+
+	bool visible = true;
+	for (int i = 0; i < 6; ++i)
+	{
+		visible = visible && dot(uPlanes[i].xyz, center) + uPlanes[i].w >= -radius;
+	}
+	if (visible && uHiZBuilt)
+	{
+		visible = !Occluded(center, radius);
+	}
+
+	// The second phase only draws what the first one left out
+	vVisible = visible ? 1.0 : 0.0;
+	vEmit	 = visible && !(uSecondPhase && aFirstVisible > 0.5) ? 1.0 : 0.0;
+}
+)";
+
+		const char* const CULL_GS = R"(
+#version 400 core
+layout (points) in;
+layout (points, max_vertices = 2) out;
+
+in mat4  vModel[];
+in vec4  vParams[];
+in float vVisible[];
+in float vEmit[];
+
+layout (stream = 0) out mat4  gModel;
+layout (stream = 0) out vec4  gParams;
+layout (stream = 1) out float gVisible;
+
+void main()
+{
+	if (vEmit[0] > 0.5)
+	{
+		gModel  = vModel[0];
+		gParams = vParams[0];
+		EmitStreamVertex(0);
+	}
+	gVisible = vVisible[0];
+	EmitStreamVertex(1);
+}
+)";
+
+		// Every captured point adds one to the single texel
+		const char* const COUNT_VS = R"(
+#version 400 core
+void main()
+{
+	gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+}
+)";
+
+		const char* const COUNT_FS = R"(
+#version 400 core
+layout (location = 0) out float oCount;
+void main()
+{
+	oCount = 1.0;
+}
+)";
+
+		const char* const COMMAND_VS = R"(
+#version 400 core
+layout (location = 0) in uvec4 aCommand;
+layout (location = 1) in uint  aBaseInstance;
+
+uniform sampler2D uCount;
+
+flat out uvec4 vCommand;
+flat out uint  vBaseInstance;
+
+void main()
+{
+	vCommand	  = uvec4(aCommand.x, uint(texelFetch(uCount, ivec2(0), 0).r + 0.5), aCommand.zw);
+	vBaseInstance = aBaseInstance;
+}
+)";
+	}
+
+	HiZCuller::HiZCuller()
+		: mCandidates(0), mCandidateCount(0), mMaxInstances(0), mCommandCount(0), mTemplates(0), mTemplateVao(0),
+		  mCommandFeedback(0), mCountTexture(0), mCountFbo(0), mEmptyVao(0), mSphere(0.0f)
+	{
+	}
+
+	void HiZCuller::Init(const std::vector<DrawElementsIndirectCommand>& commands, GLuint maxInstances)
+	{
+		mMaxInstances = maxInstances;
+		mCommandCount = static_cast<GLuint>(commands.size());
+
+		glGenBuffers(1, &mCandidates);
+		glBindBuffer(GL_ARRAY_BUFFER, mCandidates);
+		glBufferData(GL_ARRAY_BUFFER, maxInstances * sizeof(InstanceData), nullptr, GL_STATIC_DRAW);
+
+		glGenBuffers(1, &mTemplates);
+		glBindBuffer(GL_ARRAY_BUFFER, mTemplates);
+		glBufferData(GL_ARRAY_BUFFER, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data(), GL_STATIC_DRAW);
+
+		GLState* state = GLState::Instance();
+		glGenVertexArrays(1, &mTemplateVao);
+		state->BindVertexArray(mTemplateVao);
+		glEnableVertexAttribArray(0);
+		glVertexAttribIPointer(0, 4, GL_UNSIGNED_INT, sizeof(DrawElementsIndirectCommand), (void*)0);
+		glEnableVertexAttribArray(1);
+		glVertexAttribIPointer(1, 1, GL_UNSIGNED_INT, sizeof(DrawElementsIndirectCommand), (void*)offsetof(DrawElementsIndirectCommand, baseInstance));
+
+		for (GLuint i = 0; i < CULL_PHASE_COUNT; ++i)
+		{
+			auto& phase = mPhases[i];
+			phase.instances.Allocate(maxInstances);
+
+			glGenBuffers(1, &phase.flags);
+			glBindBuffer(GL_ARRAY_BUFFER, phase.flags);
+			glBufferData(GL_ARRAY_BUFFER, maxInstances * sizeof(GLfloat), nullptr, GL_DYNAMIC_COPY);
+
+			glGenBuffers(1, &phase.commands);
+			glBindBuffer(GL_ARRAY_BUFFER, phase.commands);
+			glBufferData(GL_ARRAY_BUFFER, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data(), GL_DYNAMIC_COPY);
+
+			glGenTransformFeedbacks(1, &phase.feedback);
+			glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, phase.feedback);
+			glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, phase.instances.GetBuffer());
+			glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 1, phase.flags);
+
+			glGenVertexArrays(1, &phase.vao);
+			state->BindVertexArray(phase.vao);
+			glBindBuffer(GL_ARRAY_BUFFER, mCandidates);
+			for (GLuint column = 0; column < 4; ++column)
+			{
+				glEnableVertexAttribArray(column);
+				glVertexAttribPointer(column, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, model) + column * sizeof(glm::vec4)));
+			}
+			glEnableVertexAttribArray(4);
+			glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)offsetof(InstanceData, params));
+			// The first phase writes its flags while the second reads them, so only the second's VAO sources them
+			if (i == CULL_PHASE_SECOND)
+			{
+				glBindBuffer(GL_ARRAY_BUFFER, mPhases[CULL_PHASE_FIRST].flags);
+				glEnableVertexAttribArray(5);
+				glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(GLfloat), (void*)0);
+			}
+		}
+		state->BindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		glGenTransformFeedbacks(1, &mCommandFeedback);
+		glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, 0);
+
+		glGenTextures(1, &mCountTexture);
+		state->BindTexture(GL_TEXTURE_2D, mCountTexture);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, 1, 1, 0, GL_RED, GL_FLOAT, NULL);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		glGenFramebuffers(1, &mCountFbo);
+		state->BindFramebuffer(GL_FRAMEBUFFER, mCountFbo);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mCountTexture, 0);
+		state->BindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		glGenVertexArrays(1, &mEmptyVao);
+
+		const GLchar* cullVaryings[] = { "gModel", "gParams", "gl_NextBuffer", "gVisible" };
+		mCullShader.AttachShaderSource(GL_VERTEX_SHADER, hiz::CULL_VS);
+		mCullShader.AttachShaderSource(GL_GEOMETRY_SHADER, hiz::CULL_GS);
+		glTransformFeedbackVaryings(mCullShader.program(), 4, cullVaryings, GL_INTERLEAVED_ATTRIBS);
+		mCullShader.Link();
+
+		mCountShader.AttachShaderSource(GL_VERTEX_SHADER, hiz::COUNT_VS);
+		mCountShader.AttachShaderSource(GL_FRAGMENT_SHADER, hiz::COUNT_FS);
+		mCountShader.Link();
+
+		const GLchar* commandVaryings[] = { "vCommand", "vBaseInstance" };
+		mCommandShader.AttachShaderSource(GL_VERTEX_SHADER, hiz::COMMAND_VS);
+		glTransformFeedbackVaryings(mCommandShader.program(), 2, commandVaryings, GL_INTERLEAVED_ATTRIBS);
+		mCommandShader.Link();
+	}
+
+	void HiZCuller::SetInstances(const std::vector<InstanceData>& instances, const BoundingSphere& sphere)
+	{
+		assert(instances.size() <= mMaxInstances && "More instances than the culler was initialized for");
+		mCandidateCount = static_cast<GLuint>(instances.size());
+		mSphere = glm::vec4(sphere.center, sphere.radius);
+
+		glBindBuffer(GL_ARRAY_BUFFER, mCandidates);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, instances.size() * sizeof(InstanceData), instances.data());
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	inline void HiZCuller::SetFrustum(const glm::mat4& projection, const glm::mat4& view)
+	{
+		mFrustum.Extract(projection * view);
+	}
+
+	void HiZCuller::Cull(CullPhase phase, const HiZPyramid& pyramid)
+	{
+		auto& target = mPhases[phase];
+
+		GLState* state = GLState::Instance();
+		GLuint program = state->GetProgram();
+
+		glm::vec4 planes[Frustum::PLANE_COUNT];
+		for (GLuint i = 0; i < Frustum::PLANE_COUNT; ++i)
+		{
+			planes[i] = mFrustum.GetPlane(i);
+		}
+
+		GLuint cull = mCullShader.program();
+		mCullShader.Active();
+		glUniform4fv(glGetUniformLocation(cull, "uSphere"), 1, glm::value_ptr(mSphere));
+		glUniform4fv(glGetUniformLocation(cull, "uPlanes"), Frustum::PLANE_COUNT, glm::value_ptr(planes[0]));
+		mCullShader.SetMatrix("uHiZViewProjection", pyramid.GetViewProjection());
+		mCullShader.SetValue("uHiZ", 0);
+		mCullShader.SetValue("uHiZMipCount", static_cast<int>(pyramid.GetMipCount()));
+		mCullShader.SetValue("uHiZBuilt", pyramid.IsBuilt());
+		mCullShader.SetValue("uSecondPhase", phase == CULL_PHASE_SECOND);
+		state->BindTexture(0, GL_TEXTURE_2D, pyramid.GetTexture());
+
+		glEnable(GL_RASTERIZER_DISCARD);
+		state->BindVertexArray(target.vao);
+		glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, target.feedback);
+		glBeginTransformFeedback(GL_POINTS);
+		glDrawArrays(GL_POINTS, 0, mCandidateCount);
+		glEndTransformFeedback();
+		glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, 0);
+		glDisable(GL_RASTERIZER_DISCARD);
+
+		_CountSurvivors(target);
+		_WriteCommands(target);
+
+		state->UseProgram(program);
+	}
+
+	void HiZCuller::_CountSurvivors(const Phase& phase)
+	{
+		GLState* state = GLState::Instance();
+		GLint viewport[4];
+		GLfloat clearColor[4];
+		state->GetViewport(viewport);
+		state->GetClearColor(clearColor);
+		GLuint framebuffer	   = state->GetDrawFramebuffer();
+		PipelineState pipeline = state->GetPipeline();
+
+		state->BindFramebuffer(GL_FRAMEBUFFER, mCountFbo);
+		state->SetViewport(0, 0, 1, 1);
+		state->SetClearColor(0.f, 0.f, 0.f, 0.f);
+		glClear(GL_COLOR_BUFFER_BIT);
+		state->SetPipeline(PipelineState::Overlay().WithBlend(true, GL_ONE, GL_ONE));
+
+		mCountShader.Active();
+		state->BindVertexArray(mEmptyVao);
+		glDrawTransformFeedbackStream(GL_POINTS, phase.feedback, 0);
+
+		state->BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		state->SetViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+		state->SetClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+		state->SetPipeline(pipeline);
+	}
+
+	void HiZCuller::_WriteCommands(const Phase& phase)
+	{
+		mCommandShader.Active();
+		mCommandShader.SetValue("uCount", 0);
+		GLState::Instance()->BindTexture(0, GL_TEXTURE_2D, mCountTexture);
+
+		glEnable(GL_RASTERIZER_DISCARD);
+		GLState::Instance()->BindVertexArray(mTemplateVao);
+		glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, mCommandFeedback);
+		glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, phase.commands);
+		glBeginTransformFeedback(GL_POINTS);
+		glDrawArrays(GL_POINTS, 0, mCommandCount);
+		glEndTransformFeedback();
+		glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, 0);
+		glDisable(GL_RASTERIZER_DISCARD);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,292 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "gl_state.hpp"
+#include "gl_trace.hpp"
+
+namespace gl
+{
+	// Image based lighting precompute results kept on disk, so a warm start uploads them instead of rendering
+	// them again. The file is
+	//
+	//     uint32 IBL_CACHE_MAGIC, uint32 IBL_CACHE_VERSION, uint64 key, uint32 texture count
+	//
+	// then per texture a uint16 length and the name, uint32 target, internal format, format, type, width, height
+	// and level count, and the pixels of every level (of every face, +X to -Z, for a cubemap) with rows packed to
+	// one byte. The key hashes the content of the inputs and the parameters; a file with another key, magic or
+	// version counts as empty and is overwritten by the next Save.
+	static const uint32_t IBL_CACHE_MAGIC	= 0x434C4249;		// "IBLC"
+	static const uint32_t IBL_CACHE_VERSION = 1;
+
+	class IBLCache
+	{
+	public:
+		explicit IBLCache(const std::string& path) : mPath(path), mKey(0), mDirty(false) {}
+
+		// Every input file's content and every parameter that shapes the results. A missing file hashes as empty.
+		void SetKey(const std::vector<std::string>& files, const std::vector<uint32_t>& parameters);
+		// Reads the file; false, leaving the cache empty, if there is none for this key
+		bool Load();
+		// Writes the file if Add changed the cache since the last Load or Save
+		bool Save();
+
+		bool Has(const std::string& name) const { return _Find(name) != nullptr; }
+		// A new texture with the cached levels, clamped to edge and linearly filtered between them. Its level range
+		// ends at the last cached level, so glGenerateMipmap on it adds nothing; derive more levels from a copy.
+		GLuint CreateTexture(const std::string& name) const;
+		// Reads the first `levels` levels of a texture back into the cache. format and type are what is stored;
+		// pick ones that hold the internal format exactly, e.g. GL_HALF_FLOAT for the 16F formats.
+		void Add(const std::string& name, GLenum target, GLuint texture, GLuint levels, GLenum internalFormat, GLenum format, GLenum type);
+
+		uint64_t GetKey() const { return mKey; }
+
+	private:
+		struct Texture
+		{
+			std::string		  name;
+			uint32_t		  target;
+			uint32_t		  internalFormat;
+			uint32_t		  format;
+			uint32_t		  type;
+			uint32_t		  width;
+			uint32_t		  height;
+			uint32_t		  levels;
+			std::vector<char> pixels;
+		};
+
+		const Texture* _Find(const std::string& name) const;
+		static size_t  _ImageSize(const Texture& texture, GLuint level);
+		static GLuint  _FaceCount(GLenum target) { return target == GL_TEXTURE_CUBE_MAP ? 6 : 1; }
+		static GLenum  _FaceTarget(GLenum target, GLuint face) { return target == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face : target; }
+
+		std::string			 mPath;
+		uint64_t			 mKey;
+		std::vector<Texture> mTextures;
+		bool				 mDirty;
+	};
+
+	void IBLCache::SetKey(const std::vector<std::string>& files, const std::vector<uint32_t>& parameters)
+	{
+		std::vector<uint64_t> hashes;
+		for (auto& path : files)
+		{
+			std::ifstream file(path, std::ios::binary | std::ios::ate);
+			std::vector<char> data(file ? static_cast<size_t>(file.tellg()) : 0);
+			file.seekg(0);
+			file.read(data.data(), data.size());
+			hashes.push_back(TraceHash(data.data(), data.size()));
+		}
+		for (uint32_t parameter : parameters)
+		{
+			hashes.push_back(parameter);
+		}
+		hashes.push_back(IBL_CACHE_VERSION);
+		mKey = TraceHash(hashes.data(), hashes.size() * sizeof(uint64_t));
+	}
+
+	bool IBLCache::Load()
+	{
+		mTextures.clear();
+		mDirty = false;
+
+		std::ifstream file(mPath, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			return false;
+		}
+		std::vector<char> data(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(data.data(), data.size());
+
+		size_t offset = 0;
+		auto read = [&data, &offset](void* value, size_t size)
+		{
+			if (offset + size > data.size())
+			{
+				return false;
+			}
+			std::memcpy(value, data.data() + offset, size);
+			offset += size;
+			return true;
+		};
+
+		uint32_t magic = 0, version = 0, count = 0;
+		uint64_t key = 0;
+		if (!read(&magic, 4) || !read(&version, 4) || !read(&key, 8) || !read(&count, 4) ||
+			magic != IBL_CACHE_MAGIC || version != IBL_CACHE_VERSION || key != mKey)
+		{
+			return false;
+		}
+
+		std::vector<Texture> textures(count);
+		for (auto& texture : textures)
+		{
+			uint16_t length = 0;
+			if (!read(&length, 2) || offset + length > data.size())
+			{
+				return false;
+			}
+			texture.name.assign(data.data() + offset, length);
+			offset += length;
+			if (!read(&texture.target, 4) || !read(&texture.internalFormat, 4) || !read(&texture.format, 4) || !read(&texture.type, 4) ||
+				!read(&texture.width, 4) || !read(&texture.height, 4) || !read(&texture.levels, 4))
+			{
+				return false;
+			}
+
+			size_t size = 0;
+			for (GLuint level = 0; level < texture.levels; ++level)
+			{
+				size += _ImageSize(texture, level) * _FaceCount(texture.target);
+			}
+			if (size == 0 || offset + size > data.size())
+			{
+				return false;
+			}
+			texture.pixels.assign(data.begin() + offset, data.begin() + offset + size);
+			offset += size;
+		}
+		mTextures.swap(textures);
+		return true;
+	}
+
+	bool IBLCache::Save()
+	{
+		if (!mDirty)
+		{
+			return true;
+		}
+		std::ofstream file(mPath, std::ios::binary | std::ios::trunc);
+		if (!file)
+		{
+			return false;
+		}
+
+		uint32_t count = static_cast<uint32_t>(mTextures.size());
+		file.write(reinterpret_cast<const char*>(&IBL_CACHE_MAGIC), 4);
+		file.write(reinterpret_cast<const char*>(&IBL_CACHE_VERSION), 4);
+		file.write(reinterpret_cast<const char*>(&mKey), 8);
+		file.write(reinterpret_cast<const char*>(&count), 4);
+		for (auto& texture : mTextures)
+		{
+			uint16_t length = static_cast<uint16_t>(texture.name.size());
+			file.write(reinterpret_cast<const char*>(&length), 2);
+			file.write(texture.name.data(), length);
+			for (uint32_t value : { texture.target, texture.internalFormat, texture.format, texture.type, texture.width, texture.height, texture.levels })
+			{
+				file.write(reinterpret_cast<const char*>(&value), 4);
+			}
+			file.write(texture.pixels.data(), texture.pixels.size());
+		}
+		mDirty = !file.good();
+		return !mDirty;
+	}
+
+	GLuint IBLCache::CreateTexture(const std::string& name) const
+	{
+		const Texture* texture = _Find(name);
+		if (!texture)
+		{
+			return 0;
+		}
+
+		// GL 4.0 has no glTexStorage; every level and face is allocated and filled by one glTexImage2D
+		GLuint id;
+		glGenTextures(1, &id);
+		GLState::Instance()->BindTexture(texture->target, id);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		const char* pixels = texture->pixels.data();
+		for (GLuint level = 0; level < texture->levels; ++level)
+		{
+			GLsizei width  = std::max(texture->width >> level, 1u);
+			GLsizei height = std::max(texture->height >> level, 1u);
+			for (GLuint face = 0; face < _FaceCount(texture->target); ++face)
+			{
+				glTexImage2D(_FaceTarget(texture->target, face), level, texture->internalFormat, width, height, 0, texture->format, texture->type, pixels);
+				pixels += _ImageSize(*texture, level);
+			}
+		}
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+		glTexParameteri(texture->target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(texture->target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(texture->target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		glTexParameteri(texture->target, GL_TEXTURE_MIN_FILTER, texture->levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+		glTexParameteri(texture->target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(texture->target, GL_TEXTURE_MAX_LEVEL, texture->levels - 1);
+		return id;
+	}
+
+	void IBLCache::Add(const std::string& name, GLenum target, GLuint texture, GLuint levels, GLenum internalFormat, GLenum format, GLenum type)
+	{
+		Texture entry;
+		entry.name			 = name;
+		entry.target		 = target;
+		entry.internalFormat = internalFormat;
+		entry.format		 = format;
+		entry.type			 = type;
+		entry.levels		 = levels;
+
+		GLState::Instance()->BindTexture(target, texture);
+		GLint width = 0, height = 0;
+		glGetTexLevelParameteriv(_FaceTarget(target, 0), 0, GL_TEXTURE_WIDTH, &width);
+		glGetTexLevelParameteriv(_FaceTarget(target, 0), 0, GL_TEXTURE_HEIGHT, &height);
+		entry.width	 = static_cast<uint32_t>(std::max(width, 1));
+		entry.height = static_cast<uint32_t>(std::max(height, 1));
+
+		size_t size = 0;
+		for (GLuint level = 0; level < levels; ++level)
+		{
+			size += _ImageSize(entry, level) * _FaceCount(target);
+		}
+		entry.pixels.resize(size);
+
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		char* pixels = entry.pixels.data();
+		for (GLuint level = 0; level < levels; ++level)
+		{
+			for (GLuint face = 0; face < _FaceCount(target); ++face)
+			{
+				glGetTexImage(_FaceTarget(target, face), level, format, type, pixels);
+				pixels += _ImageSize(entry, level);
+			}
+		}
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+		for (auto& existing : mTextures)
+		{
+			if (existing.name == name)
+			{
+				existing = std::move(entry);
+				mDirty = true;
+				return;
+			}
+		}
+		mTextures.push_back(std::move(entry));
+		mDirty = true;
+	}
+
+	inline const IBLCache::Texture* IBLCache::_Find(const std::string& name) const
+	{
+		for (auto& texture : mTextures)
+		{
+			if (texture.name == name)
+			{
+				return &texture;
+			}
+		}
+		return nullptr;
+	}
+
+	size_t IBLCache::_ImageSize(const Texture& texture, GLuint level)
+	{
+		size_t components = texture.format == GL_RED ? 1 : texture.format == GL_RG ? 2 : texture.format == GL_RGB ? 3 : 4;
+		size_t bytes	   = texture.type == GL_FLOAT ? 4 : texture.type == GL_HALF_FLOAT ? 2 : 1;
+		return components * bytes * std::max(texture.width >> level, 1u) * std::max(texture.height >> level, 1u);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstdlib>
+
+namespace gl
+{
+	// How far an RGB8 image is from its reference
+	struct ImageDiff
+	{
+		double psnr;		// dB over all channels, infinity for identical images
+		double ssim;		// mean over 8x8 luma windows, 1 for identical images
+		GLuint maxError;	// largest difference of any channel
+		GLuint pixels;		// pixels with any difference
+
+		ImageDiff() : psnr(std::numeric_limits<double>::infinity()), ssim(1.0), maxError(0), pixels(0) {}
+	};
+
+	// The worst an image may get before the check fails
+	struct ImageTolerance
+	{
+		double minPsnr;
+		double minSsim;
+		GLuint maxError;
+
+		ImageTolerance() : minPsnr(40.0), minSsim(0.99), maxError(255) {}
+
+		bool Accepts(const ImageDiff& diff) const
+		{
+			return diff.psnr >= minPsnr && diff.ssim >= minSsim && diff.maxError <= maxError;
+		}
+	};
+
+	// Compares two RGB8 images of width x height. heatmap, if given, receives an RGB8 image of the per-pixel
+	// largest channel difference, black through red to yellow at 64 and above, over a dimmed copy of the
+	// reference for orientation.
+	ImageDiff CompareImages(const unsigned char* reference, const unsigned char* image, int width, int height,
+							std::vector<unsigned char>* heatmap = nullptr)
+	{
+		ImageDiff diff;
+		size_t count = static_cast<size_t>(width) * height;
+		if (heatmap)
+		{
+			heatmap->resize(count * 3);
+		}
+
+		double squared = 0.0;
+		std::vector<double> lumaReference(count), lumaImage(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			const unsigned char* a = reference + i * 3;
+			const unsigned char* b = image + i * 3;
+			GLuint largest = 0;
+			for (int c = 0; c < 3; ++c)
+			{
+				int error = std::abs(a[c] - b[c]);
+				squared += error * error;
+				largest = std::max<GLuint>(largest, error);
+			}
+			diff.maxError = std::max(diff.maxError, largest);
+			diff.pixels += largest > 0;
+
+			lumaReference[i] = 0.299 * a[0] + 0.587 * a[1] + 0.114 * a[2];
+			lumaImage[i]	 = 0.299 * b[0] + 0.587 * b[1] + 0.114 * b[2];
+
+			if (heatmap)
+			{
+				double heat	 = std::min(largest / 64.0, 1.0);
+				double base	 = largest ? 0.0 : lumaReference[i] * 0.25;
+				unsigned char* out = &(*heatmap)[i * 3];
+				out[0] = static_cast<unsigned char>(std::min(255.0, base + 255.0 * std::min(heat * 2.0, 1.0)));
+				out[1] = static_cast<unsigned char>(std::min(255.0, base + 255.0 * std::max(heat * 2.0 - 1.0, 0.0)));
+				out[2] = static_cast<unsigned char>(base);
+			}
+		}
+
+		double mse = squared / (count * 3);
+		if (mse > 0.0)
+		{
+			diff.psnr = 10.0 * std::log10(255.0 * 255.0 / mse);
+		}
+
+		// Wang et al. 2004 on 8x8 windows every 4 pixels
+		const int window = 8, stride = 4;
+		const double c1 = (0.01 * 255) * (0.01 * 255), c2 = (0.03 * 255) * (0.03 * 255);
+		double total = 0.0;
+		GLuint windows = 0;
+		for (int y = 0; y + window <= height; y += stride)
+		{
+			for (int x = 0; x + window <= width; x += stride)
+			{
+				double meanA = 0.0, meanB = 0.0;
+				for (int j = 0; j < window; ++j)
+				{
+					for (int i = 0; i < window; ++i)
+					{
+						size_t pixel = static_cast<size_t>(y + j) * width + x + i;
+						meanA += lumaReference[pixel];
+						meanB += lumaImage[pixel];
+					}
+				}
+				meanA /= window * window;
+				meanB /= window * window;
+
+				double varianceA = 0.0, varianceB = 0.0, covariance = 0.0;
+				for (int j = 0; j < window; ++j)
+				{
+					for (int i = 0; i < window; ++i)
+					{
+						size_t pixel = static_cast<size_t>(y + j) * width + x + i;
+						double a = lumaReference[pixel] - meanA;
+						double b = lumaImage[pixel] - meanB;
+						varianceA  += a * a;
+						varianceB  += b * b;
+						covariance += a * b;
+					}
+				}
+				varianceA  /= window * window - 1;
+				varianceB  /= window * window - 1;
+				covariance /= window * window - 1;
+
+				total += (2.0 * meanA * meanB + c1) * (2.0 * covariance + c2) /
+						 ((meanA * meanA + meanB * meanB + c1) * (varianceA + varianceB + c2));
+				++windows;
+			}
+		}
+		if (windows)
+		{
+			diff.ssim = total / windows;
+		}
+		return diff;
+	}
+
+	// Per-image tolerances, one line per image:
+	//
+	//     <image name or *> <min PSNR dB> <min SSIM> <max channel error>
+	//
+	// '#' starts a comment; a name line overrides the * line, which overrides the ImageTolerance defaults.
+	class ImageTolerances
+	{
+	public:
+		bool Load(const std::string& path)
+		{
+			std::ifstream in(path);
+			if (!in)
+			{
+				return false;
+			}
+
+			std::string line;
+			while (std::getline(in, line))
+			{
+				line = line.substr(0, line.find('#'));
+				std::istringstream fields(line);
+				std::string name;
+				ImageTolerance tolerance;
+				if (fields >> name >> tolerance.minPsnr >> tolerance.minSsim >> tolerance.maxError)
+				{
+					if (name == "*")
+					{
+						mDefault = tolerance;
+					}
+					else
+					{
+						mImages.emplace_back(name, tolerance);
+					}
+				}
+			}
+			return true;
+		}
+
+		const ImageTolerance& For(const std::string& image) const
+		{
+			for (const auto& entry : mImages)
+			{
+				if (entry.first == image)
+				{
+					return entry.second;
+				}
+			}
+			return mDefault;
+		}
+
+	private:
+		ImageTolerance									  mDefault;
+		std::vector<std::pair<std::string, ImageTolerance>> mImages;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cassert>
+#include <glm/glm.hpp>
+#include "gl_state.hpp"
+
+namespace gl
+{
+	// Per-instance data streamed as vertex attributes: a model matrix plus four free material parameters
+	// (e.g. metallic/roughness). Shaders read them as:
+	//   layout (location = 5) in mat4 aInstanceModel;
+	//   layout (location = 9) in vec4 aInstanceParams;
+	struct InstanceData
+	{
+		glm::mat4 model;
+		glm::vec4 params;
+
+		InstanceData() : model(1.0f), params(0.0f) {}
+		InstanceData(const glm::mat4& tModel, const glm::vec4& tParams = glm::vec4(0.0f)) : model(tModel), params(tParams) {}
+	};
+
+	// Layout glDrawElementsIndirect reads from GL_DRAW_INDIRECT_BUFFER. baseInstance must stay 0 before GL 4.2.
+	struct DrawElementsIndirectCommand
+	{
+		GLuint count;
+		GLuint instanceCount;
+		GLuint firstIndex;
+		GLint  baseVertex;
+		GLuint baseInstance;
+
+		DrawElementsIndirectCommand(GLuint tCount = 0, GLuint tFirstIndex = 0, GLint tBaseVertex = 0)
+			: count(tCount), instanceCount(0), firstIndex(tFirstIndex), baseVertex(tBaseVertex), baseInstance(0) {}
+	};
+
+	class InstanceBuffer
+	{
+	public:
+		// Mesh uses attributes 0-4, so instance data starts right after
+		static const GLuint ATTRIB_MODEL  = 5;
+		static const GLuint ATTRIB_PARAMS = 9;
+
+		InstanceBuffer() : mVbo(0), mCapacity(0), mCount(0) {}
+
+		void Upload(const InstanceData* pData, GLuint count);
+		void Upload(const std::vector<InstanceData>& instances) { Upload(instances.data(), static_cast<GLuint>(instances.size())); }
+
+		// Storage for up to capacity instances that the GPU fills itself (e.g. transform feedback). count() is the
+		// capacity; draws take the real number from an indirect command.
+		void Allocate(GLuint capacity);
+
+		// Points the VAO's instance attributes at this buffer; a no-op when it already is.
+		// Later uploads reuse the same buffer name, so the VAO never needs re-attaching for them.
+		void Attach(GLuint vao) const;
+		// Deletes the buffer through GLState, so no VAO is still recorded as attached to its name
+		void Release();
+
+		GLuint count()	   const { return mCount; }
+		GLuint GetBuffer() const { return mVbo; }
+
+	private:
+		GLuint mVbo;
+		GLuint mCapacity;
+		GLuint mCount;
+	};
+
+	void InstanceBuffer::Upload(const InstanceData* pData, GLuint count)
+	{
+		if (!mVbo)
+		{
+			glGenBuffers(1, &mVbo);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, mVbo);
+		if (count > mCapacity)
+		{
+			// Grow geometrically so per-frame uploads of a changing visible set rarely reallocate
+			mCapacity = std::max(count, mCapacity * 2);
+			glBufferData(GL_ARRAY_BUFFER, mCapacity * sizeof(InstanceData), nullptr, GL_STREAM_DRAW);
+		}
+		if (count > 0)
+		{
+			glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(InstanceData), pData);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		mCount = count;
+	}
+
+	void InstanceBuffer::Allocate(GLuint capacity)
+	{
+		if (!mVbo)
+		{
+			glGenBuffers(1, &mVbo);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, mVbo);
+		glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(InstanceData), nullptr, GL_DYNAMIC_COPY);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		mCapacity = capacity;
+		mCount	  = capacity;
+	}
+
+	void InstanceBuffer::Attach(GLuint vao) const
+	{
+		assert(mVbo != 0 && "Upload instances before drawing with them");
+		GLState* state = GLState::Instance();
+		if (state->GetInstanceBuffer(vao) == mVbo)
+		{
+			return;
+		}
+
+		state->BindVertexArray(vao);
+		glBindBuffer(GL_ARRAY_BUFFER, mVbo);
+		for (GLuint i = 0; i < 4; ++i)
+		{
+			glEnableVertexAttribArray(ATTRIB_MODEL + i);
+			glVertexAttribPointer(ATTRIB_MODEL + i, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, model) + i * sizeof(glm::vec4)));
+			glVertexAttribDivisor(ATTRIB_MODEL + i, 1);
+		}
+		glEnableVertexAttribArray(ATTRIB_PARAMS);
+		glVertexAttribPointer(ATTRIB_PARAMS, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)offsetof(InstanceData, params));
+		glVertexAttribDivisor(ATTRIB_PARAMS, 1);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		state->SetInstanceBuffer(vao, mVbo);
+	}
+
+	inline void InstanceBuffer::Release()
+	{
+		if (mVbo)
+		{
+			GLState::Instance()->DeleteBuffer(mVbo);
+		}
+		mVbo	  = 0;
+		mCapacity = 0;
+		mCount	  = 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,244 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <glm/glm.hpp>
+#include "shader.hpp"
+#include "gl_state.hpp"
+
+namespace gl
+{
+	// A point light as lighting shaders read it: two vec4s, (position, linear) and (color, quadratic)
+	struct PointLight
+	{
+		glm::vec3 position;		// world space
+		GLfloat	  linear;
+		glm::vec3 color;
+		GLfloat	  quadratic;	// the constant attenuation term is always 1
+
+		PointLight() : position(), linear(0.f), color(1.f), quadratic(1.f) {}
+		PointLight(const glm::vec3& tPosition, const glm::vec3& tColor, GLfloat tLinear = 0.f, GLfloat tQuadratic = 1.f)
+			: position(tPosition), linear(tLinear), color(tColor), quadratic(tQuadratic) {}
+
+		// Distance at which the brightest channel has fallen to threshold (5/256: below what 8 bit output shows)
+		GLfloat Radius(GLfloat threshold = 5.f / 256.f) const
+		{
+			GLfloat brightest = std::max(std::max(color.r, color.g), color.b);
+			// 1 / (1 + linear d + quadratic d^2) = threshold / brightest
+			GLfloat c = 1.f - brightest / threshold;
+			if (c >= 0.f)
+			{
+				return 0.f;
+			}
+			if (quadratic <= 0.f)
+			{
+				return linear > 0.f ? -c / linear : 1e30f;
+			}
+			return (-linear + std::sqrt(linear * linear - 4.f * quadratic * c)) / (2.f * quadratic);
+		}
+	};
+
+	// Lights in one tightly packed array on the CPU and in one buffer object on the GPU. Changing a light only
+	// marks it dirty; Upload then sends each run of consecutive dirty lights with one glBufferSubData, so its cost
+	// follows the lights that changed, and nothing at all when none did.
+	//
+	// Shaders read the buffer either as a uniform block, for up to MAX_UNIFORM_LIGHTS lights:
+	//
+	//     struct Light
+	//     {
+	//         vec4 PositionLinear;    // xyz position, w linear attenuation
+	//         vec4 ColorQuadratic;    // rgb color, w quadratic attenuation
+	//     };
+	//     layout (std140) uniform LightBlock
+	//     {
+	//         Light lights[256];
+	//     };
+	//     uniform int uLightCount;
+	//
+	// or, for any number, as an RGBA32F texture buffer with light i at texels 2i and 2i + 1:
+	//
+	//     uniform samplerBuffer uLightData;
+	//     uniform int uLightCount;
+	class LightBuffer
+	{
+	public:
+		// What the LightBlock declaration holds: 8 KB, well inside the 16 KB every GL 4.0 driver offers
+		static const GLuint MAX_UNIFORM_LIGHTS = 256;
+		static const GLuint BLOCK_BINDING	   = 0;
+
+		LightBuffer() : mBuffer(0), mTexture(0), mCapacity(0), mUploaded(0) {}
+
+		void Resize(GLuint count);
+		void Set(const std::vector<PointLight>& lights);
+		void Set(GLuint index, const PointLight& light);
+		void SetPosition(GLuint index, const glm::vec3& position);
+		void SetColor(GLuint index, const glm::vec3& color);
+
+		const PointLight& Get(GLuint index) const { return mLights[index]; }
+		const std::vector<PointLight>& GetLights() const { return mLights; }
+		GLuint GetCount() const { return static_cast<GLuint>(mLights.size()); }
+
+		// Sends the dirty lights; call once a frame before drawing with them
+		void Upload();
+		// Lights sent by the last Upload
+		GLuint GetUploadedCount() const { return mUploaded; }
+
+		// Once per shader, and again when the light count changes; the shader must be active. Points its
+		// LightBlock, or its uLightData at texture unit `unit`, to where Bind* puts the buffer and sets uLightCount.
+		void AttachUniformBlock(const Shader& shader) const;
+		void AttachTexture(const Shader& shader, GLuint unit) const;
+
+		// Every frame, before drawing with an attached shader
+		void BindUniformBlock() const;
+		void BindTexture(GLuint unit) const;
+
+		GLuint GetBuffer() const { return mBuffer; }
+
+	private:
+		void _MarkDirty(GLuint index);
+
+		std::vector<PointLight> mLights;
+		std::vector<GLuint>		mDirty;			// indices, each once
+		std::vector<bool>		mIsDirty;
+		GLuint					mBuffer;
+		GLuint					mTexture;
+		GLuint					mCapacity;		// lights the buffer object holds
+		GLuint					mUploaded;
+	};
+
+	void LightBuffer::Resize(GLuint count)
+	{
+		GLuint previous = GetCount();
+		mLights.resize(count);
+		mIsDirty.resize(count, false);
+		mDirty.erase(std::remove_if(mDirty.begin(), mDirty.end(), [count](GLuint index) { return index >= count; }), mDirty.end());
+		for (GLuint i = previous; i < count; ++i)
+		{
+			_MarkDirty(i);
+		}
+	}
+
+	void LightBuffer::Set(const std::vector<PointLight>& lights)
+	{
+		Resize(static_cast<GLuint>(lights.size()));
+		for (GLuint i = 0; i < lights.size(); ++i)
+		{
+			Set(i, lights[i]);
+		}
+	}
+
+	inline void LightBuffer::Set(GLuint index, const PointLight& light)
+	{
+		assert(index < GetCount());
+		mLights[index] = light;
+		_MarkDirty(index);
+	}
+
+	inline void LightBuffer::SetPosition(GLuint index, const glm::vec3& position)
+	{
+		assert(index < GetCount());
+		mLights[index].position = position;
+		_MarkDirty(index);
+	}
+
+	inline void LightBuffer::SetColor(GLuint index, const glm::vec3& color)
+	{
+		assert(index < GetCount());
+		mLights[index].color = color;
+		_MarkDirty(index);
+	}
+
+	inline void LightBuffer::_MarkDirty(GLuint index)
+	{
+		if (!mIsDirty[index])
+		{
+			mIsDirty[index] = true;
+			mDirty.push_back(index);
+		}
+	}
+
+	void LightBuffer::Upload()
+	{
+		static_assert(sizeof(PointLight) == 2 * sizeof(glm::vec4), "PointLight is two vec4s");
+
+		mUploaded = 0;
+		if (mBuffer && mDirty.empty())
+		{
+			return;
+		}
+		if (!mBuffer)
+		{
+			glGenBuffers(1, &mBuffer);
+			glGenTextures(1, &mTexture);
+		}
+
+		glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+		if (GetCount() > mCapacity || mCapacity == 0)
+		{
+			// The uniform block always declares MAX_UNIFORM_LIGHTS, so the buffer never holds fewer; a new store
+			// takes every light
+			mCapacity = std::max(std::max(GetCount(), mCapacity * 2), static_cast<GLuint>(MAX_UNIFORM_LIGHTS));
+			glBufferData(GL_UNIFORM_BUFFER, mCapacity * sizeof(PointLight), nullptr, GL_DYNAMIC_DRAW);
+			GLState::Instance()->BindTexture(GL_TEXTURE_BUFFER, mTexture);
+			glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, mBuffer);
+
+			mDirty.resize(GetCount());
+			for (GLuint i = 0; i < GetCount(); ++i)
+			{
+				mDirty[i]	= i;
+				mIsDirty[i] = true;
+			}
+		}
+
+		std::sort(mDirty.begin(), mDirty.end());
+		for (size_t first = 0; first < mDirty.size();)
+		{
+			size_t last = first;
+			while (last + 1 < mDirty.size() && mDirty[last + 1] == mDirty[last] + 1)
+			{
+				++last;
+			}
+			GLuint begin = mDirty[first];
+			GLuint count = static_cast<GLuint>(last - first + 1);
+			glBufferSubData(GL_UNIFORM_BUFFER, begin * sizeof(PointLight), count * sizeof(PointLight), &mLights[begin]);
+			mUploaded += count;
+			first = last + 1;
+		}
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		for (GLuint index : mDirty)
+		{
+			mIsDirty[index] = false;
+		}
+		mDirty.clear();
+	}
+
+	void LightBuffer::AttachUniformBlock(const Shader& shader) const
+	{
+		assert(GetCount() <= MAX_UNIFORM_LIGHTS && "Too many lights for the uniform block, attach as a texture");
+		GLuint block = glGetUniformBlockIndex(shader.program(), "LightBlock");
+		if (block != GL_INVALID_INDEX)
+		{
+			glUniformBlockBinding(shader.program(), block, BLOCK_BINDING);
+		}
+		shader.SetValue("uLightCount", static_cast<int>(GetCount()));
+	}
+
+	void LightBuffer::AttachTexture(const Shader& shader, GLuint unit) const
+	{
+		shader.SetValue("uLightData", static_cast<int>(unit));
+		shader.SetValue("uLightCount", static_cast<int>(GetCount()));
+	}
+
+	inline void LightBuffer::BindUniformBlock() const
+	{
+		glBindBufferBase(GL_UNIFORM_BUFFER, BLOCK_BINDING, mBuffer);
+	}
+
+	inline void LightBuffer::BindTexture(GLuint unit) const
+	{
+		GLState::Instance()->BindTexture(unit, GL_TEXTURE_BUFFER, mTexture);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,394 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include "shader.hpp"
+#include "gl_state.hpp"
+#include "light_buffer.hpp"
+#include "thread_pool.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GL_CLUSTERS_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace gl
+{
+	// Clustered light culling: the view frustum is cut into TILES_X x TILES_Y screen tiles and SLICES depth slices
+	// spaced exponentially between near and far, and every cluster gets the list of lights whose sphere of
+	// influence (PointLight::Radius) can reach it. Shading then loops over the lights of a pixel's cluster only.
+	//
+	// The assignment runs on the CPU (GL 4.0 has no compute shaders), four lights at a time with SSE and in
+	// blocks of lights spread over the ThreadPool, and is uploaded into texture buffers a fragment shader reads
+	// with texelFetch, next to the lights themselves from a LightBuffer bound as uLightData:
+	//
+	//     uClusterGrid   usamplerBuffer  RG32UI per cluster: offset into uLightIndices and light count
+	//     uLightIndices  usamplerBuffer  R16UI light indices, the lists of all clusters back to back
+	//
+	// Cluster (x, y, z) is texel x + TILES_X * (y + TILES_Y * z); x and y count from the bottom left of the
+	// viewport, z is floor(log(view depth) * uSliceScale + uSliceBias).
+	class LightClusters
+	{
+	public:
+		static const GLuint TILES_X = 16;
+		static const GLuint TILES_Y = 9;
+		static const GLuint SLICES	= 24;
+		static const GLuint CLUSTER_COUNT = TILES_X * TILES_Y * SLICES;
+		// Lights per ThreadPool job; fewer than this are assigned on the calling thread
+		static const GLuint LIGHT_BLOCK = 256;
+
+		LightClusters()
+			: mGridBuffer(0), mGridTexture(0), mIndexBuffer(0), mIndexTexture(0),
+			  mIndexCapacity(0), mNear(0.1f), mFar(100.f), mSliceScale(0.f), mSliceBias(0.f) {}
+
+		// Near and far plane of the projection Update is called with
+		void Init(GLfloat zNear, GLfloat zFar);
+		// Assigns the lights to the clusters of this camera and uploads the lists
+		void Update(const glm::mat4& view, const glm::mat4& projection, const LightBuffer& lights);
+		// Binds the grid and index buffer textures to units firstUnit and firstUnit + 1 and sets the shader's
+		// cluster uniforms; the shader must be active. width and height are the viewport's.
+		void Bind(const Shader& shader, GLuint firstUnit, GLuint width, GLuint height) const;
+
+		// Sum of all cluster list lengths after the last Update
+		GLuint GetIndexCount() const { return static_cast<GLuint>(mIndices.size()); }
+
+	private:
+		// One light's clusters in one slice
+		struct Span
+		{
+			GLushort light;
+			GLushort slice;
+			GLushort x0, x1, y0, y1;
+		};
+
+		GLint _Slice(GLfloat depth) const;
+		// Appends the spans of lights [begin, end) in light order, per slice
+		void _AssignLights(const glm::mat4& view, GLfloat scaleX, GLfloat scaleY, const LightBuffer& lights, GLuint begin, GLuint end, std::vector<Span>& spans) const;
+		void _AssignLight(const glm::mat4& view, GLfloat scaleX, GLfloat scaleY, const LightBuffer& lights, GLuint light, std::vector<Span>& spans) const;
+		static GLushort _Tile(GLfloat ndc, GLuint tiles);
+		static void _CreateBufferTexture(GLuint& buffer, GLuint& texture, GLenum format);
+
+		GLfloat					mSliceDepths[SLICES + 1];	// view depth where each slice starts, and the far end
+		std::vector<std::vector<Span>> mBlockSpans;			// per LIGHT_BLOCK, joined into mSpans
+		std::vector<Span>		mSpans;
+		std::vector<GLuint>		mGrid;			// offset, count per cluster
+		std::vector<GLushort>	mIndices;
+
+		GLuint	mGridBuffer;
+		GLuint	mGridTexture;
+		GLuint	mIndexBuffer;
+		GLuint	mIndexTexture;
+		GLuint	mIndexCapacity;
+		GLfloat mNear;
+		GLfloat mFar;
+		GLfloat mSliceScale;
+		GLfloat mSliceBias;
+	};
+
+	void LightClusters::_CreateBufferTexture(GLuint& buffer, GLuint& texture, GLenum format)
+	{
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+		glBufferData(GL_TEXTURE_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+		glGenTextures(1, &texture);
+		GLState::Instance()->BindTexture(GL_TEXTURE_BUFFER, texture);
+		glTexBuffer(GL_TEXTURE_BUFFER, format, buffer);
+	}
+
+	void LightClusters::Init(GLfloat zNear, GLfloat zFar)
+	{
+		mNear		= zNear;
+		mFar		= zFar;
+		mSliceScale = SLICES / std::log(zFar / zNear);
+		mSliceBias	= -mSliceScale * std::log(zNear);
+		for (GLuint slice = 0; slice <= SLICES; ++slice)
+		{
+			mSliceDepths[slice] = std::exp((slice - mSliceBias) / mSliceScale);
+		}
+
+		_CreateBufferTexture(mGridBuffer, mGridTexture, GL_RG32UI);
+		_CreateBufferTexture(mIndexBuffer, mIndexTexture, GL_R16UI);
+
+		mGrid.resize(CLUSTER_COUNT * 2);
+		glBindBuffer(GL_TEXTURE_BUFFER, mGridBuffer);
+		glBufferData(GL_TEXTURE_BUFFER, mGrid.size() * sizeof(GLuint), nullptr, GL_STREAM_DRAW);
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+	}
+
+	inline GLint LightClusters::_Slice(GLfloat depth) const
+	{
+		GLint slice = static_cast<GLint>(std::floor(std::log(depth) * mSliceScale + mSliceBias));
+		return std::min(std::max(slice, 0), static_cast<GLint>(SLICES) - 1);
+	}
+
+	void LightClusters::Update(const glm::mat4& view, const glm::mat4& projection, const LightBuffer& lights)
+	{
+		assert(lights.GetCount() <= 0xFFFF && "Light indices are 16 bit");
+
+		// Blocks of lights are assigned in parallel, each into its own list; joined in block order the spans are
+		// in light order, as the cluster lists are
+		const GLfloat scaleX = projection[0][0];
+		const GLfloat scaleY = projection[1][1];
+		GLuint blocks = (lights.GetCount() + LIGHT_BLOCK - 1) / LIGHT_BLOCK;
+		if (mBlockSpans.size() < blocks)
+		{
+			mBlockSpans.resize(blocks);
+		}
+		ThreadPool::Instance()->ParallelFor(0, blocks, 1, [&](size_t begin, size_t end)
+		{
+			for (size_t block = begin; block < end; ++block)
+			{
+				GLuint first = static_cast<GLuint>(block * LIGHT_BLOCK);
+				mBlockSpans[block].clear();
+				_AssignLights(view, scaleX, scaleY, lights, first, std::min(first + LIGHT_BLOCK, lights.GetCount()), mBlockSpans[block]);
+			}
+		});
+		mSpans.clear();
+		for (GLuint block = 0; block < blocks; ++block)
+		{
+			mSpans.insert(mSpans.end(), mBlockSpans[block].begin(), mBlockSpans[block].end());
+		}
+
+		// Count, turn the counts into offsets, then fill the lists in light order
+		std::fill(mGrid.begin(), mGrid.end(), 0);
+		for (const Span& span : mSpans)
+		{
+			for (GLuint y = span.y0; y <= span.y1; ++y)
+			{
+				GLuint row = TILES_X * (y + TILES_Y * span.slice);
+				for (GLuint x = span.x0; x <= span.x1; ++x)
+				{
+					++mGrid[(row + x) * 2 + 1];
+				}
+			}
+		}
+		GLuint offset = 0;
+		for (GLuint cluster = 0; cluster < CLUSTER_COUNT; ++cluster)
+		{
+			mGrid[cluster * 2] = offset;
+			offset += mGrid[cluster * 2 + 1];
+			mGrid[cluster * 2 + 1] = 0;
+		}
+		mIndices.resize(offset);
+		for (const Span& span : mSpans)
+		{
+			for (GLuint y = span.y0; y <= span.y1; ++y)
+			{
+				GLuint row = TILES_X * (y + TILES_Y * span.slice);
+				for (GLuint x = span.x0; x <= span.x1; ++x)
+				{
+					GLuint* cluster = &mGrid[(row + x) * 2];
+					mIndices[cluster[0] + cluster[1]++] = span.light;
+				}
+			}
+		}
+
+		glBindBuffer(GL_TEXTURE_BUFFER, mGridBuffer);
+		glBufferData(GL_TEXTURE_BUFFER, mGrid.size() * sizeof(GLuint), mGrid.data(), GL_STREAM_DRAW);
+		glBindBuffer(GL_TEXTURE_BUFFER, mIndexBuffer);
+		if (mIndices.size() > mIndexCapacity)
+		{
+			// Grow geometrically so the lists rarely reallocate as the camera moves
+			mIndexCapacity = std::max(static_cast<GLuint>(mIndices.size()), mIndexCapacity * 2);
+		}
+		glBufferData(GL_TEXTURE_BUFFER, std::max<GLuint>(mIndexCapacity, 1) * sizeof(GLushort), nullptr, GL_STREAM_DRAW);
+		if (!mIndices.empty())
+		{
+			glBufferSubData(GL_TEXTURE_BUFFER, 0, mIndices.size() * sizeof(GLushort), mIndices.data());
+		}
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+	}
+
+	inline GLushort LightClusters::_Tile(GLfloat ndc, GLuint tiles)
+	{
+		GLint index = static_cast<GLint>(std::floor((ndc * 0.5f + 0.5f) * tiles));
+		return static_cast<GLushort>(std::min(std::max(index, 0), static_cast<GLint>(tiles) - 1));
+	}
+
+	// Screen rectangles come from the corners of each light's view space box, which bound the projection of the
+	// sphere as long as the box is in front of the camera: x / depth is monotonic in both
+	void LightClusters::_AssignLight(const glm::mat4& view, GLfloat scaleX, GLfloat scaleY, const LightBuffer& lights, GLuint light, std::vector<Span>& spans) const
+	{
+		const PointLight& source = lights.Get(light);
+		glm::vec3 center = glm::vec3(view * glm::vec4(source.position, 1.f));
+		GLfloat	  radius = source.Radius();
+		GLfloat	  depth	 = -center.z;
+		if (radius <= 0.f || depth + radius < mNear || depth - radius > mFar)
+		{
+			return;
+		}
+
+		GLint first = _Slice(std::max(depth - radius, mNear));
+		GLint last	= _Slice(std::min(depth + radius, mFar));
+		for (GLint slice = first; slice <= last; ++slice)
+		{
+			Span span = { static_cast<GLushort>(light), static_cast<GLushort>(slice), 0, TILES_X - 1, 0, TILES_Y - 1 };
+
+			// The part of the sphere's depth range inside this slice
+			GLfloat nearest	 = std::max(depth - radius, mSliceDepths[slice]);
+			GLfloat farthest = std::min(depth + radius, mSliceDepths[slice + 1]);
+			if (nearest > mNear)
+			{
+				GLfloat minX = 1e30f, maxX = -1e30f, minY = 1e30f, maxY = -1e30f;
+				for (GLfloat z : { nearest, farthest })
+				{
+					for (GLfloat sign : { -1.f, 1.f })
+					{
+						GLfloat x = scaleX * (center.x + sign * radius) / z;
+						GLfloat y = scaleY * (center.y + sign * radius) / z;
+						minX = std::min(minX, x);
+						maxX = std::max(maxX, x);
+						minY = std::min(minY, y);
+						maxY = std::max(maxY, y);
+					}
+				}
+				if (maxX < -1.f || minX > 1.f || maxY < -1.f || minY > 1.f)
+				{
+					continue;
+				}
+				span.x0 = _Tile(minX, TILES_X);
+				span.x1 = _Tile(maxX, TILES_X);
+				span.y0 = _Tile(minY, TILES_Y);
+				span.y1 = _Tile(maxY, TILES_Y);
+			}
+			spans.push_back(span);
+		}
+	}
+
+	void LightClusters::_AssignLights(const glm::mat4& view, GLfloat scaleX, GLfloat scaleY, const LightBuffer& lights, GLuint begin, GLuint end, std::vector<Span>& spans) const
+	{
+		GLuint light = begin;
+#ifdef GL_CLUSTERS_SSE
+		// Four lights side by side, in SoA form, with the same operations in the same order as _AssignLight so
+		// both give the same rectangles. Slices are visited in order for all four, so each cluster still sees
+		// the lights in index order.
+		for (; light + 4 <= end; light += 4)
+		{
+			GLfloat positions[3][4], radii[4];
+			for (GLuint lane = 0; lane < 4; ++lane)
+			{
+				const PointLight& source = lights.Get(light + lane);
+				positions[0][lane] = source.position.x;
+				positions[1][lane] = source.position.y;
+				positions[2][lane] = source.position.z;
+				radii[lane]		   = source.Radius();
+			}
+			__m128 px = _mm_loadu_ps(positions[0]);
+			__m128 py = _mm_loadu_ps(positions[1]);
+			__m128 pz = _mm_loadu_ps(positions[2]);
+			auto transform = [&](GLuint row)
+			{
+				__m128 xy = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(view[0][row]), px), _mm_mul_ps(_mm_set1_ps(view[1][row]), py));
+				__m128 zw = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(view[2][row]), pz), _mm_set1_ps(view[3][row]));
+				return _mm_add_ps(xy, zw);
+			};
+			const __m128 centerX = transform(0);
+			const __m128 centerY = transform(1);
+			const __m128 depth	 = _mm_sub_ps(_mm_setzero_ps(), transform(2));
+			const __m128 radius	 = _mm_loadu_ps(radii);
+			const __m128 back	 = _mm_sub_ps(depth, radius);
+			const __m128 front	 = _mm_add_ps(depth, radius);
+
+			GLfloat backs[4], fronts[4];
+			_mm_storeu_ps(backs, back);
+			_mm_storeu_ps(fronts, front);
+			GLint first[4], last[4], firstSlice = SLICES, lastSlice = -1;
+			for (GLuint lane = 0; lane < 4; ++lane)
+			{
+				first[lane] = 0;
+				last[lane]	= -1;
+				if (radii[lane] > 0.f && fronts[lane] >= mNear && backs[lane] <= mFar)
+				{
+					first[lane] = _Slice(std::max(backs[lane], mNear));
+					last[lane]	= _Slice(std::min(fronts[lane], mFar));
+					firstSlice	= std::min(firstSlice, first[lane]);
+					lastSlice	= std::max(lastSlice, last[lane]);
+				}
+			}
+
+			// Corners of the boxes, before the division by depth
+			const __m128 lowX  = _mm_mul_ps(_mm_set1_ps(scaleX), _mm_sub_ps(centerX, radius));
+			const __m128 highX = _mm_mul_ps(_mm_set1_ps(scaleX), _mm_add_ps(centerX, radius));
+			const __m128 lowY  = _mm_mul_ps(_mm_set1_ps(scaleY), _mm_sub_ps(centerY, radius));
+			const __m128 highY = _mm_mul_ps(_mm_set1_ps(scaleY), _mm_add_ps(centerY, radius));
+			const __m128 one   = _mm_set1_ps(1.f);
+			const __m128 minusOne = _mm_set1_ps(-1.f);
+			const __m128 half  = _mm_set1_ps(0.5f);
+			auto tiles = [&](__m128 ndc, GLuint count, GLint (&out)[4])
+			{
+				__m128 index = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(ndc, half), half), _mm_set1_ps(static_cast<GLfloat>(count)));
+				index = _mm_min_ps(_mm_max_ps(index, _mm_setzero_ps()), _mm_set1_ps(count - 1.f));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_cvttps_epi32(index));
+			};
+
+			for (GLint slice = firstSlice; slice <= lastSlice; ++slice)
+			{
+				__m128 nearest	= _mm_max_ps(back, _mm_set1_ps(mSliceDepths[slice]));
+				__m128 farthest = _mm_min_ps(front, _mm_set1_ps(mSliceDepths[slice + 1]));
+
+				__m128 x0 = _mm_div_ps(lowX, nearest), x1 = _mm_div_ps(highX, nearest), x2 = _mm_div_ps(lowX, farthest), x3 = _mm_div_ps(highX, farthest);
+				__m128 y0 = _mm_div_ps(lowY, nearest), y1 = _mm_div_ps(highY, nearest), y2 = _mm_div_ps(lowY, farthest), y3 = _mm_div_ps(highY, farthest);
+				__m128 minX = _mm_min_ps(_mm_min_ps(x0, x1), _mm_min_ps(x2, x3));
+				__m128 maxX = _mm_max_ps(_mm_max_ps(x0, x1), _mm_max_ps(x2, x3));
+				__m128 minY = _mm_min_ps(_mm_min_ps(y0, y1), _mm_min_ps(y2, y3));
+				__m128 maxY = _mm_max_ps(_mm_max_ps(y0, y1), _mm_max_ps(y2, y3));
+
+				// Lanes whose rectangle misses the screen, and lanes touching the near plane, which cover it all
+				int outside = _mm_movemask_ps(_mm_or_ps(_mm_or_ps(_mm_cmplt_ps(maxX, minusOne), _mm_cmpgt_ps(minX, one)),
+														_mm_or_ps(_mm_cmplt_ps(maxY, minusOne), _mm_cmpgt_ps(minY, one))));
+				int full	= _mm_movemask_ps(_mm_cmple_ps(nearest, _mm_set1_ps(mNear)));
+
+				GLint x0s[4], x1s[4], y0s[4], y1s[4];
+				tiles(minX, TILES_X, x0s);
+				tiles(maxX, TILES_X, x1s);
+				tiles(minY, TILES_Y, y0s);
+				tiles(maxY, TILES_Y, y1s);
+				for (GLuint lane = 0; lane < 4; ++lane)
+				{
+					if (slice < first[lane] || slice > last[lane])
+					{
+						continue;
+					}
+					Span span = { static_cast<GLushort>(light + lane), static_cast<GLushort>(slice), 0, TILES_X - 1, 0, TILES_Y - 1 };
+					if (!(full & (1 << lane)))
+					{
+						if (outside & (1 << lane))
+						{
+							continue;
+						}
+						span.x0 = static_cast<GLushort>(x0s[lane]);
+						span.x1 = static_cast<GLushort>(x1s[lane]);
+						span.y0 = static_cast<GLushort>(y0s[lane]);
+						span.y1 = static_cast<GLushort>(y1s[lane]);
+					}
+					spans.push_back(span);
+				}
+			}
+		}
+#endif
+		for (; light < end; ++light)
+		{
+			_AssignLight(view, scaleX, scaleY, lights, light, spans);
+		}
+	}
+
+	void LightClusters::Bind(const Shader& shader, GLuint firstUnit, GLuint width, GLuint height) const
+	{
+		GLState* state = GLState::Instance();
+		state->BindTexture(firstUnit, GL_TEXTURE_BUFFER, mGridTexture);
+		state->BindTexture(firstUnit + 1, GL_TEXTURE_BUFFER, mIndexTexture);
+		shader.SetValue("uClusterGrid", static_cast<int>(firstUnit));
+		shader.SetValue("uLightIndices", static_cast<int>(firstUnit + 1));
+
+		GLuint program = shader.program();
+		glUniform2f(glGetUniformLocation(program, "uTileSize"), static_cast<GLfloat>(width) / TILES_X, static_cast<GLfloat>(height) / TILES_Y);
+		shader.SetValue("uSliceScale", mSliceScale);
+		shader.SetValue("uSliceBias", mSliceBias);
+	}
+}
\ No newline at end of file
@@ -3,8 +3,18 @@
 #include <vector>
 #include <iostream>
 #include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
 #include <shader.hpp>
+#include <bounds.hpp>
+#include <occlusion.hpp>
+#include <instancing.hpp>
+#include <gl_state.hpp>
+#include <thread_pool.hpp>
+#include <transform.hpp>
 #include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
 #include <stb_image.h>
 
 #include <assimp/Importer.hpp>
@@ -33,35 +43,162 @@ namespace gl
 		Texture() : id(), type(), path() {}
 	};
 
+	// CPU side geometry of one mesh, filled off the render thread during import
+	struct MeshData
+	{
+		std::vector<Vertex>		  vertices;
+		std::vector<unsigned int> indices;
+	};
+
+	// The textures of one mesh together with the sampler each one feeds ("texture_diffuse1", "texture_normal1"...),
+	// named once at load. Sampler units come from the shader (Shader::SamplerUnit) the first time a material is drawn
+	// with it, so binding is a flat loop of glActiveTexture/glBindTexture with no string work or uniform lookups.
+	class Material
+	{
+	public:
+		Material() {}
+		explicit Material(std::vector<Texture>&& textures);
+
+		void Bind(const Shader& shader) const;
+
+		const std::vector<Texture>& textures() const { return textures_; }
+
+	private:
+		struct Binding
+		{
+			GLuint unit;
+			GLuint texture;
+		};
+
+		const std::vector<Binding>& _Resolve(const Shader& shader) const;
+
+		std::vector<Texture>	 textures_;
+		std::vector<std::string> samplers_;
+
+		// Shader::uid -> bindings, filled lazily; a material is drawn with very few shaders so a linear scan is enough.
+		// Keyed by uid rather than program name, which GL may hand to a new program once the old one is deleted.
+		mutable std::vector<std::pair<unsigned int, std::vector<Binding>>> bindings_;
+	};
+
+	Material::Material(std::vector<Texture>&& textures) : textures_(std::move(textures))
+	{
+		// texture_diffuse1, texture_diffuse2, texture_specular1... numbered per type in load order
+		std::unordered_map<std::string, unsigned int> typeCounts;
+		samplers_.reserve(textures_.size());
+		for (auto& texture : textures_)
+		{
+			samplers_.push_back(texture.type + std::to_string(++typeCounts[texture.type]));
+		}
+	}
+
+	inline void Material::Bind(const Shader& shader) const
+	{
+		for (auto& binding : _Resolve(shader))
+		{
+			GLState::Instance()->BindTexture(binding.unit, GL_TEXTURE_2D, binding.texture);
+		}
+	}
+
+	const std::vector<Material::Binding>& Material::_Resolve(const Shader& shader) const
+	{
+		for (auto& entry : bindings_)
+		{
+			if (entry.first == shader.uid())
+			{
+				return entry.second;
+			}
+		}
+
+		std::vector<Binding> bindings;
+		for (size_t i = 0; i < textures_.size(); ++i)
+		{
+			// samplers the program doesn't declare are simply not bound
+			GLint unit = shader.SamplerUnit(samplers_[i]);
+			if (unit >= 0)
+			{
+				bindings.push_back({ static_cast<GLuint>(unit), textures_[i].id });
+			}
+		}
+		bindings_.emplace_back(shader.uid(), std::move(bindings));
+		return bindings_.back().second;
+	}
+
 	class Mesh 
 	{
 	public:
 		Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const std::vector<Texture>& textures);
+		Mesh(std::vector<Vertex>&& vertices, std::vector<unsigned int>&& indices, std::vector<Texture>&& textures);
 
 		void Draw(const Shader& shader) const;
+		void DrawInstanced(const Shader& shader, const InstanceBuffer& instances) const;
+		// The command at offset in the bound GL_DRAW_INDIRECT_BUFFER says how many instances to draw
+		void DrawIndirect(const Shader& shader, const InstanceBuffer& instances, GLintptr offset) const;
+
+		// Frees the CPU copy of the geometry; the GPU buffers and bounds stay valid
+		void ReleaseCpuData();
+
+		const std::vector<Vertex>&		 vertices()	   const { return vertices_; }
+		const std::vector<unsigned int>& indices()	   const { return indices_; }
+		const Material&					 material()	   const { return material_; }
+		unsigned int					 index_count() const { return index_count_; }
+
+		const AABB&			  bounds()		   const { return bounds_; }
+		const BoundingSphere& bounding_sphere() const { return bounding_sphere_; }
 
 	private:
+		void _Upload();
+
 		unsigned int vao_;
 		unsigned int vbo_;
 		unsigned int ebo_;
+		unsigned int index_count_;
 
 		std::vector<Vertex>		  vertices_;
 		std::vector<unsigned int> indices_;
-		std::vector<Texture>      textures_;
+		Material				  material_;
+
+		AABB		   bounds_;
+		BoundingSphere bounding_sphere_;
 	};
 
-	Mesh::Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const std::vector<Texture>& textures) : vao_(), vbo_(), ebo_(), vertices_(vertices), indices_(indices), textures_(textures)
+	Mesh::Mesh(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, const std::vector<Texture>& textures) : vao_(), vbo_(), ebo_(), index_count_(), vertices_(vertices), indices_(indices), material_(std::vector<Texture>(textures))
+	{
+		_Upload();
+	}
+
+	Mesh::Mesh(std::vector<Vertex>&& vertices, std::vector<unsigned int>&& indices, std::vector<Texture>&& textures) : vao_(), vbo_(), ebo_(), index_count_(), vertices_(std::move(vertices)), indices_(std::move(indices)), material_(std::move(textures))
+	{
+		_Upload();
+	}
+
+	inline void Mesh::ReleaseCpuData()
+	{
+		std::vector<Vertex>().swap(vertices_);
+		std::vector<unsigned int>().swap(indices_);
+	}
+
+	void Mesh::_Upload()
 	{
+		for (auto& vertex : vertices_)
+		{
+			bounds_.Expand(vertex.position);
+		}
+		if (!vertices_.empty())
+		{
+			bounding_sphere_ = BoundingSphere::FromPoints(bounds_, &vertices_[0].position, sizeof(Vertex), vertices_.size());
+		}
+		index_count_ = static_cast<unsigned int>(indices_.size());
+
 		glGenVertexArrays(1, &vao_);
-		glBindVertexArray(vao_);
+		GLState::Instance()->BindVertexArray(vao_);
 
 		glGenBuffers(1, &vbo_);
 		glBindBuffer(GL_ARRAY_BUFFER, vbo_);
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), &vertices[0], GL_STATIC_DRAW);
+		glBufferData(GL_ARRAY_BUFFER, vertices_.size() * sizeof(Vertex), vertices_.data(), GL_STATIC_DRAW);
 
 		glGenBuffers(1, &ebo_);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo_);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices_.size() * sizeof(unsigned int), indices_.data(), GL_STATIC_DRAW);
 
 		glEnableVertexAttribArray(0);
 		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
@@ -74,73 +211,106 @@ namespace gl
 		glEnableVertexAttribArray(4);
 		glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, bi_tangent));
 
-		glBindVertexArray(0);
+		GLState::Instance()->BindVertexArray(0);
 	}
 
 	void Mesh::Draw(const Shader& shader) const
 	{
-		// bind appropriate textures
-		unsigned int index_diffuse  = 1;
-		unsigned int index_specular = 1;
-		unsigned int index_normal	= 1;
-		unsigned int index_height	= 1;
+		material_.Bind(shader);
 
-		for (unsigned int i = 0; i < textures_.size(); ++i)
-		{
-			// active the texture unit before binding it
-			glActiveTexture(GL_TEXTURE0 + i); 
+		GLState::Instance()->BindVertexArray(vao_);
+		glDrawElements(GL_TRIANGLES, index_count_, GL_UNSIGNED_INT, 0);
+	}
 
-			std::string index;
-			std::string name;
-			if (name == "texture_diffuse")
-			{
-				index = std::to_string(index_diffuse++);
-			}
-			else if (name == "texture_specular")
-			{
-				index = std::to_string(index_specular++);
-			}
-			else if (name == "texture_normal")
-			{
-				index = std::to_string(index_normal++);
-			}
-			else if (name == "texture_height")
-			{
-				index = std::to_string(index_height++);
-			}
+	void Mesh::DrawInstanced(const Shader& shader, const InstanceBuffer& instances) const
+	{
+		material_.Bind(shader);
 
-			glUniform1i(glGetUniformLocation(shader.program(), (name + index).c_str()), i);
-			glBindTexture(GL_TEXTURE_2D, textures_[i].id);
-		}
-		// render
-		glBindVertexArray(vao_);
-		glDrawElements(GL_TRIANGLES, indices_.size(), GL_UNSIGNED_INT, 0);
-		glBindVertexArray(0);
+		instances.Attach(vao_);
+		GLState::Instance()->BindVertexArray(vao_);
+		glDrawElementsInstanced(GL_TRIANGLES, index_count_, GL_UNSIGNED_INT, 0, instances.count());
+	}
 
-		glActiveTexture(GL_TEXTURE0);
+	void Mesh::DrawIndirect(const Shader& shader, const InstanceBuffer& instances, GLintptr offset) const
+	{
+		material_.Bind(shader);
+
+		instances.Attach(vao_);
+		GLState::Instance()->BindVertexArray(vao_);
+		glDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const void*)offset);
 	}
 
 	class Model
 	{
 	public:
-		Model(const std::string& path);
+		// keep_cpu_data = false frees each mesh's vertices/indices as soon as they are on the GPU
+		Model(const std::string& path, bool keep_cpu_data = true);
 
+		// Each mesh is drawn with its node's world matrix in the "model" uniform
 		void Draw(const Shader& shader);
+		// One instanced call per mesh reference, however many instances the buffer holds. "model" holds the node
+		// matrix, which the shader applies before the per-instance matrix.
+		void DrawInstanced(const Shader& shader, const InstanceBuffer& instances);
+		// DrawInstanced with the instance count left to the GPU: commands holds one DrawElementsIndirectCommand per
+		// mesh reference, in the order indirect_commands() returns them
+		void DrawIndirect(const Shader& shader, const InstanceBuffer& instances, GLuint commands);
+
+		// Templates for DrawIndirect's buffer, with instanceCount still 0
+		std::vector<DrawElementsIndirectCommand> indirect_commands() const;
+
+		// Adds every mesh to culler as an occluder, placed like an instance with this matrix. Meshes whose CPU
+		// copy of the geometry was released are skipped.
+		void AddOccluders(OcclusionCuller& culler, const glm::mat4& instance);
+
+		// Places the whole model; the imported node hierarchy hangs below this transform
+		void SetTransform(const glm::mat4& transform) { transforms_.SetLocal(ROOT_NODE, transform); }
+
+		// Model space bounds of all meshes, with the node transforms applied but not SetTransform
+		const AABB&			  bounds()		   const { return bounds_; }
+		const BoundingSphere& bounding_sphere() const { return bounding_sphere_; }
+		const std::vector<Mesh>& meshes() const { return meshes_; }
+
+		// One node per aiNode plus the root placed by SetTransform. Animate nodes with SetLocal; the world matrices
+		// are brought up to date at the next draw.
+		TransformStore&		  transforms()		 { return transforms_; }
+		const TransformStore& transforms() const { return transforms_; }
+
+		void ReleaseCpuData();
 
 	private:
-		void _ProcessNode(aiNode* node, const aiScene* scene);
-		Mesh _ProcessMesh(aiMesh* mesh, const aiScene* scene);
+		static const unsigned int ROOT_NODE = 0;
+
+		// A mesh referenced by a node; assimp lets several nodes share one mesh
+		struct MeshNode
+		{
+			unsigned int mesh;
+			unsigned int node;
+		};
+
+		void _ProcessNode(const aiNode* node, unsigned int parent);
+		static void _ProcessMesh(const aiMesh* mesh, MeshData& data);
+		std::vector<Texture> _ProcessMaterial(const aiMesh* mesh, const aiScene* scene);
 		std::vector<Texture> _LoadMaterialTextures(aiMaterial* mat, aiTextureType type, std::string typeName);
 		unsigned int _TextureFromFile(const char* path, const std::string& directory, bool gamma = false);
+		// Location of the shader's "model" uniform, looked up on the first draw with it
+		GLint _ModelLocation(const Shader& shader);
 
 		std::vector<Mesh>	 meshes_;
+		std::vector<MeshNode> mesh_nodes_;
 		std::vector<Texture> textures_loaded_;
+		TransformStore		 transforms_;
+
+		// Shader::uid -> "model" location; like Material::bindings_, a model is drawn with very few shaders
+		std::vector<std::pair<unsigned int, GLint>> model_locations_;
 
 		bool gamma_correction_;
 		std::string directory_;
+
+		AABB		   bounds_;
+		BoundingSphere bounding_sphere_;
 	};
 
-	Model::Model(const std::string& path)
+	Model::Model(const std::string& path, bool keep_cpu_data)
 	{
 		Assimp::Importer importer;
 		const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
@@ -152,84 +322,208 @@ namespace gl
 		}
 
 		directory_ = path.substr(0, path.find_last_of('/'));
-		_ProcessNode(scene->mRootNode, scene);
+
+		transforms_.Add(glm::mat4(1.0f));
+		_ProcessNode(scene->mRootNode, ROOT_NODE);
+		transforms_.Update();
+
+		// Vertex conversion touches no GL state, so every aiMesh is converted on the thread pool
+		std::vector<MeshData> meshData(scene->mNumMeshes);
+		ThreadPool::Instance()->ParallelFor(0, scene->mNumMeshes, 1, [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				_ProcessMesh(scene->mMeshes[i], meshData[i]);
+			}
+		});
+
+		// GL uploads and texture loading stay on this thread
+		meshes_.reserve(scene->mNumMeshes);
+		for (unsigned int i = 0; i < scene->mNumMeshes; ++i)
+		{
+			meshes_.emplace_back(std::move(meshData[i].vertices), std::move(meshData[i].indices), _ProcessMaterial(scene->mMeshes[i], scene));
+			if (!keep_cpu_data)
+			{
+				meshes_.back().ReleaseCpuData();
+			}
+		}
+
+		// The model sphere encloses every placed mesh sphere, centered on the model box
+		for (auto& meshNode : mesh_nodes_)
+		{
+			bounds_.Expand(meshes_[meshNode.mesh].bounds().Transform(transforms_.GetWorld(meshNode.node)));
+		}
+		if (bounds_.Valid())
+		{
+			bounding_sphere_ = BoundingSphere(bounds_.Center(), 0.f);
+			for (auto& meshNode : mesh_nodes_)
+			{
+				auto sphere = meshes_[meshNode.mesh].bounding_sphere().Transform(transforms_.GetWorld(meshNode.node));
+				bounding_sphere_.radius = glm::max(bounding_sphere_.radius, glm::length(sphere.center - bounds_.Center()) + sphere.radius);
+			}
+		}
+	}
+
+	void Model::Draw(const Shader& shader)
+	{
+		transforms_.Update();
+
+		GLint location = _ModelLocation(shader);
+		for (auto& meshNode : mesh_nodes_)
+		{
+			glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(transforms_.GetWorld(meshNode.node)));
+			meshes_[meshNode.mesh].Draw(shader);
+		}
+	}
+
+	void Model::DrawInstanced(const Shader& shader, const InstanceBuffer& instances)
+	{
+		transforms_.Update();
+
+		GLint location = _ModelLocation(shader);
+		for (auto& meshNode : mesh_nodes_)
+		{
+			glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(transforms_.GetWorld(meshNode.node)));
+			meshes_[meshNode.mesh].DrawInstanced(shader, instances);
+		}
+	}
+
+	void Model::DrawIndirect(const Shader& shader, const InstanceBuffer& instances, GLuint commands)
+	{
+		transforms_.Update();
+
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commands);
+		GLint location = _ModelLocation(shader);
+		for (size_t i = 0; i < mesh_nodes_.size(); ++i)
+		{
+			glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(transforms_.GetWorld(mesh_nodes_[i].node)));
+			meshes_[mesh_nodes_[i].mesh].DrawIndirect(shader, instances, i * sizeof(DrawElementsIndirectCommand));
+		}
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	}
+
+	void Model::AddOccluders(OcclusionCuller& culler, const glm::mat4& instance)
+	{
+		transforms_.Update();
+
+		for (auto& meshNode : mesh_nodes_)
+		{
+			const Mesh& mesh = meshes_[meshNode.mesh];
+			if (mesh.indices().empty())
+			{
+				continue;
+			}
+			culler.AddOccluder(&mesh.vertices()[0].position, sizeof(Vertex), mesh.indices().data(), mesh.indices().size(),
+							   instance * transforms_.GetWorld(meshNode.node));
+		}
+	}
+
+	GLint Model::_ModelLocation(const Shader& shader)
+	{
+		for (auto& entry : model_locations_)
+		{
+			if (entry.first == shader.uid())
+			{
+				return entry.second;
+			}
+		}
+		model_locations_.emplace_back(shader.uid(), glGetUniformLocation(shader.program(), "model"));
+		return model_locations_.back().second;
+	}
+
+	std::vector<DrawElementsIndirectCommand> Model::indirect_commands() const
+	{
+		std::vector<DrawElementsIndirectCommand> commands;
+		commands.reserve(mesh_nodes_.size());
+		for (auto& meshNode : mesh_nodes_)
+		{
+			commands.push_back(DrawElementsIndirectCommand(meshes_[meshNode.mesh].index_count()));
+		}
+		return commands;
 	}
 
-	inline void Model::Draw(const Shader& shader)
+	inline void Model::ReleaseCpuData()
 	{
 		for (auto& mesh : meshes_)
 		{
-			mesh.Draw(shader);
+			mesh.ReleaseCpuData();
 		}
 	}
 
-	void Model::_ProcessNode(aiNode* node, const aiScene* scene)
+	void Model::_ProcessNode(const aiNode* node, unsigned int parent)
 	{
+		// aiMatrix4x4 is row major, glm is column major
+		unsigned int index = transforms_.Add(glm::transpose(glm::make_mat4(&node->mTransformation.a1)), parent);
 		for (unsigned int i = 0; i < node->mNumMeshes; ++i)
 		{
-			aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-			meshes_.push_back(_ProcessMesh(mesh, scene));
+			mesh_nodes_.push_back({ node->mMeshes[i], index });
 		}
 		for (unsigned int i = 0; i < node->mNumChildren; i++)
 		{
-			_ProcessNode(node->mChildren[i], scene);
+			_ProcessNode(node->mChildren[i], index);
 		}
 	}
 
-	Mesh Model::_ProcessMesh(aiMesh* mesh, const aiScene* scene)
+	void Model::_ProcessMesh(const aiMesh* mesh, MeshData& data)
 	{
-		// data to fill
-		std::vector<Vertex>		  vertices;
-		std::vector<unsigned int> indices;
-		std::vector<Texture>      textures;
+		// assimp stores every stream as tightly packed aiVector3D, so each attribute is a straight strided copy
+		// into the pre-sized vertex array. Missing streams are left zeroed.
+		static_assert(sizeof(aiVector3D) == sizeof(glm::vec3), "assimp must be built with single precision ai_real");
 
-		// Walk through each of the mesh's vertices
-		for (unsigned int i = 0; i < mesh->mNumVertices; i++)
+		const unsigned int vertexCount = mesh->mNumVertices;
+		data.vertices.resize(vertexCount);
+		Vertex* pVertices = data.vertices.data();
+
+		for (unsigned int i = 0; i < vertexCount; ++i)
+		{
+			std::memcpy(&pVertices[i].position, &mesh->mVertices[i], sizeof(glm::vec3));
+		}
+		if (mesh->mNormals)
+		{
+			for (unsigned int i = 0; i < vertexCount; ++i)
+			{
+				std::memcpy(&pVertices[i].normal, &mesh->mNormals[i], sizeof(glm::vec3));
+			}
+		}
+		// a vertex can contain up to 8 different texture coordinates. We thus make the assumption that we won't 
+		// use models where a vertex can have multiple texture coordinates so we always take the first set (0).
+		if (mesh->mTextureCoords[0])
+		{
+			for (unsigned int i = 0; i < vertexCount; ++i)
+			{
+				std::memcpy(&pVertices[i].texcoords, &mesh->mTextureCoords[0][i], sizeof(glm::vec2));
+			}
+		}
+		if (mesh->mTangents && mesh->mBitangents)
 		{
-			Vertex vertex;
-			glm::vec3 vector; // we declare a placeholder vector since assimp uses its own vector class that doesn't directly convert to glm's vec3 class so we transfer the data to this placeholder glm::vec3 first.
-			// positions
-			vector.x = mesh->mVertices[i].x;
-			vector.y = mesh->mVertices[i].y;
-			vector.z = mesh->mVertices[i].z;
-			vertex.position = vector;
-			// normals
-			vector.x = mesh->mNormals[i].x;
-			vector.y = mesh->mNormals[i].y;
-			vector.z = mesh->mNormals[i].z;
-			vertex.normal = vector;
-			// texture coordinates
-			if (mesh->mTextureCoords[0]) // does the mesh contain texture coordinates?
+			for (unsigned int i = 0; i < vertexCount; ++i)
 			{
-				glm::vec2 vec;
-				// a vertex can contain up to 8 different texture coordinates. We thus make the assumption that we won't 
-				// use models where a vertex can have multiple texture coordinates so we always take the first set (0).
-				vec.x = mesh->mTextureCoords[0][i].x;
-				vec.y = mesh->mTextureCoords[0][i].y;
-				vertex.texcoords = vec;
+				std::memcpy(&pVertices[i].tangent, &mesh->mTangents[i], sizeof(glm::vec3));
+				std::memcpy(&pVertices[i].bi_tangent, &mesh->mBitangents[i], sizeof(glm::vec3));
 			}
-			else
-				vertex.texcoords = glm::vec2(0.0f, 0.0f);
-			// tangent
-			vector.x = mesh->mTangents[i].x;
-			vector.y = mesh->mTangents[i].y;
-			vector.z = mesh->mTangents[i].z;
-			vertex.tangent = vector;
-			// bitangent
-			vector.x = mesh->mBitangents[i].x;
-			vector.y = mesh->mBitangents[i].y;
-			vector.z = mesh->mBitangents[i].z;
-			vertex.bi_tangent = vector;
-			vertices.push_back(vertex);
 		}
-		// now wak through each of the mesh's faces (a face is a mesh its triangle) and retrieve the corresponding vertex indices.
-		for (unsigned int i = 0; i < mesh->mNumFaces; i++)
+
+		// now walk through each of the mesh's faces (triangles after aiProcess_Triangulate), counting first so the
+		// index array is allocated exactly once
+		size_t indexCount = 0;
+		for (unsigned int i = 0; i < mesh->mNumFaces; ++i)
 		{
-			aiFace face = mesh->mFaces[i];
-			// retrieve all indices of the face and store them in the indices vector
-			for (unsigned int j = 0; j < face.mNumIndices; j++)
-				indices.push_back(face.mIndices[j]);
+			indexCount += mesh->mFaces[i].mNumIndices;
 		}
+		data.indices.resize(indexCount);
+		unsigned int* pIndices = data.indices.data();
+		for (unsigned int i = 0; i < mesh->mNumFaces; ++i)
+		{
+			const aiFace& face = mesh->mFaces[i];
+			std::memcpy(pIndices, face.mIndices, face.mNumIndices * sizeof(unsigned int));
+			pIndices += face.mNumIndices;
+		}
+	}
+
+	std::vector<Texture> Model::_ProcessMaterial(const aiMesh* mesh, const aiScene* scene)
+	{
+		std::vector<Texture> textures;
+
 		// process materials
 		aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
 		// we assume a convention for sampler names in the shaders. Each diffuse texture should be named
@@ -252,8 +546,7 @@ namespace gl
 		std::vector<Texture> heightMaps = _LoadMaterialTextures(material, aiTextureType_AMBIENT, "texture_height");
 		textures.insert(textures.end(), heightMaps.begin(), heightMaps.end());
 
-		// return a mesh object created from the extracted mesh data
-		return Mesh(vertices, indices, textures);
+		return textures;
 	}
 
 	std::vector<Texture> Model::_LoadMaterialTextures(aiMaterial* mat, aiTextureType type, std::string typeName)
@@ -307,7 +600,7 @@ namespace gl
 			else if (nrComponents == 4)
 				format = GL_RGBA;
 
-			glBindTexture(GL_TEXTURE_2D, textureID);
+			GLState::Instance()->BindTexture(GL_TEXTURE_2D, textureID);
 			glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
 			glGenerateMipmap(GL_TEXTURE_2D);
 
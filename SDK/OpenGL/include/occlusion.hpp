@@ -0,0 +1,378 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <glm/glm.hpp>
+#include "bounds.hpp"
+#include "thread_pool.hpp"
+
+namespace gl
+{
+	// Software occlusion culling. A few large occluders (walls, floors, big props) are rasterized on the CPU into a
+	// small depth buffer seen from the camera, then bounding boxes are tested against it before any draw is issued.
+	// Nothing here touches GL, so it runs without a context.
+	//
+	// Per frame:
+	//   culler.Begin(projection, view);
+	//   culler.AddOccluder(...);		// any number
+	//   culler.Rasterize();
+	//   culler.Cull(boxes, count, visible);	// or Filter() the output of a FrustumCuller
+	//
+	// The buffer is split into tiles. Triangles are binned per tile and the tiles are rasterized on the thread pool,
+	// four pixels at a time with SSE. Depth is post-projection z in [0, 1] and a pixel keeps its nearest occluder.
+	class OcclusionCuller
+	{
+	public:
+		static const GLuint TILE_WIDTH  = 32;
+		static const GLuint TILE_HEIGHT = 32;
+
+		// width must be a multiple of 4; both are rounded up to whole tiles
+		explicit OcclusionCuller(GLuint width = 256, GLuint height = 128);
+
+		void Begin(const glm::mat4& projection, const glm::mat4& view);
+
+		// Indexed triangles; positions are read with the given byte stride (e.g. sizeof(Vertex) for Mesh data)
+		void AddOccluder(const glm::vec3* positions, size_t stride, const GLuint* indices, size_t indexCount, const glm::mat4& model);
+		// The 12 triangles of a box; most indoor occluders are boxes
+		void AddOccluder(const AABB& box, const glm::mat4& model);
+
+		void Rasterize();
+
+		// World space box against the rasterized occluders. Boxes crossing the near plane always pass.
+		bool IsVisible(const AABB& box) const;
+
+		void Cull(const AABB* boxes, size_t count, std::vector<GLuint>& visible);
+		// Removes the occluded entries from a list of indices into boxes, keeping the order
+		void Filter(const AABB* boxes, std::vector<GLuint>& indices);
+
+		const float*	 GetDepthBuffer() const { return mDepth.data(); }
+		GLuint			 GetWidth()		  const { return mWidth; }
+		GLuint			 GetHeight()	  const { return mHeight; }
+		const CullStats& GetStats()		  const { return mStats; }
+
+	private:
+		// Edge functions and depth as planes a * x + b * y + c over pixel centers
+		struct Triangle
+		{
+			glm::vec3 edgeA;
+			glm::vec3 edgeB;
+			glm::vec3 edgeC;
+			glm::vec3 depth;
+			GLint	  minX, minY, maxX, maxY;
+		};
+
+		void _AddTriangle(const glm::vec4& p0, const glm::vec4& p1, const glm::vec4& p2);
+		void _RasterizeTile(GLuint tile);
+		void _FilterRange(const AABB* boxes, const GLuint* indices, size_t begin, size_t end, unsigned char* pVisible) const;
+
+		GLuint mWidth;
+		GLuint mHeight;
+		GLuint mTilesX;
+		GLuint mTilesY;
+
+		glm::mat4			mViewProjection;
+		std::vector<float>	mDepth;
+
+		std::vector<Triangle>			  mTriangles;
+		std::vector<std::vector<GLuint>>  mBins;
+
+		std::vector<unsigned char>	mVisibleFlags;
+		CullStats					mStats;
+	};
+
+	OcclusionCuller::OcclusionCuller(GLuint width, GLuint height)
+	{
+		mTilesX = (std::max(width, 4u) + TILE_WIDTH - 1) / TILE_WIDTH;
+		mTilesY = (std::max(height, 1u) + TILE_HEIGHT - 1) / TILE_HEIGHT;
+		mWidth	= mTilesX * TILE_WIDTH;
+		mHeight = mTilesY * TILE_HEIGHT;
+		mDepth.assign(mWidth * mHeight, 1.f);
+		mBins.resize(mTilesX * mTilesY);
+	}
+
+	void OcclusionCuller::Begin(const glm::mat4& projection, const glm::mat4& view)
+	{
+		mViewProjection = projection * view;
+		std::fill(mDepth.begin(), mDepth.end(), 1.f);
+		mTriangles.clear();
+		for (auto& bin : mBins)
+		{
+			bin.clear();
+		}
+		mStats = CullStats();
+	}
+
+	void OcclusionCuller::AddOccluder(const glm::vec3* positions, size_t stride, const GLuint* indices, size_t indexCount, const glm::mat4& model)
+	{
+		glm::mat4 transform = mViewProjection * model;
+		auto vertex = [&](GLuint index)
+		{
+			const glm::vec3& position = *reinterpret_cast<const glm::vec3*>(reinterpret_cast<const char*>(positions) + index * stride);
+			return transform * glm::vec4(position, 1.f);
+		};
+
+		for (size_t i = 0; i + 2 < indexCount; i += 3)
+		{
+			_AddTriangle(vertex(indices[i]), vertex(indices[i + 1]), vertex(indices[i + 2]));
+		}
+	}
+
+	void OcclusionCuller::AddOccluder(const AABB& box, const glm::mat4& model)
+	{
+		glm::vec3 corners[8];
+		for (GLuint i = 0; i < 8; ++i)
+		{
+			corners[i] = glm::vec3(i & 1 ? box.max.x : box.min.x, i & 2 ? box.max.y : box.min.y, i & 4 ? box.max.z : box.min.z);
+		}
+		static const GLuint indices[36] = {
+			0, 2, 1, 1, 2, 3,	// -z
+			4, 5, 6, 5, 7, 6,	// +z
+			0, 4, 2, 2, 4, 6,	// -x
+			1, 3, 5, 3, 7, 5,	// +x
+			0, 1, 4, 1, 5, 4,	// -y
+			2, 6, 3, 3, 6, 7,	// +y
+		};
+		AddOccluder(corners, sizeof(glm::vec3), indices, 36, model);
+	}
+
+	void OcclusionCuller::_AddTriangle(const glm::vec4& p0, const glm::vec4& p1, const glm::vec4& p2)
+	{
+		// Occluders are optional: a triangle reaching past the near plane is dropped rather than clipped, which
+		// can only make the buffer less occluding, never wrong
+		auto clipped = [](const glm::vec4& p) { return p.w < 1e-4f || p.z < -p.w; };
+		if (clipped(p0) || clipped(p1) || clipped(p2))
+		{
+			return;
+		}
+
+		auto toScreen = [this](const glm::vec4& p)
+		{
+			glm::vec3 ndc = glm::vec3(p) / p.w;
+			return glm::vec3((ndc.x * 0.5f + 0.5f) * mWidth, (ndc.y * 0.5f + 0.5f) * mHeight, ndc.z * 0.5f + 0.5f);
+		};
+		glm::vec3 a = toScreen(p0), b = toScreen(p1), c = toScreen(p2);
+
+		float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+		if (std::abs(area) < 1e-8f)
+		{
+			return;
+		}
+		// Occluders are closed or double sided as far as culling goes, so both windings are rasterized
+		if (area < 0.f)
+		{
+			std::swap(b, c);
+			area = -area;
+		}
+
+		// Pixel centers covering the triangle's bounds, clamped to the buffer
+		Triangle triangle;
+		triangle.minX = std::max(0, static_cast<GLint>(std::floor(std::min(std::min(a.x, b.x), c.x))));
+		triangle.minY = std::max(0, static_cast<GLint>(std::floor(std::min(std::min(a.y, b.y), c.y))));
+		triangle.maxX = std::min(static_cast<GLint>(mWidth) - 1, static_cast<GLint>(std::ceil(std::max(std::max(a.x, b.x), c.x))));
+		triangle.maxY = std::min(static_cast<GLint>(mHeight) - 1, static_cast<GLint>(std::ceil(std::max(std::max(a.y, b.y), c.y))));
+		if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY || std::min(std::min(a.z, b.z), c.z) > 1.f)
+		{
+			return;
+		}
+
+		// E(x, y) >= 0 inside; each edge weighs the opposite vertex for the depth plane
+		auto edge = [](const glm::vec3& from, const glm::vec3& to)
+		{
+			return glm::vec3(from.y - to.y, to.x - from.x, from.x * to.y - from.y * to.x);
+		};
+		triangle.edgeA = edge(b, c);
+		triangle.edgeB = edge(c, a);
+		triangle.edgeC = edge(a, b);
+		triangle.depth = (triangle.edgeA * a.z + triangle.edgeB * b.z + triangle.edgeC * c.z) / area;
+
+		GLuint index = static_cast<GLuint>(mTriangles.size());
+		mTriangles.push_back(triangle);
+		for (GLint ty = triangle.minY / TILE_HEIGHT; ty <= triangle.maxY / static_cast<GLint>(TILE_HEIGHT); ++ty)
+		{
+			for (GLint tx = triangle.minX / TILE_WIDTH; tx <= triangle.maxX / static_cast<GLint>(TILE_WIDTH); ++tx)
+			{
+				mBins[ty * mTilesX + tx].push_back(index);
+			}
+		}
+	}
+
+	void OcclusionCuller::Rasterize()
+	{
+		// Tiles own disjoint pixels, so they need no synchronization
+		ThreadPool::Instance()->ParallelFor(0, mBins.size(), 1, [this](size_t begin, size_t end)
+		{
+			for (size_t tile = begin; tile < end; ++tile)
+			{
+				_RasterizeTile(static_cast<GLuint>(tile));
+			}
+		});
+	}
+
+	void OcclusionCuller::_RasterizeTile(GLuint tile)
+	{
+		const GLint tileMinX = (tile % mTilesX) * TILE_WIDTH;
+		const GLint tileMinY = (tile / mTilesX) * TILE_HEIGHT;
+
+		for (auto index : mBins[tile])
+		{
+			const Triangle& triangle = mTriangles[index];
+			// Whole groups of four so rows stay aligned; the edge test rejects the extra pixels
+			GLint minX = std::max(tileMinX, triangle.minX) & ~3;
+			GLint maxX = std::min(tileMinX + static_cast<GLint>(TILE_WIDTH) - 1, triangle.maxX);
+			GLint minY = std::max(tileMinY, triangle.minY);
+			GLint maxY = std::min(tileMinY + static_cast<GLint>(TILE_HEIGHT) - 1, triangle.maxY);
+
+#ifdef GL_BOUNDS_SSE
+			const __m128 offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+			const __m128 aA = _mm_set1_ps(triangle.edgeA.x), aB = _mm_set1_ps(triangle.edgeB.x), aC = _mm_set1_ps(triangle.edgeC.x);
+			const __m128 aZ = _mm_set1_ps(triangle.depth.x);
+			const __m128 zero = _mm_setzero_ps();
+			for (GLint y = minY; y <= maxY; ++y)
+			{
+				float py = y + 0.5f;
+				__m128 rowA = _mm_set1_ps(triangle.edgeA.y * py + triangle.edgeA.z);
+				__m128 rowB = _mm_set1_ps(triangle.edgeB.y * py + triangle.edgeB.z);
+				__m128 rowC = _mm_set1_ps(triangle.edgeC.y * py + triangle.edgeC.z);
+				__m128 rowZ = _mm_set1_ps(triangle.depth.y * py + triangle.depth.z);
+				float* pRow = &mDepth[y * mWidth];
+				for (GLint x = minX; x <= maxX; x += 4)
+				{
+					__m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), offsets);
+					__m128 inside = _mm_and_ps(_mm_and_ps(
+						_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(aA, px), rowA), zero),
+						_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(aB, px), rowB), zero)),
+						_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(aC, px), rowC), zero));
+					if (!_mm_movemask_ps(inside))
+					{
+						continue;
+					}
+					__m128 z	   = _mm_add_ps(_mm_mul_ps(aZ, px), rowZ);
+					__m128 stored  = _mm_loadu_ps(pRow + x);
+					__m128 nearest = _mm_min_ps(stored, z);
+					_mm_storeu_ps(pRow + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, stored)));
+				}
+			}
+#else
+			for (GLint y = minY; y <= maxY; ++y)
+			{
+				float py = y + 0.5f;
+				float* pRow = &mDepth[y * mWidth];
+				for (GLint x = minX; x <= maxX; ++x)
+				{
+					float px = x + 0.5f;
+					if (glm::dot(triangle.edgeA, glm::vec3(px, py, 1.f)) >= 0.f &&
+						glm::dot(triangle.edgeB, glm::vec3(px, py, 1.f)) >= 0.f &&
+						glm::dot(triangle.edgeC, glm::vec3(px, py, 1.f)) >= 0.f)
+					{
+						pRow[x] = std::min(pRow[x], glm::dot(triangle.depth, glm::vec3(px, py, 1.f)));
+					}
+				}
+			}
+#endif
+		}
+	}
+
+	bool OcclusionCuller::IsVisible(const AABB& box) const
+	{
+		// Screen rectangle and nearest depth of the eight projected corners
+		glm::vec2 rectMin(std::numeric_limits<float>::max());
+		glm::vec2 rectMax(-std::numeric_limits<float>::max());
+		float nearest = std::numeric_limits<float>::max();
+		for (GLuint i = 0; i < 8; ++i)
+		{
+			glm::vec4 p = mViewProjection * glm::vec4(i & 1 ? box.max.x : box.min.x, i & 2 ? box.max.y : box.min.y, i & 4 ? box.max.z : box.min.z, 1.f);
+			if (p.w < 1e-4f || p.z < -p.w)
+			{
+				return true;
+			}
+			glm::vec3 ndc = glm::vec3(p) / p.w;
+			rectMin = glm::min(rectMin, glm::vec2(ndc));
+			rectMax = glm::max(rectMax, glm::vec2(ndc));
+			nearest = std::min(nearest, ndc.z * 0.5f + 0.5f);
+		}
+
+		GLint minX = std::max(0, static_cast<GLint>(std::floor((rectMin.x * 0.5f + 0.5f) * mWidth)));
+		GLint minY = std::max(0, static_cast<GLint>(std::floor((rectMin.y * 0.5f + 0.5f) * mHeight)));
+		GLint maxX = std::min(static_cast<GLint>(mWidth) - 1, static_cast<GLint>(std::floor((rectMax.x * 0.5f + 0.5f) * mWidth)));
+		GLint maxY = std::min(static_cast<GLint>(mHeight) - 1, static_cast<GLint>(std::floor((rectMax.y * 0.5f + 0.5f) * mHeight)));
+		if (minX > maxX || minY > maxY)
+		{
+			// Off screen; the frustum would have rejected it too
+			return false;
+		}
+
+		// Visible as soon as one covered pixel holds nothing nearer than the box
+#ifdef GL_BOUNDS_SSE
+		minX &= ~3;
+		const __m128 boxDepth = _mm_set1_ps(nearest);
+		for (GLint y = minY; y <= maxY; ++y)
+		{
+			const float* pRow = &mDepth[y * mWidth];
+			for (GLint x = minX; x <= maxX; x += 4)
+			{
+				if (_mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(pRow + x), boxDepth)))
+				{
+					return true;
+				}
+			}
+		}
+#else
+		for (GLint y = minY; y <= maxY; ++y)
+		{
+			const float* pRow = &mDepth[y * mWidth];
+			for (GLint x = minX; x <= maxX; ++x)
+			{
+				if (pRow[x] > nearest)
+				{
+					return true;
+				}
+			}
+		}
+#endif
+		return false;
+	}
+
+	void OcclusionCuller::Cull(const AABB* boxes, size_t count, std::vector<GLuint>& visible)
+	{
+		visible.resize(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			visible[i] = static_cast<GLuint>(i);
+		}
+		Filter(boxes, visible);
+	}
+
+	void OcclusionCuller::Filter(const AABB* boxes, std::vector<GLuint>& indices)
+	{
+		// Boxes are tested in parallel into flags, then compacted in order
+		mVisibleFlags.resize(indices.size());
+		ThreadPool::Instance()->ParallelFor(0, indices.size(), 64, [&](size_t begin, size_t end)
+		{
+			_FilterRange(boxes, indices.data(), begin, end, mVisibleFlags.data());
+		});
+
+		size_t tested = indices.size();
+		size_t kept = 0;
+		for (size_t i = 0; i < tested; ++i)
+		{
+			if (mVisibleFlags[i])
+			{
+				indices[kept++] = indices[i];
+			}
+		}
+		indices.resize(kept);
+
+		mStats.tested  += static_cast<GLuint>(tested);
+		mStats.visible += static_cast<GLuint>(kept);
+		mStats.culled  += static_cast<GLuint>(tested - kept);
+	}
+
+	void OcclusionCuller::_FilterRange(const AABB* boxes, const GLuint* indices, size_t begin, size_t end, unsigned char* pVisible) const
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			pVisible[i] = IsVisible(boxes[indices[i]]) ? 1 : 0;
+		}
+	}
+}
\ No newline at end of file
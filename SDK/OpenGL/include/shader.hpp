@@ -4,8 +4,11 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <unordered_map>
+#include <algorithm>
 #include <cassert>
 #include "glm/glm.hpp"
+#include "gl_state.hpp"
 
 namespace gl
 {
@@ -17,6 +20,7 @@ namespace gl
 		~Shader();
 
 		void AttachShader(GLuint shader_type, const std::string& shader_path) const;
+		void AttachShaderSource(GLuint shader_type, const std::string& shader_source) const;
 		void AttachVertexShader(const std::string& shader_path) const;
 		void AttachFragmentShader(const std::string& shader_path) const;
 
@@ -30,20 +34,35 @@ namespace gl
 		void SetMatrix(const std::string& name, const float* mat) const;
 		void SetMatrix(const std::string& name, const glm::mat4& mat) const;
 
+		// Texture unit of a sampler uniform, -1 if the program doesn't declare it. Units are handed out in order of
+		// first request and set in the program then, so every material drawn with it agrees on e.g. texture_diffuse1.
+		GLint SamplerUnit(const std::string& sampler) const;
+
 		GLuint program() const { return program_; }
+		// Key for caches of per-program data: unlike the GL name it is never reused, and Link hands out a new one
+		unsigned int uid() const { return uid_; }
 
 	private:
 		void __LoadShader(const std::string& shader_path, std::string& shader_source) const;
+		static unsigned int __NextUid();
 
 		GLuint program_;
+		mutable unsigned int uid_;
+		mutable std::unordered_map<std::string, GLint> sampler_units_;
 	};
 
-	Shader::Shader() : program_(0)
+	inline unsigned int Shader::__NextUid()
+	{
+		static unsigned int next = 0;
+		return ++next;
+	}
+
+	Shader::Shader() : program_(0), uid_(__NextUid())
 	{
 		program_ = glCreateProgram();
 	}
 
-	Shader::Shader(const std::string& vertex_shader_path, const std::string& fragment_shader_path) : program_(0)
+	Shader::Shader(const std::string& vertex_shader_path, const std::string& fragment_shader_path) : program_(0), uid_(__NextUid())
 	{
 		program_ = glCreateProgram();
 		AttachVertexShader(vertex_shader_path);
@@ -56,13 +75,19 @@ namespace gl
 	}
 
 	void Shader::AttachShader(GLuint shader_type, const std::string& shader_path) const
+	{
+		std::string shader_source;
+		__LoadShader(shader_path, shader_source);
+		AttachShaderSource(shader_type, shader_source);
+	}
+
+	// For shaders that ship inside the SDK headers rather than next to a sample
+	void Shader::AttachShaderSource(GLuint shader_type, const std::string& shader_source) const
 	{
 		assert(program_ != 0);
 		assert(shader_type == GL_VERTEX_SHADER || shader_type == GL_FRAGMENT_SHADER || shader_type == GL_GEOMETRY_SHADER || 
 			shader_type == GL_TESS_CONTROL_SHADER || shader_type == GL_TESS_EVALUATION_SHADER);
 
-		std::string shader_source;
-		__LoadShader(shader_path, shader_source);
 		const char* pshader_source = shader_source.c_str();
 
 		GLuint shader = glCreateShader(shader_type);
@@ -96,6 +121,9 @@ namespace gl
 	{
 		assert(program_ != 0);
 		glLinkProgram(program_);
+		// Linking resets every uniform, sampler units included
+		uid_ = __NextUid();
+		sampler_units_.clear();
 
 		GLint status;
 		glGetProgramiv(program_, GL_LINK_STATUS, &status);
@@ -109,7 +137,7 @@ namespace gl
 	inline void Shader::Active() const
 	{
 		assert(program_ != 0);
-		glUseProgram(program_);
+		GLState::Instance()->UseProgram(program_);
 	}
 
 	inline void Shader::SetValue(const std::string& name, bool value) const
@@ -142,6 +170,34 @@ namespace gl
 		glUniformMatrix4fv(glGetUniformLocation(program_, name.c_str()), 1, GL_FALSE, &mat[0][0]);
 	}
 
+	GLint Shader::SamplerUnit(const std::string& sampler) const
+	{
+		auto it = sampler_units_.find(sampler);
+		if (it != sampler_units_.end())
+		{
+			return it->second;
+		}
+
+		GLint unit = -1;
+		GLint location = glGetUniformLocation(program_, sampler.c_str());
+		if (location >= 0)
+		{
+			unit = 0;
+			for (auto& entry : sampler_units_)
+			{
+				unit = std::max(unit, entry.second + 1);
+			}
+			// glUniform writes the current program; put back whatever the caller had bound
+			GLState* state	= GLState::Instance();
+			GLuint previous = state->GetProgram();
+			state->UseProgram(program_);
+			glUniform1i(location, unit);
+			state->UseProgram(previous);
+		}
+		sampler_units_.emplace(sampler, unit);
+		return unit;
+	}
+
 	void Shader::__LoadShader(const std::string& shader_path, std::string& shader_source) const
 	{
 		std::ifstream input;
@@ -0,0 +1,540 @@
+#pragma once
+#include <glad/glad.h>
+#include <functional>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include "shader.hpp"
+#include "gl_state.hpp"
+
+namespace gl
+{
+	// Draws shadow casters with the depth shader of a shadow pass, whose light transform is set already: set
+	// "model" for every draw. Casters outside the volume of viewProjection cannot cast into the map and may be
+	// culled, e.g. with a Frustum.
+	using ShadowCasterDraw = std::function<void(const Shader& shader, const glm::mat4& viewProjection)>;
+
+	// Renders casters into layers of depth array textures for CascadedShadowMap and PointShadowAtlas. Both keep
+	// two textures: static casters go into a cache that is only re-rendered when something invalidates it, and
+	// every frame the cached layers are copied into the sampled texture and the dynamic casters drawn over them.
+	class ShadowRenderer
+	{
+	public:
+		ShadowRenderer() : mDrawFbo(0), mReadFbo(0), mResolution(0), mFramebuffer(0), mProgram(0) {}
+
+		void Init(GLuint resolution);
+
+		// A depth texture of layers layers (layer-faces for GL_TEXTURE_CUBE_MAP_ARRAY) set up for shadow samplers
+		GLuint CreateTexture(GLenum target, GLuint layers) const;
+
+		// Begin saves the bound framebuffer, viewport, program and pipeline; End restores them
+		void Begin();
+		void End();
+
+		// Clears the layer when asked, then draws the casters into it; they are handed cullViewProjection
+		void Render(GLuint texture, GLuint layer, const glm::mat4& viewProjection, const glm::mat4& cullViewProjection,
+					const ShadowCasterDraw& draw, bool clear);
+		void Copy(GLuint source, GLuint destination, GLuint layer);
+
+		GLuint GetResolution() const { return mResolution; }
+
+	private:
+		GLuint mDrawFbo;
+		GLuint mReadFbo;
+		GLuint mResolution;
+		Shader mShader;
+
+		GLint		  mViewport[4];
+		GLuint		  mFramebuffer;
+		GLuint		  mProgram;
+		PipelineState mPipeline;
+	};
+
+	// Shadows of a directional light over the view frustum, split into cascades (practical split scheme: a blend
+	// of logarithmic and uniform splits). Each cascade's map is an orthographic view of a cube around the
+	// bounding sphere of its slice of the frustum; the sphere is the same for any camera rotation, and the cube
+	// is CACHE_MARGIN larger than the sphere and centered on whole texels. The static casters are only rendered
+	// again when the slice leaves the cube, the light turns or InvalidateStatic is called. Between those renders
+	// the map does not move at all, and when it does it moves by whole texels, so shadow edges never shimmer.
+	// Casters in front of the cube are clamped onto its near plane, so they still cast shadows into it; the volume
+	// the caster draws get reaches CASTER_DISTANCE further towards the light for that.
+	//
+	// Shaders sample the maps with (the first cascade whose map contains the point is the sharpest one):
+	//
+	//     uniform sampler2DArrayShadow uCascadeShadowMap;
+	//     uniform mat4 uCascadeMatrices[4];    // world to [0, 1] shadow map coordinates
+	//     uniform vec4 uCascadeTexelSize;      // world units per texel, for a normal offset
+	//     uniform int uCascadeCount;
+	class CascadedShadowMap
+	{
+	public:
+		static const GLuint MAX_CASCADES = 4;
+
+		CascadedShadowMap();
+
+		// resolution is the width and height of every cascade; splitLambda is the logarithmic share of the splits
+		void Init(GLuint resolution, GLuint cascadeCount = MAX_CASCADES, GLfloat splitLambda = 0.8f);
+
+		// Direction the light travels in; turning it re-renders every cascade
+		void SetLightDirection(const glm::vec3& direction);
+		// Static casters moved, appeared or went away: every cascade is re-rendered by the next Update
+		void InvalidateStatic();
+
+		// Fits the cascades to the camera, re-renders the cached static casters of those that need it and draws
+		// the dynamic casters over them. fovy is in radians; drawDynamic may be empty.
+		void Update(const glm::mat4& view, GLfloat fovy, GLfloat aspect, GLfloat zNear, GLfloat zFar,
+					const ShadowCasterDraw& drawStatic, const ShadowCasterDraw& drawDynamic);
+		// Binds the maps to unit and sets the uniforms above; the shader must be active
+		void Bind(const Shader& shader, GLuint unit) const;
+
+		GLuint			 GetTexture()					const { return mHasDynamic ? mTexture : mStaticTexture; }
+		GLuint			 GetCascadeCount()				const { return mCascadeCount; }
+		const glm::mat4& GetMatrix(GLuint cascade)		const { return mCascades[cascade].viewProjection; }
+		// Far end of each cascade's slice, in view space depth
+		GLfloat			 GetSplit(GLuint cascade)		const { return mCascades[cascade].split; }
+		// Cascades whose static casters the last Update rendered
+		GLuint			 GetStaticRenderCount()			const { return mStaticRenders; }
+
+	private:
+		static glm::mat4 _LightView(const glm::vec3& direction);
+
+		struct Cascade
+		{
+			glm::vec3 center;			// light space
+			GLfloat	  extent;			// half the width of the map
+			GLfloat	  split;
+			glm::mat4 viewProjection;
+			glm::mat4 cullViewProjection;
+			bool	  cached;
+		};
+
+		ShadowRenderer mRenderer;
+		GLuint		   mTexture;
+		GLuint		   mStaticTexture;
+		GLuint		   mCascadeCount;
+		GLfloat		   mSplitLambda;
+		glm::vec3	   mDirection;
+		glm::mat4	   mLightView;
+		Cascade		   mCascades[MAX_CASCADES];
+		GLuint		   mStaticRenders;
+		bool		   mHasDynamic;
+	};
+
+	// Omnidirectional shadows of point lights, one cube map per light in a cube map array. The static casters of
+	// a light are rendered into a cached cube when the light is set up and again only when it moves, its radius
+	// changes or InvalidateStatic is called; every frame the cubes are copied and the dynamic casters drawn over
+	// them.
+	//
+	// Each face is a 90 degree perspective view from the light between uPointShadowNear and the light's radius,
+	// so a shader compares against the depth that projection gives along the major axis of the direction:
+	//
+	//     uniform samplerCubeArrayShadow uPointShadowAtlas;
+	//     uniform float uPointShadowNear;
+	//     uniform float uPointShadowFar[16];   // per light: its radius
+	//     uniform int uPointShadowCount;
+	//
+	//     vec3 d = fragPos - lightPos;
+	//     float z = max(abs(d.x), max(abs(d.y), abs(d.z)));
+	//     float n = uPointShadowNear, f = uPointShadowFar[light];
+	//     float depth = ((f + n) / (f - n) - 2.0 * f * n / ((f - n) * z)) * 0.5 + 0.5;
+	//     float lit = texture(uPointShadowAtlas, vec4(d, light), depth);
+	class PointShadowAtlas
+	{
+	public:
+		static const GLuint MAX_LIGHTS = 16;
+
+		PointShadowAtlas() : mTexture(0), mStaticTexture(0), mLightCount(0), mNear(0.05f), mStaticRenders(0), mHasDynamic(false) {}
+
+		// resolution is the width and height of every cube face
+		void Init(GLuint resolution, GLuint lightCount, GLfloat zNear = 0.05f);
+
+		// Light `light` casts shadows from position out to radius (e.g. PointLight::Radius)
+		void SetLight(GLuint light, const glm::vec3& position, GLfloat radius);
+		void InvalidateStatic();
+
+		// Re-renders the cached cubes that need it and draws the dynamic casters over them, once per face that
+		// the caster draws are called for; drawDynamic may be empty
+		void Update(const ShadowCasterDraw& drawStatic, const ShadowCasterDraw& drawDynamic);
+		// Binds the atlas to unit and sets the uniforms above; the shader must be active
+		void Bind(const Shader& shader, GLuint unit) const;
+
+		GLuint GetTexture()			  const { return mHasDynamic ? mTexture : mStaticTexture; }
+		GLuint GetLightCount()		  const { return mLightCount; }
+		// Cube faces whose static casters the last Update rendered
+		GLuint GetStaticRenderCount() const { return mStaticRenders; }
+
+		// The view-projection of a cube face, in GL's face order (+X, -X, +Y, -Y, +Z, -Z)
+		static glm::mat4 FaceViewProjection(const glm::vec3& position, GLuint face, GLfloat zNear, GLfloat zFar);
+
+	private:
+		struct Light
+		{
+			glm::vec3 position;
+			GLfloat	  radius;
+			bool	  cached;
+		};
+
+		ShadowRenderer mRenderer;
+		GLuint		   mTexture;
+		GLuint		   mStaticTexture;
+		GLuint		   mLightCount;
+		GLfloat		   mNear;
+		Light		   mLights[MAX_LIGHTS];
+		GLuint		   mStaticRenders;
+		bool		   mHasDynamic;
+	};
+
+	namespace shadow
+	{
+		// How much larger than its slice's sphere a cascade's map is: the camera can move this share of the
+		// sphere's radius before the static casters are rendered again
+		const GLfloat CACHE_MARGIN = 0.25f;
+		// How far towards the light a cascade looks for casters
+		const GLfloat CASTER_DISTANCE = 1000.f;
+
+		const char* const DEPTH_VS = R"(
+#version 400 core
+layout (location = 0) in vec3 aPos;
+uniform mat4 uViewProjection;
+uniform mat4 model;
+void main()
+{
+	gl_Position = uViewProjection * model * vec4(aPos, 1.0);
+}
+)";
+
+		const char* const DEPTH_FS = R"(
+#version 400 core
+void main()
+{
+}
+)";
+	}
+
+	void ShadowRenderer::Init(GLuint resolution)
+	{
+		mResolution = resolution;
+
+		// Depth only: neither framebuffer has a color buffer to draw to or read from
+		GLuint framebuffers[] = { 0, 0 };
+		glGenFramebuffers(2, framebuffers);
+		mDrawFbo = framebuffers[0];
+		mReadFbo = framebuffers[1];
+		GLState::Instance()->BindFramebuffer(GL_DRAW_FRAMEBUFFER, mDrawFbo);
+		glDrawBuffer(GL_NONE);
+		GLState::Instance()->BindFramebuffer(GL_READ_FRAMEBUFFER, mReadFbo);
+		glReadBuffer(GL_NONE);
+		GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		mShader.AttachShaderSource(GL_VERTEX_SHADER, shadow::DEPTH_VS);
+		mShader.AttachShaderSource(GL_FRAGMENT_SHADER, shadow::DEPTH_FS);
+		mShader.Link();
+	}
+
+	GLuint ShadowRenderer::CreateTexture(GLenum target, GLuint layers) const
+	{
+		GLuint texture;
+		glGenTextures(1, &texture);
+		GLState::Instance()->BindTexture(target, texture);
+		glTexImage3D(target, 0, GL_DEPTH_COMPONENT24, mResolution, mResolution, layers, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
+		glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(target, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+		glTexParameteri(target, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+		if (target == GL_TEXTURE_2D_ARRAY)
+		{
+			// Outside a cascade's map nothing is in shadow
+			const GLfloat border[] = { 1.f, 1.f, 1.f, 1.f };
+			glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+			glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+			glTexParameterfv(target, GL_TEXTURE_BORDER_COLOR, border);
+		}
+		else
+		{
+			glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTexParameteri(target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		}
+		return texture;
+	}
+
+	void ShadowRenderer::Begin()
+	{
+		assert(mDrawFbo != 0 && "Init the shadow renderer before rendering");
+
+		GLState* state = GLState::Instance();
+		state->GetViewport(mViewport);
+		mFramebuffer = state->GetDrawFramebuffer();
+		mProgram	 = state->GetProgram();
+		mPipeline	 = state->GetPipeline();
+
+		// Slope scaled bias against acne; depth clamping keeps casters in front of the near plane
+		state->SetPipeline(PipelineState::Opaque());
+		glEnable(GL_POLYGON_OFFSET_FILL);
+		glPolygonOffset(2.f, 4.f);
+		glEnable(GL_DEPTH_CLAMP);
+		state->SetViewport(0, 0, mResolution, mResolution);
+	}
+
+	void ShadowRenderer::End()
+	{
+		GLState* state = GLState::Instance();
+		glDisable(GL_DEPTH_CLAMP);
+		glDisable(GL_POLYGON_OFFSET_FILL);
+		state->BindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+		state->SetViewport(mViewport[0], mViewport[1], mViewport[2], mViewport[3]);
+		state->UseProgram(mProgram);
+		state->SetPipeline(mPipeline);
+	}
+
+	void ShadowRenderer::Render(GLuint texture, GLuint layer, const glm::mat4& viewProjection, const glm::mat4& cullViewProjection,
+								const ShadowCasterDraw& draw, bool clear)
+	{
+		GLState::Instance()->BindFramebuffer(GL_DRAW_FRAMEBUFFER, mDrawFbo);
+		glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, texture, 0, layer);
+		if (clear)
+		{
+			glClear(GL_DEPTH_BUFFER_BIT);
+		}
+		if (draw)
+		{
+			// The caster draws may switch programs to set their own state; the depth shader is theirs to use
+			mShader.Active();
+			mShader.SetMatrix("uViewProjection", viewProjection);
+			draw(mShader, cullViewProjection);
+		}
+	}
+
+	void ShadowRenderer::Copy(GLuint source, GLuint destination, GLuint layer)
+	{
+		GLState* state = GLState::Instance();
+		state->BindFramebuffer(GL_READ_FRAMEBUFFER, mReadFbo);
+		glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, source, 0, layer);
+		state->BindFramebuffer(GL_DRAW_FRAMEBUFFER, mDrawFbo);
+		glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, destination, 0, layer);
+		glBlitFramebuffer(0, 0, mResolution, mResolution, 0, 0, mResolution, mResolution, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+	}
+
+	CascadedShadowMap::CascadedShadowMap()
+		: mTexture(0), mStaticTexture(0), mCascadeCount(0), mSplitLambda(0.8f), mDirection(0.f, -1.f, 0.f),
+		  mLightView(_LightView(mDirection)), mStaticRenders(0), mHasDynamic(false)
+	{
+		for (auto& cascade : mCascades)
+		{
+			cascade = { glm::vec3(0.f), 0.f, 0.f, glm::mat4(1.f), glm::mat4(1.f), false };
+		}
+	}
+
+	void CascadedShadowMap::Init(GLuint resolution, GLuint cascadeCount, GLfloat splitLambda)
+	{
+		assert(cascadeCount >= 1 && cascadeCount <= MAX_CASCADES);
+		mCascadeCount = cascadeCount;
+		mSplitLambda  = splitLambda;
+
+		mRenderer.Init(resolution);
+		mTexture	   = mRenderer.CreateTexture(GL_TEXTURE_2D_ARRAY, cascadeCount);
+		mStaticTexture = mRenderer.CreateTexture(GL_TEXTURE_2D_ARRAY, cascadeCount);
+		InvalidateStatic();
+	}
+
+	glm::mat4 CascadedShadowMap::_LightView(const glm::vec3& direction)
+	{
+		glm::vec3 up = std::abs(direction.y) > 0.99f ? glm::vec3(0.f, 0.f, 1.f) : glm::vec3(0.f, 1.f, 0.f);
+		return glm::lookAt(glm::vec3(0.f), direction, up);
+	}
+
+	void CascadedShadowMap::SetLightDirection(const glm::vec3& direction)
+	{
+		glm::vec3 forward = glm::normalize(direction);
+		if (forward != mDirection)
+		{
+			mDirection = forward;
+			mLightView = _LightView(forward);
+			InvalidateStatic();
+		}
+	}
+
+	inline void CascadedShadowMap::InvalidateStatic()
+	{
+		for (auto& cascade : mCascades)
+		{
+			cascade.cached = false;
+		}
+	}
+
+	void CascadedShadowMap::Update(const glm::mat4& view, GLfloat fovy, GLfloat aspect, GLfloat zNear, GLfloat zFar,
+								   const ShadowCasterDraw& drawStatic, const ShadowCasterDraw& drawDynamic)
+	{
+		assert(mTexture != 0 && "Init the shadow map before updating it");
+
+		const GLfloat	resolution = static_cast<GLfloat>(mRenderer.GetResolution());
+		const GLfloat	tanY	   = std::tan(fovy * 0.5f);
+		const GLfloat	tanX	   = tanY * aspect;
+		const GLfloat	k2		   = tanX * tanX + tanY * tanY;	// squared distance of a corner from the axis, per unit depth
+		const glm::mat4 invView	   = glm::inverse(view);
+
+		mStaticRenders = 0;
+		mHasDynamic	   = static_cast<bool>(drawDynamic);
+		mRenderer.Begin();
+
+		GLfloat sliceNear = zNear;
+		for (GLuint i = 0; i < mCascadeCount; ++i)
+		{
+			Cascade& cascade = mCascades[i];
+			GLfloat	 t		 = static_cast<GLfloat>(i + 1) / mCascadeCount;
+			GLfloat	 logSplit = zNear * std::pow(zFar / zNear, t);
+			GLfloat	 uniSplit = zNear + (zFar - zNear) * t;
+			GLfloat	 sliceFar = mSplitLambda * logSplit + (1.f - mSplitLambda) * uniSplit;
+			cascade.split	  = sliceFar;
+
+			// Smallest sphere around the slice: its center is on the view axis, as far from the near corners as
+			// from the far ones (or at the far plane, if the far corners alone decide)
+			GLfloat depth  = std::min((sliceFar + sliceNear) * (1.f + k2) * 0.5f, sliceFar);
+			GLfloat radius = std::sqrt(sliceFar * sliceFar * k2 + (sliceFar - depth) * (sliceFar - depth));
+			glm::vec3 center = glm::vec3(mLightView * invView * glm::vec4(0.f, 0.f, -depth, 1.f));
+			sliceNear = sliceFar;
+
+			// The cached map still covers the sphere: nothing of the static casters changes
+			GLfloat	  extent = radius * (1.f + shadow::CACHE_MARGIN);
+			glm::vec3 offset = glm::abs(center - cascade.center);
+			bool contained	 = std::max(std::max(offset.x, offset.y), offset.z) <= extent - radius;
+			if (!cascade.cached || cascade.extent != extent || !contained)
+			{
+				GLfloat texel	 = 2.f * extent / resolution;
+				cascade.center	 = glm::floor(center / texel + 0.5f) * texel;
+				cascade.extent	 = extent;
+				GLfloat left   = cascade.center.x - extent;
+				GLfloat right  = cascade.center.x + extent;
+				GLfloat bottom = cascade.center.y - extent;
+				GLfloat top	   = cascade.center.y + extent;
+				GLfloat zFar   = -cascade.center.z + extent;
+				cascade.viewProjection	   = glm::ortho(left, right, bottom, top, -cascade.center.z - extent, zFar) * mLightView;
+				cascade.cullViewProjection = glm::ortho(left, right, bottom, top, -cascade.center.z - extent - shadow::CASTER_DISTANCE, zFar) * mLightView;
+				cascade.cached			   = true;
+
+				mRenderer.Render(mStaticTexture, i, cascade.viewProjection, cascade.cullViewProjection, drawStatic, true);
+				++mStaticRenders;
+			}
+
+			if (mHasDynamic)
+			{
+				mRenderer.Copy(mStaticTexture, mTexture, i);
+				mRenderer.Render(mTexture, i, cascade.viewProjection, cascade.cullViewProjection, drawDynamic, false);
+			}
+		}
+
+		mRenderer.End();
+	}
+
+	void CascadedShadowMap::Bind(const Shader& shader, GLuint unit) const
+	{
+		// Clip space to [0, 1] texture coordinates and depth
+		const glm::mat4 bias = glm::translate(glm::mat4(1.f), glm::vec3(0.5f)) * glm::scale(glm::mat4(1.f), glm::vec3(0.5f));
+
+		glm::mat4 matrices[MAX_CASCADES];
+		glm::vec4 texelSize(0.f);
+		for (GLuint i = 0; i < mCascadeCount; ++i)
+		{
+			matrices[i]	 = bias * mCascades[i].viewProjection;
+			texelSize[i] = 2.f * mCascades[i].extent / mRenderer.GetResolution();
+		}
+
+		GLState::Instance()->BindTexture(unit, GL_TEXTURE_2D_ARRAY, GetTexture());
+		shader.SetValue("uCascadeShadowMap", static_cast<int>(unit));
+		shader.SetValue("uCascadeCount", static_cast<int>(mCascadeCount));
+		GLuint program = shader.program();
+		glUniformMatrix4fv(glGetUniformLocation(program, "uCascadeMatrices"), mCascadeCount, GL_FALSE, &matrices[0][0][0]);
+		glUniform4fv(glGetUniformLocation(program, "uCascadeTexelSize"), 1, &texelSize[0]);
+	}
+
+	void PointShadowAtlas::Init(GLuint resolution, GLuint lightCount, GLfloat zNear)
+	{
+		assert(lightCount >= 1 && lightCount <= MAX_LIGHTS);
+		mLightCount = lightCount;
+		mNear		= zNear;
+		for (auto& light : mLights)
+		{
+			light = { glm::vec3(0.f), 1.f, false };
+		}
+
+		mRenderer.Init(resolution);
+		mTexture	   = mRenderer.CreateTexture(GL_TEXTURE_CUBE_MAP_ARRAY, lightCount * 6);
+		mStaticTexture = mRenderer.CreateTexture(GL_TEXTURE_CUBE_MAP_ARRAY, lightCount * 6);
+	}
+
+	inline void PointShadowAtlas::SetLight(GLuint light, const glm::vec3& position, GLfloat radius)
+	{
+		assert(light < mLightCount);
+		Light&	slot = mLights[light];
+		GLfloat far	 = std::max(radius, mNear * 2.f);
+		if (slot.position != position || slot.radius != far)
+		{
+			slot.position = position;
+			slot.radius	  = far;
+			slot.cached	  = false;
+		}
+	}
+
+	inline void PointShadowAtlas::InvalidateStatic()
+	{
+		for (auto& light : mLights)
+		{
+			light.cached = false;
+		}
+	}
+
+	glm::mat4 PointShadowAtlas::FaceViewProjection(const glm::vec3& position, GLuint face, GLfloat zNear, GLfloat zFar)
+	{
+		static const glm::vec3 FORWARD[6] = { { 1.f, 0.f, 0.f }, { -1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 0.f, -1.f, 0.f }, { 0.f, 0.f, 1.f }, { 0.f, 0.f, -1.f } };
+		static const glm::vec3 UP[6]	  = { { 0.f, -1.f, 0.f }, { 0.f, -1.f, 0.f }, { 0.f, 0.f, 1.f }, { 0.f, 0.f, -1.f }, { 0.f, -1.f, 0.f }, { 0.f, -1.f, 0.f } };
+		return glm::perspective(glm::radians(90.f), 1.f, zNear, zFar) * glm::lookAt(position, position + FORWARD[face], UP[face]);
+	}
+
+	void PointShadowAtlas::Update(const ShadowCasterDraw& drawStatic, const ShadowCasterDraw& drawDynamic)
+	{
+		assert(mTexture != 0 && "Init the atlas before updating it");
+
+		mStaticRenders = 0;
+		mHasDynamic	   = static_cast<bool>(drawDynamic);
+		mRenderer.Begin();
+
+		for (GLuint i = 0; i < mLightCount; ++i)
+		{
+			Light& light = mLights[i];
+			for (GLuint face = 0; face < 6; ++face)
+			{
+				glm::mat4 viewProjection = FaceViewProjection(light.position, face, mNear, light.radius);
+				if (!light.cached)
+				{
+					mRenderer.Render(mStaticTexture, i * 6 + face, viewProjection, viewProjection, drawStatic, true);
+					++mStaticRenders;
+				}
+				if (mHasDynamic)
+				{
+					mRenderer.Copy(mStaticTexture, mTexture, i * 6 + face);
+					mRenderer.Render(mTexture, i * 6 + face, viewProjection, viewProjection, drawDynamic, false);
+				}
+			}
+			light.cached = true;
+		}
+
+		mRenderer.End();
+	}
+
+	void PointShadowAtlas::Bind(const Shader& shader, GLuint unit) const
+	{
+		GLfloat radii[MAX_LIGHTS];
+		for (GLuint i = 0; i < mLightCount; ++i)
+		{
+			radii[i] = mLights[i].radius;
+		}
+
+		GLState::Instance()->BindTexture(unit, GL_TEXTURE_CUBE_MAP_ARRAY, GetTexture());
+		shader.SetValue("uPointShadowAtlas", static_cast<int>(unit));
+		shader.SetValue("uPointShadowNear", mNear);
+		shader.SetValue("uPointShadowCount", static_cast<int>(mLightCount));
+		glUniform1fv(glGetUniformLocation(shader.program(), "uPointShadowFar"), mLightCount, radii);
+	}
+}
\ No newline at end of file
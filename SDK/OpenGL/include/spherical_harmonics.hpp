@@ -0,0 +1,507 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <mutex>
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+#include <glm/glm.hpp>
+#include "shader.hpp"
+#include "gl_state.hpp"
+#include "thread_pool.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GL_SH_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace gl
+{
+	// Nine RGB coefficients of the first three spherical harmonic bands. As SHIrradiance makes them they already
+	// hold the cosine lobe convolution and the 1/PI of a Lambertian surface, so Evaluate(n) is what an irradiance
+	// cubemap from irradiance_convolution.fs stores for the direction n.
+	struct SH9
+	{
+		static const GLuint COUNT = 9;
+
+		glm::vec3 coefficients[COUNT];
+
+		SH9() : coefficients() {}
+
+		// The real basis functions at a unit direction
+		static void Basis(const glm::vec3& d, GLfloat basis[COUNT]);
+		glm::vec3 Evaluate(const glm::vec3& direction) const;
+	};
+
+	inline void SH9::Basis(const glm::vec3& d, GLfloat basis[COUNT])
+	{
+		basis[0] = 0.282095f;
+		basis[1] = 0.488603f * d.y;
+		basis[2] = 0.488603f * d.z;
+		basis[3] = 0.488603f * d.x;
+		basis[4] = 1.092548f * d.x * d.y;
+		basis[5] = 1.092548f * d.y * d.z;
+		basis[6] = 0.315392f * (3.f * d.z * d.z - 1.f);
+		basis[7] = 1.092548f * d.x * d.z;
+		basis[8] = 0.546274f * (d.x * d.x - d.y * d.y);
+	}
+
+	inline glm::vec3 SH9::Evaluate(const glm::vec3& direction) const
+	{
+		GLfloat basis[COUNT];
+		Basis(glm::normalize(direction), basis);
+		glm::vec3 result(0.f);
+		for (GLuint i = 0; i < COUNT; ++i)
+		{
+			result += coefficients[i] * basis[i];
+		}
+		return result;
+	}
+
+	// Diffuse environment lighting as nine SH coefficients in a uniform buffer, in place of a convolved irradiance
+	// cubemap. The environment is projected either on the CPU, read back and spread over the ThreadPool with SSE,
+	// or on the GPU by a fragment pass whose result is copied into the buffer without leaving the GPU. Shaders read
+	// the buffer as
+	//
+	//     layout (std140) uniform SHBlock
+	//     {
+	//         vec4 uSH[9];    // rgb used
+	//     };
+	//
+	// and evaluate irradiance / PI with the basis functions of SH9::Basis.
+	class SHIrradiance
+	{
+	public:
+		// LightBuffer takes binding 0
+		static const GLuint BLOCK_BINDING	= 1;
+		// Face size of the mip level the GPU projection reads; nine coefficients need no more detail than this
+		static const GLuint PROJECTION_SIZE = 32;
+
+		SHIrradiance() : mBuffer(0), mFbo(0), mTexture(0), mVao(0) {}
+
+		void Init();
+
+		// Reads back mip level `level` of a cubemap, RGB, whose level 0 faces are size x size, and projects it
+		void Project(GLuint cubemap, GLuint size, GLint level = 0);
+		// Projects level 0 of the cubemap, RGB and color-renderable, downsampled to PROJECTION_SIZE in a cubemap of
+		// its own; the caller's texture is only read. size is level 0's and a power of two no smaller than
+		// PROJECTION_SIZE. Leaves Get() as it was; see Read.
+		void ProjectOnGPU(GLuint cubemap, GLuint size);
+
+		// The coefficients of the last CPU projection
+		const SH9& Get() const { return mCoefficients; }
+		// The coefficients in the buffer, whichever projection made them. Waits for the GPU.
+		SH9 Read() const;
+
+		// Once per shader; the shader must be active
+		void AttachUniformBlock(const Shader& shader) const;
+		// Every frame, before drawing with an attached shader
+		void BindUniformBlock() const;
+
+		// Projects six RGB float faces of size x size, ordered +X, -X, +Y, -Y, +Z, -Z with rows as glGetTexImage
+		// returns them
+		static SH9 ProjectFaces(const std::vector<GLfloat> (&faces)[6], GLuint size);
+
+		// Mean and largest relative difference between sh and an irradiance cubemap of size x size, over its texels
+		static void Compare(const SH9& sh, GLuint irradianceMap, GLuint size, GLfloat& meanError, GLfloat& maxError);
+
+	private:
+		static void _ReadFaces(GLuint cubemap, GLuint size, GLint level, std::vector<GLfloat> (&faces)[6]);
+		static glm::vec3 _FaceDirection(GLuint face, GLfloat u, GLfloat v);
+
+		GLuint mBuffer;
+		GLuint mFbo;
+		GLuint mTexture;		// 9 x 1 RGBA32F, one texel per coefficient
+		GLuint mVao;
+		Shader mShader;
+		SH9	   mCoefficients;
+	};
+
+	namespace sh
+	{
+		// Cube face texel (u, v) in [-1, 1] lies along MAIN + u * U + v * V, as GL samples cubemaps
+		const glm::vec3 FACE_MAIN[6] = { glm::vec3(1, 0, 0), glm::vec3(-1, 0, 0), glm::vec3(0, 1, 0), glm::vec3(0, -1, 0), glm::vec3(0, 0, 1), glm::vec3(0, 0, -1) };
+		const glm::vec3 FACE_U[6]	 = { glm::vec3(0, 0, -1), glm::vec3(0, 0, 1), glm::vec3(1, 0, 0), glm::vec3(1, 0, 0), glm::vec3(1, 0, 0), glm::vec3(-1, 0, 0) };
+		const glm::vec3 FACE_V[6]	 = { glm::vec3(0, -1, 0), glm::vec3(0, -1, 0), glm::vec3(0, 0, 1), glm::vec3(0, 0, -1), glm::vec3(0, -1, 0), glm::vec3(0, -1, 0) };
+
+		// Convolution with the clamped cosine, over PI: 1 for band 0, 2/3 for band 1, 1/4 for band 2
+		const GLfloat BAND_SCALE[SH9::COUNT] = { 1.f, 2.f / 3.f, 2.f / 3.f, 2.f / 3.f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f };
+
+		// One triangle covering the viewport, positions made from gl_VertexID
+		const char* const PROJECT_VS = R"(
+#version 400 core
+void main()
+{
+	vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+		// Fragment i of the 9 x 1 target sums basis function i over every texel of the base level, weighted by the
+		// texel's solid angle. The weights are normalised to 4 PI so the face discretisation cancels out.
+		const char* const PROJECT_FS = R"(
+#version 400 core
+uniform samplerCube uEnvironment;
+uniform int uSize;
+layout (location = 0) out vec4 oCoefficient;
+
+const float PI = 3.14159265359;
+const vec3 FACE_MAIN[6] = vec3[](vec3(1, 0, 0), vec3(-1, 0, 0), vec3(0, 1, 0), vec3(0, -1, 0), vec3(0, 0, 1), vec3(0, 0, -1));
+const vec3 FACE_U[6] = vec3[](vec3(0, 0, -1), vec3(0, 0, 1), vec3(1, 0, 0), vec3(1, 0, 0), vec3(1, 0, 0), vec3(-1, 0, 0));
+const vec3 FACE_V[6] = vec3[](vec3(0, -1, 0), vec3(0, -1, 0), vec3(0, 0, 1), vec3(0, 0, -1), vec3(0, -1, 0), vec3(0, -1, 0));
+const float BAND_SCALE[9] = float[](1.0, 2.0 / 3.0, 2.0 / 3.0, 2.0 / 3.0, 0.25, 0.25, 0.25, 0.25, 0.25);
+
+float Basis(int i, vec3 d)
+{
+	switch (i)
+	{
+	case 0: return 0.282095;
+	case 1: return 0.488603 * d.y;
+	case 2: return 0.488603 * d.z;
+	case 3: return 0.488603 * d.x;
+	case 4: return 1.092548 * d.x * d.y;
+	case 5: return 1.092548 * d.y * d.z;
+	case 6: return 0.315392 * (3.0 * d.z * d.z - 1.0);
+	case 7: return 1.092548 * d.x * d.z;
+	default: return 0.546274 * (d.x * d.x - d.y * d.y);
+	}
+}
+
+void main()
+{
+	int index = int(gl_FragCoord.x);
+	vec3 sum = vec3(0.0);
+	float weights = 0.0;
+	for (int face = 0; face < 6; ++face)
+	{
+		for (int y = 0; y < uSize; ++y)
+		{
+			for (int x = 0; x < uSize; ++x)
+			{
+				vec2 uv = (vec2(x, y) + 0.5) * (2.0 / float(uSize)) - 1.0;
+				float t = 1.0 + dot(uv, uv);
+				float weight = 1.0 / (t * sqrt(t));
+				vec3 d = normalize(FACE_MAIN[face] + uv.x * FACE_U[face] + uv.y * FACE_V[face]);
+				sum += textureLod(uEnvironment, d, 0.0).rgb * (Basis(index, d) * weight);
+				weights += weight;
+			}
+		}
+	}
+	oCoefficient = vec4(sum * (4.0 * PI / weights * BAND_SCALE[index]), 0.0);
+}
+)";
+	}
+
+	void SHIrradiance::Init()
+	{
+		glGenBuffers(1, &mBuffer);
+		glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+		glBufferData(GL_UNIFORM_BUFFER, SH9::COUNT * sizeof(glm::vec4), nullptr, GL_STATIC_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		glGenTextures(1, &mTexture);
+		GLState::Instance()->BindTexture(GL_TEXTURE_2D, mTexture);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, SH9::COUNT, 1, 0, GL_RGBA, GL_FLOAT, nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		glGenFramebuffers(1, &mFbo);
+		GLuint framebuffer = GLState::Instance()->GetDrawFramebuffer();
+		GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, mFbo);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture, 0);
+		GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		glGenVertexArrays(1, &mVao);
+
+		mShader.AttachShaderSource(GL_VERTEX_SHADER, sh::PROJECT_VS);
+		mShader.AttachShaderSource(GL_FRAGMENT_SHADER, sh::PROJECT_FS);
+		mShader.Link();
+	}
+
+	void SHIrradiance::Project(GLuint cubemap, GLuint size, GLint level)
+	{
+		assert(mBuffer != 0 && "Init before projecting");
+		GLuint levelSize = std::max(size >> level, 1u);
+		std::vector<GLfloat> faces[6];
+		_ReadFaces(cubemap, levelSize, level, faces);
+		mCoefficients = ProjectFaces(faces, levelSize);
+
+		glm::vec4 data[SH9::COUNT];
+		for (GLuint i = 0; i < SH9::COUNT; ++i)
+		{
+			data[i] = glm::vec4(mCoefficients.coefficients[i], 0.f);
+		}
+		glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+		glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(data), data);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	void SHIrradiance::ProjectOnGPU(GLuint cubemap, GLuint size)
+	{
+		assert(mBuffer != 0 && "Init before projecting");
+		assert(size >= PROJECTION_SIZE && (size & (size - 1)) == 0);
+
+		GLState* state = GLState::Instance();
+		GLint viewport[4];
+		state->GetViewport(viewport);
+		GLuint framebuffer	   = state->GetDrawFramebuffer();
+		GLuint program		   = state->GetProgram();
+		PipelineState pipeline = state->GetPipeline();
+		state->SetPipeline(PipelineState::Overlay());
+
+		// The mips are built in a cubemap of our own, so the caller's levels, level range and filters stay as they
+		// were: a texture clamped to one level (as IBLCache makes them) could not grow a chain in place. Level 0
+		// of it is the caller's level 0 halved by a linear blit, which is the same 2 x 2 box glGenerateMipmap uses.
+		GLuint scratchSize = std::max(size >> 1, PROJECTION_SIZE);
+		GLint  level	   = 0;
+		while ((scratchSize >> level) > PROJECTION_SIZE)
+		{
+			++level;
+		}
+		GLuint scratch;
+		glGenTextures(1, &scratch);
+		state->BindTexture(0, GL_TEXTURE_CUBE_MAP, scratch);
+		for (GLuint face = 0; face < 6; ++face)
+		{
+			glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, GL_RGB16F, scratchSize, scratchSize, 0, GL_RGB, GL_FLOAT, nullptr);
+		}
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		GLuint blit[2];
+		glGenFramebuffers(2, blit);
+		state->BindFramebuffer(GL_READ_FRAMEBUFFER, blit[0]);
+		state->BindFramebuffer(GL_DRAW_FRAMEBUFFER, blit[1]);
+		for (GLuint face = 0; face < 6; ++face)
+		{
+			glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, cubemap, 0);
+			glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, scratch, 0);
+			glBlitFramebuffer(0, 0, size, size, 0, 0, scratchSize, scratchSize, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+		}
+
+		// Only the projected level is visible while the pass runs, so lod 0 reads it
+		glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BASE_LEVEL, level);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, level);
+
+		state->BindFramebuffer(GL_FRAMEBUFFER, mFbo);
+		state->BindVertexArray(mVao);
+		state->SetViewport(0, 0, SH9::COUNT, 1);
+		mShader.Active();
+		mShader.SetValue("uEnvironment", 0);
+		mShader.SetValue("uSize", static_cast<int>(PROJECTION_SIZE));
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+
+		// The 9 RGBA32F texels are the std140 vec4 array, byte for byte
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, mBuffer);
+		glReadPixels(0, 0, SH9::COUNT, 1, GL_RGBA, GL_FLOAT, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		state->BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		state->SetViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+		state->UseProgram(program);
+		state->SetPipeline(pipeline);
+
+		// Unbound through GLState first, so its shadow does not keep the deleted names
+		state->BindTexture(0, GL_TEXTURE_CUBE_MAP, 0);
+		glDeleteTextures(1, &scratch);
+		glDeleteFramebuffers(2, blit);
+	}
+
+	SH9 SHIrradiance::Read() const
+	{
+		std::vector<glm::vec4> data(SH9::COUNT, glm::vec4(0.f));
+		glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+		glGetBufferSubData(GL_UNIFORM_BUFFER, 0, SH9::COUNT * sizeof(glm::vec4), data.data());
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		SH9 result;
+		for (GLuint i = 0; i < SH9::COUNT; ++i)
+		{
+			result.coefficients[i] = glm::vec3(data[i]);
+		}
+		return result;
+	}
+
+	void SHIrradiance::AttachUniformBlock(const Shader& shader) const
+	{
+		GLuint block = glGetUniformBlockIndex(shader.program(), "SHBlock");
+		if (block != GL_INVALID_INDEX)
+		{
+			glUniformBlockBinding(shader.program(), block, BLOCK_BINDING);
+		}
+	}
+
+	inline void SHIrradiance::BindUniformBlock() const
+	{
+		glBindBufferBase(GL_UNIFORM_BUFFER, BLOCK_BINDING, mBuffer);
+	}
+
+	void SHIrradiance::_ReadFaces(GLuint cubemap, GLuint size, GLint level, std::vector<GLfloat> (&faces)[6])
+	{
+		GLState::Instance()->BindTexture(GL_TEXTURE_CUBE_MAP, cubemap);
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		for (GLuint face = 0; face < 6; ++face)
+		{
+			faces[face].resize(size * size * 3);
+			glGetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, GL_RGB, GL_FLOAT, faces[face].data());
+		}
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	}
+
+	inline glm::vec3 SHIrradiance::_FaceDirection(GLuint face, GLfloat u, GLfloat v)
+	{
+		return glm::normalize(sh::FACE_MAIN[face] + u * sh::FACE_U[face] + v * sh::FACE_V[face]);
+	}
+
+	SH9 SHIrradiance::ProjectFaces(const std::vector<GLfloat> (&faces)[6], GLuint size)
+	{
+		// Every row of every face is a job; each chunk of rows sums into its own totals, in double so a
+		// 512 x 512 x 6 environment adds up without losing the small terms
+		double sums[SH9::COUNT][3] = {};
+		double weights = 0.0;
+		std::mutex mutex;
+
+		const GLfloat scale = 2.f / size;
+		ThreadPool::Instance()->ParallelFor(0, 6 * size, 8, [&](size_t begin, size_t end)
+		{
+			double chunkSums[SH9::COUNT][3] = {};
+			double chunkWeights = 0.0;
+			for (size_t row = begin; row < end; ++row)
+			{
+				GLuint face = static_cast<GLuint>(row / size);
+				GLuint y	= static_cast<GLuint>(row % size);
+				GLfloat v	= (y + 0.5f) * scale - 1.f;
+				const GLfloat* texels = faces[face].data() + y * size * 3;
+				const glm::vec3 origin = sh::FACE_MAIN[face] + v * sh::FACE_V[face];
+				const glm::vec3& axis  = sh::FACE_U[face];
+
+				GLuint x = 0;
+#ifdef GL_SH_SSE
+				// Four texels of the row at a time, in SoA form
+				__m128 rowSums[SH9::COUNT][3];
+				for (GLuint i = 0; i < SH9::COUNT; ++i)
+				{
+					rowSums[i][0] = rowSums[i][1] = rowSums[i][2] = _mm_setzero_ps();
+				}
+				__m128 rowWeights = _mm_setzero_ps();
+				const __m128 one  = _mm_set1_ps(1.f);
+				const __m128 vv	  = _mm_set1_ps(1.f + v * v);
+				for (; x + 4 <= size; x += 4)
+				{
+					__m128 u = _mm_sub_ps(_mm_mul_ps(_mm_setr_ps(x + 0.5f, x + 1.5f, x + 2.5f, x + 3.5f), _mm_set1_ps(scale)), one);
+					__m128 t = _mm_add_ps(vv, _mm_mul_ps(u, u));
+					__m128 inv = _mm_div_ps(one, _mm_sqrt_ps(t));
+					__m128 weight = _mm_mul_ps(inv, _mm_mul_ps(inv, inv));
+					__m128 dx = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(origin.x), _mm_mul_ps(_mm_set1_ps(axis.x), u)), inv);
+					__m128 dy = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(origin.y), _mm_mul_ps(_mm_set1_ps(axis.y), u)), inv);
+					__m128 dz = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(origin.z), _mm_mul_ps(_mm_set1_ps(axis.z), u)), inv);
+
+					__m128 basis[SH9::COUNT];
+					basis[0] = _mm_set1_ps(0.282095f);
+					basis[1] = _mm_mul_ps(_mm_set1_ps(0.488603f), dy);
+					basis[2] = _mm_mul_ps(_mm_set1_ps(0.488603f), dz);
+					basis[3] = _mm_mul_ps(_mm_set1_ps(0.488603f), dx);
+					basis[4] = _mm_mul_ps(_mm_set1_ps(1.092548f), _mm_mul_ps(dx, dy));
+					basis[5] = _mm_mul_ps(_mm_set1_ps(1.092548f), _mm_mul_ps(dy, dz));
+					basis[6] = _mm_mul_ps(_mm_set1_ps(0.315392f), _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(3.f), _mm_mul_ps(dz, dz)), one));
+					basis[7] = _mm_mul_ps(_mm_set1_ps(1.092548f), _mm_mul_ps(dx, dz));
+					basis[8] = _mm_mul_ps(_mm_set1_ps(0.546274f), _mm_sub_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+
+					const GLfloat* p = texels + x * 3;
+					__m128 rgb[3] = {
+						_mm_mul_ps(_mm_setr_ps(p[0], p[3], p[6], p[9]), weight),
+						_mm_mul_ps(_mm_setr_ps(p[1], p[4], p[7], p[10]), weight),
+						_mm_mul_ps(_mm_setr_ps(p[2], p[5], p[8], p[11]), weight)
+					};
+					for (GLuint i = 0; i < SH9::COUNT; ++i)
+					{
+						for (GLuint c = 0; c < 3; ++c)
+						{
+							rowSums[i][c] = _mm_add_ps(rowSums[i][c], _mm_mul_ps(rgb[c], basis[i]));
+						}
+					}
+					rowWeights = _mm_add_ps(rowWeights, weight);
+				}
+
+				GLfloat lanes[4];
+				for (GLuint i = 0; i < SH9::COUNT; ++i)
+				{
+					for (GLuint c = 0; c < 3; ++c)
+					{
+						_mm_storeu_ps(lanes, rowSums[i][c]);
+						chunkSums[i][c] += double(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+					}
+				}
+				_mm_storeu_ps(lanes, rowWeights);
+				chunkWeights += double(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+#endif
+				for (; x < size; ++x)
+				{
+					GLfloat u = (x + 0.5f) * scale - 1.f;
+					GLfloat t = 1.f + u * u + v * v;
+					GLfloat weight = 1.f / (t * std::sqrt(t));
+					GLfloat basis[SH9::COUNT];
+					SH9::Basis(glm::normalize(origin + u * axis), basis);
+
+					const GLfloat* p = texels + x * 3;
+					for (GLuint i = 0; i < SH9::COUNT; ++i)
+					{
+						for (GLuint c = 0; c < 3; ++c)
+						{
+							chunkSums[i][c] += double(p[c]) * basis[i] * weight;
+						}
+					}
+					chunkWeights += weight;
+				}
+			}
+
+			std::lock_guard<std::mutex> lock(mutex);
+			for (GLuint i = 0; i < SH9::COUNT; ++i)
+			{
+				for (GLuint c = 0; c < 3; ++c)
+				{
+					sums[i][c] += chunkSums[i][c];
+				}
+			}
+			weights += chunkWeights;
+		});
+
+		// The weights are each texel's solid angle up to a constant; normalising them to the sphere's 4 PI
+		// cancels the constant and the error of the discrete faces
+		SH9 result;
+		const double normalisation = 4.0 * 3.14159265358979 / weights;
+		for (GLuint i = 0; i < SH9::COUNT; ++i)
+		{
+			for (GLuint c = 0; c < 3; ++c)
+			{
+				result.coefficients[i][c] = static_cast<GLfloat>(sums[i][c] * normalisation * sh::BAND_SCALE[i]);
+			}
+		}
+		return result;
+	}
+
+	void SHIrradiance::Compare(const SH9& sh, GLuint irradianceMap, GLuint size, GLfloat& meanError, GLfloat& maxError)
+	{
+		std::vector<GLfloat> faces[6];
+		_ReadFaces(irradianceMap, size, 0, faces);
+
+		double total = 0.0;
+		maxError = 0.f;
+		for (GLuint face = 0; face < 6; ++face)
+		{
+			for (GLuint y = 0; y < size; ++y)
+			{
+				for (GLuint x = 0; x < size; ++x)
+				{
+					const GLfloat* p = faces[face].data() + (y * size + x) * 3;
+					glm::vec3 expected(p[0], p[1], p[2]);
+					glm::vec3 actual = sh.Evaluate(_FaceDirection(face, (x + 0.5f) * 2.f / size - 1.f, (y + 0.5f) * 2.f / size - 1.f));
+					GLfloat error = glm::length(actual - expected) / std::max(glm::length(expected), 1e-4f);
+					total += error;
+					maxError = std::max(maxError, error);
+				}
+			}
+		}
+		meanError = static_cast<GLfloat>(total / (6.0 * size * size));
+	}
+}
\ No newline at end of file
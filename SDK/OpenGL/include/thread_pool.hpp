@@ -0,0 +1,174 @@
+#pragma once
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <algorithm>
+#include <chrono>
+
+namespace gl
+{
+	// Fixed set of worker threads for CPU-side jobs (asset import, culling, transform updates...).
+	// Workers never touch GL; anything that needs the context stays on the render thread.
+	class ThreadPool
+	{
+	public:
+		explicit ThreadPool(unsigned int threadCount = std::max(1u, std::thread::hardware_concurrency()));
+		virtual ~ThreadPool();
+
+		static ThreadPool* Instance()
+		{
+			if (!mInstance)
+			{
+				mInstance = new ThreadPool();
+			}
+			return mInstance;
+		}
+
+		template <typename Func>
+		std::future<void> Submit(Func&& func);
+
+		// Splits [begin, end) into contiguous chunks of at least minChunk items and blocks until all are done.
+		// func(chunkBegin, chunkEnd) runs on the workers and on the calling thread. The caller runs queued
+		// tasks while it waits, so ParallelFor may be nested inside pool tasks.
+		template <typename Func>
+		void ParallelFor(size_t begin, size_t end, size_t minChunk, Func&& func);
+
+		unsigned int GetThreadCount() const { return static_cast<unsigned int>(mWorkers.size()); }
+
+		// Blocks on the future, running queued tasks meanwhile instead of idling
+		void Wait(std::future<void>& future);
+
+	private:
+		void _WorkerLoop();
+		bool _RunPendingTask();
+
+		std::vector<std::thread>			mWorkers;
+		std::queue<std::function<void()>>	mTasks;
+		std::mutex							mMutex;
+		std::condition_variable				mCondition;
+		bool								mStop;
+
+		static ThreadPool* mInstance;
+	};
+
+	ThreadPool* ThreadPool::mInstance = nullptr;
+
+	ThreadPool::ThreadPool(unsigned int threadCount) : mStop(false)
+	{
+		for (unsigned int i = 0; i < threadCount; ++i)
+		{
+			mWorkers.emplace_back(&ThreadPool::_WorkerLoop, this);
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStop = true;
+		}
+		mCondition.notify_all();
+		for (auto& worker : mWorkers)
+		{
+			worker.join();
+		}
+	}
+
+	template <typename Func>
+	std::future<void> ThreadPool::Submit(Func&& func)
+	{
+		auto task = std::make_shared<std::packaged_task<void()>>(std::forward<Func>(func));
+		auto future = task->get_future();
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mTasks.emplace([task]() { (*task)(); });
+		}
+		mCondition.notify_one();
+		return future;
+	}
+
+	template <typename Func>
+	void ThreadPool::ParallelFor(size_t begin, size_t end, size_t minChunk, Func&& func)
+	{
+		if (end <= begin)
+		{
+			return;
+		}
+
+		size_t count	 = end - begin;
+		size_t maxChunks = static_cast<size_t>(GetThreadCount()) + 1;
+		size_t chunk	 = std::max(std::max<size_t>(minChunk, 1), (count + maxChunks - 1) / maxChunks);
+		if (chunk >= count)
+		{
+			func(begin, end);
+			return;
+		}
+
+		std::vector<std::future<void>> futures;
+		size_t chunkBegin = begin + chunk;
+		for (; chunkBegin < end; chunkBegin += chunk)
+		{
+			size_t chunkEnd = std::min(chunkBegin + chunk, end);
+			futures.push_back(Submit([&func, chunkBegin, chunkEnd]() { func(chunkBegin, chunkEnd); }));
+		}
+		// The caller takes the first chunk instead of idling
+		func(begin, begin + chunk);
+
+		for (auto& future : futures)
+		{
+			Wait(future);
+		}
+	}
+
+	void ThreadPool::Wait(std::future<void>& future)
+	{
+		while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		{
+			if (!_RunPendingTask())
+			{
+				std::this_thread::yield();
+			}
+		}
+		future.get();
+	}
+
+	bool ThreadPool::_RunPendingTask()
+	{
+		std::function<void()> task;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (mTasks.empty())
+			{
+				return false;
+			}
+			task = std::move(mTasks.front());
+			mTasks.pop();
+		}
+		task();
+		return true;
+	}
+
+	void ThreadPool::_WorkerLoop()
+	{
+		for (;;)
+		{
+			std::function<void()> task;
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mCondition.wait(lock, [this]() { return mStop || !mTasks.empty(); });
+				if (mStop && mTasks.empty())
+				{
+					return;
+				}
+				task = std::move(mTasks.front());
+				mTasks.pop();
+			}
+			task();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+#include <glm/glm.hpp>
+#include "thread_pool.hpp"
+
+namespace gl
+{
+	// Node hierarchy stored as flat arrays (parent, local, world, dirty). Nodes are added parent first and keep the
+	// handle Add returned, while the arrays themselves are kept sorted by depth so every level is one contiguous run.
+	//
+	// SetLocal just flags the node; Update walks the levels in order, splitting each across the thread pool, and
+	// recomputes world matrices only for flagged nodes and their descendants.
+	class TransformStore
+	{
+	public:
+		static const unsigned int NO_PARENT = 0xFFFFFFFFu;
+
+		TransformStore() : mLevelsValid(true), mDirtyCount(0) {}
+
+		void Reserve(size_t count);
+		unsigned int Add(const glm::mat4& local, unsigned int parent = NO_PARENT);
+
+		void SetLocal(unsigned int node, const glm::mat4& local);
+
+		// Brings every world matrix up to date; returns immediately when nothing changed
+		void Update();
+
+		const glm::mat4& GetLocal(unsigned int node)  const { return mLocals[mSlots[node]]; }
+		const glm::mat4& GetWorld(unsigned int node)  const { return mWorlds[mSlots[node]]; }
+		// NO_PARENT for a root
+		unsigned int GetParent(unsigned int node) const
+		{
+			unsigned int parentSlot = mParents[mSlots[node]];
+			return parentSlot == NO_PARENT ? NO_PARENT : mNodes[parentSlot];
+		}
+
+		bool   IsDirty() const { return mDirtyCount > 0; }
+		size_t size()	 const { return mSlots.size(); }
+
+	private:
+		// Levels with fewer nodes than this are updated on the calling thread
+		static const size_t PARALLEL_CHUNK = 2048;
+
+		void _BuildLevels();
+		void _UpdateRange(size_t begin, size_t end);
+
+		template <typename T>
+		static void _Permute(std::vector<T>& values, const std::vector<unsigned int>& order);
+
+		// handle -> slot and slot -> handle
+		std::vector<unsigned int>	mSlots;
+		std::vector<unsigned int>	mNodes;
+
+		// per slot; mParents holds the parent's slot
+		std::vector<unsigned int>	mParents;
+		std::vector<unsigned int>	mDepths;
+		std::vector<glm::mat4>		mLocals;
+		std::vector<glm::mat4>		mWorlds;
+		std::vector<unsigned char>	mDirty;
+
+		// level d occupies slots [mLevelStarts[d], mLevelStarts[d + 1]) once the levels are built
+		std::vector<size_t>			mLevelStarts;
+		bool						mLevelsValid;
+		size_t						mDirtyCount;
+	};
+
+	inline void TransformStore::Reserve(size_t count)
+	{
+		mSlots.reserve(count);
+		mNodes.reserve(count);
+		mParents.reserve(count);
+		mDepths.reserve(count);
+		mLocals.reserve(count);
+		mWorlds.reserve(count);
+		mDirty.reserve(count);
+	}
+
+	unsigned int TransformStore::Add(const glm::mat4& local, unsigned int parent)
+	{
+		assert((parent == NO_PARENT || parent < size()) && "Parents must be added before their children");
+
+		// New nodes go at the end; the next Update moves them into their level
+		unsigned int node = static_cast<unsigned int>(size());
+		unsigned int parentSlot = parent == NO_PARENT ? NO_PARENT : mSlots[parent];
+		mSlots.push_back(node);
+		mNodes.push_back(node);
+		mParents.push_back(parentSlot);
+		mDepths.push_back(parent == NO_PARENT ? 0 : mDepths[parentSlot] + 1);
+		mLocals.push_back(local);
+		mWorlds.push_back(local);
+		mDirty.push_back(1);
+
+		++mDirtyCount;
+		mLevelsValid = false;
+		return node;
+	}
+
+	inline void TransformStore::SetLocal(unsigned int node, const glm::mat4& local)
+	{
+		unsigned int slot = mSlots[node];
+		mLocals[slot] = local;
+		if (!mDirty[slot])
+		{
+			mDirty[slot] = 1;
+			++mDirtyCount;
+		}
+	}
+
+	void TransformStore::Update()
+	{
+		if (!mDirtyCount)
+		{
+			return;
+		}
+		if (!mLevelsValid)
+		{
+			_BuildLevels();
+		}
+
+		// Every parent sits in an earlier level, so a level only reads results that are already final
+		for (size_t level = 0; level + 1 < mLevelStarts.size(); ++level)
+		{
+			ThreadPool::Instance()->ParallelFor(mLevelStarts[level], mLevelStarts[level + 1], PARALLEL_CHUNK, [this](size_t begin, size_t end)
+			{
+				_UpdateRange(begin, end);
+			});
+		}
+
+		std::memset(mDirty.data(), 0, mDirty.size());
+		mDirtyCount = 0;
+	}
+
+	void TransformStore::_UpdateRange(size_t begin, size_t end)
+	{
+		for (size_t slot = begin; slot < end; ++slot)
+		{
+			unsigned int parent = mParents[slot];
+			if (parent == NO_PARENT)
+			{
+				if (mDirty[slot])
+				{
+					mWorlds[slot] = mLocals[slot];
+				}
+				continue;
+			}
+			// A changed parent drags its whole subtree along, one level at a time
+			if (mDirty[parent])
+			{
+				mDirty[slot] = 1;
+			}
+			if (mDirty[slot])
+			{
+				mWorlds[slot] = mWorlds[parent] * mLocals[slot];
+			}
+		}
+	}
+
+	void TransformStore::_BuildLevels()
+	{
+		// Stable counting sort of the slots by depth, then every array is moved into that order
+		unsigned int maxDepth = 0;
+		for (auto depth : mDepths)
+		{
+			maxDepth = std::max(maxDepth, depth);
+		}
+
+		mLevelStarts.assign(maxDepth + 2, 0);
+		for (auto depth : mDepths)
+		{
+			++mLevelStarts[depth + 1];
+		}
+		for (size_t level = 1; level < mLevelStarts.size(); ++level)
+		{
+			mLevelStarts[level] += mLevelStarts[level - 1];
+		}
+
+		std::vector<size_t> cursor(mLevelStarts.begin(), mLevelStarts.end() - 1);
+		std::vector<unsigned int> order(size());		// new slot -> old slot
+		std::vector<unsigned int> remap(size());		// old slot -> new slot
+		for (unsigned int slot = 0; slot < size(); ++slot)
+		{
+			unsigned int target = static_cast<unsigned int>(cursor[mDepths[slot]]++);
+			order[target] = slot;
+			remap[slot]	  = target;
+		}
+
+		for (auto& parent : mParents)
+		{
+			if (parent != NO_PARENT)
+			{
+				parent = remap[parent];
+			}
+		}
+		_Permute(mParents, order);
+		_Permute(mDepths, order);
+		_Permute(mLocals, order);
+		_Permute(mWorlds, order);
+		_Permute(mDirty, order);
+		_Permute(mNodes, order);
+		for (unsigned int slot = 0; slot < size(); ++slot)
+		{
+			mSlots[mNodes[slot]] = slot;
+		}
+		mLevelsValid = true;
+	}
+
+	template <typename T>
+	void TransformStore::_Permute(std::vector<T>& values, const std::vector<unsigned int>& order)
+	{
+		std::vector<T> sorted(values.size());
+		for (size_t i = 0; i < order.size(); ++i)
+		{
+			sorted[i] = values[order[i]];
+		}
+		values.swap(sorted);
+	}
+}
\ No newline at end of file
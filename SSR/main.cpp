@@ -3,7 +3,9 @@
 #include "model.hpp"
 #include "common.hpp"
 #include "controller.hpp"
+#include "hiz.hpp"
 #include "common_mesh.hpp"
+#include "light_buffer.hpp"
 #include <vector>
 #include <random>
 
@@ -14,61 +16,58 @@ namespace gl
 {
 	// TODO ŻܹǰȾӳȾܹ
 	GLuint gBuffer = 0;
-	GLuint gPos, gNormal, gAlbedoSpec;
+	GLuint gNormal, gAlbedoSpec, gDepth;
+	// Hi-Z pyramid of the G-Buffer depth, for the reflection ray march
+	GLuint gHiZ = 0;
 
 	class GeometryPass : public RenderPass
 	{
 	public:
-		GeometryPass() : mShader(), mModel("../Resource/Model/Nanosuit/nanosuit.obj")
+		GeometryPass() : mShader(), mModel("../Resource/Model/Nanosuit/nanosuit.obj", false)
 		{
 
 		}
 
-		virtual void Init() override
+		virtual void Init(const SContext& context) override
 		{
-			glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
-			glEnable(GL_DEPTH_TEST);
+			GLState::Instance()->SetViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
+			GLState::Instance()->SetPipeline(PipelineState::Opaque());
 
-			// G-Buffer, 3 texture:
-			// 1. Position (RGB, 16F)
-			// 2. Normals (RGB, 16F)
-			// 3. Color (RGB) + Specular(A)
+			// G-Buffer, 2 textures and depth, 12 bytes a pixel:
+			// 1. Normals, octahedral (RG, 16 unorm)
+			// 2. Color (RGB) + Specular(A)
+			// 3. Depth, from which the lighting pass reconstructs position
 			glGenFramebuffers(1, &gBuffer);
-			glBindFramebuffer(GL_FRAMEBUFFER, gBuffer);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, gBuffer);
 			{
-				// Position Buffer
-				glGenTextures(1, &gPos);
-				glBindTexture(GL_TEXTURE_2D, gPos);
-				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGB, GL_FLOAT, NULL);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, gPos, 0);
 				// Normal Buffer
 				glGenTextures(1, &gNormal);
-				glBindTexture(GL_TEXTURE_2D, gNormal);
-				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGB, GL_FLOAT, NULL);
+				GLState::Instance()->BindTexture(GL_TEXTURE_2D, gNormal);
+				glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16, SCR_WIDTH, SCR_HEIGHT, 0, GL_RG, GL_UNSIGNED_SHORT, NULL);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, gNormal, 0);
+				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, gNormal, 0);
 				// Color & Specular color buffer
 				glGenTextures(1, &gAlbedoSpec);
-				glBindTexture(GL_TEXTURE_2D, gAlbedoSpec);
+				GLState::Instance()->BindTexture(GL_TEXTURE_2D, gAlbedoSpec);
 				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT2, GL_TEXTURE_2D, gAlbedoSpec, 0);
+				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, gAlbedoSpec, 0);
 
 				// Tell OpenGL which color attachments we'll use (of this framebuffer) for rendering
-				GLuint attachments[3] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2 };
-				glDrawBuffers(3, attachments);
-
-				// Depth buffer?
-				GLuint rboDepth;
-				glGenRenderbuffers(1, &rboDepth);
-				glBindRenderbuffer(GL_RENDERBUFFER, rboDepth);
-				glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, SCR_WIDTH, SCR_HEIGHT);
-				glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rboDepth);
+				GLuint attachments[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+				glDrawBuffers(2, attachments);
+
+				// Depth buffer, a texture so the Hi-Z pyramid and the lighting pass can sample it. 24 bits like the
+				// default framebuffer, which the lighting pass blits it into.
+				glGenTextures(1, &gDepth);
+				GLState::Instance()->BindTexture(GL_TEXTURE_2D, gDepth);
+				glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, SCR_WIDTH, SCR_HEIGHT, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, gDepth, 0);
 
 				// Check the framebuffer status
 				if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
@@ -76,7 +75,7 @@ namespace gl
 					throw std::exception("Framebuffer not complete!");
 				}
 			}
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 
 			// Init shader
 			mShader.AttachShader(GL_VERTEX_SHADER, "Shaders/g_buffer.vs.glsl");
@@ -94,15 +93,32 @@ namespace gl
 			mModelPositions.push_back(glm::vec3(0.0, -3.0, 3.0));
 			mModelPositions.push_back(glm::vec3(3.0, -3.0, 3.0));
 
+			// Instances never move, so the culler gets them once and tests them on the GPU every frame
+			std::vector<InstanceData> instances;
+			for (auto& pos : mModelPositions)
+			{
+				instances.push_back(InstanceData(glm::scale(glm::translate(glm::mat4(1.0f), pos), glm::vec3(0.25f))));
+			}
+			mCuller.Init(mModel.indirect_commands(), static_cast<GLuint>(instances.size()));
+			mCuller.SetInstances(instances, mModel.bounding_sphere());
+			mPyramid.Init(SCR_WIDTH, SCR_HEIGHT);
+			gHiZ = mPyramid.GetTexture();
+
+			glm::mat4 floorModel = glm::mat4(1.0f);
+			floorModel = glm::translate(floorModel, glm::vec3(0.f, -3.f, 0.f));
+			floorModel = glm::scale(floorModel, glm::vec3(10.f));
+			InstanceData floor(floorModel);
+			mFloorInstance.Upload(&floor, 1);
+
 			Controller::Instance()->ResetCamera(glm::vec3(0.f, 0.f, 5.f), glm::vec3(0.0f, 1.0f, 0.0f));
 		}
 
-		virtual void Update() override
+		virtual void Update(const SContext& context, const STime& time) override
 		{
 			auto& camera = Controller::Instance()->GetCamera();
 
 			// Geometry Pass: render scene's geometry/color data into gbuffer
-			glBindFramebuffer(GL_FRAMEBUFFER, gBuffer);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, gBuffer);
 			{
 				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -112,40 +128,42 @@ namespace gl
 				mShader.SetMatrix("view", &view[0][0]);
 				mShader.SetMatrix("projection", &projection[0][0]);
 
-				for (auto& pos : mModelPositions)
-				{
-					glm::mat4 model = glm::mat4(1.0f);
-					model = glm::translate(model, pos);
-					model = glm::scale(model, glm::vec3(0.25f));
-					mShader.SetMatrix("model", &model[0][0]);
+				// What last frame's pyramid doesn't hide is drawn first; the pyramid rebuilt from that depth then
+				// decides on the rest. Instance counts stay on the GPU, so each phase is one indirect call per mesh.
+				mCuller.SetFrustum(projection, view);
+				mCuller.Cull(CULL_PHASE_FIRST, mPyramid);
+				mModel.DrawIndirect(mShader, mCuller.GetInstances(CULL_PHASE_FIRST), mCuller.GetCommands(CULL_PHASE_FIRST));
 
-					mModel.Draw(mShader);
-				}
-				mModel.Draw(mShader);
+				// The floor has no node hierarchy; reset the node matrix the model left behind. It goes before the
+				// pyramid so it occludes too.
+				mShader.SetMatrix("model", glm::mat4(1.0f));
+				mFloor.DrawInstanced(mFloorInstance);
 
-				glm::mat4 model = glm::mat4(1.0f);
-				model = glm::translate(model, glm::vec3(0.f, -3.f, 0.f));
-				model = glm::scale(model, glm::vec3(10.f));
-				mShader.SetMatrix("model", &model[0][0]);
-				mFloor.Draw();
+				mPyramid.Build(gDepth, projection * view);
+				mCuller.Cull(CULL_PHASE_SECOND, mPyramid);
+				mModel.DrawIndirect(mShader, mCuller.GetInstances(CULL_PHASE_SECOND), mCuller.GetCommands(CULL_PHASE_SECOND));
 			}
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 		}
 
 	private:
 		Model		mModel;
 		Shader		mShader;
-		PlaneMesh	mFloor;
+		PlaneMesh		mFloor;
+		InstanceBuffer	mFloorInstance;
 		std::vector<glm::vec3> mModelPositions;
+
+		HiZCuller	mCuller;
+		HiZPyramid	mPyramid;
 	};
 
 	class DeferredLightingPass : public RenderPass
 	{
 	public:
-		virtual void Init() override
+		virtual void Init(const SContext& context) override
 		{
 			glGenVertexArrays(1, &mQuadVao);
-			glBindVertexArray(mQuadVao);
+			GLState::Instance()->BindVertexArray(mQuadVao);
 			{
 				GLfloat quadVertices[] = {
 					// Positions        // Texture Coords
@@ -164,7 +182,7 @@ namespace gl
 				glEnableVertexAttribArray(1);
 				glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
 			}
-			glBindVertexArray(0);
+			GLState::Instance()->BindVertexArray(0);
 
 			// Init shader
 			mShader.AttachShader(GL_VERTEX_SHADER, "Shaders/deferred_shading.vs.glsl");
@@ -173,16 +191,18 @@ namespace gl
 
 			// Set samplers
 			mShader.Active();
-			mShader.SetValue("gPosition", 0);
+			mShader.SetValue("gDepth", 0);
 			mShader.SetValue("gNormal", 1);
 			mShader.SetValue("gAlbedoSpec", 2);
 
-			// Init Light
+			// Init Light. The constant attenuation is always 1.0 and never sent to the shader
 			constexpr GLuint NUM_LIGHTS = 32;
-			Lights.resize(NUM_LIGHTS);
+			const GLfloat linear = 0.7;
+			const GLfloat quadratic = 1.8;
+			mLights.Resize(NUM_LIGHTS);
 
 			srand(13);
-			for (auto& light : Lights)
+			for (GLuint i = 0; i < NUM_LIGHTS; ++i)
 			{
 				// Cal slightly ramdom offsets
 				GLfloat x = ((rand() % 100) / 100.0) * 6.0 - 3.0;
@@ -191,53 +211,46 @@ namespace gl
 				GLfloat r = ((rand() % 100) / 200.0) + 0.5;
 				GLfloat g = ((rand() % 100) / 200.0) + 0.5;
 				GLfloat b = ((rand() % 100) / 200.0) + 0.5;
-				light = std::make_pair<glm::vec3, glm::vec3>(glm::vec3(x, y, z), glm::vec3(r, g, b));
+				mLights.Set(i, PointLight(glm::vec3(x, y, z), glm::vec3(r, g, b), linear, quadratic));
 			}
+			mLights.AttachUniformBlock(mShader);
 		}
 
-		virtual void Update() override
+		virtual void Update(const SContext& context, const STime& time) override
 		{
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 			auto& camera = Controller::Instance()->GetCamera();
 
+			// Positions come back from depth through the inverse of the geometry pass's view-projection
+			glm::mat4 view = camera.GetViewMatrix();
+			glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
+
 			mShader.Active();
 			mShader.SetValue("viewPos", camera.Position);
-			glActiveTexture(GL_TEXTURE0);
-			glBindTexture(GL_TEXTURE_2D, gPos);
-			glActiveTexture(GL_TEXTURE1);
-			glBindTexture(GL_TEXTURE_2D, gNormal);
-			glActiveTexture(GL_TEXTURE2);
-			glBindTexture(GL_TEXTURE_2D, gAlbedoSpec);
-
-			// Set lights
-			for (GLuint i = 0; i < Lights.size(); ++i)
-			{
-				mShader.SetValue(("lights[" + std::to_string(i) + "].Position").c_str(), Lights[i].first);
-				mShader.SetValue(("lights[" + std::to_string(i) + "].Color").c_str(), Lights[i].second);
-
-				const GLfloat constant = 1.0; // Note that we don't send this to the shader, we assume it is always 1.0 (in our case)
-				const GLfloat linear = 0.7;
-				const GLfloat quadratic = 1.8;
-				mShader.SetValue(("lights[" + std::to_string(i) + "].Linear").c_str(), linear);
-				mShader.SetValue(("lights[" + std::to_string(i) + "].Quadratic").c_str(), quadratic);
-			}
+			mShader.SetMatrix("uInvViewProjection", glm::inverse(projection * view));
+			GLState::Instance()->BindTexture(0, GL_TEXTURE_2D, gDepth);
+			GLState::Instance()->BindTexture(1, GL_TEXTURE_2D, gNormal);
+			GLState::Instance()->BindTexture(2, GL_TEXTURE_2D, gAlbedoSpec);
+
+			// Lights live in a uniform block; only the ones that changed are uploaded
+			mLights.Upload();
+			mLights.BindUniformBlock();
 
-			glBindVertexArray(mQuadVao);
+			GLState::Instance()->BindVertexArray(mQuadVao);
 			glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-			glBindVertexArray(0);
 
-			glBindFramebuffer(GL_READ_FRAMEBUFFER, gBuffer);
-			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0); // Write to default framebuffer
+			GLState::Instance()->BindFramebuffer(GL_READ_FRAMEBUFFER, gBuffer);
+			GLState::Instance()->BindFramebuffer(GL_DRAW_FRAMEBUFFER, 0); // Write to default framebuffer
 			glBlitFramebuffer(0, 0, SCR_WIDTH, SCR_HEIGHT, 0, 0, SCR_WIDTH, SCR_HEIGHT, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLState::Instance()->BindFramebuffer(GL_FRAMEBUFFER, 0);
 		}
 
 	private:
 		GLuint mQuadVao;
 		Shader mShader;
 
-		std::vector<std::pair<glm::vec3, glm::vec3>> Lights;
+		LightBuffer mLights;
 	};
 }
 
@@ -245,7 +258,7 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
 	// make sure the viewport matches the new window dimensions; note that width and 
 	// height will be significantly larger than specified on retina displays.
-	glViewport(0, 0, width, height);
+	gl::GLState::Instance()->SetViewport(0, 0, width, height);
 }
 
 void mouse_callback(GLFWwindow* window, double xpos, double ypos)
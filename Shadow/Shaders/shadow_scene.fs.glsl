@@ -0,0 +1,93 @@
+#version 400 core
+in vec3 fragPos;
+in vec3 normal;
+
+out vec4 FragColor;
+
+uniform vec3 uColor;
+uniform vec3 viewPos;
+uniform vec3 uSunDirection;
+uniform vec3 uSunColor;
+
+// gl::CascadedShadowMap
+uniform sampler2DArrayShadow uCascadeShadowMap;
+uniform mat4 uCascadeMatrices[4];
+uniform vec4 uCascadeTexelSize;
+uniform int uCascadeCount;
+
+// gl::PointShadowAtlas, one cube per lamp
+uniform samplerCubeArrayShadow uPointShadowAtlas;
+uniform float uPointShadowNear;
+uniform float uPointShadowFar[16];
+uniform int uPointShadowCount;
+
+// Lamps as gl::LightBuffer uploads them
+struct Light {
+    vec4 PositionLinear;    // xyz position, w linear attenuation
+    vec4 ColorQuadratic;    // rgb color, w quadratic attenuation
+};
+layout (std140) uniform LightBlock
+{
+    Light lights[256];
+};
+uniform int uLightCount;
+
+// The sharpest cascade whose map holds the point; the point is pushed out along the normal by a texel or two
+// of that cascade, so surfaces facing away from the sun at a grazing angle do not shadow themselves
+float SunShadow(vec3 n)
+{
+    for (int i = 0; i < uCascadeCount; ++i)
+    {
+        vec4 coord = uCascadeMatrices[i] * vec4(fragPos + n * uCascadeTexelSize[i] * 1.5, 1.0);
+        if (all(greaterThan(coord.xyz, vec3(0.0))) && all(lessThan(coord.xyz, vec3(1.0))))
+        {
+            return texture(uCascadeShadowMap, vec4(coord.xy, i, coord.z));
+        }
+    }
+    return 1.0;
+}
+
+// Depth of the point in the cube face it falls on, as that face's perspective projection wrote it
+float LampShadow(int light, vec3 n)
+{
+    if (light >= uPointShadowCount)
+    {
+        return 1.0;
+    }
+    vec3 d = fragPos + n * 0.02 - lights[light].PositionLinear.xyz;
+    float z = max(abs(d.x), max(abs(d.y), abs(d.z)));
+    float zNear = uPointShadowNear;
+    float zFar = uPointShadowFar[light];
+    float depth = ((zFar + zNear) / (zFar - zNear) - 2.0 * zFar * zNear / ((zFar - zNear) * z)) * 0.5 + 0.5;
+    return texture(uPointShadowAtlas, vec4(d, light), depth);
+}
+
+void main()
+{
+    vec3 n = normalize(normal);
+    vec3 v = normalize(viewPos - fragPos);
+    vec3 lighting = uColor * 0.08;
+
+    // Sun
+    vec3 l = -uSunDirection;
+    vec3 h = normalize(l + v);
+    float diffuse = max(dot(n, l), 0.0);
+    float specular = pow(max(dot(n, h), 0.0), 32.0) * 0.25;
+    lighting += (uColor * diffuse + specular) * uSunColor * SunShadow(n);
+
+    // Lamps
+    for (int i = 0; i < uLightCount; ++i)
+    {
+        vec3 lightPos = lights[i].PositionLinear.xyz;
+        vec3 lightColor = lights[i].ColorQuadratic.rgb;
+        float distance = length(lightPos - fragPos);
+        float attenuation = 1.0 / (1.0 + lights[i].PositionLinear.w * distance + lights[i].ColorQuadratic.w * distance * distance);
+        l = (lightPos - fragPos) / distance;
+        h = normalize(l + v);
+        diffuse = max(dot(n, l), 0.0);
+        specular = pow(max(dot(n, h), 0.0), 32.0) * 0.25;
+        lighting += (uColor * diffuse + specular) * lightColor * attenuation * LampShadow(i, n);
+    }
+
+    FragColor = vec4(lighting, 1.0);
+}
\ No newline at end of file
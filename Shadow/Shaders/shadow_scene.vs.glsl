@@ -0,0 +1,17 @@
+#version 400 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+out vec3 fragPos;
+out vec3 normal;
+
+void main()
+{
+    fragPos = vec3(model * vec4(aPos, 1.0));
+    normal = mat3(transpose(inverse(model))) * aNormal;
+    gl_Position = projection * view * vec4(fragPos, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+#include "engine.hpp"
+#include "shader.hpp"
+#include "common_mesh.hpp"
+#include "controller.hpp"
+#include "bounds.hpp"
+#include "light_buffer.hpp"
+#include "shadow_maps.hpp"
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+GLuint SCR_WIDTH = 1280;
+GLuint SCR_HEIGHT = 720;
+
+// SHADOW_CACHE=0 renders the static casters into every map every frame, to compare against the cached maps
+bool SHADOW_CACHE = true;
+
+const GLfloat Z_NEAR = 0.1f;
+const GLfloat Z_FAR = 100.0f;
+// The cascades cover the view out to here; farther away nothing is in the sun's shadow
+const GLfloat SHADOW_DISTANCE = 60.0f;
+
+namespace gl
+{
+	// A floor with a ring of columns and scattered boxes that never move, and boxes and tori that do. The sun's
+	// shadows come from a CascadedShadowMap and the two lamps' from a PointShadowAtlas; both keep what the
+	// static objects cast and only draw the moving ones every frame.
+	class ShadowScene : public RenderPass
+	{
+	public:
+		ShadowScene() : mTorus(TESSELLATION_LOW) {}
+
+		virtual void Init(const SContext& context) override
+		{
+			mShader.AttachShader(GL_VERTEX_SHADER, "Shaders/shadow_scene.vs.glsl");
+			mShader.AttachShader(GL_FRAGMENT_SHADER, "Shaders/shadow_scene.fs.glsl");
+			mShader.Link();
+			mShader.Active();
+
+			// Static objects
+			_Add(mStatic, &mPlane, glm::scale(glm::mat4(1.f), glm::vec3(30.f, 1.f, 30.f)), glm::vec3(0.6f));
+			for (int i = 0; i < 12; ++i)
+			{
+				GLfloat angle = glm::radians(30.f * i);
+				glm::mat4 model = glm::translate(glm::mat4(1.f), glm::vec3(8.f * std::cos(angle), 2.f, 8.f * std::sin(angle)));
+				_Add(mStatic, &mCylinder, glm::scale(model, glm::vec3(0.4f, 2.f, 0.4f)), glm::vec3(0.8f, 0.75f, 0.7f));
+			}
+			srand(7);
+			for (int i = 0; i < 24; ++i)
+			{
+				GLfloat x = ((rand() % 100) / 100.0) * 24.0 - 12.0;
+				GLfloat z = ((rand() % 100) / 100.0) * 24.0 - 12.0;
+				GLfloat size = ((rand() % 100) / 100.0) * 1.0 + 0.5;
+				glm::mat4 model = glm::translate(glm::mat4(1.f), glm::vec3(x, size * 0.5f, z));
+				model = glm::rotate(model, glm::radians(static_cast<GLfloat>(rand() % 90)), glm::vec3(0.f, 1.f, 0.f));
+				_Add(mStatic, &mCube, glm::scale(model, glm::vec3(size)), glm::vec3(0.55f, 0.6f, 0.7f));
+			}
+
+			// Dynamic objects; _Animate places them
+			for (int i = 0; i < 4; ++i)
+			{
+				_Add(mDynamic, &mCube, glm::mat4(1.f), glm::vec3(0.9f, 0.4f, 0.3f));
+				_Add(mDynamic, &mTorus, glm::mat4(1.f), glm::vec3(0.3f, 0.8f, 0.4f));
+			}
+
+			// Lamps, lit out to where PointLight::Radius cuts them off
+			mLights.Set({
+				PointLight(glm::vec3(-4.f, 2.5f, 0.f), glm::vec3(3.0f, 2.4f, 1.8f), 0.35f, 0.44f),
+				PointLight(glm::vec3(4.f, 2.5f, 2.f), glm::vec3(1.5f, 2.0f, 3.0f), 0.35f, 0.44f),
+			});
+			mLights.AttachUniformBlock(mShader);
+
+			mSun.Init(2048);
+			mSun.SetLightDirection(glm::vec3(-0.4f, -1.f, -0.3f));
+			mLamps.Init(512, mLights.GetCount());
+			for (GLuint i = 0; i < mLights.GetCount(); ++i)
+			{
+				mLamps.SetLight(i, mLights.Get(i).position, mLights.Get(i).Radius());
+			}
+
+			Controller::Instance()->ResetCamera(glm::vec3(0.f, 4.f, 16.f), glm::vec3(0.f, 1.f, 0.f));
+		}
+
+		virtual void Update(const SContext& context, const STime& time) override
+		{
+			_Animate(time._Time.y);
+
+			auto& camera = Controller::Instance()->GetCamera();
+			glm::mat4 view = camera.GetViewMatrix();
+			GLfloat fovy = glm::radians(camera.Zoom);
+			GLfloat aspect = (float)context.width / (float)context.height;
+			glm::mat4 projection = glm::perspective(fovy, aspect, Z_NEAR, Z_FAR);
+
+			// Shadow maps first; they restore the framebuffer, viewport and pipeline
+			if (!SHADOW_CACHE)
+			{
+				mSun.InvalidateStatic();
+				mLamps.InvalidateStatic();
+			}
+			auto drawStatic = [this](const Shader& shader, const glm::mat4& viewProjection) { _DrawCasters(mStatic, shader, viewProjection); };
+			auto drawDynamic = [this](const Shader& shader, const glm::mat4& viewProjection) { _DrawCasters(mDynamic, shader, viewProjection); };
+			mSun.Update(view, fovy, aspect, Z_NEAR, SHADOW_DISTANCE, drawStatic, drawDynamic);
+			mLamps.Update(drawStatic, drawDynamic);
+
+			GLState::Instance()->SetPipeline(PipelineState::Opaque());
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+			mShader.Active();
+			mShader.SetMatrix("view", view);
+			mShader.SetMatrix("projection", projection);
+			mShader.SetValue("viewPos", camera.Position);
+			mShader.SetValue("uSunDirection", glm::normalize(glm::vec3(-0.4f, -1.f, -0.3f)));
+			mShader.SetValue("uSunColor", glm::vec3(1.f, 0.95f, 0.85f));
+			mLights.Upload();
+			mLights.BindUniformBlock();
+			mSun.Bind(mShader, 0);
+			mLamps.Bind(mShader, 1);
+
+			for (auto* objects : { &mStatic, &mDynamic })
+			{
+				for (auto& object : *objects)
+				{
+					mShader.SetMatrix("model", object.model);
+					mShader.SetValue("uColor", object.color);
+					object.mesh->Draw();
+				}
+			}
+		}
+
+	private:
+		struct Object
+		{
+			const BaseMesh* mesh;
+			glm::mat4		model;
+			AABB			bounds;		// world space
+			glm::vec3		color;
+		};
+
+		static void _Add(std::vector<Object>& objects, const BaseMesh* mesh, const glm::mat4& model, const glm::vec3& color)
+		{
+			objects.push_back({ mesh, model, mesh->GetBounds().Transform(model), color });
+		}
+
+		// Boxes circle the ring of columns, tori bob and spin between the lamps
+		void _Animate(GLfloat seconds)
+		{
+			for (size_t i = 0; i < mDynamic.size(); ++i)
+			{
+				Object&	  object = mDynamic[i];
+				GLfloat	  phase	 = seconds * 0.5f + glm::radians(90.f) * (i / 2);
+				glm::mat4 model(1.f);
+				if (i % 2 == 0)
+				{
+					model = glm::translate(model, glm::vec3(5.5f * std::cos(phase), 1.f, 5.5f * std::sin(phase)));
+					model = glm::rotate(model, seconds, glm::vec3(0.f, 1.f, 0.f));
+				}
+				else
+				{
+					model = glm::translate(model, glm::vec3(2.5f * std::cos(phase), 1.5f + 0.75f * std::sin(seconds * 2.f + phase), 2.5f * std::sin(phase)));
+					model = glm::rotate(model, seconds * 1.5f, glm::vec3(1.f, 0.f, 0.f));
+				}
+				object.model  = model;
+				object.bounds = object.mesh->GetBounds().Transform(model);
+			}
+		}
+
+		static void _DrawCasters(const std::vector<Object>& objects, const Shader& shader, const glm::mat4& viewProjection)
+		{
+			Frustum frustum;
+			frustum.Extract(viewProjection);
+			for (auto& object : objects)
+			{
+				if (frustum.Intersects(object.bounds))
+				{
+					shader.SetMatrix("model", object.model);
+					object.mesh->Draw();
+				}
+			}
+		}
+
+		Shader		 mShader;
+		PlaneMesh	 mPlane;
+		CubeMesh	 mCube;
+		CylinderMesh mCylinder;
+		TorusMesh	 mTorus;
+
+		std::vector<Object> mStatic;
+		std::vector<Object> mDynamic;
+
+		LightBuffer		  mLights;
+		CascadedShadowMap mSun;
+		PointShadowAtlas  mLamps;
+	};
+}
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+	// make sure the viewport matches the new window dimensions; note that width and
+	// height will be significantly larger than specified on retina displays.
+	gl::GLState::Instance()->SetViewport(0, 0, width, height);
+}
+
+void mouse_callback(GLFWwindow* window, double xpos, double ypos)
+{
+	gl::Controller::Instance()->MouseCallback(xpos, ypos);
+}
+
+int main()
+{
+	if (const char* cache = std::getenv("SHADOW_CACHE"))
+	{
+		SHADOW_CACHE = std::string(cache) != "0";
+	}
+
+	gl::Engine engine;
+	engine.Init(SCR_WIDTH, SCR_HEIGHT);
+	engine.SetFrameBufferSizeCallback(framebuffer_size_callback);
+	engine.SetCursorPosCallback(mouse_callback);
+
+	gl::ShadowScene scene;
+	engine.AddPass(&scene);
+	engine.Render();
+
+	return 0;
+}
\ No newline at end of file
@@ -20,7 +20,7 @@ namespace gl
 		virtual void Init() override
 		{
 			glGenVertexArrays(1, &mCubeVao);
-			glBindVertexArray(mCubeVao);
+			GLState::Instance()->BindVertexArray(mCubeVao);
 			{
 				float cubeVertices[] = {
 					// positions          // normals
@@ -76,10 +76,10 @@ namespace gl
 				glEnableVertexAttribArray(1);
 				glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
 			}
-			glBindVertexArray(0);
+			GLState::Instance()->BindVertexArray(0);
 
 			glGenVertexArrays(1, &mSkyboxVao);
-			glBindVertexArray(mSkyboxVao);
+			GLState::Instance()->BindVertexArray(mSkyboxVao);
 			{
 				float skyboxVertices[] = {
 					-1.0f,  1.0f, -1.0f,
@@ -132,7 +132,7 @@ namespace gl
 				glEnableVertexAttribArray(0);
 				glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
 			}
-			glBindVertexArray(0);
+			GLState::Instance()->BindVertexArray(0);
 
 			std::vector<std::string> faces
 			{
@@ -153,7 +153,7 @@ namespace gl
 			mCubeShader.AttachShader(GL_FRAGMENT_SHADER, "Shader/cube_fs.glsl");
 			mCubeShader.Link();
 
-			glEnable(GL_DEPTH_TEST);
+			GLState::Instance()->SetPipeline(PipelineState::Opaque());
 		}
 
 		virtual void Update() override
@@ -175,18 +175,16 @@ namespace gl
 				mCubeShader.SetMatrix("projection", &projMat[0][0]);
 				mCubeShader.SetValue("camPos", camera.Position);
 				// render
-				glBindVertexArray(mCubeVao);
+				GLState::Instance()->BindVertexArray(mCubeVao);
 				{
-					glActiveTexture(GL_TEXTURE0);
-					glBindTexture(GL_TEXTURE_CUBE_MAP, mCubemapTex);
+					GLState::Instance()->BindTexture(0, GL_TEXTURE_CUBE_MAP, mCubemapTex);
 					glDrawArrays(GL_TRIANGLES, 0, 36);
 				}
-				glBindVertexArray(0);
 			}
 
 			// skybox
 			// change depth function so depth test passes when values are equal to depth buffer's content
-			glDepthFunc(GL_LEQUAL);  
+			GLState::Instance()->SetPipeline(PipelineState::Opaque().WithDepthTest(true, GL_LEQUAL));
 			{
 				viewMat = glm::mat4(glm::mat3(camera.GetViewMatrix())); // remove translation from the view matrix
 				mShader.Active();
@@ -195,16 +193,14 @@ namespace gl
 				mShader.SetMatrix("projection", &projMat[0][0]);
 
 				// render
-				glBindVertexArray(mSkyboxVao);
+				GLState::Instance()->BindVertexArray(mSkyboxVao);
 				{
-					glActiveTexture(GL_TEXTURE0);
-					glBindTexture(GL_TEXTURE_CUBE_MAP, mCubemapTex);
+					GLState::Instance()->BindTexture(0, GL_TEXTURE_CUBE_MAP, mCubemapTex);
 					glDrawArrays(GL_TRIANGLES, 0, 36);
 				}
-				glBindVertexArray(0);
 			}
 			// set depth function back to default
-			glDepthFunc(GL_LESS);
+			GLState::Instance()->SetPipeline(PipelineState::Opaque());
 		}
 
 	private:
@@ -220,7 +216,7 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
 	// make sure the viewport matches the new window dimensions; note that width and 
 	// height will be significantly larger than specified on retina displays.
-	glViewport(0, 0, width, height);
+	gl::GLState::Instance()->SetViewport(0, 0, width, height);
 }
 
 void mouse_callback(GLFWwindow* window, double xpos, double ypos)